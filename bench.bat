@@ -0,0 +1,9 @@
+if "%1"=="host" (
+gcc -std=gnu99 -O2 -DDSP_HOST -DDSP_BENCH dsp_bench.c dsp.c -o dsp_bench.exe -lm
+dsp_bench.exe
+del dsp_bench.exe
+) else (
+xcc -O3 xio.xn dsp_bench.c dsp.c -o dsp_bench.xe
+xrun --io dsp_bench.xe
+del dsp_bench.xe
+)
@@ -0,0 +1,9 @@
+if [ "$1" = "host" ]; then
+gcc -std=gnu99 -O2 -DDSP_HOST -DDSP_BENCH dsp_bench.c dsp.c -o dsp_bench -lm
+./dsp_bench
+rm dsp_bench
+else
+xcc -O3 xio.xn dsp_bench.c dsp.c -o dsp_bench.xe
+xrun --io dsp_bench.xe
+rm dsp_bench.xe
+fi
@@ -1,7 +1,9 @@
 #include <math.h>
 #include <string.h>
+#ifndef DSP_HOST
 #include <xccompat.h>
 #include <xs1.h>
+#endif
 
 #include "xio.h"
 #include "dsp.h"
@@ -21,6 +23,32 @@ static byte _preset_data[4096];
 int _master_volume = 0, _master_preset = 0, _master_sync = 0;
 int _master_tone_coeff[8] = {FQ(1.0),0,0,0,0,0}, _master_tone_state[4] = {0,0,0,0};
 int _footswitch_short_press = 0, _footswitch_long_press = 0;
+int c99_master_output = 0;
+
+#ifndef C99_LOAD
+#define C99_LOAD 0
+#endif
+
+#if C99_LOAD
+
+// Execution time statistics for the mixer (stage 0) and DSP threads 1-5 in reference timer ticks
+// (100 MHz, one tick per instruction for a 100 MIPS thread). Updated by the mixer, read and reset
+// by the control task via property 23s0 (only in builds with C99_LOAD=1, see C99.H).
+
+unsigned _load_min[6], _load_max[6], _load_sum[6], _load_count[6], _load_overrun[6];
+unsigned _load_budget = 0;
+
+static void _load_update( int stage, unsigned ticks )
+{
+    if( ticks == 0 ) return; // Pipeline not running yet.
+    if( _load_count[stage] == 0 || ticks < _load_min[stage] ) _load_min[stage] = ticks;
+    if( ticks > _load_max[stage] ) _load_max[stage] = ticks;
+    if( ticks > _load_budget ) ++_load_overrun[stage];
+    if( _load_count[stage] == 0x100000 ) { _load_sum[stage] /= 2; _load_count[stage] /= 2; }
+    _load_sum[stage] += ticks; ++_load_count[stage];
+}
+
+#endif
 
 void xio_control( const int rcv_prop[6], int snd_prop[6], int dsp_prop[6] )
 {
@@ -82,9 +110,34 @@ void xio_control( const int rcv_prop[6], int snd_prop[6], int dsp_prop[6] )
                 parameters[ii] += diff;
             }
             c99_control( parameters, dsp_prop );
+
+            // DSP threads ramp to new coefficients themselves so only send properties that have
+            // changed since they were last sent (properties are identified by their first word).
+            // The last value of up to 64 different ID's is kept, others are always sent.
+            static int sent[64][6], count = 0;
+            if( dsp_prop[0] != 0 ) {
+                int ii = 0; while( ii < count && sent[ii][0] != dsp_prop[0] ) ++ii;
+                if( ii < count && memcmp( sent[ii], dsp_prop, 6*sizeof(int) ) == 0 ) dsp_prop[0] = 0;
+                else if( ii < 64 ) { memcpy( sent[ii], dsp_prop, 6*sizeof(int) ); if( ii == count ) ++count; }
+            }
         }
     }
 
+    #if C99_LOAD
+    // 23s0 - Read and reset load statistics for stage S (0=mixer, 1-5=DSP thread 1-5)
+    //        [1]=min, [2]=avg, [3]=max, [4]=overrun count, [5]=budget (timer ticks per sample)
+    else if( (rcv_prop[0] & 0xFF0F) == 0x2300 && ((rcv_prop[0] & 0x00F0) >> 4) <= 5 )
+    {
+        int ss = (rcv_prop[0] & 0x00F0) >> 4;
+        snd_prop[0] = rcv_prop[0];
+        snd_prop[1] = _load_min[ss];
+        snd_prop[2] = _load_count[ss] ? _load_sum[ss] / _load_count[ss] : 0;
+        snd_prop[3] = _load_max[ss];
+        snd_prop[4] = _load_overrun[ss];
+        snd_prop[5] = _load_budget;
+        _load_count[ss] = _load_max[ss] = _load_overrun[ss] = _load_sum[ss] = 0;
+    }
+    #endif
     // 20nn - Read parameter label for parameter N
     else if( (rcv_prop[0] & 0xFF00) == 0x2000 )
     {
@@ -112,6 +165,10 @@ void xio_mixer( const int usb_output[32], int usb_input[32],
                 const int adc_output[32], int dac_input[32],
                 const int dsp_output[32], int dsp_input[32], const int property[6] )
 {
+    #if C99_LOAD
+    unsigned start = timer_count();
+    if( _load_budget == 0 ) _load_budget = 100000000 / audio_sample_rate;
+    #endif
     //static int active = 0, footsw = 0, sync_tx = 0, sync_rx = 0;
     //int level, period = audio_sample_rate / 1000;
     
@@ -120,6 +177,7 @@ void xio_mixer( const int usb_output[32], int usb_input[32],
     
     result = dsp_iir2( result, _master_tone_coeff, _master_tone_state ); // Tone knob/control
     result = dsp_mul ( result, _master_volume ); // Volume knob/control
+    c99_master_output = result;
 
     usb_input[0] = input;      // USB input left Q31 = guitar input (ADC) Q31
     usb_input[1] = result * 8; // USB input right Q31 = DSP result Q28
@@ -156,6 +214,76 @@ void xio_mixer( const int usb_output[32], int usb_input[32],
     i2s_input[2] = active; // Set LED to 1 if footsw == 1 (active, not bypassed)
     */
     c99_mixer( usb_output, usb_input, adc_output, dac_input, dsp_output, dsp_input, property );
+
+    #if C99_LOAD
+    _load_update( 0, timer_count() - start );
+    for( int ss = 1; ss <= 5; ++ss ) _load_update( ss, dsp_output[32-ss] );
+    #endif
+}
+
+#if C99_BLOCK > 1
+
+// Block mode. Each DSP thread collects C99_BLOCK samples into an input block while the previous
+// block is processed (in place) by its 'c99_threadN', one slice per sample period, and the block
+// before that is played out. Three buffers per thread rotate at the end of each block. Properties
+// travel with their block - the ones that arrive while a block is collected are handed over, in
+// order, from slice 0 of that block's processing on (so they get the same 2*C99_BLOCK latency as
+// the samples and take effect at a block boundary). Other slices receive an empty property.
+
+int _block_data[5][3][32][C99_BLOCK], _block_index[5], _block_phase[5];
+int _block_prop[5][3][C99_BLOCK][6], _block_count[5][3];
+
+#define _C99_THREAD( nn, thread ) \
+{ \
+    int (*bb)[32][C99_BLOCK] = _block_data[nn-1], ii = _block_index[nn-1], pp = _block_phase[nn-1]; \
+    int* cc = _block_count[nn-1]; int (*qq)[C99_BLOCK][6] = _block_prop[nn-1]; \
+    for( int ch = 0; ch < 32; ++ch ) { \
+        bb[ii][ch][pp] = samples[ch]; samples[ch] = bb[(ii+2)%3][ch][pp]; \
+    } \
+    if( property[0] != 0 ) memcpy( qq[ii][cc[ii]++], property, 6*sizeof(int) ); \
+    if( pp < cc[(ii+1)%3] ) thread( bb[(ii+1)%3], qq[(ii+1)%3][pp], pp ); \
+    else { static const int none[6] = {0,0,0,0,0,0}; thread( bb[(ii+1)%3], none, pp ); } \
+    if( ++pp == C99_BLOCK ) { pp = 0; _block_index[nn-1] = (ii+2)%3; cc[(ii+2)%3] = 0; } \
+    _block_phase[nn-1] = pp; \
+}
+
+#else
+
+#define _C99_THREAD( nn, thread ) thread( samples, property );
+
+#endif
+
+#if C99_LOAD
+#define _C99_START() unsigned start = timer_count();
+#define _C99_STOP(nn) samples[32-nn] = timer_count() - start;
+#else
+#define _C99_START()
+#define _C99_STOP(nn)
+#endif
+
+void xio_thread1( int samples[32], const int property[6] )
+{
+    _C99_START(); _C99_THREAD( 1, c99_thread1 ); _C99_STOP( 1 );
+}
+
+void xio_thread2( int samples[32], const int property[6] )
+{
+    _C99_START(); _C99_THREAD( 2, c99_thread2 ); _C99_STOP( 2 );
+}
+
+void xio_thread3( int samples[32], const int property[6] )
+{
+    _C99_START(); _C99_THREAD( 3, c99_thread3 ); _C99_STOP( 3 );
+}
+
+void xio_thread4( int samples[32], const int property[6] )
+{
+    _C99_START(); _C99_THREAD( 4, c99_thread4 ); _C99_STOP( 4 );
+}
+
+void xio_thread5( int samples[32], const int property[6] )
+{
+    _C99_START(); _C99_THREAD( 5, c99_thread5 ); _C99_STOP( 5 );
 }
 
 static void _property_get_data( const int property[6], byte data[20] )
@@ -9,4 +9,48 @@ void c99_mixer( const int usb_output[32], int usb_input[32],
                 const int adc_output[32], int dac_input[32],
                 const int dsp_output[32], int dsp_input[32], const int property[6] );
 
+// DSP result (QQQ) after the master tone and volume, before conversion to the DAC and USB outputs
+// (DSP_OUTPUT[0] * 8). Valid in 'c99_mixer', e.g. for output limiting ahead of the DAC.
+
+extern int c99_master_output;
+
+// DSP threads, called by 'xio_thread1' through 'xio_thread5' (see XIO.H). Compile with C99_LOAD
+// defined as 1 (e.g. './build.sh c99_preamp -DC99_LOAD=1', always on in host.sh builds) to measure
+// the execution time of the mixer and each thread and read the statistics with property 23s0 (see
+// C99.C). Load builds pass each thread's time to the mixer in sample slot 32-N, so slots 27 through
+// 31 are then not available for audio samples. Off by default.
+//
+// Block mode (optional): compile with C99_BLOCK defined as 2, 4, 8 or 16 (e.g. -DC99_BLOCK=8) and
+// each thread receives blocks of C99_BLOCK samples per channel (samples[ch][0] is the oldest) for
+// use with the DSP.H block functions. A thread is called once per sample period with the same
+// block and SLICE counting from 0 to C99_BLOCK-1, results written into the block are output during
+// the next block period. Spread the work over the slices (e.g. 'dsp_convolve_block' with one
+// group of IR segments per slice) so every call stays within one sample period. Each thread adds
+// 2*C99_BLOCK samples of latency. Properties are queued with the samples of the period in which
+// they arrived and handed to the thread with that block (from slice 0 on), so they keep the
+// same 2*C99_BLOCK delay as the audio. Effects that support block mode provide both thread
+// signatures under '#if C99_BLOCK == 1' (see 'c99_cabsim.c').
+
+#ifndef C99_BLOCK
+#define C99_BLOCK 1
+#endif
+
+#if C99_BLOCK > 1
+
+void c99_thread1( int samples[32][C99_BLOCK], const int property[6], int slice );
+void c99_thread2( int samples[32][C99_BLOCK], const int property[6], int slice );
+void c99_thread3( int samples[32][C99_BLOCK], const int property[6], int slice );
+void c99_thread4( int samples[32][C99_BLOCK], const int property[6], int slice );
+void c99_thread5( int samples[32][C99_BLOCK], const int property[6], int slice );
+
+#else
+
+void c99_thread1( int samples[32], const int property[6] );
+void c99_thread2( int samples[32], const int property[6] );
+void c99_thread3( int samples[32], const int property[6] );
+void c99_thread4( int samples[32], const int property[6] );
+void c99_thread5( int samples[32], const int property[6] );
+
+#endif
+
 #endif
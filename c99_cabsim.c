@@ -37,39 +37,13 @@ const char* control_labels[21] = { "C99 Cabsim",
                                    "Cabinet IR",
                                    "","","","","","","","","","" };
 
-int _ampcab_gain_lut[32768];
-int _ampcab_gain_model( int xx, int* cc, int* ss )
+// Power-amp gain stage - 'dsp_waveshaper' without pre/post-filters, 15-bit index resolution.
+
+int _ampcab_gain_lut[2+32768];
+
+static inline int _ampcab_gain_model( int xx, const int* cc, int* ss ) // block,gain,bias,slew
 {
-	int s1,s2,ii,ff,block,gain,bias,slew,ah; unsigned al;
-    /* 1st order high-pass / dc blocking */
-    asm volatile( "ldd %0,%1,%2[0]":"=r"(gain),"=r"(block):"r"(cc) ); \
-    asm volatile( "ldd %0,%1,%2[0]":"=r"(s2),"=r"(s1):"r"(ss) ); \
-    asm volatile( "maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(block),"r"(s2),"0"(0),"1"(1<<(QQ-1)) ); \
-    asm volatile( "lextract %0,%1,%2,%3,32":"=r"(ah):"r"(ah),"r"(al),"r"(QQ) ); \
-    s2 = xx - s1 + ah; s1 = xx; xx = s2; \
-    asm volatile( "std %0,%1,%2[0]"::"r"(s2),"r"(s1),"r"(ss) ); \
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(xx),"r"(gain),"0"(0),"1"(1<<(QQ-1)) );
-    asm volatile("lextract %0,%1,%2,%3,32":"=r"(xx):"r"(ah),"r"(al),"r"(QQ));
-    /* Table lookup and Lagrange interpolation */
-    asm volatile("ldd %0,%1,%2[1]":"=r"(slew),"=r"(bias):"r"(cc) ); xx = xx/2 + bias;
-    if( xx<FQ(-0.499999) ) xx=FQ(-0.499999); if( xx>FQ(+0.499999) ) xx=FQ(+0.499999);
-	xx += FQ(+0.5); ii=(xx&0x0FFFE000)>>13; ff=(xx&0x00001FFF)<<15;
-	int z1,z2,z3, x0 = ff - FQ(0.0), x1 = ff - FQ(1.0), x2 = ff - FQ(2.0);
-	asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(x1),"r"(x2),"0"(0),"1"(1<<(QQ-1)));
-	asm volatile("lextract %0,%1,%2,%3,32":"=r"(z1):"r"(ah),"r"(al),"r"((QQ+1)));
-	asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(x0),"r"(-x2),"0"(0),"1"(1<<(QQ-1)));
-	asm volatile("lextract %0,%1,%2,%3,32":"=r"(z2):"r"(ah),"r"(al),"r"((QQ+0)));
-	asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(x0),"r"(x1),"0"(0),"1"(1<<(QQ-1)));
-	asm volatile("lextract %0,%1,%2,%3,32":"=r"(z3):"r"(ah),"r"(al),"r"((QQ+1)));
-	asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(_ampcab_gain_lut[ii+0]),"r"(z1),"0"(0),"1"(1<<(QQ-1)));
-	asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(_ampcab_gain_lut[ii+1]),"r"(z2),"0"(ah),"1"(al));
-	asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(_ampcab_gain_lut[ii+2]),"r"(z3),"0"(ah),"1"(al));
-	asm volatile("lextract %0,%1,%2,%3,32":"=r"(xx):"r"(ah),"r"(al),"r"(QQ));
-    /* Slew-rate limiting */
-    asm volatile("ldd %0,%1,%2[1]":"=r"(s2),"=r"(s1):"r"(ss));
-    if( xx > s1+slew ) xx = s1+slew; if( xx < s1-slew ) xx = s1-slew; s1 = xx;
-    asm volatile( "std %0,%1,%2[1]"::"r"(s1),"r"(xx),"r"(ss) );
-    return xx;
+    return _dsp_waveshaper( xx, _ampcab_gain_lut, cc, ss, 0 );
 }
 
 int _ampcab_dnsample_coeff[120] = // pass=0.04 stop=0.10 atten=110
@@ -100,14 +74,45 @@ int _ampcab_dnsample_coeff[120] = // pass=0.04 stop=0.10 atten=110
     FQ(-0.000005139),FQ(-0.000001362),FQ(+0.000000447),FQ(+0.000000841),FQ(+0.000000541)
 };
 int _ampcab_upsample_coeff[120];
-int _ampcab_upsample_state[120], _ampcab_dnsample_state[120];
+int _ampcab_upsample_state[24], _ampcab_dnsample_state[120];
 
 int _ampcab_pwramp_coeff[6] = { 0,0,0,0,0,0 }, _ampcab_pwramp_state[4] = { 0,0,0,0 };
-int _ampcab_tone_data[7];
+int _ampcab_tone_data[8];
 int _ampcab_tone_coeff[8]={FQ(1.0),0,0,0,0,0,0,0}, _ampcab_tone_state[6];
 
+// Power-amp and tone stack coefficients are ramped to new values over 2^CABSIM_RAMP samples (5.3 ms
+// at 48 kHz, a bit longer than the 4 ms it takes the control task to cycle through properties 1-4).
+// The tone stack takes two properties (3 and 4) so it is staged in a coefficient bank and ramped as
+// a whole once property 4 commits the complete set.
+
+#define CABSIM_RAMP 8
+
+int _ampcab_pwramp_ramp[2+2*5], _ampcab_tone_ramp[2+2*8], _ampcab_tone_bank[2+2*8];
+
 int _ampcab_ir_coeff[11][1680], _ampcab_ir_state[1680];
 
+// Optional IR tail beyond the 1440 taps computed by 'dsp_convolve' in threads 2 to 4. The tail is
+// computed in thread 5 by partitioned FFT convolution with growing partitions (512 taps up to tap
+// 4096, 2048 taps after that) and added to the direct-form result with no additional latency.
+// Build with e.g. '-DCABSIM_IR_LENGTH=8192' and fill '_ampcab_tail_coeff' with IR taps 1440 and up
+// before 'xio_initialize' calculates the partition spectra. Memory use is about 4 words per tap.
+// The tail is a single fixed IR shared by all cabinets: the "Cabinet IR" morph (property 3) only
+// moves the 1440-tap head, since the tail spectra are computed once at startup and per-cabinet
+// tails would need 4 words per tap for each of the ten IR's.
+
+#ifndef CABSIM_IR_LENGTH
+#define CABSIM_IR_LENGTH 1440
+#endif
+
+#if CABSIM_IR_LENGTH > 1440
+#define _CABSIM_TAIL_A (CABSIM_IR_LENGTH < 4096 ? CABSIM_IR_LENGTH-1440 : 4096-1440)
+int _ampcab_tail_coeff[CABSIM_IR_LENGTH-1440];
+int _ampcab_tail_state_a[24+7*512+4*512*((_CABSIM_TAIL_A+1440-512-1)/512)];
+#endif
+#if CABSIM_IR_LENGTH > 4096
+int _ampcab_tail_state_b[24+7*2048+4*2048*((CABSIM_IR_LENGTH-2048-1)/2048)];
+#endif
+
 void _calc_peaking( int* coeffs, double min, double max, double val )
 {
     calc_peaking( coeffs, (min+val*(max-min)) / 576000.0, 0.500, 6.0 );
@@ -170,6 +175,8 @@ void c99_control( const double parameters[20], int property[6] )
     {
         property[0] = state; state = 1;
         memcpy( property+1, _ampcab_tone_data+5, 2*sizeof(int) );
+        property[3] = property[4] = 0;
+        property[5] = dsp_bank_sum( _ampcab_tone_data, 8 ); // Commit the complete tone stack
     }
 }
 
@@ -188,12 +195,27 @@ void xio_initialize( void )
     memset( _ampcab_tone_coeff, 0, sizeof(_ampcab_tone_coeff) );
     memset( _ampcab_tone_state, 0, sizeof(_ampcab_tone_state) );
 
+    dsp_ramp_init( _ampcab_pwramp_coeff, _ampcab_pwramp_ramp, 5 );
+    dsp_ramp_init( _ampcab_tone_coeff, _ampcab_tone_ramp, 8 );
+    dsp_bank_init( _ampcab_tone_bank, _ampcab_tone_coeff, 8 );
+
     mix_fir_coeffs( _ampcab_upsample_coeff, _ampcab_dnsample_coeff, 120, 5 );
+
+    #if CABSIM_IR_LENGTH > 1440
+    dsp_tables_init( DSP_SINE_14 ); // FFT twiddle factors
+    dsp_fftconv_tail( _ampcab_tail_state_a, _ampcab_tail_coeff, _CABSIM_TAIL_A, 1440, 512 );
+    #endif
+    #if CABSIM_IR_LENGTH > 4096
+    dsp_fftconv_tail( _ampcab_tail_state_b, _ampcab_tail_coeff+4096-1440,
+                      CABSIM_IR_LENGTH-4096, 4096, 2048 );
+    #endif
     
     _ampcab_ir_coeff[0][0] = FQ(+0.8);
 }
 
-void xio_thread1( int samples[32], const int property[6] )
+// Power amp at 5x the sample rate, SAMPLES[0] in and out (SAMPLES[0:4] hold the 5x samples).
+
+static void _ampcab_poweramp( int* samples )
 {
     _dsp_fir_up( samples, _ampcab_upsample_coeff, _ampcab_upsample_state, 120, 5 );
 
@@ -203,43 +225,68 @@ void xio_thread1( int samples[32], const int property[6] )
     samples[1] = _ampcab_gain_model( samples[1], _ampcab_pwramp_coeff, _ampcab_pwramp_state );
     samples[0] = _ampcab_gain_model( samples[0], _ampcab_pwramp_coeff, _ampcab_pwramp_state );
     
-    _dsp_fir_dn( samples, _ampcab_dnsample_coeff, _ampcab_dnsample_state, 120, 5 );
+    _dsp_fir_dn_sym( samples, _ampcab_dnsample_coeff, _ampcab_dnsample_state, 120, 5 );
 }
 
-void xio_thread2( int samples[32], const int property[6] )
+#if C99_BLOCK == 1
+
+void c99_thread1( int samples[32], const int property[6] )
 {
-    samples[1] = 0; samples[2] = 1<<(QQ-1);
+    _ampcab_poweramp( samples );
+}
+
+void c99_thread2( int samples[32], const int property[6] )
+{
+    samples[1] = 0; samples[2] = 1<<(QQ-1); samples[3] = samples[0]; // Dry input for IR tail
     samples[0] = dsp_convolve( samples[0], _ampcab_ir_coeff[0]+0*20*24, _ampcab_ir_state+0*20*24,
                                samples+1, samples+2, 20 );
 }
 
-void xio_thread3( int samples[32], const int property[6] )
+void c99_thread3( int samples[32], const int property[6] )
 {
     samples[0] = dsp_convolve( samples[0], _ampcab_ir_coeff[0]+1*20*24, _ampcab_ir_state+1*20*24,
                                samples+1, samples+2, 20 );
 }
 
-void xio_thread4( int samples[32], const int property[6] )
+void c99_thread4( int samples[32], const int property[6] )
 {
     samples[0] = dsp_convolve( samples[0], _ampcab_ir_coeff[0]+2*20*24, _ampcab_ir_state+2*20*24,
                                samples+1, samples+2, 20 );
     samples[0] = dsp_ext( samples[1], samples[2] );
 }
 
-void xio_thread5( int samples[32], const int property[6] )
+#endif
+
+// Output stage - IR tail, volume and property handling, SAMPLES[0] in and out, SAMPLES[3] holds
+// the dry input for the IR tail.
+
+static void _ampcab_output( int* samples, const int property[6] )
 {
     //samples[0] = dsp_convolve( samples[0], _ampcab_ir_coeff+3*20*24, _ampcab_ir_state+3*20*24,
     //                           samples+1, samples+2, 10 );
     //samples[0] = dsp_ext( samples[1], samples[2] );
 
     static int volume = 0, ir_sel = 0, ir_num, ir_idx = 0;
+    #if CABSIM_IR_LENGTH > 1440
+    samples[0] += dsp_fftconv( samples[3], _ampcab_tail_state_a );
+    #endif
+    #if CABSIM_IR_LENGTH > 4096
+    samples[0] += dsp_fftconv( samples[3], _ampcab_tail_state_b );
+    #endif
     //samples[0] = dsp_iir3( samples[0], _ampcab_tone_coeff, _ampcab_tone_state );
     samples[0] = dsp_mul ( samples[0], volume );
 
+    dsp_ramp( _ampcab_pwramp_coeff, _ampcab_pwramp_ramp );
+    dsp_ramp( _ampcab_tone_coeff, _ampcab_tone_ramp );
+
     if( property[0] == 1 ) volume = property[1];
-    if( property[0] == 2 ) memcpy( _ampcab_pwramp_coeff, property+1, 5*sizeof(int) );
-    if( property[0] == 3 ) memcpy( _ampcab_tone_coeff+0, property+1, 5*sizeof(int) );
-    if( property[0] == 4 ) memcpy( _ampcab_tone_coeff+5, property+1, 2*sizeof(int) );
+    if( property[0] == 2 )
+        dsp_ramp_set( _ampcab_pwramp_coeff, _ampcab_pwramp_ramp, property+1, CABSIM_RAMP );
+    if( property[0] == 3 ) dsp_bank_stage( _ampcab_tone_bank, property+1, 0, 5 );
+    if( property[0] == 4 ) dsp_bank_stage( _ampcab_tone_bank, property+1, 5, 2 );
+    if( property[0] == 4 && dsp_bank_commit( _ampcab_tone_bank, property[5] ) )
+        dsp_ramp_set( _ampcab_tone_coeff, _ampcab_tone_ramp, dsp_bank(_ampcab_tone_bank),
+                      CABSIM_RAMP );
     if( property[0] == 5 ) ir_sel = property[1];
 
     int ratio = FQ(0.0);
@@ -264,8 +311,68 @@ void xio_thread5( int samples[32], const int property[6] )
     if( ++ir_idx == 1680 ) ir_idx = 0;
 }
 
-int _ampcab_gain_lut[32768] =
+#if C99_BLOCK == 1
+
+void c99_thread5( int samples[32], const int property[6] )
+{
+    _ampcab_output( samples, property );
+}
+
+#else
+
+// Block mode (see C99.H), e.g. './host.sh c99_cabsim -DC99_BLOCK=8'. The power amp and the output
+// stage run one sample per slice. Threads 2 to 4 compute the 1440-tap head with 'dsp_convolve_block'
+// and spread their 20 segments over the slices. The shifted-out block (SAMPLES[0]) and the BB
+// accumulators (SAMPLES[1] and SAMPLES[2]) are passed down the pipeline as in per-sample mode.
+
+int _ampcab_ir_block[3][20*24+C99_BLOCK*C99_BLOCK];
+
+static void _ampcab_convolve_block( int samples[32][C99_BLOCK], int tt, int slice )
+{
+    int s0 = 20 * slice / C99_BLOCK, s1 = 20 * (slice+1) / C99_BLOCK; // Segments for this slice
+    dsp_convolve_block( samples[0], _ampcab_ir_coeff[0] + 24*(20*tt+s0),
+                        _ampcab_ir_block[tt] + 24*s0 + C99_BLOCK*slice,
+                        samples[1], samples[2], s1-s0, C99_BLOCK );
+}
+
+void c99_thread1( int samples[32][C99_BLOCK], const int property[6], int slice )
+{
+    int xx[5] = { samples[0][slice] };
+    _ampcab_poweramp( xx ); samples[0][slice] = xx[0];
+}
+
+void c99_thread2( int samples[32][C99_BLOCK], const int property[6], int slice )
+{
+    if( slice == 0 ) for( int ii = 0; ii < C99_BLOCK; ++ii ) {
+        samples[1][ii] = 0; samples[2][ii] = 1<<(QQ-1); samples[3][ii] = samples[0][ii];
+    }
+    _ampcab_convolve_block( samples, 0, slice );
+}
+
+void c99_thread3( int samples[32][C99_BLOCK], const int property[6], int slice )
+{
+    _ampcab_convolve_block( samples, 1, slice );
+}
+
+void c99_thread4( int samples[32][C99_BLOCK], const int property[6], int slice )
+{
+    _ampcab_convolve_block( samples, 2, slice );
+    if( slice == C99_BLOCK-1 ) for( int ii = 0; ii < C99_BLOCK; ++ii ) {
+        samples[0][ii] = dsp_ext( samples[1][ii], samples[2][ii] );
+    }
+}
+
+void c99_thread5( int samples[32][C99_BLOCK], const int property[6], int slice )
+{
+    int xx[4] = { samples[0][slice], 0, 0, samples[3][slice] };
+    _ampcab_output( xx, property ); samples[0][slice] = xx[0];
+}
+
+#endif
+
+int _ampcab_gain_lut[2+32768] =
 {
+    15, 32768, // Index bits and curve length
     FQ(-0.999999),FQ(-0.999999),FQ(-0.999999),FQ(-0.999999),FQ(-0.999999),FQ(-0.999999),FQ(-0.999999),FQ(-0.999999),
     FQ(-0.999999),FQ(-0.999999),FQ(-0.999999),FQ(-0.999999),FQ(-0.999999),FQ(-0.999999),FQ(-0.999999),FQ(-0.999999),
     FQ(-0.999999),FQ(-0.999999),FQ(-0.999999),FQ(-0.999999),FQ(-0.999999),FQ(-0.999999),FQ(-0.999999),FQ(-0.999999),
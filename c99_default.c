@@ -41,8 +41,8 @@ void xio_initialize( void )
 {
 }
 
-void xio_thread1( int samples[32], const int property[6] ) {}
-void xio_thread2( int samples[32], const int property[6] ) {}
-void xio_thread3( int samples[32], const int property[6] ) {}
-void xio_thread4( int samples[32], const int property[6] ) {}
-void xio_thread5( int samples[32], const int property[6] ) {}
+void c99_thread1( int samples[32], const int property[6] ) {}
+void c99_thread2( int samples[32], const int property[6] ) {}
+void c99_thread3( int samples[32], const int property[6] ) {}
+void c99_thread4( int samples[32], const int property[6] ) {}
+void c99_thread5( int samples[32], const int property[6] ) {}
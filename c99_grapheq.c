@@ -59,35 +59,49 @@ void c99_mixer( const int usb_output[32], int usb_input[32],
                 const int adc_output[32], int dac_input[32],
                 const int dsp_output[32], int dsp_input[32], const int property[6] )
 {
+    dsp_input[1] = adc_output[1] / 8; // Stereo input and output
+    dac_input[0] = dsp_output[0] * 8;
+    dac_input[1] = dsp_output[1] * 8;
 }
 
-int _grapheq_coeff[15*5], _grapheq_state[15*4];
+int _grapheq_coeff[15*5], _grapheq_state[2*15*4]; // Left and right channel share coefficients
+
+// Band coefficients are ramped to new values over 2^GRAPHEQ_RAMP samples (21 ms at 192 kHz, a bit
+// longer than the 16 ms it takes the control task to cycle through all bands).
+
+#define GRAPHEQ_RAMP 12
+
+int _grapheq_ramp[15][2+2*5];
 
 void xio_initialize( void )
 {
-    return;
     memset( _grapheq_coeff, 0, sizeof(_grapheq_coeff) );
     memset( _grapheq_state, 0, sizeof(_grapheq_state) );
     // Initialize all bands to unity gain (b0=1, b1=b2=a1=a2=0)
     for( int ii = 0; ii < 15; ++ii ) _grapheq_coeff[5*ii] = FQ(+1.0);
+    for( int ii = 0; ii < 15; ++ii ) dsp_ramp_init( _grapheq_coeff+5*ii, _grapheq_ramp[ii], 5 );
 }
 
-void xio_thread1( int samples[32], const int property[6] )
+void c99_thread1( int samples[32], const int property[6] )
 {
-    return;
     static int volume = 0, gain = 0;
     
     samples[0] = dsp_mul( samples[0], gain );
-    samples[0] = dsp_biquad( samples[0], _grapheq_coeff, _grapheq_state, 15 );
+    samples[1] = dsp_mul( samples[1], gain );
+    dsp_biquad_multi( samples, _grapheq_coeff, _grapheq_state, 15, 2 );
     samples[0] = dsp_mul( samples[0], volume );
+    samples[1] = dsp_mul( samples[1], volume );
+    
+    for( int ii = 0; ii < 15; ++ii ) dsp_ramp( _grapheq_coeff+5*ii, _grapheq_ramp[ii] );
     
     if( property[0] == 1 ) { volume = property[1], gain = property[2]; }
     if( property[0] >= 0x11 && property[0] <= 0x1F ) {
-        memcpy( _grapheq_coeff + 5*(property[0]-0x11), property+1, 5*sizeof(int) );
+        int ii = property[0] - 0x11;
+        dsp_ramp_set( _grapheq_coeff+5*ii, _grapheq_ramp[ii], property+1, GRAPHEQ_RAMP );
     }
 }
 
-void xio_thread2( int samples[32], const int property[6] ) {}
-void xio_thread3( int samples[32], const int property[6] ) {}
-void xio_thread4( int samples[32], const int property[6] ) {}
-void xio_thread5( int samples[32], const int property[6] ) {}
+void c99_thread2( int samples[32], const int property[6] ) {}
+void c99_thread3( int samples[32], const int property[6] ) {}
+void c99_thread4( int samples[32], const int property[6] ) {}
+void c99_thread5( int samples[32], const int property[6] ) {}
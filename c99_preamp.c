@@ -38,81 +38,15 @@ const char* control_labels[21] = { "C99 Preamp",
 //FQ(-0.001603981),FQ(-0.021411303),FQ(+0.093966609),FQ(+0.429048675),FQ(+0.429048675),
 //FQ(+0.093966609),FQ(-0.021411303),FQ(-0.001603981)
     
-int _preamp_gain_lut[47003];
-int _preamp_gain_model( int xx, int* cc, int* ss ) // block,gain,bias,slew
+// Triode gain stage - 'dsp_waveshaper' with the emphasis as the pre-filter, FIR noise attenuation
+// and the high cut as the post-filter, inverting like a common-cathode stage. The transfer curve
+// has 16-bit index resolution.
+
+int _preamp_gain_lut[2+43703];
+
+static inline int _preamp_gain_model( int xx, const int* cc, int* ss ) // block,gain,bias,slew
 {
-	int c1,c2,s0,s1,s2,s3,ii,ff,block,gain,bias,slew,ah; unsigned al;
-    /* 1st order high-pass / dc blocking */
-    asm volatile( "ldd %0,%1,%2[0]":"=r"(gain),"=r"(block):"r"(cc) );
-    asm volatile( "ldd %0,%1,%2[0]":"=r"(s2),"=r"(s1):"r"(ss) );
-    asm volatile( "maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(block),"r"(s2),"0"(0),"1"(1<<(QQ-1)) );
-    asm volatile( "lextract %0,%1,%2,%3,32":"=r"(ah):"r"(ah),"r"(al),"r"(QQ) );
-    s2 = xx - s1 + ah; s1 = xx; xx = s2;
-    asm volatile( "std %0,%1,%2[0]"::"r"(s2),"r"(s1),"r"(ss) );
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(xx),"r"(gain),"0"(0),"1"(1<<(QQ-1)) );
-    asm volatile("lextract %0,%1,%2,%3,32":"=r"(xx):"r"(ah),"r"(al),"r"(QQ));
-    /* 2nd order peaking */
-    asm volatile("ldd %0,%1,%2[3]":"=r"(c2),"=r"(c1):"r"(cc));
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(xx),"r"(c1),"0"(0),"1"(1<<(QQ-1)) );
-    asm volatile("ldd %0,%1,%2[2]":"=r"(s2),"=r"(s1):"r"(ss));
-    asm volatile("std %0,%1,%2[2]"::"r"(s1),"r"(xx),"r"(ss));
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(s1),"r"(c2),"0"(ah),"1"(al));
-    asm volatile("ldd %0,%1,%2[4]":"=r"(c2),"=r"(c1):"r"(cc));
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(s2),"r"(c1),"0"(ah),"1"(al));
-    asm volatile("ldd %0,%1,%2[3]":"=r"(s2),"=r"(s1):"r"(ss));
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(s1),"r"(c2),"0"(ah),"1"(al));
-    asm volatile("ldd %0,%1,%2[5]":"=r"(c2),"=r"(c1):"r"(cc));
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(s2),"r"(c1),"0"(ah),"1"(al));
-    asm volatile("lextract %0,%1,%2,%3,32":"=r"(xx):"r"(ah),"r"(al),"r"(QQ));
-    asm volatile("std %0,%1,%2[3]"::"r"(s1),"r"(xx),"r"(ss));
-    /* Table lookup and Lagrange interpolation */
-    asm volatile("ldd %0,%1,%2[1]":"=r"(slew),"=r"(bias):"r"(cc) ); xx = xx/2 + bias;
-    if( xx<FQ(-0.499999) ) xx=FQ(-0.499999); if( xx>FQ(+0.499999) ) xx=FQ(+0.499999);
-	xx += FQ(+0.5); ii=(xx&0x0FFFF000)>>12; ff=(xx&0x00000FFF)<<16; if(ii>43700) ii=43700;
-	int z1,z2,z3, x0 = ff - FQ(0.0), x1 = ff - FQ(1.0), x2 = ff - FQ(2.0);
-	asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(x1),"r"(x2),"0"(0),"1"(1<<(QQ-1)));
-	asm volatile("lextract %0,%1,%2,%3,32":"=r"(z1):"r"(ah),"r"(al),"r"((QQ+1)));
-	asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(x0),"r"(-x2),"0"(0),"1"(1<<(QQ-1)));
-	asm volatile("lextract %0,%1,%2,%3,32":"=r"(z2):"r"(ah),"r"(al),"r"((QQ+0)));
-	asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(x0),"r"(x1),"0"(0),"1"(1<<(QQ-1)));
-	asm volatile("lextract %0,%1,%2,%3,32":"=r"(z3):"r"(ah),"r"(al),"r"((QQ+1)));
-	asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(_preamp_gain_lut[ii+0]),"r"(z1),"0"(0),"1"(1<<(QQ-1)));
-	asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(_preamp_gain_lut[ii+1]),"r"(z2),"0"(ah),"1"(al));
-	asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(_preamp_gain_lut[ii+2]),"r"(z3),"0"(ah),"1"(al));
-	asm volatile("lextract %0,%1,%2,%3,32":"=r"(xx):"r"(ah),"r"(al),"r"(QQ));
-    /* 6th order FIR noise attenuation, util_fir.py 0 0.5 1.0 40 */
-    asm volatile( "ldd %0,%1,%2[6]"  :"=r"(s2),"=r"(s1):"r"(ss) );
-    asm volatile( "std %0,%1,%2[6]" ::"r" (s1), "r"(xx),"r"(ss) );
-    asm volatile( "maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(FQ(-0.013268164)),"r"(xx),"0"(0),"1"(1<<(QQ-1)) );
-    asm volatile( "maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(FQ(+0.087136613)),"r"(s1),"0"(ah),"1"(al) );
-    asm volatile( "ldd %0,%1,%2[7]"  :"=r"(s0),"=r"(s3):"r"(ss) );
-    asm volatile( "std %0,%1,%2[7]"  ::"r"(s3), "r"(s2),"r"(ss) );
-    asm volatile( "maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(FQ(+0.426131551)),"r"(s2),"0"(ah),"1"(al) );
-    asm volatile( "maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(FQ(+0.426131551)),"r"(s3),"0"(ah),"1"(al) );
-    asm volatile( "ldd %0,%1,%2[7]"  :"=r"(s2),"=r"(s1):"r"(ss) );
-    asm volatile( "std %0,%1,%2[7]"  ::"r"(s1), "r"(s0),"r"(ss) );
-    asm volatile( "maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(FQ(+0.087136613)),"r"(s0),"0"(ah),"1"(al) );
-    asm volatile( "maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(FQ(-0.013268164)),"r"(s1),"0"(ah),"1"(al) );
-    asm volatile( "lextract %0,%1,%2,%3,32":"=r"(xx):"r"(ah),"r"(al),"r"(QQ) );
-    /* 2nd order low-pass */
-    asm volatile("ldd %0,%1,%2[6]":"=r"(c2),"=r"(c1):"r"(cc));
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(xx),"r"(c1),"0"(0),"1"(1<<(QQ-1)) );
-    asm volatile("ldd %0,%1,%2[4]":"=r"(s2),"=r"(s1):"r"(ss));
-    asm volatile("std %0,%1,%2[4]"::"r"(s1),"r"(xx),"r"(ss));
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(s1),"r"(c2),"0"(ah),"1"(al));
-    asm volatile("ldd %0,%1,%2[7]":"=r"(c2),"=r"(c1):"r"(cc));
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(s2),"r"(c1),"0"(ah),"1"(al));
-    asm volatile("ldd %0,%1,%2[5]":"=r"(s2),"=r"(s1):"r"(ss));
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(s1),"r"(c2),"0"(ah),"1"(al));
-    asm volatile("ldd %0,%1,%2[8]":"=r"(c2),"=r"(c1):"r"(cc));
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(s2),"r"(c1),"0"(ah),"1"(al));
-    asm volatile("lextract %0,%1,%2,%3,32":"=r"(xx):"r"(ah),"r"(al),"r"(QQ));
-    asm volatile("std %0,%1,%2[5]"::"r"(s1),"r"(xx),"r"(ss));
-    /* Slew-rate limiting */
-    asm volatile("ldd %0,%1,%2[1]":"=r"(s2),"=r"(s1):"r"(ss));
-    if( xx > s1+slew ) xx = s1+slew; if( xx < s1-slew ) xx = s1-slew; s1 = xx;
-    asm volatile( "std %0,%1,%2[1]"::"r"(s1),"r"(xx),"r"(ss) );
-    return -xx;
+    return -_dsp_waveshaper( xx, _preamp_gain_lut, cc, ss, DSP_SHAPER_PRE|DSP_SHAPER_FIR|DSP_SHAPER_POST );
 }
 
 int _preamp_dnsample_coeff[72] = // python util_fir.py 0.00 0.11 1.0 -120
@@ -139,9 +73,25 @@ int _preamp_amp1_coeff[24], _preamp_amp1_state[20];
 int _preamp_amp2_coeff[24], _preamp_amp2_state[20];
 int _preamp_amp3_coeff[24], _preamp_amp3_state[20];
 
-int _preamp_upsample_state[72];
+// Each stage's coefficients (properties 0xS1, 0xS2 and 0xS3) are staged in a coefficient bank and
+// once committed ramped to as a whole over 2^PREAMP_RAMP samples (10.7 ms at 192 kHz, a bit longer
+// than the 10 ms it takes the control task to cycle through all properties).
+
+#define PREAMP_RAMP 11
+
+int* _preamp_amp_coeff[3] = { _preamp_amp1_coeff, _preamp_amp2_coeff, _preamp_amp3_coeff };
+int  _preamp_amp_ramp[3][2+2*18], _preamp_amp_bank[3][2+2*18];
+
+int _preamp_upsample_state[24];
 int _preamp_dnsample_state[72];
 
+// Noise gate ahead of the gain stages (-60 dBFS, 0.5 ms attack, 50 ms release, 40 dB range) and a
+// brick-wall limiter ahead of the DAC (-0.2 dBFS ceiling, 1 ms look-ahead, 50 ms release). The
+// limiter runs in the mixer after the master tone and volume, so nothing follows it but the DAC.
+
+int _preamp_gate_coeff[12], _preamp_gate_state[3];
+int _preamp_limit_coeff[12], _preamp_limit_state[3+192];
+
 void _calc_peaking( int* coeffs, double min, double max, double val )
 {
     calc_peaking( coeffs, (min+val*(max-min)) / 576000.0, 0.500, 6.0 );
@@ -151,9 +101,13 @@ void _calc_lowpass( int* coeffs, double min, double max, double val )
     calc_lowpass( coeffs, (min+val*(max-min)) / 576000.0, 0.500 );
 }
 
+// Stage S coefficients are sent as 0xS2 (emphasis), 0xS3 (high cut) and then 0xS1 (block, gain,
+// bias and slew) which also carries the check-sum of the stage's complete coefficient set - the DSP
+// thread stages the properties in a coefficient bank and commits the set when 0xS1 arrives.
+
 void c99_control( const double parameters[20], int property[6] )
 {
-    static int state = 1;
+    static int state = 1, sets[3][18];
     
     double A_locut_min = 0.995, A_locut_max = 0.99999;
     double A_emph_min  = 400,   A_emph_max  = 1500;
@@ -181,12 +135,12 @@ void c99_control( const double parameters[20], int property[6] )
     
     if( state == 1 )
     {
-        property[0] = state; state = 0x11;
+        property[0] = state; state = 0x12;
         property[1] = FQ( volume_min + parameters[9] * (volume_max - volume_min) );
     }
     else if( state == 0x11 ) // Block, Gain, Bias, Slew
     {
-        property[0] = state; state = 0x12;
+        property[0] = state; state = 0x22;
         property[1] = FQ( A_locut_min + parameters[1] * (A_locut_max - A_locut_min) );
         property[2] = FQ( A_gain_min  + parameters[3] * (A_gain_max  - A_gain_min) );
         property[3] = FQ( A_bias_min  + parameters[6] * (A_bias_max  - A_bias_min) );
@@ -199,12 +153,12 @@ void c99_control( const double parameters[20], int property[6] )
     }
     else if( state == 0x13 ) // High Cut
     {
-        property[0] = state; state = 0x21;
+        property[0] = state; state = 0x11;
         _calc_lowpass( property+1, A_hicut_min, A_hicut_max, parameters[5] );
     }
     else if( state == 0x21 ) // Block, Drive*Gain, Bias, Slew
     {
-        property[0] = state; state = 0x22;
+        property[0] = state; state = 0x32;
         property[1] = FQ( B_locut_min + parameters[1] * (B_locut_max - B_locut_min) );
         
         int drive = FQ( B_drive_min + parameters[0] * (B_drive_max - B_drive_min) );
@@ -222,12 +176,12 @@ void c99_control( const double parameters[20], int property[6] )
     }
     else if( state == 0x23 ) // High Cut
     {
-        property[0] = state; state = 0x31;
+        property[0] = state; state = 0x21;
         _calc_lowpass( property+1, B_hicut_min, B_hicut_max, parameters[5] );
     }
     else if( state == 0x31 ) // Block, Gain, Bias, Slew
     {
-        property[0] = state; state = 0x32;
+        property[0] = state; state = 1;
         property[1] = FQ( C_locut_min + parameters[1] * (C_locut_max - C_locut_min) );
         property[2] = FQ( C_gain_min  + parameters[3] * (C_gain_max  - C_gain_min) );
         property[3] = FQ( C_bias_min  + parameters[8] * (C_bias_max  - C_bias_min) );
@@ -240,15 +194,24 @@ void c99_control( const double parameters[20], int property[6] )
     }
     else if( state == 0x33 ) // High Cut
     {
-        property[0] = state; state = 1;
+        property[0] = state; state = 0x31;
         _calc_lowpass( property+1, C_hicut_min, C_hicut_max, parameters[5] );
     }
+    
+    int ii = (property[0] >> 4) - 1, jj = (property[0] & 15) - 1; // 0xS1-0xS3 for stage S
+    if( ii >= 0 && ii < 3 && jj >= 0 && jj < 3 ) {
+        memcpy( sets[ii]+6*jj, property+1, (jj ? 5 : 4) * sizeof(int) );
+        if( jj == 0 ) property[5] = dsp_bank_sum( sets[ii], 18 );
+    }
 }
 
 void c99_mixer( const int usb_output[32], int usb_input[32],
                 const int adc_output[32], int dac_input[32],
                 const int dsp_output[32], int dsp_input[32], const int property[6] )
 {
+    int xx[1] = { c99_master_output };
+    _dsp_dynamics( xx, _preamp_limit_coeff, _preamp_limit_state, 1 );
+    usb_input[1] = dac_input[0] = dac_input[1] = xx[0] * 8; // Q28 -> Q31, full-scale is 1.0
 }
 
 void xio_initialize( void )
@@ -261,64 +224,74 @@ void xio_initialize( void )
     memset( _preamp_amp2_state, 0, sizeof(_preamp_amp2_state) );
     memset( _preamp_amp3_state, 0, sizeof(_preamp_amp3_state) );
 
+    for( int ii = 0; ii < 3; ++ii ) {
+        dsp_ramp_init( _preamp_amp_coeff[ii], _preamp_amp_ramp[ii], 18 );
+        dsp_bank_init( _preamp_amp_bank[ii], _preamp_amp_coeff[ii], 18 );
+    }
+
+    calc_gate( _preamp_gate_coeff, -60, 96, 9600, 40 );
+    calc_limiter( _preamp_limit_coeff, 0.977, 9600, 192 );
+    memset( _preamp_gate_state,  0, sizeof(_preamp_gate_state) );
+    memset( _preamp_limit_state, 0, sizeof(_preamp_limit_state) );
+
     memset( _preamp_upsample_state, 0, sizeof(_preamp_upsample_state) );
     memset( _preamp_dnsample_state, 0, sizeof(_preamp_dnsample_state) );
 
     mix_fir_coeffs( _preamp_upsample_coeff, _preamp_dnsample_coeff, 72, 3 );
 }
 
-void xio_thread1( int samples[32], const int property[6] )
+void c99_thread1( int samples[32], const int property[6] )
 {
+    _dsp_dynamics( samples, _preamp_gate_coeff, _preamp_gate_state, 1 );
     _dsp_fir_up( samples, _preamp_upsample_coeff, _preamp_upsample_state, 72, 3 );
 }
 
-void xio_thread2( int samples[32], const int property[6] )
+void c99_thread2( int samples[32], const int property[6] )
 {
     samples[2] = _preamp_gain_model( samples[2], _preamp_amp1_coeff, _preamp_amp1_state );
     samples[1] = _preamp_gain_model( samples[1], _preamp_amp1_coeff, _preamp_amp1_state );
     samples[0] = _preamp_gain_model( samples[0], _preamp_amp1_coeff, _preamp_amp1_state );
 }
 
-void xio_thread3( int samples[32], const int property[6] )
+void c99_thread3( int samples[32], const int property[6] )
 {
     samples[2] = _preamp_gain_model( samples[2], _preamp_amp2_coeff, _preamp_amp2_state );
     samples[1] = _preamp_gain_model( samples[1], _preamp_amp2_coeff, _preamp_amp2_state );
     samples[0] = _preamp_gain_model( samples[0], _preamp_amp2_coeff, _preamp_amp2_state );
 }
 
-void xio_thread4( int samples[32], const int property[6] )
+void c99_thread4( int samples[32], const int property[6] )
 {
     samples[2] = _preamp_gain_model( samples[2], _preamp_amp3_coeff, _preamp_amp3_state );
     samples[1] = _preamp_gain_model( samples[1], _preamp_amp3_coeff, _preamp_amp3_state );
     samples[0] = _preamp_gain_model( samples[0], _preamp_amp3_coeff, _preamp_amp3_state );
 }
 
-void xio_thread5( int samples[32], const int property[6] )
+void c99_thread5( int samples[32], const int property[6] )
 {
     static int volume = 0;
     
-    _dsp_fir_dn( samples, _preamp_dnsample_coeff, _preamp_dnsample_state, 72, 3 ) ;
+    _dsp_fir_dn_sym( samples, _preamp_dnsample_coeff, _preamp_dnsample_state, 72, 3 );
     
     samples[0] = dsp_mul( samples[0], volume );
     samples[0] = dsp_mul( samples[0], FQ(0.02) ); // Compensate for preamp gain.
 
+    for( int ii = 0; ii < 3; ++ii ) dsp_ramp( _preamp_amp_coeff[ii], _preamp_amp_ramp[ii] );
+
     if( property[0] == 1 ) volume = property[1];
     
-    if( property[0] == 0x11 ) memcpy( _preamp_amp1_coeff+ 0, property+1, 20 );
-    if( property[0] == 0x12 ) memcpy( _preamp_amp1_coeff+ 6, property+1, 20 );
-    if( property[0] == 0x13 ) memcpy( _preamp_amp1_coeff+12, property+1, 20 );
-    
-    if( property[0] == 0x21 ) memcpy( _preamp_amp2_coeff+ 0, property+1, 20 );
-    if( property[0] == 0x22 ) memcpy( _preamp_amp2_coeff+ 6, property+1, 20 );
-    if( property[0] == 0x23 ) memcpy( _preamp_amp2_coeff+12, property+1, 20 );
-    
-    if( property[0] == 0x31 ) memcpy( _preamp_amp3_coeff+ 0, property+1, 20 );
-    if( property[0] == 0x32 ) memcpy( _preamp_amp3_coeff+ 6, property+1, 20 );
-    if( property[0] == 0x33 ) memcpy( _preamp_amp3_coeff+12, property+1, 20 );
+    int ii = (property[0] >> 4) - 1, jj = (property[0] & 15) - 1; // 0xS1-0xS3 for stage S
+    if( ii >= 0 && ii < 3 && jj >= 0 && jj < 3 ) {
+        dsp_bank_stage( _preamp_amp_bank[ii], property+1, 6*jj, jj ? 5 : 4 );
+        if( jj == 0 && dsp_bank_commit( _preamp_amp_bank[ii], property[5] ) )
+            dsp_ramp_set( _preamp_amp_coeff[ii], _preamp_amp_ramp[ii], dsp_bank(_preamp_amp_bank[ii]),
+                          PREAMP_RAMP );
+    }
 }
 
-int _preamp_gain_lut[47003] =
+int _preamp_gain_lut[2+43703] =
 {
+    16, 43703, // Index bits and curve length
     FQ(-0.999999),FQ(-0.999999),FQ(-0.999999),FQ(-0.999998),FQ(-0.999996),FQ(-0.999993),FQ(-0.999989),FQ(-0.999986),
     FQ(-0.999983),FQ(-0.999979),FQ(-0.999976),FQ(-0.999973),FQ(-0.999970),FQ(-0.999966),FQ(-0.999963),FQ(-0.999960),
     FQ(-0.999956),FQ(-0.999953),FQ(-0.999950),FQ(-0.999946),FQ(-0.999943),FQ(-0.999940),FQ(-0.999936),FQ(-0.999933),
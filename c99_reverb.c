@@ -1,6 +1,7 @@
-//////////////////////////////////////////////////////////////////////////////////////////////////
-// NOT FINSISHED
-//////////////////////////////////////////////////////////////////////////////////////////////////
+// Stereo reverb based on an 8-line feedback delay network (FDN) with settings for pre-delay, room
+// size, decay time, damping, input diffusion, delay modulation depth and rate, stereo width, and
+// wet/dry blending. Three bypass-switch controlled parameters, USB/MIDI/HTML control, and
+// parameter-set morphing.
 
 #include <math.h>
 #include <string.h>
@@ -22,19 +23,86 @@ const int i2s_channel_count     = 2; // Channels per SDIN/SDOUT wire (2,4,or 8)
 
 const int i2s_sync_word[8] = { 0xFFFFFFFF,0x00000000,0,0,0,0,0,0 };
 
-const char* control_labels[11] = { "C99 Reverb",
-                                   "","","","","","","","","",
-                                   "Output Volume" };
+const char* control_labels[21] = { "C99 Reverb",
+                                   "Pre-Delay", "Room Size", "Decay Time",
+                                   "Damping", "Diffusion",
+                                   "Mod Depth", "Mod Rate",
+                                   "Stereo Width", "Dry/Wet Mix",
+                                   "Output Volume",
+                                   "","","","","","","","","","" };
+
+/*
+                   +----------------------------------------------+
+                   |                                              |
+                   |      +--> Line 0 --> Damping --+             |
+input L/R --> Pre-Delay --+--> ...  (8 lines)  ...  +--> Hadamard -+
+              Diffusion   +--> Line 7 --> Damping --+
+                                  |
+                                  +--> Output taps --> Width --> Mixer --> output L/R
+
+  Thread 1: Pre-delay and input diffusion (two series allpasses per channel)
+  Thread 2: FDN - 8 delay line reads (4 modulated), damping, 8x8 Hadamard feedback and writes
+  Thread 3: Wet signal low-cut and stereo width
+  Thread 4: Delay modulation LFO (quadrature, one phase per modulated line)
+  Thread 5: Wet/dry blend, output volume and property updates
+*/
+
+// Delay line lengths (samples at 48 kHz, mutually prime, scaled by the room size) and line storage.
+// Lines 0 to 3 are modulated by up to 2*REVERB_MOD_MAX samples (linear interpolation).
+
+#define REVERB_MOD_MAX 8
+
+const int _reverb_length[8] = { 1031, 1153, 1277, 1399, 1523, 1657, 1787, 1931 };
+
+int _reverb_line[8][2+2048], _reverb_delay[8];
+int _reverb_damp_coeff[8][4], _reverb_damp_state[8][2];
+int _reverb_predelay[2][2+4096], _reverb_diffuse[4][2+256];
+int _reverb_lowcut_state[2][3];
+
+int _reverb_volume = 0, _reverb_blend = 0, _reverb_width = FQ(1.0);
+int _reverb_pre = 0, _reverb_diff = 0, _reverb_gain[8], _reverb_damp = 0;
+int _reverb_mod[4], _reverb_depth = 0, _reverb_rate = 0;
+int _reverb_lfo[1+6*2]; // Quadrature LFO (sine and cosine NCO's)
+
+const int _reverb_diffuse_length[4] = { 142, 107, 151, 113 };
 
 void c99_control( const double parameters[20], int property[6] )
 {
 	static int state = 1;
 
-    if( state == 1 ) // Volume, Gain
+    double fs    = audio_sample_rate;
+    double size  = 0.4 + 0.6 * parameters[1];               // Delay line scale
+    double decay = 0.3 * pow( 8.0 / 0.3, parameters[2] );  // RT60 seconds, 0.3 to 8.0
+    double gg[8];
+
+    for( int ii = 0; ii < 8; ++ii ) gg[ii] = pow( 10, -3.0 * _reverb_length[ii] * size / (fs * decay) );
+
+    if( state == 1 ) // Volume, blend, width, pre-delay, diffusion
+    {
+        property[0] = state; state = 2;
+        property[1] = FQ( 0.25 + 0.75 * parameters[9] ); // Volume
+        property[2] = FQ( parameters[8] );              // Wet/dry mix
+        property[3] = FQ( parameters[7] );              // Stereo width
+        property[4] = (int)( parameters[0] * 0.080 * fs ); // Pre-delay in samples (0 to 80 ms)
+        property[5] = FQ( 0.7 * parameters[4] );        // Diffusion (allpass coefficient)
+    }
+    else if( state == 2 ) // Line gains 0-4
+    {
+        property[0] = state; state = 3;
+        for( int ii = 0; ii < 5; ++ii ) property[1+ii] = FQ( gg[ii] );
+    }
+    else if( state == 3 ) // Line gains 5-7, damping, room size
     {
-        property[0] = state; state = 0x11;
-        property[1] = FQ( volume_min + param_volume * (volume_max - volume_min) );
-        property[2] = FQ( exp(10, (-24.0 * (max_gain/100.0-0.5)) ));
+        property[0] = state; state = 4;
+        for( int ii = 5; ii < 8; ++ii ) property[1+ii-5] = FQ( gg[ii] );
+        property[4] = FQ( 0.7 * parameters[3] ); // Damping (one-pole low-pass in each line)
+        property[5] = FQ( size );
+    }
+    else if( state == 4 ) // Modulation depth and rate
+    {
+        property[0] = state; state = 1;
+        property[1] = (int)( parameters[5] * REVERB_MOD_MAX * 65536 ); // Depth, samples Q16
+        property[2] = FQ( (0.1 + 1.9 * parameters[6]) / fs );         // Rate, cycles per sample
     }
 }
 
@@ -42,101 +110,120 @@ void c99_mixer( const int usb_output[32], int usb_input[32],
                 const int adc_output[32], int dac_input[32],
                 const int dsp_output[32], int dsp_input[32], const int property[6] )
 {
+    dsp_input[1] = adc_output[1] / 8; // Stereo input and output
+    dac_input[0] = dsp_output[0] * 8;
+    dac_input[1] = dsp_output[1] * 8;
 }
 
-inline int _comb_filterL( int xx, int ii, int nn ) // yy[k] = xx[k] + g1*xx[k-M1] - g2*yy[k-M2]
+void xio_initialize( void )
 {
-    ii = (_comb_delays[nn] + ii) & 2047; // Index into sample delay FIFO
-    int yy = _comb_bufferL[nn][ii];
-    _comb_stateL[nn] = dsp_multiply( yy, FQ(1.0) - _comb_damping )
-                     + dsp_multiply( _comb_stateL[nn], _comb_damping );
-    _comb_bufferL[nn][ii] = xx + dsp_multiply( _comb_stateL[nn], _comb_feedbk );
-    return yy;
+    for( int ii = 0; ii < 8; ++ii ) {
+        dsp_delay_init( _reverb_line[ii], 2048 );
+        _reverb_delay[ii] = _reverb_length[ii];
+        _reverb_gain[ii] = 0;
+    }
+    for( int ii = 0; ii < 2; ++ii ) dsp_delay_init( _reverb_predelay[ii], 4096 );
+    for( int ii = 0; ii < 4; ++ii ) dsp_delay_init( _reverb_diffuse[ii], 256 );
+    memset( _reverb_damp_coeff,   0, sizeof(_reverb_damp_coeff) );
+    memset( _reverb_damp_state,   0, sizeof(_reverb_damp_state) );
+    memset( _reverb_lowcut_state, 0, sizeof(_reverb_lowcut_state) );
+    memset( _reverb_mod,          0, sizeof(_reverb_mod) );
+    dsp_nco_init( _reverb_lfo, 2 );
 }
 
-inline int _comb_filterR( int xx, int ii, int nn ) // yy[k] = xx[k] + g1*xx[k-M1] - g2*yy[k-M2]
-{
-    ii = (_comb_delays[nn] + ii + _stereo_spread) & 2047; // Index into sample delay FIFO
-    int yy = _comb_bufferR[nn][ii];
-    _comb_stateR[nn] = dsp_multiply( yy, FQ(1.0) - _comb_damping )
-                     + dsp_multiply( _comb_stateR[nn], _comb_damping );
-    _comb_bufferR[nn][ii] = xx + dsp_multiply( _comb_stateR[nn], _comb_feedbk );
-    return yy;
-}
+// Schroeder allpass, y[n] = -g*w[n] + w[n-N] with w[n] = x[n] + g*w[n-N].
 
-inline int _allpass_filterL( int xx, int ii, int nn ) // yy[k] = xx[k] + g * xx[k-M] - g * xx[k]
+static inline int _reverb_allpass( int xx, int* dl, int nn, int gg )
 {
-    ii = (_allpass_delays[nn] + ii) & 1023; // Index into sample delay FIFO
-    int yy = _allpass_bufferL[nn][ii] - xx;
-    _allpass_bufferL[nn][ii] = xx + dsp_multiply( _allpass_bufferL[nn][ii], _allpass_feedbk );
-    return yy;
+    int zz = _dsp_delay_read( dl, nn-1 ), ww = xx + dsp_mul( gg, zz );
+    _dsp_delay_write( dl, ww );
+    return zz - dsp_mul( gg, ww );
 }
 
-inline int _allpass_filterR( int xx, int ii, int nn ) // yy[k] = xx[k] + g * xx[k-M] - g * xx[k]
+void c99_thread1( int samples[32], const int property[6] )
 {
-    ii = (_allpass_delays[nn] + ii + _stereo_spread) & 1023; // Index into sample delay FIFO
-    int yy = _allpass_bufferR[nn][ii] - xx;
-    _allpass_bufferR[nn][ii] = xx + dsp_multiply( _allpass_bufferR[nn][ii], _allpass_feedbk );
-    return yy;
+    for( int ch = 0; ch < 2; ++ch )
+    {
+        _dsp_delay_write( _reverb_predelay[ch], samples[ch] );
+        int xx = _dsp_delay_read( _reverb_predelay[ch], _reverb_pre ) / 4; // Headroom in the FDN
+        xx = _reverb_allpass( xx, _reverb_diffuse[2*ch+0], _reverb_diffuse_length[2*ch+0], _reverb_diff );
+        xx = _reverb_allpass( xx, _reverb_diffuse[2*ch+1], _reverb_diffuse_length[2*ch+1], _reverb_diff );
+        samples[2+ch] = xx;
+    }
 }
 
-void xio_initialize( void )
+void c99_thread2( int samples[32], const int property[6] )
 {
-    memset( _comb_bufferL, 0, sizeof(_comb_bufferL) );
-    memset( _comb_stateL,  0, sizeof(_comb_stateL) );
-    memset( _comb_bufferR, 0, sizeof(_comb_bufferR) );
-    memset( _comb_stateR,  0, sizeof(_comb_stateR) );
-}
-
-int _reverb_volume = 0;
+    int yy[8], zz[8], aa, bb, ii;
 
-int _comb_buffer   [8][2048]; // Delay lines for comb filters
-int _comb_state    [8];       // Comb filter state (previous value)
-int _allpass_buffer[4][1024]; // Delay lines for allpass filters
+    for( ii = 0; ii < 4; ++ii ) { // Modulated lines, delay in Q16
+        int dd = (_reverb_delay[ii] << 16) + _reverb_mod[ii];
+        yy[ii] = _dsp_delay_lin( _reverb_line[ii], dd >> 16, (dd & 0xFFFF) << (QQ-16) );
+    }
+    for( ii = 4; ii < 8; ++ii ) yy[ii] = _dsp_delay_read( _reverb_line[ii], _reverb_delay[ii] );
 
-int _allpass_feedbk    = FQ(0.5); // Reflection decay/dispersion
-int _stereo_spread     = 23;      // Buffer index spread for stereo separation
-int _comb_delays   [8] = { 1116, 1188, 1277, 1356, 1422, 1491, 1557, 1617 }; // From FreeVerb
-int _allpass_delays[8] = { 556, 441, 341, 225 }; // From FreeVerb
+    samples[4] = yy[0] - yy[2] + yy[4] - yy[6]; // Output taps (decorrelated left and right)
+    samples[5] = yy[1] - yy[3] + yy[5] - yy[7];
 
-int _wet_dry_blend  = FQ(0.2); // Parameter: Wet/dry mix setting (0.0=dry)
-int _stereo_width   = FQ(0.2); // Parameter: Stereo width setting
-int _comb_damping   = FQ(0.2); // Parameter: Reflection damping factor (aka 'reflectivity')
-int _comb_feedbk    = FQ(0.2); // Parameter: Reflection feedback ratio (aka 'room size')
+    for( ii = 0; ii < 8; ++ii ) { // Damping and decay (includes the 1/sqrt(8) Hadamard scale)
+        zz[ii] = yy[ii]; _dsp_iir1( zz[ii], _reverb_damp_coeff[ii], _reverb_damp_state[ii] );
+    }
+    for( int ss = 1; ss < 8; ss *= 2 ) { // Fast Walsh-Hadamard transform (24 adds, orthogonal)
+        for( ii = 0; ii < 8; ++ii ) if( !(ii & ss) ) {
+            aa = zz[ii]; bb = zz[ii+ss]; zz[ii] = aa + bb; zz[ii+ss] = aa - bb;
+        }
+    }
+    for( ii = 0; ii < 8; ++ii ) {
+        _dsp_delay_write( _reverb_line[ii], zz[ii] + samples[2 + (ii & 1)] );
+    }
+}
 
-void xio_thread1( int samples[32], const int property[6] )
+void c99_thread3( int samples[32], const int property[6] )
 {
-    static int index = 0; ++index; // Used to index into the sample FIFO delay buffer
-    // Eight parallel comb filters ...
-    samples[2] = _comb_filterL( samples[0]/8, index, 0 ) + _comb_filterL( samples[0]/8, index, 1 )
-               + _comb_filterL( samples[0]/8, index, 2 ) + _comb_filterL( samples[0]/8, index, 3 )
-               + _comb_filterL( samples[0]/8, index, 4 ) + _comb_filterL( samples[0]/8, index, 5 )
-               + _comb_filterL( samples[0]/8, index, 6 ) + _comb_filterL( samples[0]/8, index, 7 );
-    // Four series all-pass filters ...
-    samples[2] = _allpass_filterL( samples[2], index, 0 );
-    samples[2] = _allpass_filterL( samples[2], index, 1 );
-    samples[2] = _allpass_filterL( samples[2], index, 2 );
-    samples[2] = _allpass_filterL( samples[2], index, 3 );
+    int ml, sd;
+    _dsp_dcblock( samples[4], FQ(0.995), _reverb_lowcut_state[0] ); // Low-cut at ~40 Hz
+    _dsp_dcblock( samples[5], FQ(0.995), _reverb_lowcut_state[1] );
+    ml = (samples[4] + samples[5]) / 2;
+    sd = dsp_mul( (samples[4] - samples[5]) / 2, _reverb_width );
+    samples[4] = ml + sd; samples[5] = ml - sd;
 }
 
-void xio_thread2( int samples[32], const int property[6] )
+void c99_thread4( int samples[32], const int property[6] )
 {
+    int lfo[2], ss, cc;
+    _dsp_nco( _reverb_lfo, lfo );
+    ss = dsp_mul( lfo[0], _reverb_depth );
+    cc = dsp_mul( lfo[1], _reverb_depth );
+    _reverb_mod[0] = _reverb_depth + ss; _reverb_mod[1] = _reverb_depth + cc;
+    _reverb_mod[2] = _reverb_depth - ss; _reverb_mod[3] = _reverb_depth - cc;
 }
 
-void xio_thread3( int samples[32], const int property[6] ) {}
-void xio_thread4( int samples[32], const int property[6] ) {}
-
-void xio_thread5( int samples[32], const int property[6] )
+void c99_thread5( int samples[32], const int property[6] )
 {
+    samples[0] = dsp_blend( samples[0], samples[4], _reverb_blend );
+    samples[1] = dsp_blend( samples[1], samples[5], _reverb_blend );
     samples[0] = dsp_mul( samples[0], _reverb_volume );
+    samples[1] = dsp_mul( samples[1], _reverb_volume );
 
-    if( property[0] == 1 ) _reverb_volume = property[1];
-    if( property[0] == 2 ) {
+    if( property[0] == 1 ) {
+        _reverb_volume = property[1]; _reverb_blend = property[2]; _reverb_width = property[3];
+        _reverb_pre = property[4] < 4093 ? property[4] : 4093; _reverb_diff = property[5];
     }
+    if( property[0] == 2 ) for( int ii = 0; ii < 5; ++ii ) _reverb_gain[ii] = property[1+ii];
     if( property[0] == 3 ) {
+        for( int ii = 5; ii < 8; ++ii ) _reverb_gain[ii] = property[1+ii-5];
+        _reverb_damp = property[4];
+        for( int ii = 0; ii < 8; ++ii ) {
+            _reverb_delay[ii] = dsp_mul( _reverb_length[ii], property[5] );
+            _reverb_damp_coeff[ii][0] = dsp_mul( dsp_mul( _reverb_gain[ii], FQ(1.0) - _reverb_damp ),
+                                                 FQ(0.35355339059) ); // 1/sqrt(8)
+            _reverb_damp_coeff[ii][1] = 0;
+            _reverb_damp_coeff[ii][2] = _reverb_damp;
+        }
     }
     if( property[0] == 4 ) {
+        _reverb_depth = property[1]; _reverb_rate = property[2];
+        dsp_nco_set( _reverb_lfo, 0, DSP_NCO_SINE, _reverb_rate, 0 );
+        dsp_nco_set( _reverb_lfo, 1, DSP_NCO_SINE, _reverb_rate, FQ(0.25) );
     }
-    
-    _delay_fback = 0; _delay_regen = 0;
 }
@@ -1,18 +1,28 @@
 #include <math.h>
 #include <string.h>
+#ifndef DSP_HOST
 #include <xccompat.h>
 #include <xs1.h>
+#endif
 
 #include "xio.h"
 #include "dsp.h"
 #include "dsp.i"
 
+extern int dsp_mul( int xx, int yy );
+extern int dsp_mac( int xx, int yy, int zz );
+extern int dsp_ext( int ah, int al );
+extern int dsp_sine( const int* tt, int nn, int ii );
+extern int dsp_sine_10( int ii );
+extern int dsp_sine_12( int ii );
+extern int dsp_sine_14( int ii );
+
 static double pi = 3.14159265359;
 
 #define RR (1<<(QQ-1))
 
 int  math_random (int gg, int seed);
-//int  math_sqr_x  (int xx)
+int  math_sqr_x  (int xx)                                      {return _math_sqr_x(xx);}
 int  math_min_X  (const int* xx,int nn)                       {return _math_min_X(xx,nn);}
 int  math_max_X  (const int* xx,int nn)                       {return _math_max_X(xx,nn);}
 int  math_avg_X  (const int* xx,int nn)                       {return _math_avg_X(xx,nn);}
@@ -33,26 +43,111 @@ void math_mac_XYZ(int* xx,const int* yy,const int* zz,int nn) {_math_mac_XYZ(xx,
 
 int math_random( int xx, int seed )
 {
-    asm("crc32 %0,%2,%3":"=r"(xx):"0"(xx),"r"(seed),"r"(0xEB31D82E));
+    DSP_CRC32( xx, seed, 0xEB31D82E );
     return xx;
 }
 
 int dsp_blend( int dry, int wet, int blend ) // 0 (100% dry) <= MM <= 1 (100% wet)
 {
     int ah = 0; unsigned al = 1<<(QQ-1);
-    asm("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(dry),"r"(FQ(1.0)-blend),"0"(ah),"1"(al) );
-    asm("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(wet),"r"(blend),"0"(ah),"1"(al) );
-    asm("lextract %0,%1,%2,%3,32":"=r"(ah):"r"(ah),"r"(al),"r"(QQ));
+    DSP_MACCS( ah, al, dry, FQ(1.0)-blend, ah, al );
+    DSP_MACCS( ah, al, wet, blend, ah, al );
+    DSP_LEXTRACT( ah, ah, al, QQ );
     return ah;
 }
 
 int dsp_envelope( int xx, int kk, int* ss ) { int yy; _dsp_envelope(yy,xx,kk,ss); return yy; }
 int dsp_dcblock ( int xx, int kk, int* ss ) {_dsp_dcblock(xx,kk,ss); return xx; }
+void dsp_dynamics( int* xx,const int* cc,int* ss,int nn ) {_dsp_dynamics(xx,cc,ss,nn);}
+int dsp_interp  ( int xx,int a,int b)       { int yy; _dsp_interp(yy,xx,a,b); return yy; }
 int dsp_lagrange( int xx,int a,int b,int c) { int yy; _dsp_lagrange(yy,xx,a,b,c); return yy; }
 
+void dsp_delay_init( int* dl, int nn )
+{
+    dl[0] = nn - 1; dl[1] = 0;
+    memset( dl+2, 0, nn * sizeof(int) );
+}
+
+void dsp_delay_write( int* dl, int xx )                    { _dsp_delay_write( dl, xx ); }
+int  dsp_delay_read ( const int* dl, int dd )              { return _dsp_delay_read( dl, dd ); }
+int  dsp_delay_lin  ( const int* dl, int dd, int ff )      { return _dsp_delay_lin( dl, dd, ff ); }
+int  dsp_delay_lagr ( const int* dl, int dd, int ff )      { return _dsp_delay_lagr( dl, dd, ff ); }
+int  dsp_delay_herm ( const int* dl, int dd, int ff )      { return _dsp_delay_herm( dl, dd, ff ); }
+int  dsp_delay_allp ( const int* dl, int dd, int ff, int* ss ) { return _dsp_delay_allp(dl,dd,ff,ss); }
+void dsp_delay_taps ( const int* dl, int* xx, const int* dd, int nn ) { _dsp_delay_taps(dl,xx,dd,nn); }
+void dsp_delay_write_block( int* dl, const int* xx, int bb ) { _dsp_delay_write_block( dl, xx, bb ); }
+void dsp_delay_read_block ( const int* dl, int* xx, int dd, int bb )
+                                                           { _dsp_delay_read_block( dl, xx, dd, bb ); }
+
 int  dsp_fir   (int  xx,const int* cc,int* ss,int nn)        {return _dsp_fir(xx,cc,ss,nn);}
 void dsp_fir_up(int* xx,const int* cc,int* ss,int nn,int rr) {_dsp_fir_up(xx,cc,ss,nn,rr);}
 void dsp_fir_dn(int* xx,const int* cc,int* ss,int nn,int rr) {_dsp_fir_dn(xx,cc,ss,nn,rr);}
+int  dsp_fir_sym(int xx,const int* cc,int* ss,int nn)        {return _dsp_fir_sym(xx,cc,ss,nn);}
+void dsp_fir_dn_sym(int* xx,const int* cc,int* ss,int nn,int rr) {_dsp_fir_dn_sym(xx,cc,ss,nn,rr);}
+void dsp_cic_up(int* xx,const int* cc,int* ss,int nn,int rr) {_dsp_cic_up(xx,cc,ss,nn,rr);}
+void dsp_cic_dn(int* xx,const int* cc,int* ss,int nn,int rr) {_dsp_cic_dn(xx,cc,ss,nn,rr);}
+void dsp_fir_block(int* xx,const int* cc,int* ss,int nn,int bb)    {_dsp_fir_block(xx,cc,ss,nn,bb);}
+void dsp_biquad_block(int* xx,const int* cc,int* ss,int nn,int bb) {_dsp_biquad_block(xx,cc,ss,nn,bb);}
+void dsp_biquad_multi(int* xx,const int* cc,int* ss,int nn,int ch) {_dsp_biquad_multi(xx,cc,ss,nn,ch);}
+void dsp_halfband_up(int* xx,const int* cc,int* ss,int nn)  {_dsp_halfband_up(xx,cc,ss,nn);}
+void dsp_halfband_dn(int* xx,const int* cc,int* ss,int nn)  {_dsp_halfband_dn(xx,cc,ss,nn);}
+
+// 31-tap half-band filter used for the 2nd and 3rd stages of the oversampling cascades. Pass-band
+// edge is 0.125 (0.0625) of the stage output rate with 112 dB (120 dB) stop-band attenuation.
+
+int dsp_halfband_31[8] =
+{
+    FQ(-0.000001807),FQ(+0.000110336),FQ(-0.000889005),FQ(+0.003976526),
+    FQ(-0.012820920),FQ(+0.033989997),FQ(-0.084988751),FQ(+0.310623624)
+};
+
+// Oversampling cascades. The first half-band stage (CC, NN) sets the pass-band and runs at the
+// lowest rate, the following stages (at 4x and 8x) use 'dsp_halfband_31'. Stage states follow each
+// other in SS: 2*NN (+16 per extra stage) for up-sampling and 3*NN (+24 per extra stage) for
+// dn-sampling. XX[0] is the newest sample (like 'dsp_fir_up' and 'dsp_fir_dn').
+
+void dsp_oversample2x_up( int* xx, const int* cc, int* ss, int nn )
+{
+    _dsp_halfband_up( xx, cc, ss, nn );
+}
+
+void dsp_oversample4x_up( int* xx, const int* cc, int* ss, int nn )
+{
+    _dsp_halfband_up( xx, cc, ss, nn ); ss += 2*nn;
+    xx[2] = xx[1]; _dsp_halfband_up( xx+2, dsp_halfband_31, ss, 8 );
+                   _dsp_halfband_up( xx+0, dsp_halfband_31, ss, 8 );
+}
+
+void dsp_oversample8x_up( int* xx, const int* cc, int* ss, int nn )
+{
+    dsp_oversample4x_up( xx, cc, ss, nn ); ss += 2*nn + 16;
+    xx[6] = xx[3]; _dsp_halfband_up( xx+6, dsp_halfband_31, ss, 8 );
+    xx[4] = xx[2]; _dsp_halfband_up( xx+4, dsp_halfband_31, ss, 8 );
+    xx[2] = xx[1]; _dsp_halfband_up( xx+2, dsp_halfband_31, ss, 8 );
+                   _dsp_halfband_up( xx+0, dsp_halfband_31, ss, 8 );
+}
+
+void dsp_oversample2x_dn( int* xx, const int* cc, int* ss, int nn )
+{
+    _dsp_halfband_dn( xx, cc, ss, nn );
+}
+
+void dsp_oversample4x_dn( int* xx, const int* cc, int* ss, int nn )
+{
+    _dsp_halfband_dn( xx+2, dsp_halfband_31, ss + 3*nn, 8 );
+    _dsp_halfband_dn( xx+0, dsp_halfband_31, ss + 3*nn, 8 ); xx[1] = xx[2];
+    _dsp_halfband_dn( xx, cc, ss, nn );
+}
+
+void dsp_oversample8x_dn( int* xx, const int* cc, int* ss, int nn )
+{
+    _dsp_halfband_dn( xx+6, dsp_halfband_31, ss + 3*nn + 24, 8 );
+    _dsp_halfband_dn( xx+4, dsp_halfband_31, ss + 3*nn + 24, 8 );
+    _dsp_halfband_dn( xx+2, dsp_halfband_31, ss + 3*nn + 24, 8 );
+    _dsp_halfband_dn( xx+0, dsp_halfband_31, ss + 3*nn + 24, 8 );
+    xx[1] = xx[2]; xx[2] = xx[4]; xx[3] = xx[6];
+    dsp_oversample4x_dn( xx, cc, ss, nn );
+}
 
 void mix_fir_coeffs( int* upsample_cc, int* fir_cc, int nn, int rr )
 {
@@ -66,6 +161,92 @@ void mix_fir_coeffs( int* upsample_cc, int* fir_cc, int nn, int rr )
 
 void dsp_statevar( int* xx, const int* cc, int* ss ) { _dsp_statevar(xx,cc,ss); }
 
+int dsp_tanh_poly3( int xx ) { return _dsp_tanh_poly3( xx ); }
+int dsp_tanh_poly5( int xx ) { return _dsp_tanh_poly5( xx ); }
+int dsp_tanh_poly7( int xx ) { return _dsp_tanh_poly7( xx ); }
+int dsp_atan_poly ( int xx ) { return _dsp_atan_poly ( xx ); }
+int dsp_exp2_poly ( int xx ) { return _dsp_exp2_poly ( xx ); }
+int dsp_sin_poly  ( int xx ) { return _dsp_sin_poly  ( xx ); }
+
+int dsp_log2      ( int xx ) { return _dsp_log2      ( xx ); }
+int dsp_exp2      ( int xx ) { return _dsp_exp2      ( xx ); }
+int dsp_db_to_lin ( int xx ) { return _dsp_db_to_lin ( xx ); }
+int dsp_lin_to_db ( int xx ) { return _dsp_lin_to_db ( xx ); }
+
+void dsp_nco_init( int* nc, int nn )
+{
+    memset( nc, 0, (1+6*nn) * sizeof(int) ); nc[0] = nn;
+    for( int ii = 0; ii < nn; ++ii ) nc[6+6*ii] = 0x5EED0000 + ii; // Random state (HOLD)
+}
+
+void dsp_nco_set( int* nc, int ii, int shape, int rate, int offset )
+{
+    int* oo = nc + 1 + 6*ii;
+    oo[1] = rate % (1<<QQ); oo[2] = offset & ((1<<QQ)-1); oo[3] = shape; // Rate keeps its sign
+}
+
+void dsp_nco( int* nc, int* yy ) { _dsp_nco( nc, yy ); }
+
+int dsp_waveshaper( int xx, const int* lut, const int* cc, int* ss, int ff )
+{
+    return _dsp_waveshaper( xx, lut, cc, ss, ff );
+}
+
+int* dsp_bank( int* bk ) { return _dsp_bank( bk ); }
+
+void dsp_bank_init( int* bk, const int* cc, int nn )
+{
+    bk[0] = 0; bk[1] = nn;
+    for( int ii = 0; ii < nn; ++ii ) bk[2+ii] = bk[2+nn+ii] = cc[ii];
+}
+
+void dsp_bank_stage( int* bk, const int* xx, int ii, int nn )
+{
+    int* cc = bk + 2 + (1-bk[0]) * bk[1] + ii;
+    for( int jj = 0; jj < nn; ++jj ) cc[jj] = xx[jj];
+}
+
+int dsp_bank_sum( const int* cc, int nn )
+{
+    int cs = -1;
+    for( int ii = 0; ii < nn; ++ii ) DSP_CRC32( cs, cc[ii], 0xEB31D82E );
+    return cs;
+}
+
+// Make the staging bank active if it holds the complete set with check-sum CS. The new active bank
+// is copied to the (now) staging bank so that later properties update the latest complete set.
+
+int dsp_bank_commit( int* bk, int cs )
+{
+    int nn = bk[1], *cc = bk + 2 + (1-bk[0]) * nn, *dd = bk + 2 + bk[0] * nn;
+    if( dsp_bank_sum( cc, nn ) != cs ) return 0;
+    bk[0] = 1 - bk[0];
+    for( int ii = 0; ii < nn; ++ii ) dd[ii] = cc[ii];
+    return 1;
+}
+
+void dsp_ramp( int* cc, int* rr ) { _dsp_ramp( cc, rr ); }
+
+void dsp_ramp_init( int* cc, int* rr, int nn )
+{
+    rr[0] = nn; rr[1] = 0;
+    for( int ii = 0; ii < nn; ++ii ) rr[2+ii] = cc[ii];
+}
+
+// Start a new ramp from the current coefficients towards TT. The increments are (TT-CC)/2^SS so no
+// division is needed, the remainder is taken up by the final step. Linear interpolation between
+// two stable bi-quads is stable (the A1/A2 stability triangle is convex). Restarting a ramp that
+// is still running is fine - it continues from wherever the coefficients happen to be.
+
+void dsp_ramp_set( int* cc, int* rr, const int* tt, int ss )
+{
+    int nn = rr[0];
+    for( int ii = 0; ii < nn; ++ii ) {
+        rr[2+ii] = tt[ii]; rr[2+nn+ii] = (tt[ii] - cc[ii]) >> ss;
+    }
+    rr[1] = 1 << ss;
+}
+
 int dsp_iir1( int xx, const int* cc, int* ss ) { _dsp_iir1( xx, cc, ss ); return xx; }
 int dsp_iir2( int xx, const int* cc, int* ss ) { _dsp_iir2( xx, cc, ss ); return xx; }
 int dsp_iir3( int xx, const int* cc, int* ss ) { _dsp_iir3( xx, cc, ss ); return xx; }
@@ -87,18 +268,18 @@ int dsp_biquad( int xx, const int* cc, int* ss, int nn )
 }
 
 #define _CONVOLVE_2a(nn) \
-    asm("ldd   %0,%1,%2[%3]":"=r"(b1),"=r"(b0):"r"(cc),"r"(nn)); \
-    asm("ldd   %0,%1,%2[%3]":"=r"(s2),"=r"(s1):"r"(ss),"r"(nn)); \
-    asm("std   %0,%1,%2[%3]"::"r"(s1), "r"(s0),"r"(ss),"r"(nn)); \
-    asm("maccs %0,%1,%2,%3" :"=r"(ah),"=r"(al):"r"(b0),"r"(s0), "0"(ah),"1"(al)); \
-    asm("maccs %0,%1,%2,%3" :"=r"(ah),"=r"(al):"r"(b1),"r"(s1), "0"(ah),"1"(al));
+    DSP_LDD( b1, b0, cc, nn ); \
+    DSP_LDD( s2, s1, ss, nn ); \
+    DSP_STD( s1, s0, ss, nn ); \
+    DSP_MACCS( ah, al, b0, s0, ah, al ); \
+    DSP_MACCS( ah, al, b1, s1, ah, al );
 
 #define _CONVOLVE_2b(nn) \
-    asm("ldd   %0,%1,%2[%3]":"=r"(b1),"=r"(b0):"r"(cc),"r"(nn)); \
-    asm("ldd   %0,%1,%2[%3]":"=r"(s0),"=r"(s3):"r"(ss),"r"(nn)); \
-    asm("std   %0,%1,%2[%3]"::"r"(s3), "r"(s2),"r"(ss),"r"(nn)); \
-    asm("maccs %0,%1,%2,%3" :"=r"(ah),"=r"(al):"r"(b0),"r"(s2), "0"(ah),"1"(al)); \
-    asm("maccs %0,%1,%2,%3" :"=r"(ah),"=r"(al):"r"(b1),"r"(s3), "0"(ah),"1"(al));
+    DSP_LDD( b1, b0, cc, nn ); \
+    DSP_LDD( s0, s3, ss, nn ); \
+    DSP_STD( s3, s2, ss, nn ); \
+    DSP_MACCS( ah, al, b0, s2, ah, al ); \
+    DSP_MACCS( ah, al, b1, s3, ah, al );
 
 #define _CONVOLVE_24 \
 { \
@@ -114,6 +295,413 @@ int dsp_convolve( int xx, const int* cc, int* ss, int* ah_, int* al_, int nn )
     *ah_ = ah; *al_ = al; return s0;
 }
 
+// Block convolution. XX holds BB samples in time order (XX[0] is the oldest), AH/AL hold the BB
+// accumulators. On return XX holds the BB samples shifted out of this segment (the input for the
+// next segment, like the return value of 'dsp_convolve'). SS length is NN*24+BB.
+
+void dsp_convolve_block( int* xx, const int* cc, int* ss, int* ah, int* al, int nn, int bb )
+{
+    int ii, aa[2], ab[2];
+    memmove( ss+bb, ss, 4*24*nn );
+    for( ii = 0; ii < bb; ++ii ) ss[ii] = xx[bb-1-ii];
+    for( ii = bb-1; ii > 0; ii -= 2 ) {
+        aa[0] = ah[ii-0]; aa[1] = al[ii-0]; ab[0] = ah[ii-1]; ab[1] = al[ii-1];
+        _fir_pair( cc, ss+bb-1-ii, 24*nn, aa, ab );
+        ah[ii-0] = aa[0]; al[ii-0] = aa[1]; ah[ii-1] = ab[0]; al[ii-1] = ab[1];
+    }
+    for( ii = 0; ii < bb; ++ii ) xx[ii] = ss[24*nn+bb-1-ii];
+}
+
+// Fixed-point FFT with block floating point scaling. Complex data is interleaved (re,im) and must
+// be 64-bit aligned. Before each stage the data is shifted right by 0, 1 or 2 bits (based on the
+// largest magnitude produced by the previous stage) so that no butterfly can overflow; the total
+// shift is returned as the block exponent EE (true result = XX * 2^EE). Twiddle factors are read
+// from 'dsp_sine_14' with a stride of 16384/size (NN <= 16384). Stages 1 and 2 are combined into
+// radix-4 butterflies that need no multiplications.
+//
+// The transforms can be run in pieces (see 'dsp_fftconv'). CS holds the progress of a transform:
+// CS[0] is the step (0=bit reversal, 1=radix-4, 2+=radix-2, 99=done, <0 for the real FFT split),
+// CS[1] the position within the step, CS[2] the OR of magnitudes, CS[3] the block exponent, CS[4]
+// the shift of the current step and CS[5] the bit reversal index. NB is decremented once for each
+// butterfly (or point for bit reversal and split steps) and a transform stops when NB reaches 0.
+
+#define _fft_shift( mm ) ((mm) >= 1<<30 ? 2 : ((mm) >= 1<<29 ? 1 : 0))
+#define _fft_mag( xx ) ((xx) ^ ((xx) >> 31))
+
+#define _fft_step( cs, nb ) \
+if( *nb <= 0 ) return 0; \
+if( cs[1] == 0 ) { cs[4] = _fft_shift( cs[2] ); cs[3] += cs[4]; cs[2] = 0; }
+
+static int _fft_max( const int* xx, int nn ) // Bitwise OR of the magnitudes of XX[0:NN-1]
+{
+    int mm = 0;
+    while( nn-- > 0 ) { mm |= _fft_mag( *xx ); ++xx; }
+    return mm;
+}
+
+static int _fft_run( int* xx, int nn, int inv, int* cs, int* nb )
+{
+    int ii, jj, kk, hh, gg, ng, sh, mm, ah; unsigned al;
+    int ar, ai, br, bi, cr, ci, dr, di, wr, ws, wn, tr, ti;
+
+    if( cs[0] == 0 ) // Bit reversal, collects the magnitude of the input
+    {
+        ii = cs[1]; jj = cs[5]; mm = cs[2];
+        for( ; ii < nn && *nb > 0; ++ii, --*nb ) {
+            if( ii < jj ) {
+                DSP_LDD( ai, ar, xx+2*ii, 0 ); DSP_LDD( bi, br, xx+2*jj, 0 );
+                DSP_STD( bi, br, xx+2*ii, 0 ); DSP_STD( ai, ar, xx+2*jj, 0 );
+            }
+            mm |= _fft_mag( xx[2*ii+0] ) | _fft_mag( xx[2*ii+1] );
+            for( kk = nn >> 1; jj & kk; kk >>= 1 ) jj ^= kk;
+            jj |= kk;
+        }
+        cs[1] = ii; cs[5] = jj; cs[2] = mm;
+        if( ii < nn ) return 0;
+        cs[0] = 1; cs[1] = 0;
+    }
+    if( cs[0] == 1 ) // Stages 1 and 2 (twiddles 1 and -j, +j for the inverse)
+    {
+        _fft_step( cs, nb );
+        ii = cs[1]; sh = cs[4]; mm = cs[2];
+        for( ; ii < nn && *nb > 0; ii += 4, *nb -= 2 )
+        {
+            int* pp = xx + 2*ii;
+            DSP_LDD( ai, ar, pp, 0 ); DSP_LDD( bi, br, pp, 1 );
+            DSP_LDD( ci, cr, pp, 2 ); DSP_LDD( di, dr, pp, 3 );
+            ar >>= sh; ai >>= sh; br >>= sh; bi >>= sh; cr >>= sh; ci >>= sh; dr >>= sh; di >>= sh;
+            tr = ar + br; ti = ai + bi; ar -= br; ai -= bi;
+            br = cr + dr; bi = ci + di; cr -= dr; ci -= di;
+            if( inv ) { dr = -cr; cr = ci; ci = dr; } else { dr = cr; cr = -ci; ci = dr; }
+            DSP_STD( ti+bi, tr+br, pp, 0 ); DSP_STD( ti-bi, tr-br, pp, 2 );
+            DSP_STD( ai-ci, ar-cr, pp, 1 ); DSP_STD( ai+ci, ar+cr, pp, 3 );
+            mm |= _fft_mag(tr+br) | _fft_mag(ti+bi) | _fft_mag(tr-br) | _fft_mag(ti-bi);
+            mm |= _fft_mag(ar-cr) | _fft_mag(ai-ci) | _fft_mag(ar+cr) | _fft_mag(ai+ci);
+        }
+        cs[1] = ii; cs[2] = mm;
+        if( ii < nn ) return 0;
+        cs[0] = 2; cs[1] = 0;
+    }
+    while( cs[0] >= 2 && cs[0] < 99 ) // Radix-2 stages, butterfly span 2*HH, NG groups per twiddle
+    {
+        hh = 4 << (cs[0]-2); ng = nn / (2*hh);
+        if( hh >= nn ) { // Done, 1/NN scaling of the inverse transform
+            cs[0] = 99; cs[1] = 0;
+            if( inv ) for( ii = nn; ii > 1; ii /= 2 ) --cs[3];
+            break;
+        }
+        _fft_step( cs, nb );
+        jj = cs[1]; sh = cs[4]; mm = cs[2];
+        while( jj < nn/2 && *nb > 0 )
+        {
+            kk = jj / ng; gg = jj % ng; ii = kk * (8192 / hh); // W = exp(-j*pi*kk/hh) = wr + j*ws
+            wr = dsp_sine_14( ii+4096 ); ws = inv ? dsp_sine_14( ii ) : -dsp_sine_14( ii );
+            wn = -ws;
+            for( ; gg < ng && *nb > 0; ++gg, ++jj, --*nb )
+            {
+                int* pa = xx + 2*(gg*2*hh+kk); int* pb = pa + 2*hh;
+                DSP_LDD( bi, br, pb, 0 );
+                DSP_MACCS( ah, al, br, wr, 0, 1<<(QQ+sh-1) ); DSP_MACCS( ah, al, bi, wn, ah, al );
+                DSP_LEXTRACT( tr, ah, al, QQ+sh );
+                DSP_MACCS( ah, al, br, ws, 0, 1<<(QQ+sh-1) ); DSP_MACCS( ah, al, bi, wr, ah, al );
+                DSP_LEXTRACT( ti, ah, al, QQ+sh );
+                DSP_LDD( ai, ar, pa, 0 ); ar >>= sh; ai >>= sh;
+                DSP_STD( ai+ti, ar+tr, pa, 0 ); DSP_STD( ai-ti, ar-tr, pb, 0 );
+                mm |= _fft_mag(ar+tr) | _fft_mag(ai+ti) | _fft_mag(ar-tr) | _fft_mag(ai-ti);
+            }
+        }
+        cs[1] = jj; cs[2] = mm;
+        if( jj < nn/2 ) return 0;
+        cs[0] += 1; cs[1] = 0;
+    }
+    return 1;
+}
+
+// Real FFT of NN points using an NN/2 point complex FFT followed (forward) or preceded (inverse) by
+// the split step that separates (combines) the spectra of the even and odd samples.
+
+static int _rfft_run( int* xx, int nn, int* cs, int* nb )
+{
+    int kk, jj, n2 = nn/2, sh, ah; unsigned al;
+    int ar, ai, br, bi, er, ei, fr, fi, wr, ws, tr, ti;
+
+    if( cs[0] >= 0 && cs[0] < 99 && !_fft_run( xx, n2, 0, cs, nb ) ) return 0;
+    if( cs[0] == 99 ) {
+        cs[0] = -1; cs[1] = 1; cs[4] = sh = _fft_shift( cs[2] ); cs[3] += sh;
+        ar = xx[0] >> sh; ai = xx[1] >> sh;
+        xx[0] = ar + ai; xx[1] = ar - ai;
+    }
+    kk = cs[1]; sh = cs[4];
+    for( ; kk <= n2/2 && *nb > 0; ++kk, --*nb )
+    {
+        int* pa = xx + 2*kk; int* pb = xx + 2*(n2-kk);
+        DSP_LDD( ai, ar, pa, 0 ); DSP_LDD( bi, br, pb, 0 );
+        ar >>= sh; ai >>= sh; br >>= sh; bi >>= sh;
+        er = (ar + br) >> 1; ei = (ai - bi) >> 1; // Even samples spectrum
+        fr = ai + bi; fi = br - ar;                // Odd samples spectrum * 2
+        jj = kk * (16384 / nn); // W = exp(-j*2*pi*kk/nn) = wr - j*sin
+        wr = dsp_sine_14( jj+4096 ); ws = dsp_sine_14( jj );
+        DSP_MACCS( ah, al, fr, wr, 0, 1<<QQ ); DSP_MACCS( ah, al, fi, ws, ah, al );
+        DSP_LEXTRACT( tr, ah, al, QQ+1 );
+        DSP_MACCS( ah, al, fi, wr, 0, 1<<QQ ); DSP_MACCS( ah, al, fr, -ws, ah, al );
+        DSP_LEXTRACT( ti, ah, al, QQ+1 );
+        DSP_STD( ti-ei, er-tr, pb, 0 ); DSP_STD( ei+ti, er+tr, pa, 0 );
+    }
+    cs[1] = kk;
+    if( kk <= n2/2 ) return 0;
+    cs[0] = 100;
+    return 1;
+}
+
+// CS[0] is -2 and CS[2] the OR of the magnitudes of XX (see '_fft_max') when starting.
+
+static int _irfft_run( int* xx, int nn, int* cs, int* nb )
+{
+    int kk, jj, n2 = nn/2, sh, ah; unsigned al;
+    int ar, ai, br, bi, er, ei, dr, di, wr, ws, fr, fi;
+
+    if( cs[0] == -2 ) {
+        cs[0] = -1; cs[1] = 1; cs[3] = cs[4] = sh = _fft_shift( cs[2] );
+        ar = xx[0] >> sh; ai = xx[1] >> sh;
+        xx[0] = (ar + ai) >> 1; xx[1] = (ar - ai) >> 1;
+    }
+    if( cs[0] == -1 )
+    {
+        kk = cs[1]; sh = cs[4];
+        for( ; kk <= n2/2 && *nb > 0; ++kk, --*nb )
+        {
+            int* pa = xx + 2*kk; int* pb = xx + 2*(n2-kk);
+            DSP_LDD( ai, ar, pa, 0 ); DSP_LDD( bi, br, pb, 0 );
+            ar >>= sh; ai >>= sh; br >>= sh; bi >>= sh;
+            er = (ar + br) >> 1; ei = (ai - bi) >> 1;
+            dr = ar - br; di = ai + bi;
+            jj = kk * (16384 / nn); // W = exp(+j*2*pi*kk/nn) = wr + j*ws
+            wr = dsp_sine_14( jj+4096 ); ws = dsp_sine_14( jj );
+            DSP_MACCS( ah, al, dr, wr, 0, 1<<QQ ); DSP_MACCS( ah, al, di, -ws, ah, al );
+            DSP_LEXTRACT( fr, ah, al, QQ+1 );
+            DSP_MACCS( ah, al, dr, ws, 0, 1<<QQ ); DSP_MACCS( ah, al, di, wr, ah, al );
+            DSP_LEXTRACT( fi, ah, al, QQ+1 );
+            DSP_STD( fr-ei, er+fi, pb, 0 ); DSP_STD( ei+fr, er-fi, pa, 0 );
+        }
+        cs[1] = kk;
+        if( kk <= n2/2 ) return 0;
+        cs[0] = cs[1] = cs[2] = cs[5] = 0;
+    }
+    return _fft_run( xx, n2, 1, cs, nb );
+}
+
+// Forward/inverse complex FFT of NN points (NN = 4,8,...,16384) in place (XX length is 2*NN).
+// The inverse includes the 1/NN scaling (returned in EE, EE < 0 for small signals).
+
+int dsp_fft( int* xx, int nn )
+{
+    int cs[6] = { 0,0,0,0,0,0 }, nb = 0x7FFFFFFF;
+    _fft_run( xx, nn, 0, cs, &nb ); return cs[3];
+}
+
+int dsp_ifft( int* xx, int nn )
+{
+    int cs[6] = { 0,0,0,0,0,0 }, nb = 0x7FFFFFFF;
+    _fft_run( xx, nn, 1, cs, &nb ); return cs[3];
+}
+
+// Real FFT of NN points (NN = 8,16,...,16384) using an NN/2 point complex FFT. On return XX holds
+// bins 0 to NN/2 packed as XX[0] = DC, XX[1] = Nyquist (both real) followed by re,im for bins 1 to
+// NN/2-1. 'dsp_irfft' is the inverse (packed spectrum in, NN real samples out, 1/NN scaling).
+
+int dsp_rfft( int* xx, int nn )
+{
+    int cs[6] = { 0,0,0,0,0,0 }, nb = 0x7FFFFFFF;
+    _rfft_run( xx, nn, cs, &nb ); return cs[3];
+}
+
+int dsp_irfft( int* xx, int nn )
+{
+    int cs[6] = { -2,0,0,0,0,0 }, nb = 0x7FFFFFFF;
+    cs[2] = _fft_max( xx, nn );
+    _irfft_run( xx, nn, cs, &nb ); return cs[3];
+}
+
+// Multiplication of two packed real FFT spectra (see 'dsp_rfft'), XX[] = XX[] * YY[] (NN real
+// points, NN/2+1 bins). The block exponent of the result is the sum of the two input exponents.
+
+void dsp_rfft_mul( int* xx, const int* yy, int nn )
+{
+    int ah, xr, xi, yr, yi, zr; unsigned al;
+    DSP_MACCS( ah, al, xx[0], yy[0], 0, 1<<(QQ-1) ); DSP_LEXTRACT( xx[0], ah, al, QQ );
+    DSP_MACCS( ah, al, xx[1], yy[1], 0, 1<<(QQ-1) ); DSP_LEXTRACT( xx[1], ah, al, QQ );
+    for( xx += 2, yy += 2, nn = nn/2-1; nn > 0; --nn, xx += 2, yy += 2 )
+    {
+        DSP_LDD( xi, xr, xx, 0 ); DSP_LDD( yi, yr, yy, 0 );
+        DSP_MACCS( ah, al, xr, yr, 0, 1<<(QQ-1) ); DSP_MACCS( ah, al, -xi, yi, ah, al );
+        DSP_LEXTRACT( zr, ah, al, QQ );
+        DSP_MACCS( ah, al, xr, yi, 0, 1<<(QQ-1) ); DSP_MACCS( ah, al, xi, yr, ah, al );
+        DSP_LEXTRACT( xi, ah, al, QQ );
+        DSP_STD( xi, zr, xx, 0 );
+    }
+}
+
+// Uniformly partitioned FFT convolution (overlap-save with a frequency domain delay line) for long
+// impulse responses. The IR is split into PP partitions of BB taps. Each block of BB input samples
+// is transformed (2*BB point real FFT), the PP most recent input spectra are multiplied with the PP
+// partition spectra and accumulated (64-bit) and the sum is transformed back. The work for a block
+// is spread evenly over the BB calls of the next block so 'dsp_fftconv' is called once per sample
+// like the other filters; the output is delayed by 2*BB samples.
+//
+// Input spectra are stored with a fixed block exponent EX (log2 of the transform size)
+// and partition spectra with a common exponent EH so products of any pair can be accumulated
+// without further alignment.
+//
+// SS header: 0=BB, 1=PP, 2=EH, 3=EX, 4=work step, 5=position within the step, 6=newest input
+// spectrum, 7=sample index within the block, 8=input block being filled, 9=work per sample, 10=
+// output block being read, 11=input block being transformed, 12:17=transform progress (see
+// '_fft_run'). The header is followed by the input ring (3 blocks), two output blocks, the work
+// buffer (2*BB), the PP input spectra and the PP partition spectra (2*BB each).
+
+static int _fftconv_scale( int xx, int sh ) // XX * 2^SH with rounding/saturation
+{
+    if( sh < 0 ) return (xx >> -sh) + ((xx >> (-sh-1)) & 1);
+    if( xx > (0x7FFFFFFF >> sh) ) return 0x7FFFFFFF;
+    if( xx < ((int)0x80000000 >> sh) ) return (int)0x80000000;
+    return xx * (1 << sh);
+}
+
+static int _fftconv_work( int* ss, int* nb )
+{
+    int bb = ss[0], pp = ss[1], ii, jj, kk, mm, ah, bh, xr, xi, hr, hi; unsigned al, bl;
+    int* ring = ss + 24; int* out = ring + 3*bb; int* ww = out + 2*bb;
+    int* fx = ww + 2*bb; int* fh = fx + 2*bb*pp; int* xx = fx + 2*bb*ss[6]; int* cs = ss + 12;
+
+    if( ss[4] == 0 ) // Copy the two newest input blocks (the overlap-save frame)
+    {
+        const int* x0 = ring + bb * ((ss[11]+2) % 3); const int* x1 = ring + bb * ss[11];
+        for( ii = ss[5]; ii < bb && *nb > 0; ii += 2, --*nb ) {
+            DSP_LDD( hi, hr, x0+ii, 0 ); DSP_STD( hi, hr, xx+ii, 0 );
+            DSP_LDD( hi, hr, x1+ii, 0 ); DSP_STD( hi, hr, xx+bb+ii, 0 );
+        }
+        ss[5] = ii;
+        if( ii < bb ) return 0;
+        ss[4] = 1; cs[0] = cs[1] = cs[2] = cs[3] = cs[4] = cs[5] = 0;
+    }
+    if( ss[4] == 1 ) // Input spectrum
+    {
+        if( !_rfft_run( xx, 2*bb, cs, nb ) ) return 0;
+        ss[4] = 2; ss[5] = 0;
+    }
+    if( ss[4] == 2 ) // Scale the input spectrum to the exponent EX
+    {
+        kk = cs[3] - ss[3];
+        for( ii = ss[5]; ii < 2*bb && *nb > 0; ii += 2, --*nb ) {
+            xx[ii+0] = _fftconv_scale( xx[ii+0], kk ); xx[ii+1] = _fftconv_scale( xx[ii+1], kk );
+        }
+        ss[5] = ii;
+        if( ii < 2*bb ) return 0;
+        ss[4] = 3; ss[5] = 0; cs[2] = 0;
+    }
+    if( ss[4] == 3 ) // Sum of input spectra (newest first) times partition spectra, for each bin
+    {
+        mm = cs[2];
+        for( kk = ss[5]; kk < bb && *nb > 0; ++kk, *nb -= pp )
+        {
+            const int* ph = fh + 2*kk; ah = bh = 0; al = bl = 1<<(QQ-1);
+            for( ii = 0, jj = ss[6]; ii < pp; ++ii, ph += 2*bb, jj = (jj ? jj : pp) - 1 )
+            {
+                DSP_LDD( xi, xr, fx + 2*bb*jj + 2*kk, 0 ); DSP_LDD( hi, hr, ph, 0 );
+                if( kk == 0 ) { // DC and Nyquist (both real)
+                    DSP_MACCS( ah, al, xr, hr, ah, al ); DSP_MACCS( bh, bl, xi, hi, bh, bl );
+                } else {
+                    DSP_MACCS( ah, al, xr, hr, ah, al ); DSP_MACCS( ah, al, -xi, hi, ah, al );
+                    DSP_MACCS( bh, bl, xr, hi, bh, bl ); DSP_MACCS( bh, bl, xi, hr, bh, bl );
+                }
+            }
+            DSP_LSATS( ah, al, QQ ); DSP_LEXTRACT( xr, ah, al, QQ );
+            DSP_LSATS( bh, bl, QQ ); DSP_LEXTRACT( xi, bh, bl, QQ );
+            DSP_STD( xi, xr, ww+2*kk, 0 );
+            mm |= _fft_mag( xr ) | _fft_mag( xi );
+        }
+        ss[5] = kk; cs[2] = mm;
+        if( kk < bb ) return 0;
+        ss[4] = 4; cs[0] = -2; cs[1] = cs[3] = cs[4] = cs[5] = 0;
+    }
+    if( ss[4] == 4 ) // Output (2*BB samples of which the last BB are valid)
+    {
+        if( !_irfft_run( ww, 2*bb, cs, nb ) ) return 0;
+        ss[4] = 5; ss[5] = 0;
+    }
+    if( ss[4] == 5 ) // Scale to Q28 and copy to the output block for the next BB samples
+    {
+        int* yy = out + bb * (ss[10] ^ 1); kk = ss[3] + ss[2] + cs[3];
+        for( ii = ss[5]; ii < bb && *nb > 0; ii += 2, --*nb ) {
+            yy[ii+0] = _fftconv_scale( ww[bb+ii+0], kk ); yy[ii+1] = _fftconv_scale( ww[bb+ii+1], kk );
+        }
+        ss[5] = ii;
+        if( ii < bb ) return 0;
+        ss[4] = 6;
+    }
+    return 1;
+}
+
+// Calculate partition spectra for the NN tap impulse response CC, BB is the partition size (8 to
+// 8192, power of 2). SS length is 24+7*BB+4*BB*PP where PP = (NN+BB-1)/BB. Not for use in real-time
+// DSP threads.
+//
+// For 'dsp_fftconv_tail' CC is a segment of a longer impulse response that starts at tap DD (DD is
+// at least 2*BB). The 2*BB block delay is taken from the segment's position so the output is
+// aligned with the input (no added latency). The earlier taps are computed separately, usually by
+// 'dsp_convolve' (for the first 2*BB taps) or by other 'dsp_fftconv_tail' stages with smaller BB.
+// PP is (NN+DD-BB-1)/BB.
+
+static void _fftconv_init( int* ss, const int* cc, int nn, int dd, int bb )
+{
+    int pp = (nn + dd + bb-1) / bb, ii, jj, kk, eh = -64, nb;
+    int* fx = ss + 24 + 7*bb; int* fh = fx + 2*bb*pp;
+
+    memset( ss, 0, 4 * (24 + 7*bb + 4*bb*pp) );
+    ss[0] = bb; ss[1] = pp;
+    for( ii = 2; (1 << ii) < 2*bb; ++ii ) {}
+    ss[3] = ii; // EX, spectra of inputs up to +/-8.0 fit in 32 bits
+
+    for( ii = 0; ii < pp; ++ii ) { // Partition spectra, exponents kept in the input spectra area
+        for( jj = 0; jj < bb; ++jj ) {
+            kk = ii*bb + jj - dd;
+            fh[2*bb*ii+jj] = (kk >= 0 && kk < nn) ? cc[kk] : 0;
+        }
+        fx[ii] = dsp_rfft( fh + 2*bb*ii, 2*bb );
+        if( fx[ii] > eh ) eh = fx[ii];
+    }
+    for( ii = 0; ii < pp; ++ii ) {
+        for( jj = 0; jj < 2*bb; ++jj ) fh[2*bb*ii+jj] = _fftconv_scale( fh[2*bb*ii+jj], fx[ii]-eh );
+        fx[ii] = 0;
+    }
+    ss[2] = eh;
+    // Measure the work for one block (in transform steps) to set the work per sample.
+    nb = 0x7FFFFFFF; _fftconv_work( ss, &nb );
+    ss[9] = (0x7FFFFFFF - nb) / bb + 1;
+    memset( ss+24, 0, 4 * 7*bb ); memset( fx, 0, 4 * 2*bb*pp );
+    ss[4] = 6;
+}
+
+void dsp_fftconv_init( int* ss, const int* cc, int nn, int bb ) { _fftconv_init( ss, cc, nn, 0, bb ); }
+
+void dsp_fftconv_tail( int* ss, const int* cc, int nn, int dd, int bb )
+{
+    _fftconv_init( ss, cc, nn, dd - 2*bb, bb );
+}
+
+int dsp_fftconv( int xx, int* ss )
+{
+    int bb = ss[0], nb; int* ring = ss + 24; int* out = ring + 3*bb;
+    ring[bb*ss[8] + ss[7]] = xx; xx = out[bb*ss[10] + ss[7]];
+    if( ++ss[7] == bb ) // New input block, start its transform
+    {
+        nb = 0x7FFFFFFF; _fftconv_work( ss, &nb ); // Finish the previous block if behind
+        ss[7] = 0; ss[10] ^= 1; ss[11] = ss[8]; ss[8] = (ss[8]+1) % 3;
+        ss[6] = (ss[6]+1) % ss[1]; ss[4] = ss[5] = 0;
+    }
+    nb = ss[9]; _fftconv_work( ss, &nb );
+    return xx;
+}
+
 static void _make_filter
 (
     int coeffs[5],
@@ -238,25 +826,120 @@ void calc_tonestack( int* cc, double l, double m, double t, double v1, double v2
     cc[4] = FQ(-A1/A0); cc[5] = FQ(-A2/A0); cc[6] = FQ(-A3/A0);
 }
 
-/*
-import math
-nn = 16384
-yy = [0] * nn
-for ii in range( 0, nn ):
-    if (ii+0) % 5 == 0: sys.stdout.write("    ");
-    #xx = math.sin( 2.0 * math.pi * ((1.0*ii)/nn) )
-    #xx = (2/math.pi) * math.atan( 8.0 * (math.pi / 2) * (float(ii)/nn) )
-    #xx = math.tanh( (8.0 * ii) / nn )
-    #xx = 1.0 - math.e ** ((-8.0 * ii) / nn)
-    yy[ii] = xx
-    sys.stdout.write( "FQ(%+01.9f)," % xx )
-    if (ii+1) % 5 == 0: print
-print
-print (yy[1]-yy[0])*nn
-exit(0)
-*/
+// Least-squares fit of a symmetric 8-tap FIR to the inverse of the NN-stage CIC response (RR) over
+// the pass-band 0..FF (FF relative to the low sample rate) with a lightly weighted stop-band from
+// (FF+0.5)/2 to 0.5. Normalized to unity DC gain.
+
+void calc_cic_comp( int cc[8], int nn, int rr, double ff )
+{
+    double aa[4][5], hh[4], ww, dd, gg, ee;
+    memset( aa, 0, sizeof(aa) );
+    for( int kk = 1; kk <= 256; ++kk )
+    {
+        double fk = 0.5 * kk / 257, cw[4];
+        if( fk > ff && fk < (ff+0.5)/2 ) continue;
+        ww = fk <= ff ? 1.0 : 0.1;
+        dd = fk <= ff ? pow( rr * sin( pi * fk / rr ) / sin( pi * fk ), nn ) : 0.0;
+        for( int ii = 0; ii < 4; ++ii ) cw[ii] = 2 * cos( 2 * pi * fk * (3.5-ii) );
+        for( int ii = 0; ii < 4; ++ii ) {
+            for( int jj = 0; jj < 4; ++jj ) aa[ii][jj] += ww * cw[ii] * cw[jj];
+            aa[ii][4] += ww * cw[ii] * dd;
+        }
+    }
+    for( int ii = 0; ii < 4; ++ii ) // Gaussian elimination with partial pivoting
+    {
+        int pp = ii;
+        for( int jj = ii+1; jj < 4; ++jj ) if( fabs(aa[jj][ii]) > fabs(aa[pp][ii]) ) pp = jj;
+        for( int kk = 0; kk < 5; ++kk ) { ee = aa[ii][kk]; aa[ii][kk] = aa[pp][kk]; aa[pp][kk] = ee; }
+        for( int jj = ii+1; jj < 4; ++jj ) {
+            ee = aa[jj][ii] / aa[ii][ii];
+            for( int kk = ii; kk < 5; ++kk ) aa[jj][kk] -= ee * aa[ii][kk];
+        }
+    }
+    for( int ii = 3; ii >= 0; --ii ) {
+        hh[ii] = aa[ii][4];
+        for( int jj = ii+1; jj < 4; ++jj ) hh[ii] -= aa[ii][jj] * hh[jj];
+        hh[ii] /= aa[ii][ii];
+    }
+    gg = 2 * (hh[0] + hh[1] + hh[2] + hh[3]);
+    for( int ii = 0; ii < 4; ++ii ) cc[ii] = cc[7-ii] = FQ( hh[ii] / gg );
+}
+
+// Dynamics parameters for 'dsp_dynamics'. Levels are dB relative to QQQ 1.0, times are in samples.
+
+#define _DB( db ) ((int)floor( (db) * (1<<(QQ-4)) + 0.5 ))
+
+static void _calc_dynamics( int cc[12], int dir, double th, double slope, double knee,
+                            double attack, double release, double rms, double floor_db,
+                            double makeup, int lookahead, double ceiling )
+{
+    th = th < -90 ? -90 : th > 18 ? 18 : th;
+    cc[0] = _DB( th ); cc[1] = dir; cc[2] = _DB( slope );
+    cc[3] = _DB( knee / 2 ); cc[4] = knee > 0.125 ? FQ( 1.0 / knee ) : 0;
+    cc[5] = _DB( floor_db < -127 ? -127 : floor_db ); cc[6] = _DB( makeup );
+    cc[7] = attack  > 1 ? FQ( 1.0 - exp( -1.0 / attack  ) ) : FQ(1.0);
+    cc[8] = release > 1 ? FQ( 1.0 - exp( -1.0 / release ) ) : FQ(1.0);
+    cc[9] = rms > 1 ? FQ( 1.0 - exp( -1.0 / rms ) ) : 0;
+    cc[10] = lookahead; cc[11] = ceiling > 0 ? FQ( ceiling ) : 0;
+    if( knee <= 0.125 ) cc[3] = 0;
+}
+
+void calc_compressor( int cc[12], double th, double ratio, double knee,
+                      double attack, double release, double rms, double makeup )
+{
+    _calc_dynamics( cc, +1, th, 1.0/ratio - 1.0, knee, attack, release, rms, -127, makeup, 0, 0 );
+}
+
+void calc_expander( int cc[12], double th, double ratio, double knee,
+                    double attack, double release, double range )
+{
+    _calc_dynamics( cc, -1, th, 1.0 - ratio, knee, attack, release, 0, -range, 0, 0, 0 );
+}
+
+void calc_gate( int cc[12], double th, double attack, double release, double range )
+{
+    _calc_dynamics( cc, -1, th, -50.0, 0, attack, release, 0, -range, 0, 0, 0 );
+}
+
+void calc_limiter( int cc[12], double ceiling, double release, int lookahead )
+{
+    double th = 20 * log10( ceiling );
+    _calc_dynamics( cc, +1, th, -1.0, 0, lookahead / 5.0, release, 0, -127, 0, lookahead, ceiling );
+}
+
+void calc_waveshaper( int* lut, int bits, int nn, double (*shape)( double ) )
+{
+    lut[0] = bits; lut[1] = nn;
+    for( int ii = 0; ii < nn; ++ii ) {
+        double yy = shape( 2.0 * ii / (1 << bits) - 1.0 );
+        lut[2+ii] = FQ( yy < -0.999999 ? -0.999999 : (yy > +0.999999 ? +0.999999 : yy) );
+    }
+}
+
+// Lookup tables. The sine tables hold the first quarter wave, sin(2*pi*ii/nn) for 0 <= ii <= nn/4
+// (see 'dsp_sine'). The others hold nn values of atan(8*ii/nn)/atan(8*1025/1024), tanh(8*ii/nn) and
+// 1-exp(-8*ii/nn). Builds with DSP_TABLES_INIT leave the tables uninitialized and generate the ones
+// selected by 'dsp_tables_init' at boot, using the same functions as the initialized tables below.
 
-int dsp_sine_10[1024] =
+void dsp_table_make( int* tt, int table ) // TABLE is one of DSP_SINE_10 .. DSP_NEXP_14
+{
+    int kk = 0; while( kk < 11 && !(table & (1<<kk)) ) ++kk;
+    int type = kk % 4, nn = 1024 << (2*(kk/4));
+    if( type == 0 ) for( int ii = 0; ii <= nn/4; ++ii ) tt[ii] = FQ( sin( 2.0 * pi * ii / nn ) );
+    if( type == 1 ) for( int ii = 0; ii < nn; ++ii ) tt[ii] = FQ( atan( 8.0*ii/nn ) / atan( 8.0*1025/1024 ) );
+    if( type == 2 ) for( int ii = 0; ii < nn; ++ii ) tt[ii] = FQ( tanh( 8.0 * ii / nn ) );
+    if( type == 3 ) for( int ii = 0; ii < nn; ++ii ) tt[ii] = FQ( 1.0 - exp( -8.0 * ii / nn ) );
+}
+
+#ifdef DSP_TABLES_INIT
+
+int dsp_qsine_10[  257], dsp_atan_10[ 1024], dsp_tanh_10[ 1024], dsp_nexp_10[ 1024];
+int dsp_qsine_12[ 1025], dsp_atan_12[ 4096], dsp_tanh_12[ 4096], dsp_nexp_12[ 4096];
+int dsp_qsine_14[ 4097], dsp_atan_14[16384], dsp_tanh_14[16384], dsp_nexp_14[16384];
+
+#else
+
+int dsp_qsine_10[257] =
 {
     FQ(+0.000000000),FQ(+0.006135885),FQ(+0.012271538),FQ(+0.018406730),FQ(+0.024541229),
     FQ(+0.030674803),FQ(+0.036807223),FQ(+0.042938257),FQ(+0.049067674),FQ(+0.055195244),
@@ -309,160 +992,7 @@ int dsp_sine_10[1024] =
     FQ(+0.995184727),FQ(+0.995767414),FQ(+0.996312612),FQ(+0.996820299),FQ(+0.997290457),
     FQ(+0.997723067),FQ(+0.998118113),FQ(+0.998475581),FQ(+0.998795456),FQ(+0.999077728),
     FQ(+0.999322385),FQ(+0.999529418),FQ(+0.999698819),FQ(+0.999830582),FQ(+0.999924702),
-    FQ(+0.999981175),FQ(+1.000000000),FQ(+0.999981175),FQ(+0.999924702),FQ(+0.999830582),
-    FQ(+0.999698819),FQ(+0.999529418),FQ(+0.999322385),FQ(+0.999077728),FQ(+0.998795456),
-    FQ(+0.998475581),FQ(+0.998118113),FQ(+0.997723067),FQ(+0.997290457),FQ(+0.996820299),
-    FQ(+0.996312612),FQ(+0.995767414),FQ(+0.995184727),FQ(+0.994564571),FQ(+0.993906970),
-    FQ(+0.993211949),FQ(+0.992479535),FQ(+0.991709754),FQ(+0.990902635),FQ(+0.990058210),
-    FQ(+0.989176510),FQ(+0.988257568),FQ(+0.987301418),FQ(+0.986308097),FQ(+0.985277642),
-    FQ(+0.984210092),FQ(+0.983105487),FQ(+0.981963869),FQ(+0.980785280),FQ(+0.979569766),
-    FQ(+0.978317371),FQ(+0.977028143),FQ(+0.975702130),FQ(+0.974339383),FQ(+0.972939952),
-    FQ(+0.971503891),FQ(+0.970031253),FQ(+0.968522094),FQ(+0.966976471),FQ(+0.965394442),
-    FQ(+0.963776066),FQ(+0.962121404),FQ(+0.960430519),FQ(+0.958703475),FQ(+0.956940336),
-    FQ(+0.955141168),FQ(+0.953306040),FQ(+0.951435021),FQ(+0.949528181),FQ(+0.947585591),
-    FQ(+0.945607325),FQ(+0.943593458),FQ(+0.941544065),FQ(+0.939459224),FQ(+0.937339012),
-    FQ(+0.935183510),FQ(+0.932992799),FQ(+0.930766961),FQ(+0.928506080),FQ(+0.926210242),
-    FQ(+0.923879533),FQ(+0.921514039),FQ(+0.919113852),FQ(+0.916679060),FQ(+0.914209756),
-    FQ(+0.911706032),FQ(+0.909167983),FQ(+0.906595705),FQ(+0.903989293),FQ(+0.901348847),
-    FQ(+0.898674466),FQ(+0.895966250),FQ(+0.893224301),FQ(+0.890448723),FQ(+0.887639620),
-    FQ(+0.884797098),FQ(+0.881921264),FQ(+0.879012226),FQ(+0.876070094),FQ(+0.873094978),
-    FQ(+0.870086991),FQ(+0.867046246),FQ(+0.863972856),FQ(+0.860866939),FQ(+0.857728610),
-    FQ(+0.854557988),FQ(+0.851355193),FQ(+0.848120345),FQ(+0.844853565),FQ(+0.841554977),
-    FQ(+0.838224706),FQ(+0.834862875),FQ(+0.831469612),FQ(+0.828045045),FQ(+0.824589303),
-    FQ(+0.821102515),FQ(+0.817584813),FQ(+0.814036330),FQ(+0.810457198),FQ(+0.806847554),
-    FQ(+0.803207531),FQ(+0.799537269),FQ(+0.795836905),FQ(+0.792106577),FQ(+0.788346428),
-    FQ(+0.784556597),FQ(+0.780737229),FQ(+0.776888466),FQ(+0.773010453),FQ(+0.769103338),
-    FQ(+0.765167266),FQ(+0.761202385),FQ(+0.757208847),FQ(+0.753186799),FQ(+0.749136395),
-    FQ(+0.745057785),FQ(+0.740951125),FQ(+0.736816569),FQ(+0.732654272),FQ(+0.728464390),
-    FQ(+0.724247083),FQ(+0.720002508),FQ(+0.715730825),FQ(+0.711432196),FQ(+0.707106781),
-    FQ(+0.702754744),FQ(+0.698376249),FQ(+0.693971461),FQ(+0.689540545),FQ(+0.685083668),
-    FQ(+0.680600998),FQ(+0.676092704),FQ(+0.671558955),FQ(+0.666999922),FQ(+0.662415778),
-    FQ(+0.657806693),FQ(+0.653172843),FQ(+0.648514401),FQ(+0.643831543),FQ(+0.639124445),
-    FQ(+0.634393284),FQ(+0.629638239),FQ(+0.624859488),FQ(+0.620057212),FQ(+0.615231591),
-    FQ(+0.610382806),FQ(+0.605511041),FQ(+0.600616479),FQ(+0.595699304),FQ(+0.590759702),
-    FQ(+0.585797857),FQ(+0.580813958),FQ(+0.575808191),FQ(+0.570780746),FQ(+0.565731811),
-    FQ(+0.560661576),FQ(+0.555570233),FQ(+0.550457973),FQ(+0.545324988),FQ(+0.540171473),
-    FQ(+0.534997620),FQ(+0.529803625),FQ(+0.524589683),FQ(+0.519355990),FQ(+0.514102744),
-    FQ(+0.508830143),FQ(+0.503538384),FQ(+0.498227667),FQ(+0.492898192),FQ(+0.487550160),
-    FQ(+0.482183772),FQ(+0.476799230),FQ(+0.471396737),FQ(+0.465976496),FQ(+0.460538711),
-    FQ(+0.455083587),FQ(+0.449611330),FQ(+0.444122145),FQ(+0.438616239),FQ(+0.433093819),
-    FQ(+0.427555093),FQ(+0.422000271),FQ(+0.416429560),FQ(+0.410843171),FQ(+0.405241314),
-    FQ(+0.399624200),FQ(+0.393992040),FQ(+0.388345047),FQ(+0.382683432),FQ(+0.377007410),
-    FQ(+0.371317194),FQ(+0.365612998),FQ(+0.359895037),FQ(+0.354163525),FQ(+0.348418680),
-    FQ(+0.342660717),FQ(+0.336889853),FQ(+0.331106306),FQ(+0.325310292),FQ(+0.319502031),
-    FQ(+0.313681740),FQ(+0.307849640),FQ(+0.302005949),FQ(+0.296150888),FQ(+0.290284677),
-    FQ(+0.284407537),FQ(+0.278519689),FQ(+0.272621355),FQ(+0.266712757),FQ(+0.260794118),
-    FQ(+0.254865660),FQ(+0.248927606),FQ(+0.242980180),FQ(+0.237023606),FQ(+0.231058108),
-    FQ(+0.225083911),FQ(+0.219101240),FQ(+0.213110320),FQ(+0.207111376),FQ(+0.201104635),
-    FQ(+0.195090322),FQ(+0.189068664),FQ(+0.183039888),FQ(+0.177004220),FQ(+0.170961889),
-    FQ(+0.164913120),FQ(+0.158858143),FQ(+0.152797185),FQ(+0.146730474),FQ(+0.140658239),
-    FQ(+0.134580709),FQ(+0.128498111),FQ(+0.122410675),FQ(+0.116318631),FQ(+0.110222207),
-    FQ(+0.104121634),FQ(+0.098017140),FQ(+0.091908956),FQ(+0.085797312),FQ(+0.079682438),
-    FQ(+0.073564564),FQ(+0.067443920),FQ(+0.061320736),FQ(+0.055195244),FQ(+0.049067674),
-    FQ(+0.042938257),FQ(+0.036807223),FQ(+0.030674803),FQ(+0.024541229),FQ(+0.018406730),
-    FQ(+0.012271538),FQ(+0.006135885),FQ(+0.000000000),FQ(-0.006135885),FQ(-0.012271538),
-    FQ(-0.018406730),FQ(-0.024541229),FQ(-0.030674803),FQ(-0.036807223),FQ(-0.042938257),
-    FQ(-0.049067674),FQ(-0.055195244),FQ(-0.061320736),FQ(-0.067443920),FQ(-0.073564564),
-    FQ(-0.079682438),FQ(-0.085797312),FQ(-0.091908956),FQ(-0.098017140),FQ(-0.104121634),
-    FQ(-0.110222207),FQ(-0.116318631),FQ(-0.122410675),FQ(-0.128498111),FQ(-0.134580709),
-    FQ(-0.140658239),FQ(-0.146730474),FQ(-0.152797185),FQ(-0.158858143),FQ(-0.164913120),
-    FQ(-0.170961889),FQ(-0.177004220),FQ(-0.183039888),FQ(-0.189068664),FQ(-0.195090322),
-    FQ(-0.201104635),FQ(-0.207111376),FQ(-0.213110320),FQ(-0.219101240),FQ(-0.225083911),
-    FQ(-0.231058108),FQ(-0.237023606),FQ(-0.242980180),FQ(-0.248927606),FQ(-0.254865660),
-    FQ(-0.260794118),FQ(-0.266712757),FQ(-0.272621355),FQ(-0.278519689),FQ(-0.284407537),
-    FQ(-0.290284677),FQ(-0.296150888),FQ(-0.302005949),FQ(-0.307849640),FQ(-0.313681740),
-    FQ(-0.319502031),FQ(-0.325310292),FQ(-0.331106306),FQ(-0.336889853),FQ(-0.342660717),
-    FQ(-0.348418680),FQ(-0.354163525),FQ(-0.359895037),FQ(-0.365612998),FQ(-0.371317194),
-    FQ(-0.377007410),FQ(-0.382683432),FQ(-0.388345047),FQ(-0.393992040),FQ(-0.399624200),
-    FQ(-0.405241314),FQ(-0.410843171),FQ(-0.416429560),FQ(-0.422000271),FQ(-0.427555093),
-    FQ(-0.433093819),FQ(-0.438616239),FQ(-0.444122145),FQ(-0.449611330),FQ(-0.455083587),
-    FQ(-0.460538711),FQ(-0.465976496),FQ(-0.471396737),FQ(-0.476799230),FQ(-0.482183772),
-    FQ(-0.487550160),FQ(-0.492898192),FQ(-0.498227667),FQ(-0.503538384),FQ(-0.508830143),
-    FQ(-0.514102744),FQ(-0.519355990),FQ(-0.524589683),FQ(-0.529803625),FQ(-0.534997620),
-    FQ(-0.540171473),FQ(-0.545324988),FQ(-0.550457973),FQ(-0.555570233),FQ(-0.560661576),
-    FQ(-0.565731811),FQ(-0.570780746),FQ(-0.575808191),FQ(-0.580813958),FQ(-0.585797857),
-    FQ(-0.590759702),FQ(-0.595699304),FQ(-0.600616479),FQ(-0.605511041),FQ(-0.610382806),
-    FQ(-0.615231591),FQ(-0.620057212),FQ(-0.624859488),FQ(-0.629638239),FQ(-0.634393284),
-    FQ(-0.639124445),FQ(-0.643831543),FQ(-0.648514401),FQ(-0.653172843),FQ(-0.657806693),
-    FQ(-0.662415778),FQ(-0.666999922),FQ(-0.671558955),FQ(-0.676092704),FQ(-0.680600998),
-    FQ(-0.685083668),FQ(-0.689540545),FQ(-0.693971461),FQ(-0.698376249),FQ(-0.702754744),
-    FQ(-0.707106781),FQ(-0.711432196),FQ(-0.715730825),FQ(-0.720002508),FQ(-0.724247083),
-    FQ(-0.728464390),FQ(-0.732654272),FQ(-0.736816569),FQ(-0.740951125),FQ(-0.745057785),
-    FQ(-0.749136395),FQ(-0.753186799),FQ(-0.757208847),FQ(-0.761202385),FQ(-0.765167266),
-    FQ(-0.769103338),FQ(-0.773010453),FQ(-0.776888466),FQ(-0.780737229),FQ(-0.784556597),
-    FQ(-0.788346428),FQ(-0.792106577),FQ(-0.795836905),FQ(-0.799537269),FQ(-0.803207531),
-    FQ(-0.806847554),FQ(-0.810457198),FQ(-0.814036330),FQ(-0.817584813),FQ(-0.821102515),
-    FQ(-0.824589303),FQ(-0.828045045),FQ(-0.831469612),FQ(-0.834862875),FQ(-0.838224706),
-    FQ(-0.841554977),FQ(-0.844853565),FQ(-0.848120345),FQ(-0.851355193),FQ(-0.854557988),
-    FQ(-0.857728610),FQ(-0.860866939),FQ(-0.863972856),FQ(-0.867046246),FQ(-0.870086991),
-    FQ(-0.873094978),FQ(-0.876070094),FQ(-0.879012226),FQ(-0.881921264),FQ(-0.884797098),
-    FQ(-0.887639620),FQ(-0.890448723),FQ(-0.893224301),FQ(-0.895966250),FQ(-0.898674466),
-    FQ(-0.901348847),FQ(-0.903989293),FQ(-0.906595705),FQ(-0.909167983),FQ(-0.911706032),
-    FQ(-0.914209756),FQ(-0.916679060),FQ(-0.919113852),FQ(-0.921514039),FQ(-0.923879533),
-    FQ(-0.926210242),FQ(-0.928506080),FQ(-0.930766961),FQ(-0.932992799),FQ(-0.935183510),
-    FQ(-0.937339012),FQ(-0.939459224),FQ(-0.941544065),FQ(-0.943593458),FQ(-0.945607325),
-    FQ(-0.947585591),FQ(-0.949528181),FQ(-0.951435021),FQ(-0.953306040),FQ(-0.955141168),
-    FQ(-0.956940336),FQ(-0.958703475),FQ(-0.960430519),FQ(-0.962121404),FQ(-0.963776066),
-    FQ(-0.965394442),FQ(-0.966976471),FQ(-0.968522094),FQ(-0.970031253),FQ(-0.971503891),
-    FQ(-0.972939952),FQ(-0.974339383),FQ(-0.975702130),FQ(-0.977028143),FQ(-0.978317371),
-    FQ(-0.979569766),FQ(-0.980785280),FQ(-0.981963869),FQ(-0.983105487),FQ(-0.984210092),
-    FQ(-0.985277642),FQ(-0.986308097),FQ(-0.987301418),FQ(-0.988257568),FQ(-0.989176510),
-    FQ(-0.990058210),FQ(-0.990902635),FQ(-0.991709754),FQ(-0.992479535),FQ(-0.993211949),
-    FQ(-0.993906970),FQ(-0.994564571),FQ(-0.995184727),FQ(-0.995767414),FQ(-0.996312612),
-    FQ(-0.996820299),FQ(-0.997290457),FQ(-0.997723067),FQ(-0.998118113),FQ(-0.998475581),
-    FQ(-0.998795456),FQ(-0.999077728),FQ(-0.999322385),FQ(-0.999529418),FQ(-0.999698819),
-    FQ(-0.999830582),FQ(-0.999924702),FQ(-0.999981175),FQ(-1.000000000),FQ(-0.999981175),
-    FQ(-0.999924702),FQ(-0.999830582),FQ(-0.999698819),FQ(-0.999529418),FQ(-0.999322385),
-    FQ(-0.999077728),FQ(-0.998795456),FQ(-0.998475581),FQ(-0.998118113),FQ(-0.997723067),
-    FQ(-0.997290457),FQ(-0.996820299),FQ(-0.996312612),FQ(-0.995767414),FQ(-0.995184727),
-    FQ(-0.994564571),FQ(-0.993906970),FQ(-0.993211949),FQ(-0.992479535),FQ(-0.991709754),
-    FQ(-0.990902635),FQ(-0.990058210),FQ(-0.989176510),FQ(-0.988257568),FQ(-0.987301418),
-    FQ(-0.986308097),FQ(-0.985277642),FQ(-0.984210092),FQ(-0.983105487),FQ(-0.981963869),
-    FQ(-0.980785280),FQ(-0.979569766),FQ(-0.978317371),FQ(-0.977028143),FQ(-0.975702130),
-    FQ(-0.974339383),FQ(-0.972939952),FQ(-0.971503891),FQ(-0.970031253),FQ(-0.968522094),
-    FQ(-0.966976471),FQ(-0.965394442),FQ(-0.963776066),FQ(-0.962121404),FQ(-0.960430519),
-    FQ(-0.958703475),FQ(-0.956940336),FQ(-0.955141168),FQ(-0.953306040),FQ(-0.951435021),
-    FQ(-0.949528181),FQ(-0.947585591),FQ(-0.945607325),FQ(-0.943593458),FQ(-0.941544065),
-    FQ(-0.939459224),FQ(-0.937339012),FQ(-0.935183510),FQ(-0.932992799),FQ(-0.930766961),
-    FQ(-0.928506080),FQ(-0.926210242),FQ(-0.923879533),FQ(-0.921514039),FQ(-0.919113852),
-    FQ(-0.916679060),FQ(-0.914209756),FQ(-0.911706032),FQ(-0.909167983),FQ(-0.906595705),
-    FQ(-0.903989293),FQ(-0.901348847),FQ(-0.898674466),FQ(-0.895966250),FQ(-0.893224301),
-    FQ(-0.890448723),FQ(-0.887639620),FQ(-0.884797098),FQ(-0.881921264),FQ(-0.879012226),
-    FQ(-0.876070094),FQ(-0.873094978),FQ(-0.870086991),FQ(-0.867046246),FQ(-0.863972856),
-    FQ(-0.860866939),FQ(-0.857728610),FQ(-0.854557988),FQ(-0.851355193),FQ(-0.848120345),
-    FQ(-0.844853565),FQ(-0.841554977),FQ(-0.838224706),FQ(-0.834862875),FQ(-0.831469612),
-    FQ(-0.828045045),FQ(-0.824589303),FQ(-0.821102515),FQ(-0.817584813),FQ(-0.814036330),
-    FQ(-0.810457198),FQ(-0.806847554),FQ(-0.803207531),FQ(-0.799537269),FQ(-0.795836905),
-    FQ(-0.792106577),FQ(-0.788346428),FQ(-0.784556597),FQ(-0.780737229),FQ(-0.776888466),
-    FQ(-0.773010453),FQ(-0.769103338),FQ(-0.765167266),FQ(-0.761202385),FQ(-0.757208847),
-    FQ(-0.753186799),FQ(-0.749136395),FQ(-0.745057785),FQ(-0.740951125),FQ(-0.736816569),
-    FQ(-0.732654272),FQ(-0.728464390),FQ(-0.724247083),FQ(-0.720002508),FQ(-0.715730825),
-    FQ(-0.711432196),FQ(-0.707106781),FQ(-0.702754744),FQ(-0.698376249),FQ(-0.693971461),
-    FQ(-0.689540545),FQ(-0.685083668),FQ(-0.680600998),FQ(-0.676092704),FQ(-0.671558955),
-    FQ(-0.666999922),FQ(-0.662415778),FQ(-0.657806693),FQ(-0.653172843),FQ(-0.648514401),
-    FQ(-0.643831543),FQ(-0.639124445),FQ(-0.634393284),FQ(-0.629638239),FQ(-0.624859488),
-    FQ(-0.620057212),FQ(-0.615231591),FQ(-0.610382806),FQ(-0.605511041),FQ(-0.600616479),
-    FQ(-0.595699304),FQ(-0.590759702),FQ(-0.585797857),FQ(-0.580813958),FQ(-0.575808191),
-    FQ(-0.570780746),FQ(-0.565731811),FQ(-0.560661576),FQ(-0.555570233),FQ(-0.550457973),
-    FQ(-0.545324988),FQ(-0.540171473),FQ(-0.534997620),FQ(-0.529803625),FQ(-0.524589683),
-    FQ(-0.519355990),FQ(-0.514102744),FQ(-0.508830143),FQ(-0.503538384),FQ(-0.498227667),
-    FQ(-0.492898192),FQ(-0.487550160),FQ(-0.482183772),FQ(-0.476799230),FQ(-0.471396737),
-    FQ(-0.465976496),FQ(-0.460538711),FQ(-0.455083587),FQ(-0.449611330),FQ(-0.444122145),
-    FQ(-0.438616239),FQ(-0.433093819),FQ(-0.427555093),FQ(-0.422000271),FQ(-0.416429560),
-    FQ(-0.410843171),FQ(-0.405241314),FQ(-0.399624200),FQ(-0.393992040),FQ(-0.388345047),
-    FQ(-0.382683432),FQ(-0.377007410),FQ(-0.371317194),FQ(-0.365612998),FQ(-0.359895037),
-    FQ(-0.354163525),FQ(-0.348418680),FQ(-0.342660717),FQ(-0.336889853),FQ(-0.331106306),
-    FQ(-0.325310292),FQ(-0.319502031),FQ(-0.313681740),FQ(-0.307849640),FQ(-0.302005949),
-    FQ(-0.296150888),FQ(-0.290284677),FQ(-0.284407537),FQ(-0.278519689),FQ(-0.272621355),
-    FQ(-0.266712757),FQ(-0.260794118),FQ(-0.254865660),FQ(-0.248927606),FQ(-0.242980180),
-    FQ(-0.237023606),FQ(-0.231058108),FQ(-0.225083911),FQ(-0.219101240),FQ(-0.213110320),
-    FQ(-0.207111376),FQ(-0.201104635),FQ(-0.195090322),FQ(-0.189068664),FQ(-0.183039888),
-    FQ(-0.177004220),FQ(-0.170961889),FQ(-0.164913120),FQ(-0.158858143),FQ(-0.152797185),
-    FQ(-0.146730474),FQ(-0.140658239),FQ(-0.134580709),FQ(-0.128498111),FQ(-0.122410675),
-    FQ(-0.116318631),FQ(-0.110222207),FQ(-0.104121634),FQ(-0.098017140),FQ(-0.091908956),
-    FQ(-0.085797312),FQ(-0.079682438),FQ(-0.073564564),FQ(-0.067443920),FQ(-0.061320736),
-    FQ(-0.055195244),FQ(-0.049067674),FQ(-0.042938257),FQ(-0.036807223),FQ(-0.030674803),
-    FQ(-0.024541229),FQ(-0.018406730),FQ(-0.012271538),FQ(-0.006135885)
+    FQ(+0.999981175),FQ(+1.000000000)
 };
 
 int dsp_atan_10[1024] =
@@ -1092,7 +1622,7 @@ int dsp_nexp_10[1024] =
     FQ(+0.999653889),FQ(+0.999656582),FQ(+0.999659255),FQ(+0.999661906)
 };
 
-int dsp_sine_12[4096] =
+int dsp_qsine_12[1025] =
 {
     FQ(+0.000000000),FQ(+0.001533980),FQ(+0.003067957),FQ(+0.004601926),FQ(+0.006135885),
     FQ(+0.007669829),FQ(+0.009203755),FQ(+0.010737659),FQ(+0.012271538),FQ(+0.013805389),
@@ -1298,622 +1828,7 @@ int dsp_sine_12[4096] =
     FQ(+0.999575296),FQ(+0.999618822),FQ(+0.999659997),FQ(+0.999698819),FQ(+0.999735288),
     FQ(+0.999769405),FQ(+0.999801170),FQ(+0.999830582),FQ(+0.999857641),FQ(+0.999882347),
     FQ(+0.999904701),FQ(+0.999924702),FQ(+0.999942350),FQ(+0.999957645),FQ(+0.999970586),
-    FQ(+0.999981175),FQ(+0.999989411),FQ(+0.999995294),FQ(+0.999998823),FQ(+1.000000000),
-    FQ(+0.999998823),FQ(+0.999995294),FQ(+0.999989411),FQ(+0.999981175),FQ(+0.999970586),
-    FQ(+0.999957645),FQ(+0.999942350),FQ(+0.999924702),FQ(+0.999904701),FQ(+0.999882347),
-    FQ(+0.999857641),FQ(+0.999830582),FQ(+0.999801170),FQ(+0.999769405),FQ(+0.999735288),
-    FQ(+0.999698819),FQ(+0.999659997),FQ(+0.999618822),FQ(+0.999575296),FQ(+0.999529418),
-    FQ(+0.999481187),FQ(+0.999430605),FQ(+0.999377670),FQ(+0.999322385),FQ(+0.999264747),
-    FQ(+0.999204759),FQ(+0.999142419),FQ(+0.999077728),FQ(+0.999010686),FQ(+0.998941293),
-    FQ(+0.998869550),FQ(+0.998795456),FQ(+0.998719012),FQ(+0.998640218),FQ(+0.998559074),
-    FQ(+0.998475581),FQ(+0.998389737),FQ(+0.998301545),FQ(+0.998211003),FQ(+0.998118113),
-    FQ(+0.998022874),FQ(+0.997925286),FQ(+0.997825350),FQ(+0.997723067),FQ(+0.997618435),
-    FQ(+0.997511456),FQ(+0.997402130),FQ(+0.997290457),FQ(+0.997176437),FQ(+0.997060070),
-    FQ(+0.996941358),FQ(+0.996820299),FQ(+0.996696895),FQ(+0.996571146),FQ(+0.996443051),
-    FQ(+0.996312612),FQ(+0.996179829),FQ(+0.996044701),FQ(+0.995907229),FQ(+0.995767414),
-    FQ(+0.995625256),FQ(+0.995480755),FQ(+0.995333912),FQ(+0.995184727),FQ(+0.995033199),
-    FQ(+0.994879331),FQ(+0.994723121),FQ(+0.994564571),FQ(+0.994403680),FQ(+0.994240449),
-    FQ(+0.994074879),FQ(+0.993906970),FQ(+0.993736722),FQ(+0.993564136),FQ(+0.993389211),
-    FQ(+0.993211949),FQ(+0.993032350),FQ(+0.992850414),FQ(+0.992666142),FQ(+0.992479535),
-    FQ(+0.992290591),FQ(+0.992099313),FQ(+0.991905700),FQ(+0.991709754),FQ(+0.991511473),
-    FQ(+0.991310860),FQ(+0.991107914),FQ(+0.990902635),FQ(+0.990695025),FQ(+0.990485084),
-    FQ(+0.990272812),FQ(+0.990058210),FQ(+0.989841278),FQ(+0.989622017),FQ(+0.989400428),
-    FQ(+0.989176510),FQ(+0.988950265),FQ(+0.988721692),FQ(+0.988490793),FQ(+0.988257568),
-    FQ(+0.988022017),FQ(+0.987784142),FQ(+0.987543942),FQ(+0.987301418),FQ(+0.987056571),
-    FQ(+0.986809402),FQ(+0.986559910),FQ(+0.986308097),FQ(+0.986053963),FQ(+0.985797509),
-    FQ(+0.985538735),FQ(+0.985277642),FQ(+0.985014231),FQ(+0.984748502),FQ(+0.984480455),
-    FQ(+0.984210092),FQ(+0.983937413),FQ(+0.983662419),FQ(+0.983385110),FQ(+0.983105487),
-    FQ(+0.982823551),FQ(+0.982539302),FQ(+0.982252741),FQ(+0.981963869),FQ(+0.981672686),
-    FQ(+0.981379193),FQ(+0.981083391),FQ(+0.980785280),FQ(+0.980484862),FQ(+0.980182136),
-    FQ(+0.979877104),FQ(+0.979569766),FQ(+0.979260123),FQ(+0.978948175),FQ(+0.978633924),
-    FQ(+0.978317371),FQ(+0.977998515),FQ(+0.977677358),FQ(+0.977353900),FQ(+0.977028143),
-    FQ(+0.976700086),FQ(+0.976369731),FQ(+0.976037079),FQ(+0.975702130),FQ(+0.975364885),
-    FQ(+0.975025345),FQ(+0.974683511),FQ(+0.974339383),FQ(+0.973992962),FQ(+0.973644250),
-    FQ(+0.973293246),FQ(+0.972939952),FQ(+0.972584369),FQ(+0.972226497),FQ(+0.971866337),
-    FQ(+0.971503891),FQ(+0.971139158),FQ(+0.970772141),FQ(+0.970402839),FQ(+0.970031253),
-    FQ(+0.969657385),FQ(+0.969281235),FQ(+0.968902805),FQ(+0.968522094),FQ(+0.968139105),
-    FQ(+0.967753837),FQ(+0.967366292),FQ(+0.966976471),FQ(+0.966584374),FQ(+0.966190003),
-    FQ(+0.965793359),FQ(+0.965394442),FQ(+0.964993253),FQ(+0.964589793),FQ(+0.964184064),
-    FQ(+0.963776066),FQ(+0.963365800),FQ(+0.962953267),FQ(+0.962538468),FQ(+0.962121404),
-    FQ(+0.961702077),FQ(+0.961280486),FQ(+0.960856633),FQ(+0.960430519),FQ(+0.960002146),
-    FQ(+0.959571513),FQ(+0.959138622),FQ(+0.958703475),FQ(+0.958266071),FQ(+0.957826413),
-    FQ(+0.957384501),FQ(+0.956940336),FQ(+0.956493919),FQ(+0.956045251),FQ(+0.955594334),
-    FQ(+0.955141168),FQ(+0.954685755),FQ(+0.954228095),FQ(+0.953768190),FQ(+0.953306040),
-    FQ(+0.952841648),FQ(+0.952375013),FQ(+0.951906137),FQ(+0.951435021),FQ(+0.950961666),
-    FQ(+0.950486074),FQ(+0.950008245),FQ(+0.949528181),FQ(+0.949045882),FQ(+0.948561350),
-    FQ(+0.948074586),FQ(+0.947585591),FQ(+0.947094366),FQ(+0.946600913),FQ(+0.946105232),
-    FQ(+0.945607325),FQ(+0.945107193),FQ(+0.944604837),FQ(+0.944100258),FQ(+0.943593458),
-    FQ(+0.943084437),FQ(+0.942573198),FQ(+0.942059740),FQ(+0.941544065),FQ(+0.941026175),
-    FQ(+0.940506071),FQ(+0.939983753),FQ(+0.939459224),FQ(+0.938932484),FQ(+0.938403534),
-    FQ(+0.937872376),FQ(+0.937339012),FQ(+0.936803442),FQ(+0.936265667),FQ(+0.935725689),
-    FQ(+0.935183510),FQ(+0.934639130),FQ(+0.934092550),FQ(+0.933543773),FQ(+0.932992799),
-    FQ(+0.932439629),FQ(+0.931884266),FQ(+0.931326709),FQ(+0.930766961),FQ(+0.930205023),
-    FQ(+0.929640896),FQ(+0.929074581),FQ(+0.928506080),FQ(+0.927935395),FQ(+0.927362526),
-    FQ(+0.926787474),FQ(+0.926210242),FQ(+0.925630831),FQ(+0.925049241),FQ(+0.924465474),
-    FQ(+0.923879533),FQ(+0.923291417),FQ(+0.922701128),FQ(+0.922108669),FQ(+0.921514039),
-    FQ(+0.920917242),FQ(+0.920318277),FQ(+0.919717146),FQ(+0.919113852),FQ(+0.918508394),
-    FQ(+0.917900776),FQ(+0.917290997),FQ(+0.916679060),FQ(+0.916064966),FQ(+0.915448716),
-    FQ(+0.914830312),FQ(+0.914209756),FQ(+0.913587048),FQ(+0.912962190),FQ(+0.912335185),
-    FQ(+0.911706032),FQ(+0.911074734),FQ(+0.910441292),FQ(+0.909805708),FQ(+0.909167983),
-    FQ(+0.908528119),FQ(+0.907886116),FQ(+0.907241978),FQ(+0.906595705),FQ(+0.905947298),
-    FQ(+0.905296759),FQ(+0.904644091),FQ(+0.903989293),FQ(+0.903332368),FQ(+0.902673318),
-    FQ(+0.902012144),FQ(+0.901348847),FQ(+0.900683429),FQ(+0.900015892),FQ(+0.899346237),
-    FQ(+0.898674466),FQ(+0.898000580),FQ(+0.897324581),FQ(+0.896646470),FQ(+0.895966250),
-    FQ(+0.895283921),FQ(+0.894599486),FQ(+0.893912945),FQ(+0.893224301),FQ(+0.892533555),
-    FQ(+0.891840709),FQ(+0.891145765),FQ(+0.890448723),FQ(+0.889749586),FQ(+0.889048356),
-    FQ(+0.888345033),FQ(+0.887639620),FQ(+0.886932119),FQ(+0.886222530),FQ(+0.885510856),
-    FQ(+0.884797098),FQ(+0.884081259),FQ(+0.883363339),FQ(+0.882643340),FQ(+0.881921264),
-    FQ(+0.881197113),FQ(+0.880470889),FQ(+0.879742593),FQ(+0.879012226),FQ(+0.878279792),
-    FQ(+0.877545290),FQ(+0.876808724),FQ(+0.876070094),FQ(+0.875329403),FQ(+0.874586652),
-    FQ(+0.873841843),FQ(+0.873094978),FQ(+0.872346059),FQ(+0.871595087),FQ(+0.870842063),
-    FQ(+0.870086991),FQ(+0.869329871),FQ(+0.868570706),FQ(+0.867809497),FQ(+0.867046246),
-    FQ(+0.866280954),FQ(+0.865513624),FQ(+0.864744258),FQ(+0.863972856),FQ(+0.863199422),
-    FQ(+0.862423956),FQ(+0.861646461),FQ(+0.860866939),FQ(+0.860085390),FQ(+0.859301818),
-    FQ(+0.858516224),FQ(+0.857728610),FQ(+0.856938977),FQ(+0.856147328),FQ(+0.855353665),
-    FQ(+0.854557988),FQ(+0.853760301),FQ(+0.852960605),FQ(+0.852158902),FQ(+0.851355193),
-    FQ(+0.850549481),FQ(+0.849741768),FQ(+0.848932055),FQ(+0.848120345),FQ(+0.847306639),
-    FQ(+0.846490939),FQ(+0.845673247),FQ(+0.844853565),FQ(+0.844031895),FQ(+0.843208240),
-    FQ(+0.842382600),FQ(+0.841554977),FQ(+0.840725375),FQ(+0.839893794),FQ(+0.839060237),
-    FQ(+0.838224706),FQ(+0.837387202),FQ(+0.836547727),FQ(+0.835706284),FQ(+0.834862875),
-    FQ(+0.834017501),FQ(+0.833170165),FQ(+0.832320868),FQ(+0.831469612),FQ(+0.830616400),
-    FQ(+0.829761234),FQ(+0.828904115),FQ(+0.828045045),FQ(+0.827184027),FQ(+0.826321063),
-    FQ(+0.825456154),FQ(+0.824589303),FQ(+0.823720511),FQ(+0.822849781),FQ(+0.821977115),
-    FQ(+0.821102515),FQ(+0.820225983),FQ(+0.819347520),FQ(+0.818467130),FQ(+0.817584813),
-    FQ(+0.816700573),FQ(+0.815814411),FQ(+0.814926329),FQ(+0.814036330),FQ(+0.813144415),
-    FQ(+0.812250587),FQ(+0.811354847),FQ(+0.810457198),FQ(+0.809557642),FQ(+0.808656182),
-    FQ(+0.807752818),FQ(+0.806847554),FQ(+0.805940391),FQ(+0.805031331),FQ(+0.804120377),
-    FQ(+0.803207531),FQ(+0.802292796),FQ(+0.801376172),FQ(+0.800457662),FQ(+0.799537269),
-    FQ(+0.798614995),FQ(+0.797690841),FQ(+0.796764810),FQ(+0.795836905),FQ(+0.794907126),
-    FQ(+0.793975478),FQ(+0.793041960),FQ(+0.792106577),FQ(+0.791169330),FQ(+0.790230221),
-    FQ(+0.789289253),FQ(+0.788346428),FQ(+0.787401747),FQ(+0.786455214),FQ(+0.785506830),
-    FQ(+0.784556597),FQ(+0.783604519),FQ(+0.782650596),FQ(+0.781694832),FQ(+0.780737229),
-    FQ(+0.779777788),FQ(+0.778816512),FQ(+0.777853404),FQ(+0.776888466),FQ(+0.775921699),
-    FQ(+0.774953107),FQ(+0.773982691),FQ(+0.773010453),FQ(+0.772036397),FQ(+0.771060524),
-    FQ(+0.770082837),FQ(+0.769103338),FQ(+0.768122029),FQ(+0.767138912),FQ(+0.766153990),
-    FQ(+0.765167266),FQ(+0.764178741),FQ(+0.763188417),FQ(+0.762196298),FQ(+0.761202385),
-    FQ(+0.760206682),FQ(+0.759209189),FQ(+0.758209910),FQ(+0.757208847),FQ(+0.756206001),
-    FQ(+0.755201377),FQ(+0.754194975),FQ(+0.753186799),FQ(+0.752176850),FQ(+0.751165132),
-    FQ(+0.750151646),FQ(+0.749136395),FQ(+0.748119380),FQ(+0.747100606),FQ(+0.746080074),
-    FQ(+0.745057785),FQ(+0.744033744),FQ(+0.743007952),FQ(+0.741980412),FQ(+0.740951125),
-    FQ(+0.739920095),FQ(+0.738887324),FQ(+0.737852815),FQ(+0.736816569),FQ(+0.735778589),
-    FQ(+0.734738878),FQ(+0.733697438),FQ(+0.732654272),FQ(+0.731609381),FQ(+0.730562769),
-    FQ(+0.729514438),FQ(+0.728464390),FQ(+0.727412629),FQ(+0.726359155),FQ(+0.725303972),
-    FQ(+0.724247083),FQ(+0.723188489),FQ(+0.722128194),FQ(+0.721066199),FQ(+0.720002508),
-    FQ(+0.718937122),FQ(+0.717870045),FQ(+0.716801279),FQ(+0.715730825),FQ(+0.714658688),
-    FQ(+0.713584869),FQ(+0.712509371),FQ(+0.711432196),FQ(+0.710353347),FQ(+0.709272826),
-    FQ(+0.708190637),FQ(+0.707106781),FQ(+0.706021261),FQ(+0.704934080),FQ(+0.703845241),
-    FQ(+0.702754744),FQ(+0.701662595),FQ(+0.700568794),FQ(+0.699473345),FQ(+0.698376249),
-    FQ(+0.697277511),FQ(+0.696177131),FQ(+0.695075114),FQ(+0.693971461),FQ(+0.692866175),
-    FQ(+0.691759258),FQ(+0.690650714),FQ(+0.689540545),FQ(+0.688428753),FQ(+0.687315341),
-    FQ(+0.686200312),FQ(+0.685083668),FQ(+0.683965412),FQ(+0.682845546),FQ(+0.681724074),
-    FQ(+0.680600998),FQ(+0.679476320),FQ(+0.678350043),FQ(+0.677222170),FQ(+0.676092704),
-    FQ(+0.674961646),FQ(+0.673829000),FQ(+0.672694769),FQ(+0.671558955),FQ(+0.670421560),
-    FQ(+0.669282588),FQ(+0.668142041),FQ(+0.666999922),FQ(+0.665856234),FQ(+0.664710978),
-    FQ(+0.663564159),FQ(+0.662415778),FQ(+0.661265838),FQ(+0.660114342),FQ(+0.658961293),
-    FQ(+0.657806693),FQ(+0.656650546),FQ(+0.655492853),FQ(+0.654333618),FQ(+0.653172843),
-    FQ(+0.652010531),FQ(+0.650846685),FQ(+0.649681307),FQ(+0.648514401),FQ(+0.647345969),
-    FQ(+0.646176013),FQ(+0.645004537),FQ(+0.643831543),FQ(+0.642657034),FQ(+0.641481013),
-    FQ(+0.640303482),FQ(+0.639124445),FQ(+0.637943904),FQ(+0.636761861),FQ(+0.635578320),
-    FQ(+0.634393284),FQ(+0.633206755),FQ(+0.632018736),FQ(+0.630829230),FQ(+0.629638239),
-    FQ(+0.628445767),FQ(+0.627251815),FQ(+0.626056388),FQ(+0.624859488),FQ(+0.623661118),
-    FQ(+0.622461279),FQ(+0.621259977),FQ(+0.620057212),FQ(+0.618852988),FQ(+0.617647308),
-    FQ(+0.616440175),FQ(+0.615231591),FQ(+0.614021559),FQ(+0.612810082),FQ(+0.611597164),
-    FQ(+0.610382806),FQ(+0.609167012),FQ(+0.607949785),FQ(+0.606731127),FQ(+0.605511041),
-    FQ(+0.604289531),FQ(+0.603066599),FQ(+0.601842247),FQ(+0.600616479),FQ(+0.599389298),
-    FQ(+0.598160707),FQ(+0.596930708),FQ(+0.595699304),FQ(+0.594466499),FQ(+0.593232295),
-    FQ(+0.591996695),FQ(+0.590759702),FQ(+0.589521319),FQ(+0.588281548),FQ(+0.587040394),
-    FQ(+0.585797857),FQ(+0.584553943),FQ(+0.583308653),FQ(+0.582061990),FQ(+0.580813958),
-    FQ(+0.579564559),FQ(+0.578313796),FQ(+0.577061673),FQ(+0.575808191),FQ(+0.574553355),
-    FQ(+0.573297167),FQ(+0.572039629),FQ(+0.570780746),FQ(+0.569520519),FQ(+0.568258953),
-    FQ(+0.566996049),FQ(+0.565731811),FQ(+0.564466242),FQ(+0.563199344),FQ(+0.561931121),
-    FQ(+0.560661576),FQ(+0.559390712),FQ(+0.558118531),FQ(+0.556845037),FQ(+0.555570233),
-    FQ(+0.554294121),FQ(+0.553016706),FQ(+0.551737988),FQ(+0.550457973),FQ(+0.549176662),
-    FQ(+0.547894059),FQ(+0.546610167),FQ(+0.545324988),FQ(+0.544038527),FQ(+0.542750785),
-    FQ(+0.541461766),FQ(+0.540171473),FQ(+0.538879909),FQ(+0.537587076),FQ(+0.536292979),
-    FQ(+0.534997620),FQ(+0.533701002),FQ(+0.532403128),FQ(+0.531104001),FQ(+0.529803625),
-    FQ(+0.528502002),FQ(+0.527199135),FQ(+0.525895027),FQ(+0.524589683),FQ(+0.523283103),
-    FQ(+0.521975293),FQ(+0.520666254),FQ(+0.519355990),FQ(+0.518044504),FQ(+0.516731799),
-    FQ(+0.515417878),FQ(+0.514102744),FQ(+0.512786401),FQ(+0.511468850),FQ(+0.510150097),
-    FQ(+0.508830143),FQ(+0.507508991),FQ(+0.506186645),FQ(+0.504863109),FQ(+0.503538384),
-    FQ(+0.502212474),FQ(+0.500885383),FQ(+0.499557113),FQ(+0.498227667),FQ(+0.496897049),
-    FQ(+0.495565262),FQ(+0.494232309),FQ(+0.492898192),FQ(+0.491562916),FQ(+0.490226483),
-    FQ(+0.488888897),FQ(+0.487550160),FQ(+0.486210276),FQ(+0.484869248),FQ(+0.483527079),
-    FQ(+0.482183772),FQ(+0.480839331),FQ(+0.479493758),FQ(+0.478147056),FQ(+0.476799230),
-    FQ(+0.475450282),FQ(+0.474100215),FQ(+0.472749032),FQ(+0.471396737),FQ(+0.470043332),
-    FQ(+0.468688822),FQ(+0.467333209),FQ(+0.465976496),FQ(+0.464618686),FQ(+0.463259784),
-    FQ(+0.461899791),FQ(+0.460538711),FQ(+0.459176548),FQ(+0.457813304),FQ(+0.456448982),
-    FQ(+0.455083587),FQ(+0.453717121),FQ(+0.452349587),FQ(+0.450980989),FQ(+0.449611330),
-    FQ(+0.448240612),FQ(+0.446868840),FQ(+0.445496017),FQ(+0.444122145),FQ(+0.442747228),
-    FQ(+0.441371269),FQ(+0.439994271),FQ(+0.438616239),FQ(+0.437237174),FQ(+0.435857080),
-    FQ(+0.434475961),FQ(+0.433093819),FQ(+0.431710658),FQ(+0.430326481),FQ(+0.428941292),
-    FQ(+0.427555093),FQ(+0.426167889),FQ(+0.424779681),FQ(+0.423390474),FQ(+0.422000271),
-    FQ(+0.420609074),FQ(+0.419216888),FQ(+0.417823716),FQ(+0.416429560),FQ(+0.415034424),
-    FQ(+0.413638312),FQ(+0.412241227),FQ(+0.410843171),FQ(+0.409444149),FQ(+0.408044163),
-    FQ(+0.406643217),FQ(+0.405241314),FQ(+0.403838458),FQ(+0.402434651),FQ(+0.401029897),
-    FQ(+0.399624200),FQ(+0.398217562),FQ(+0.396809987),FQ(+0.395401479),FQ(+0.393992040),
-    FQ(+0.392581674),FQ(+0.391170384),FQ(+0.389758174),FQ(+0.388345047),FQ(+0.386931006),
-    FQ(+0.385516054),FQ(+0.384100195),FQ(+0.382683432),FQ(+0.381265769),FQ(+0.379847209),
-    FQ(+0.378427755),FQ(+0.377007410),FQ(+0.375586178),FQ(+0.374164063),FQ(+0.372741067),
-    FQ(+0.371317194),FQ(+0.369892447),FQ(+0.368466830),FQ(+0.367040346),FQ(+0.365612998),
-    FQ(+0.364184790),FQ(+0.362755724),FQ(+0.361325806),FQ(+0.359895037),FQ(+0.358463421),
-    FQ(+0.357030961),FQ(+0.355597662),FQ(+0.354163525),FQ(+0.352728556),FQ(+0.351292756),
-    FQ(+0.349856130),FQ(+0.348418680),FQ(+0.346980411),FQ(+0.345541325),FQ(+0.344101426),
-    FQ(+0.342660717),FQ(+0.341219202),FQ(+0.339776884),FQ(+0.338333767),FQ(+0.336889853),
-    FQ(+0.335445147),FQ(+0.333999651),FQ(+0.332553370),FQ(+0.331106306),FQ(+0.329658463),
-    FQ(+0.328209844),FQ(+0.326760452),FQ(+0.325310292),FQ(+0.323859367),FQ(+0.322407679),
-    FQ(+0.320955232),FQ(+0.319502031),FQ(+0.318048077),FQ(+0.316593376),FQ(+0.315137929),
-    FQ(+0.313681740),FQ(+0.312224814),FQ(+0.310767153),FQ(+0.309308760),FQ(+0.307849640),
-    FQ(+0.306389795),FQ(+0.304929230),FQ(+0.303467947),FQ(+0.302005949),FQ(+0.300543241),
-    FQ(+0.299079826),FQ(+0.297615707),FQ(+0.296150888),FQ(+0.294685372),FQ(+0.293219163),
-    FQ(+0.291752263),FQ(+0.290284677),FQ(+0.288816408),FQ(+0.287347460),FQ(+0.285877835),
-    FQ(+0.284407537),FQ(+0.282936570),FQ(+0.281464938),FQ(+0.279992643),FQ(+0.278519689),
-    FQ(+0.277046080),FQ(+0.275571819),FQ(+0.274096910),FQ(+0.272621355),FQ(+0.271145160),
-    FQ(+0.269668326),FQ(+0.268190857),FQ(+0.266712757),FQ(+0.265234030),FQ(+0.263754679),
-    FQ(+0.262274707),FQ(+0.260794118),FQ(+0.259312915),FQ(+0.257831102),FQ(+0.256348682),
-    FQ(+0.254865660),FQ(+0.253382037),FQ(+0.251897818),FQ(+0.250413007),FQ(+0.248927606),
-    FQ(+0.247441619),FQ(+0.245955050),FQ(+0.244467903),FQ(+0.242980180),FQ(+0.241491885),
-    FQ(+0.240003022),FQ(+0.238513595),FQ(+0.237023606),FQ(+0.235533059),FQ(+0.234041959),
-    FQ(+0.232550307),FQ(+0.231058108),FQ(+0.229565366),FQ(+0.228072083),FQ(+0.226578264),
-    FQ(+0.225083911),FQ(+0.223589029),FQ(+0.222093621),FQ(+0.220597690),FQ(+0.219101240),
-    FQ(+0.217604275),FQ(+0.216106797),FQ(+0.214608811),FQ(+0.213110320),FQ(+0.211611327),
-    FQ(+0.210111837),FQ(+0.208611852),FQ(+0.207111376),FQ(+0.205610413),FQ(+0.204108966),
-    FQ(+0.202607039),FQ(+0.201104635),FQ(+0.199601758),FQ(+0.198098411),FQ(+0.196594598),
-    FQ(+0.195090322),FQ(+0.193585587),FQ(+0.192080397),FQ(+0.190574755),FQ(+0.189068664),
-    FQ(+0.187562129),FQ(+0.186055152),FQ(+0.184547737),FQ(+0.183039888),FQ(+0.181531608),
-    FQ(+0.180022901),FQ(+0.178513771),FQ(+0.177004220),FQ(+0.175494253),FQ(+0.173983873),
-    FQ(+0.172473084),FQ(+0.170961889),FQ(+0.169450291),FQ(+0.167938295),FQ(+0.166425904),
-    FQ(+0.164913120),FQ(+0.163399949),FQ(+0.161886394),FQ(+0.160372457),FQ(+0.158858143),
-    FQ(+0.157343456),FQ(+0.155828398),FQ(+0.154312973),FQ(+0.152797185),FQ(+0.151281038),
-    FQ(+0.149764535),FQ(+0.148247679),FQ(+0.146730474),FQ(+0.145212925),FQ(+0.143695033),
-    FQ(+0.142176804),FQ(+0.140658239),FQ(+0.139139344),FQ(+0.137620122),FQ(+0.136100575),
-    FQ(+0.134580709),FQ(+0.133060525),FQ(+0.131540029),FQ(+0.130019223),FQ(+0.128498111),
-    FQ(+0.126976696),FQ(+0.125454983),FQ(+0.123932975),FQ(+0.122410675),FQ(+0.120888087),
-    FQ(+0.119365215),FQ(+0.117842062),FQ(+0.116318631),FQ(+0.114794927),FQ(+0.113270952),
-    FQ(+0.111746711),FQ(+0.110222207),FQ(+0.108697444),FQ(+0.107172425),FQ(+0.105647154),
-    FQ(+0.104121634),FQ(+0.102595869),FQ(+0.101069863),FQ(+0.099543619),FQ(+0.098017140),
-    FQ(+0.096490431),FQ(+0.094963495),FQ(+0.093436336),FQ(+0.091908956),FQ(+0.090381361),
-    FQ(+0.088853553),FQ(+0.087325535),FQ(+0.085797312),FQ(+0.084268888),FQ(+0.082740265),
-    FQ(+0.081211447),FQ(+0.079682438),FQ(+0.078153242),FQ(+0.076623861),FQ(+0.075094301),
-    FQ(+0.073564564),FQ(+0.072034653),FQ(+0.070504573),FQ(+0.068974328),FQ(+0.067443920),
-    FQ(+0.065913353),FQ(+0.064382631),FQ(+0.062851758),FQ(+0.061320736),FQ(+0.059789571),
-    FQ(+0.058258265),FQ(+0.056726821),FQ(+0.055195244),FQ(+0.053663538),FQ(+0.052131705),
-    FQ(+0.050599749),FQ(+0.049067674),FQ(+0.047535484),FQ(+0.046003182),FQ(+0.044470772),
-    FQ(+0.042938257),FQ(+0.041405641),FQ(+0.039872928),FQ(+0.038340120),FQ(+0.036807223),
-    FQ(+0.035274239),FQ(+0.033741172),FQ(+0.032208025),FQ(+0.030674803),FQ(+0.029141509),
-    FQ(+0.027608146),FQ(+0.026074718),FQ(+0.024541229),FQ(+0.023007681),FQ(+0.021474080),
-    FQ(+0.019940429),FQ(+0.018406730),FQ(+0.016872988),FQ(+0.015339206),FQ(+0.013805389),
-    FQ(+0.012271538),FQ(+0.010737659),FQ(+0.009203755),FQ(+0.007669829),FQ(+0.006135885),
-    FQ(+0.004601926),FQ(+0.003067957),FQ(+0.001533980),FQ(+0.000000000),FQ(-0.001533980),
-    FQ(-0.003067957),FQ(-0.004601926),FQ(-0.006135885),FQ(-0.007669829),FQ(-0.009203755),
-    FQ(-0.010737659),FQ(-0.012271538),FQ(-0.013805389),FQ(-0.015339206),FQ(-0.016872988),
-    FQ(-0.018406730),FQ(-0.019940429),FQ(-0.021474080),FQ(-0.023007681),FQ(-0.024541229),
-    FQ(-0.026074718),FQ(-0.027608146),FQ(-0.029141509),FQ(-0.030674803),FQ(-0.032208025),
-    FQ(-0.033741172),FQ(-0.035274239),FQ(-0.036807223),FQ(-0.038340120),FQ(-0.039872928),
-    FQ(-0.041405641),FQ(-0.042938257),FQ(-0.044470772),FQ(-0.046003182),FQ(-0.047535484),
-    FQ(-0.049067674),FQ(-0.050599749),FQ(-0.052131705),FQ(-0.053663538),FQ(-0.055195244),
-    FQ(-0.056726821),FQ(-0.058258265),FQ(-0.059789571),FQ(-0.061320736),FQ(-0.062851758),
-    FQ(-0.064382631),FQ(-0.065913353),FQ(-0.067443920),FQ(-0.068974328),FQ(-0.070504573),
-    FQ(-0.072034653),FQ(-0.073564564),FQ(-0.075094301),FQ(-0.076623861),FQ(-0.078153242),
-    FQ(-0.079682438),FQ(-0.081211447),FQ(-0.082740265),FQ(-0.084268888),FQ(-0.085797312),
-    FQ(-0.087325535),FQ(-0.088853553),FQ(-0.090381361),FQ(-0.091908956),FQ(-0.093436336),
-    FQ(-0.094963495),FQ(-0.096490431),FQ(-0.098017140),FQ(-0.099543619),FQ(-0.101069863),
-    FQ(-0.102595869),FQ(-0.104121634),FQ(-0.105647154),FQ(-0.107172425),FQ(-0.108697444),
-    FQ(-0.110222207),FQ(-0.111746711),FQ(-0.113270952),FQ(-0.114794927),FQ(-0.116318631),
-    FQ(-0.117842062),FQ(-0.119365215),FQ(-0.120888087),FQ(-0.122410675),FQ(-0.123932975),
-    FQ(-0.125454983),FQ(-0.126976696),FQ(-0.128498111),FQ(-0.130019223),FQ(-0.131540029),
-    FQ(-0.133060525),FQ(-0.134580709),FQ(-0.136100575),FQ(-0.137620122),FQ(-0.139139344),
-    FQ(-0.140658239),FQ(-0.142176804),FQ(-0.143695033),FQ(-0.145212925),FQ(-0.146730474),
-    FQ(-0.148247679),FQ(-0.149764535),FQ(-0.151281038),FQ(-0.152797185),FQ(-0.154312973),
-    FQ(-0.155828398),FQ(-0.157343456),FQ(-0.158858143),FQ(-0.160372457),FQ(-0.161886394),
-    FQ(-0.163399949),FQ(-0.164913120),FQ(-0.166425904),FQ(-0.167938295),FQ(-0.169450291),
-    FQ(-0.170961889),FQ(-0.172473084),FQ(-0.173983873),FQ(-0.175494253),FQ(-0.177004220),
-    FQ(-0.178513771),FQ(-0.180022901),FQ(-0.181531608),FQ(-0.183039888),FQ(-0.184547737),
-    FQ(-0.186055152),FQ(-0.187562129),FQ(-0.189068664),FQ(-0.190574755),FQ(-0.192080397),
-    FQ(-0.193585587),FQ(-0.195090322),FQ(-0.196594598),FQ(-0.198098411),FQ(-0.199601758),
-    FQ(-0.201104635),FQ(-0.202607039),FQ(-0.204108966),FQ(-0.205610413),FQ(-0.207111376),
-    FQ(-0.208611852),FQ(-0.210111837),FQ(-0.211611327),FQ(-0.213110320),FQ(-0.214608811),
-    FQ(-0.216106797),FQ(-0.217604275),FQ(-0.219101240),FQ(-0.220597690),FQ(-0.222093621),
-    FQ(-0.223589029),FQ(-0.225083911),FQ(-0.226578264),FQ(-0.228072083),FQ(-0.229565366),
-    FQ(-0.231058108),FQ(-0.232550307),FQ(-0.234041959),FQ(-0.235533059),FQ(-0.237023606),
-    FQ(-0.238513595),FQ(-0.240003022),FQ(-0.241491885),FQ(-0.242980180),FQ(-0.244467903),
-    FQ(-0.245955050),FQ(-0.247441619),FQ(-0.248927606),FQ(-0.250413007),FQ(-0.251897818),
-    FQ(-0.253382037),FQ(-0.254865660),FQ(-0.256348682),FQ(-0.257831102),FQ(-0.259312915),
-    FQ(-0.260794118),FQ(-0.262274707),FQ(-0.263754679),FQ(-0.265234030),FQ(-0.266712757),
-    FQ(-0.268190857),FQ(-0.269668326),FQ(-0.271145160),FQ(-0.272621355),FQ(-0.274096910),
-    FQ(-0.275571819),FQ(-0.277046080),FQ(-0.278519689),FQ(-0.279992643),FQ(-0.281464938),
-    FQ(-0.282936570),FQ(-0.284407537),FQ(-0.285877835),FQ(-0.287347460),FQ(-0.288816408),
-    FQ(-0.290284677),FQ(-0.291752263),FQ(-0.293219163),FQ(-0.294685372),FQ(-0.296150888),
-    FQ(-0.297615707),FQ(-0.299079826),FQ(-0.300543241),FQ(-0.302005949),FQ(-0.303467947),
-    FQ(-0.304929230),FQ(-0.306389795),FQ(-0.307849640),FQ(-0.309308760),FQ(-0.310767153),
-    FQ(-0.312224814),FQ(-0.313681740),FQ(-0.315137929),FQ(-0.316593376),FQ(-0.318048077),
-    FQ(-0.319502031),FQ(-0.320955232),FQ(-0.322407679),FQ(-0.323859367),FQ(-0.325310292),
-    FQ(-0.326760452),FQ(-0.328209844),FQ(-0.329658463),FQ(-0.331106306),FQ(-0.332553370),
-    FQ(-0.333999651),FQ(-0.335445147),FQ(-0.336889853),FQ(-0.338333767),FQ(-0.339776884),
-    FQ(-0.341219202),FQ(-0.342660717),FQ(-0.344101426),FQ(-0.345541325),FQ(-0.346980411),
-    FQ(-0.348418680),FQ(-0.349856130),FQ(-0.351292756),FQ(-0.352728556),FQ(-0.354163525),
-    FQ(-0.355597662),FQ(-0.357030961),FQ(-0.358463421),FQ(-0.359895037),FQ(-0.361325806),
-    FQ(-0.362755724),FQ(-0.364184790),FQ(-0.365612998),FQ(-0.367040346),FQ(-0.368466830),
-    FQ(-0.369892447),FQ(-0.371317194),FQ(-0.372741067),FQ(-0.374164063),FQ(-0.375586178),
-    FQ(-0.377007410),FQ(-0.378427755),FQ(-0.379847209),FQ(-0.381265769),FQ(-0.382683432),
-    FQ(-0.384100195),FQ(-0.385516054),FQ(-0.386931006),FQ(-0.388345047),FQ(-0.389758174),
-    FQ(-0.391170384),FQ(-0.392581674),FQ(-0.393992040),FQ(-0.395401479),FQ(-0.396809987),
-    FQ(-0.398217562),FQ(-0.399624200),FQ(-0.401029897),FQ(-0.402434651),FQ(-0.403838458),
-    FQ(-0.405241314),FQ(-0.406643217),FQ(-0.408044163),FQ(-0.409444149),FQ(-0.410843171),
-    FQ(-0.412241227),FQ(-0.413638312),FQ(-0.415034424),FQ(-0.416429560),FQ(-0.417823716),
-    FQ(-0.419216888),FQ(-0.420609074),FQ(-0.422000271),FQ(-0.423390474),FQ(-0.424779681),
-    FQ(-0.426167889),FQ(-0.427555093),FQ(-0.428941292),FQ(-0.430326481),FQ(-0.431710658),
-    FQ(-0.433093819),FQ(-0.434475961),FQ(-0.435857080),FQ(-0.437237174),FQ(-0.438616239),
-    FQ(-0.439994271),FQ(-0.441371269),FQ(-0.442747228),FQ(-0.444122145),FQ(-0.445496017),
-    FQ(-0.446868840),FQ(-0.448240612),FQ(-0.449611330),FQ(-0.450980989),FQ(-0.452349587),
-    FQ(-0.453717121),FQ(-0.455083587),FQ(-0.456448982),FQ(-0.457813304),FQ(-0.459176548),
-    FQ(-0.460538711),FQ(-0.461899791),FQ(-0.463259784),FQ(-0.464618686),FQ(-0.465976496),
-    FQ(-0.467333209),FQ(-0.468688822),FQ(-0.470043332),FQ(-0.471396737),FQ(-0.472749032),
-    FQ(-0.474100215),FQ(-0.475450282),FQ(-0.476799230),FQ(-0.478147056),FQ(-0.479493758),
-    FQ(-0.480839331),FQ(-0.482183772),FQ(-0.483527079),FQ(-0.484869248),FQ(-0.486210276),
-    FQ(-0.487550160),FQ(-0.488888897),FQ(-0.490226483),FQ(-0.491562916),FQ(-0.492898192),
-    FQ(-0.494232309),FQ(-0.495565262),FQ(-0.496897049),FQ(-0.498227667),FQ(-0.499557113),
-    FQ(-0.500885383),FQ(-0.502212474),FQ(-0.503538384),FQ(-0.504863109),FQ(-0.506186645),
-    FQ(-0.507508991),FQ(-0.508830143),FQ(-0.510150097),FQ(-0.511468850),FQ(-0.512786401),
-    FQ(-0.514102744),FQ(-0.515417878),FQ(-0.516731799),FQ(-0.518044504),FQ(-0.519355990),
-    FQ(-0.520666254),FQ(-0.521975293),FQ(-0.523283103),FQ(-0.524589683),FQ(-0.525895027),
-    FQ(-0.527199135),FQ(-0.528502002),FQ(-0.529803625),FQ(-0.531104001),FQ(-0.532403128),
-    FQ(-0.533701002),FQ(-0.534997620),FQ(-0.536292979),FQ(-0.537587076),FQ(-0.538879909),
-    FQ(-0.540171473),FQ(-0.541461766),FQ(-0.542750785),FQ(-0.544038527),FQ(-0.545324988),
-    FQ(-0.546610167),FQ(-0.547894059),FQ(-0.549176662),FQ(-0.550457973),FQ(-0.551737988),
-    FQ(-0.553016706),FQ(-0.554294121),FQ(-0.555570233),FQ(-0.556845037),FQ(-0.558118531),
-    FQ(-0.559390712),FQ(-0.560661576),FQ(-0.561931121),FQ(-0.563199344),FQ(-0.564466242),
-    FQ(-0.565731811),FQ(-0.566996049),FQ(-0.568258953),FQ(-0.569520519),FQ(-0.570780746),
-    FQ(-0.572039629),FQ(-0.573297167),FQ(-0.574553355),FQ(-0.575808191),FQ(-0.577061673),
-    FQ(-0.578313796),FQ(-0.579564559),FQ(-0.580813958),FQ(-0.582061990),FQ(-0.583308653),
-    FQ(-0.584553943),FQ(-0.585797857),FQ(-0.587040394),FQ(-0.588281548),FQ(-0.589521319),
-    FQ(-0.590759702),FQ(-0.591996695),FQ(-0.593232295),FQ(-0.594466499),FQ(-0.595699304),
-    FQ(-0.596930708),FQ(-0.598160707),FQ(-0.599389298),FQ(-0.600616479),FQ(-0.601842247),
-    FQ(-0.603066599),FQ(-0.604289531),FQ(-0.605511041),FQ(-0.606731127),FQ(-0.607949785),
-    FQ(-0.609167012),FQ(-0.610382806),FQ(-0.611597164),FQ(-0.612810082),FQ(-0.614021559),
-    FQ(-0.615231591),FQ(-0.616440175),FQ(-0.617647308),FQ(-0.618852988),FQ(-0.620057212),
-    FQ(-0.621259977),FQ(-0.622461279),FQ(-0.623661118),FQ(-0.624859488),FQ(-0.626056388),
-    FQ(-0.627251815),FQ(-0.628445767),FQ(-0.629638239),FQ(-0.630829230),FQ(-0.632018736),
-    FQ(-0.633206755),FQ(-0.634393284),FQ(-0.635578320),FQ(-0.636761861),FQ(-0.637943904),
-    FQ(-0.639124445),FQ(-0.640303482),FQ(-0.641481013),FQ(-0.642657034),FQ(-0.643831543),
-    FQ(-0.645004537),FQ(-0.646176013),FQ(-0.647345969),FQ(-0.648514401),FQ(-0.649681307),
-    FQ(-0.650846685),FQ(-0.652010531),FQ(-0.653172843),FQ(-0.654333618),FQ(-0.655492853),
-    FQ(-0.656650546),FQ(-0.657806693),FQ(-0.658961293),FQ(-0.660114342),FQ(-0.661265838),
-    FQ(-0.662415778),FQ(-0.663564159),FQ(-0.664710978),FQ(-0.665856234),FQ(-0.666999922),
-    FQ(-0.668142041),FQ(-0.669282588),FQ(-0.670421560),FQ(-0.671558955),FQ(-0.672694769),
-    FQ(-0.673829000),FQ(-0.674961646),FQ(-0.676092704),FQ(-0.677222170),FQ(-0.678350043),
-    FQ(-0.679476320),FQ(-0.680600998),FQ(-0.681724074),FQ(-0.682845546),FQ(-0.683965412),
-    FQ(-0.685083668),FQ(-0.686200312),FQ(-0.687315341),FQ(-0.688428753),FQ(-0.689540545),
-    FQ(-0.690650714),FQ(-0.691759258),FQ(-0.692866175),FQ(-0.693971461),FQ(-0.695075114),
-    FQ(-0.696177131),FQ(-0.697277511),FQ(-0.698376249),FQ(-0.699473345),FQ(-0.700568794),
-    FQ(-0.701662595),FQ(-0.702754744),FQ(-0.703845241),FQ(-0.704934080),FQ(-0.706021261),
-    FQ(-0.707106781),FQ(-0.708190637),FQ(-0.709272826),FQ(-0.710353347),FQ(-0.711432196),
-    FQ(-0.712509371),FQ(-0.713584869),FQ(-0.714658688),FQ(-0.715730825),FQ(-0.716801279),
-    FQ(-0.717870045),FQ(-0.718937122),FQ(-0.720002508),FQ(-0.721066199),FQ(-0.722128194),
-    FQ(-0.723188489),FQ(-0.724247083),FQ(-0.725303972),FQ(-0.726359155),FQ(-0.727412629),
-    FQ(-0.728464390),FQ(-0.729514438),FQ(-0.730562769),FQ(-0.731609381),FQ(-0.732654272),
-    FQ(-0.733697438),FQ(-0.734738878),FQ(-0.735778589),FQ(-0.736816569),FQ(-0.737852815),
-    FQ(-0.738887324),FQ(-0.739920095),FQ(-0.740951125),FQ(-0.741980412),FQ(-0.743007952),
-    FQ(-0.744033744),FQ(-0.745057785),FQ(-0.746080074),FQ(-0.747100606),FQ(-0.748119380),
-    FQ(-0.749136395),FQ(-0.750151646),FQ(-0.751165132),FQ(-0.752176850),FQ(-0.753186799),
-    FQ(-0.754194975),FQ(-0.755201377),FQ(-0.756206001),FQ(-0.757208847),FQ(-0.758209910),
-    FQ(-0.759209189),FQ(-0.760206682),FQ(-0.761202385),FQ(-0.762196298),FQ(-0.763188417),
-    FQ(-0.764178741),FQ(-0.765167266),FQ(-0.766153990),FQ(-0.767138912),FQ(-0.768122029),
-    FQ(-0.769103338),FQ(-0.770082837),FQ(-0.771060524),FQ(-0.772036397),FQ(-0.773010453),
-    FQ(-0.773982691),FQ(-0.774953107),FQ(-0.775921699),FQ(-0.776888466),FQ(-0.777853404),
-    FQ(-0.778816512),FQ(-0.779777788),FQ(-0.780737229),FQ(-0.781694832),FQ(-0.782650596),
-    FQ(-0.783604519),FQ(-0.784556597),FQ(-0.785506830),FQ(-0.786455214),FQ(-0.787401747),
-    FQ(-0.788346428),FQ(-0.789289253),FQ(-0.790230221),FQ(-0.791169330),FQ(-0.792106577),
-    FQ(-0.793041960),FQ(-0.793975478),FQ(-0.794907126),FQ(-0.795836905),FQ(-0.796764810),
-    FQ(-0.797690841),FQ(-0.798614995),FQ(-0.799537269),FQ(-0.800457662),FQ(-0.801376172),
-    FQ(-0.802292796),FQ(-0.803207531),FQ(-0.804120377),FQ(-0.805031331),FQ(-0.805940391),
-    FQ(-0.806847554),FQ(-0.807752818),FQ(-0.808656182),FQ(-0.809557642),FQ(-0.810457198),
-    FQ(-0.811354847),FQ(-0.812250587),FQ(-0.813144415),FQ(-0.814036330),FQ(-0.814926329),
-    FQ(-0.815814411),FQ(-0.816700573),FQ(-0.817584813),FQ(-0.818467130),FQ(-0.819347520),
-    FQ(-0.820225983),FQ(-0.821102515),FQ(-0.821977115),FQ(-0.822849781),FQ(-0.823720511),
-    FQ(-0.824589303),FQ(-0.825456154),FQ(-0.826321063),FQ(-0.827184027),FQ(-0.828045045),
-    FQ(-0.828904115),FQ(-0.829761234),FQ(-0.830616400),FQ(-0.831469612),FQ(-0.832320868),
-    FQ(-0.833170165),FQ(-0.834017501),FQ(-0.834862875),FQ(-0.835706284),FQ(-0.836547727),
-    FQ(-0.837387202),FQ(-0.838224706),FQ(-0.839060237),FQ(-0.839893794),FQ(-0.840725375),
-    FQ(-0.841554977),FQ(-0.842382600),FQ(-0.843208240),FQ(-0.844031895),FQ(-0.844853565),
-    FQ(-0.845673247),FQ(-0.846490939),FQ(-0.847306639),FQ(-0.848120345),FQ(-0.848932055),
-    FQ(-0.849741768),FQ(-0.850549481),FQ(-0.851355193),FQ(-0.852158902),FQ(-0.852960605),
-    FQ(-0.853760301),FQ(-0.854557988),FQ(-0.855353665),FQ(-0.856147328),FQ(-0.856938977),
-    FQ(-0.857728610),FQ(-0.858516224),FQ(-0.859301818),FQ(-0.860085390),FQ(-0.860866939),
-    FQ(-0.861646461),FQ(-0.862423956),FQ(-0.863199422),FQ(-0.863972856),FQ(-0.864744258),
-    FQ(-0.865513624),FQ(-0.866280954),FQ(-0.867046246),FQ(-0.867809497),FQ(-0.868570706),
-    FQ(-0.869329871),FQ(-0.870086991),FQ(-0.870842063),FQ(-0.871595087),FQ(-0.872346059),
-    FQ(-0.873094978),FQ(-0.873841843),FQ(-0.874586652),FQ(-0.875329403),FQ(-0.876070094),
-    FQ(-0.876808724),FQ(-0.877545290),FQ(-0.878279792),FQ(-0.879012226),FQ(-0.879742593),
-    FQ(-0.880470889),FQ(-0.881197113),FQ(-0.881921264),FQ(-0.882643340),FQ(-0.883363339),
-    FQ(-0.884081259),FQ(-0.884797098),FQ(-0.885510856),FQ(-0.886222530),FQ(-0.886932119),
-    FQ(-0.887639620),FQ(-0.888345033),FQ(-0.889048356),FQ(-0.889749586),FQ(-0.890448723),
-    FQ(-0.891145765),FQ(-0.891840709),FQ(-0.892533555),FQ(-0.893224301),FQ(-0.893912945),
-    FQ(-0.894599486),FQ(-0.895283921),FQ(-0.895966250),FQ(-0.896646470),FQ(-0.897324581),
-    FQ(-0.898000580),FQ(-0.898674466),FQ(-0.899346237),FQ(-0.900015892),FQ(-0.900683429),
-    FQ(-0.901348847),FQ(-0.902012144),FQ(-0.902673318),FQ(-0.903332368),FQ(-0.903989293),
-    FQ(-0.904644091),FQ(-0.905296759),FQ(-0.905947298),FQ(-0.906595705),FQ(-0.907241978),
-    FQ(-0.907886116),FQ(-0.908528119),FQ(-0.909167983),FQ(-0.909805708),FQ(-0.910441292),
-    FQ(-0.911074734),FQ(-0.911706032),FQ(-0.912335185),FQ(-0.912962190),FQ(-0.913587048),
-    FQ(-0.914209756),FQ(-0.914830312),FQ(-0.915448716),FQ(-0.916064966),FQ(-0.916679060),
-    FQ(-0.917290997),FQ(-0.917900776),FQ(-0.918508394),FQ(-0.919113852),FQ(-0.919717146),
-    FQ(-0.920318277),FQ(-0.920917242),FQ(-0.921514039),FQ(-0.922108669),FQ(-0.922701128),
-    FQ(-0.923291417),FQ(-0.923879533),FQ(-0.924465474),FQ(-0.925049241),FQ(-0.925630831),
-    FQ(-0.926210242),FQ(-0.926787474),FQ(-0.927362526),FQ(-0.927935395),FQ(-0.928506080),
-    FQ(-0.929074581),FQ(-0.929640896),FQ(-0.930205023),FQ(-0.930766961),FQ(-0.931326709),
-    FQ(-0.931884266),FQ(-0.932439629),FQ(-0.932992799),FQ(-0.933543773),FQ(-0.934092550),
-    FQ(-0.934639130),FQ(-0.935183510),FQ(-0.935725689),FQ(-0.936265667),FQ(-0.936803442),
-    FQ(-0.937339012),FQ(-0.937872376),FQ(-0.938403534),FQ(-0.938932484),FQ(-0.939459224),
-    FQ(-0.939983753),FQ(-0.940506071),FQ(-0.941026175),FQ(-0.941544065),FQ(-0.942059740),
-    FQ(-0.942573198),FQ(-0.943084437),FQ(-0.943593458),FQ(-0.944100258),FQ(-0.944604837),
-    FQ(-0.945107193),FQ(-0.945607325),FQ(-0.946105232),FQ(-0.946600913),FQ(-0.947094366),
-    FQ(-0.947585591),FQ(-0.948074586),FQ(-0.948561350),FQ(-0.949045882),FQ(-0.949528181),
-    FQ(-0.950008245),FQ(-0.950486074),FQ(-0.950961666),FQ(-0.951435021),FQ(-0.951906137),
-    FQ(-0.952375013),FQ(-0.952841648),FQ(-0.953306040),FQ(-0.953768190),FQ(-0.954228095),
-    FQ(-0.954685755),FQ(-0.955141168),FQ(-0.955594334),FQ(-0.956045251),FQ(-0.956493919),
-    FQ(-0.956940336),FQ(-0.957384501),FQ(-0.957826413),FQ(-0.958266071),FQ(-0.958703475),
-    FQ(-0.959138622),FQ(-0.959571513),FQ(-0.960002146),FQ(-0.960430519),FQ(-0.960856633),
-    FQ(-0.961280486),FQ(-0.961702077),FQ(-0.962121404),FQ(-0.962538468),FQ(-0.962953267),
-    FQ(-0.963365800),FQ(-0.963776066),FQ(-0.964184064),FQ(-0.964589793),FQ(-0.964993253),
-    FQ(-0.965394442),FQ(-0.965793359),FQ(-0.966190003),FQ(-0.966584374),FQ(-0.966976471),
-    FQ(-0.967366292),FQ(-0.967753837),FQ(-0.968139105),FQ(-0.968522094),FQ(-0.968902805),
-    FQ(-0.969281235),FQ(-0.969657385),FQ(-0.970031253),FQ(-0.970402839),FQ(-0.970772141),
-    FQ(-0.971139158),FQ(-0.971503891),FQ(-0.971866337),FQ(-0.972226497),FQ(-0.972584369),
-    FQ(-0.972939952),FQ(-0.973293246),FQ(-0.973644250),FQ(-0.973992962),FQ(-0.974339383),
-    FQ(-0.974683511),FQ(-0.975025345),FQ(-0.975364885),FQ(-0.975702130),FQ(-0.976037079),
-    FQ(-0.976369731),FQ(-0.976700086),FQ(-0.977028143),FQ(-0.977353900),FQ(-0.977677358),
-    FQ(-0.977998515),FQ(-0.978317371),FQ(-0.978633924),FQ(-0.978948175),FQ(-0.979260123),
-    FQ(-0.979569766),FQ(-0.979877104),FQ(-0.980182136),FQ(-0.980484862),FQ(-0.980785280),
-    FQ(-0.981083391),FQ(-0.981379193),FQ(-0.981672686),FQ(-0.981963869),FQ(-0.982252741),
-    FQ(-0.982539302),FQ(-0.982823551),FQ(-0.983105487),FQ(-0.983385110),FQ(-0.983662419),
-    FQ(-0.983937413),FQ(-0.984210092),FQ(-0.984480455),FQ(-0.984748502),FQ(-0.985014231),
-    FQ(-0.985277642),FQ(-0.985538735),FQ(-0.985797509),FQ(-0.986053963),FQ(-0.986308097),
-    FQ(-0.986559910),FQ(-0.986809402),FQ(-0.987056571),FQ(-0.987301418),FQ(-0.987543942),
-    FQ(-0.987784142),FQ(-0.988022017),FQ(-0.988257568),FQ(-0.988490793),FQ(-0.988721692),
-    FQ(-0.988950265),FQ(-0.989176510),FQ(-0.989400428),FQ(-0.989622017),FQ(-0.989841278),
-    FQ(-0.990058210),FQ(-0.990272812),FQ(-0.990485084),FQ(-0.990695025),FQ(-0.990902635),
-    FQ(-0.991107914),FQ(-0.991310860),FQ(-0.991511473),FQ(-0.991709754),FQ(-0.991905700),
-    FQ(-0.992099313),FQ(-0.992290591),FQ(-0.992479535),FQ(-0.992666142),FQ(-0.992850414),
-    FQ(-0.993032350),FQ(-0.993211949),FQ(-0.993389211),FQ(-0.993564136),FQ(-0.993736722),
-    FQ(-0.993906970),FQ(-0.994074879),FQ(-0.994240449),FQ(-0.994403680),FQ(-0.994564571),
-    FQ(-0.994723121),FQ(-0.994879331),FQ(-0.995033199),FQ(-0.995184727),FQ(-0.995333912),
-    FQ(-0.995480755),FQ(-0.995625256),FQ(-0.995767414),FQ(-0.995907229),FQ(-0.996044701),
-    FQ(-0.996179829),FQ(-0.996312612),FQ(-0.996443051),FQ(-0.996571146),FQ(-0.996696895),
-    FQ(-0.996820299),FQ(-0.996941358),FQ(-0.997060070),FQ(-0.997176437),FQ(-0.997290457),
-    FQ(-0.997402130),FQ(-0.997511456),FQ(-0.997618435),FQ(-0.997723067),FQ(-0.997825350),
-    FQ(-0.997925286),FQ(-0.998022874),FQ(-0.998118113),FQ(-0.998211003),FQ(-0.998301545),
-    FQ(-0.998389737),FQ(-0.998475581),FQ(-0.998559074),FQ(-0.998640218),FQ(-0.998719012),
-    FQ(-0.998795456),FQ(-0.998869550),FQ(-0.998941293),FQ(-0.999010686),FQ(-0.999077728),
-    FQ(-0.999142419),FQ(-0.999204759),FQ(-0.999264747),FQ(-0.999322385),FQ(-0.999377670),
-    FQ(-0.999430605),FQ(-0.999481187),FQ(-0.999529418),FQ(-0.999575296),FQ(-0.999618822),
-    FQ(-0.999659997),FQ(-0.999698819),FQ(-0.999735288),FQ(-0.999769405),FQ(-0.999801170),
-    FQ(-0.999830582),FQ(-0.999857641),FQ(-0.999882347),FQ(-0.999904701),FQ(-0.999924702),
-    FQ(-0.999942350),FQ(-0.999957645),FQ(-0.999970586),FQ(-0.999981175),FQ(-0.999989411),
-    FQ(-0.999995294),FQ(-0.999998823),FQ(-1.000000000),FQ(-0.999998823),FQ(-0.999995294),
-    FQ(-0.999989411),FQ(-0.999981175),FQ(-0.999970586),FQ(-0.999957645),FQ(-0.999942350),
-    FQ(-0.999924702),FQ(-0.999904701),FQ(-0.999882347),FQ(-0.999857641),FQ(-0.999830582),
-    FQ(-0.999801170),FQ(-0.999769405),FQ(-0.999735288),FQ(-0.999698819),FQ(-0.999659997),
-    FQ(-0.999618822),FQ(-0.999575296),FQ(-0.999529418),FQ(-0.999481187),FQ(-0.999430605),
-    FQ(-0.999377670),FQ(-0.999322385),FQ(-0.999264747),FQ(-0.999204759),FQ(-0.999142419),
-    FQ(-0.999077728),FQ(-0.999010686),FQ(-0.998941293),FQ(-0.998869550),FQ(-0.998795456),
-    FQ(-0.998719012),FQ(-0.998640218),FQ(-0.998559074),FQ(-0.998475581),FQ(-0.998389737),
-    FQ(-0.998301545),FQ(-0.998211003),FQ(-0.998118113),FQ(-0.998022874),FQ(-0.997925286),
-    FQ(-0.997825350),FQ(-0.997723067),FQ(-0.997618435),FQ(-0.997511456),FQ(-0.997402130),
-    FQ(-0.997290457),FQ(-0.997176437),FQ(-0.997060070),FQ(-0.996941358),FQ(-0.996820299),
-    FQ(-0.996696895),FQ(-0.996571146),FQ(-0.996443051),FQ(-0.996312612),FQ(-0.996179829),
-    FQ(-0.996044701),FQ(-0.995907229),FQ(-0.995767414),FQ(-0.995625256),FQ(-0.995480755),
-    FQ(-0.995333912),FQ(-0.995184727),FQ(-0.995033199),FQ(-0.994879331),FQ(-0.994723121),
-    FQ(-0.994564571),FQ(-0.994403680),FQ(-0.994240449),FQ(-0.994074879),FQ(-0.993906970),
-    FQ(-0.993736722),FQ(-0.993564136),FQ(-0.993389211),FQ(-0.993211949),FQ(-0.993032350),
-    FQ(-0.992850414),FQ(-0.992666142),FQ(-0.992479535),FQ(-0.992290591),FQ(-0.992099313),
-    FQ(-0.991905700),FQ(-0.991709754),FQ(-0.991511473),FQ(-0.991310860),FQ(-0.991107914),
-    FQ(-0.990902635),FQ(-0.990695025),FQ(-0.990485084),FQ(-0.990272812),FQ(-0.990058210),
-    FQ(-0.989841278),FQ(-0.989622017),FQ(-0.989400428),FQ(-0.989176510),FQ(-0.988950265),
-    FQ(-0.988721692),FQ(-0.988490793),FQ(-0.988257568),FQ(-0.988022017),FQ(-0.987784142),
-    FQ(-0.987543942),FQ(-0.987301418),FQ(-0.987056571),FQ(-0.986809402),FQ(-0.986559910),
-    FQ(-0.986308097),FQ(-0.986053963),FQ(-0.985797509),FQ(-0.985538735),FQ(-0.985277642),
-    FQ(-0.985014231),FQ(-0.984748502),FQ(-0.984480455),FQ(-0.984210092),FQ(-0.983937413),
-    FQ(-0.983662419),FQ(-0.983385110),FQ(-0.983105487),FQ(-0.982823551),FQ(-0.982539302),
-    FQ(-0.982252741),FQ(-0.981963869),FQ(-0.981672686),FQ(-0.981379193),FQ(-0.981083391),
-    FQ(-0.980785280),FQ(-0.980484862),FQ(-0.980182136),FQ(-0.979877104),FQ(-0.979569766),
-    FQ(-0.979260123),FQ(-0.978948175),FQ(-0.978633924),FQ(-0.978317371),FQ(-0.977998515),
-    FQ(-0.977677358),FQ(-0.977353900),FQ(-0.977028143),FQ(-0.976700086),FQ(-0.976369731),
-    FQ(-0.976037079),FQ(-0.975702130),FQ(-0.975364885),FQ(-0.975025345),FQ(-0.974683511),
-    FQ(-0.974339383),FQ(-0.973992962),FQ(-0.973644250),FQ(-0.973293246),FQ(-0.972939952),
-    FQ(-0.972584369),FQ(-0.972226497),FQ(-0.971866337),FQ(-0.971503891),FQ(-0.971139158),
-    FQ(-0.970772141),FQ(-0.970402839),FQ(-0.970031253),FQ(-0.969657385),FQ(-0.969281235),
-    FQ(-0.968902805),FQ(-0.968522094),FQ(-0.968139105),FQ(-0.967753837),FQ(-0.967366292),
-    FQ(-0.966976471),FQ(-0.966584374),FQ(-0.966190003),FQ(-0.965793359),FQ(-0.965394442),
-    FQ(-0.964993253),FQ(-0.964589793),FQ(-0.964184064),FQ(-0.963776066),FQ(-0.963365800),
-    FQ(-0.962953267),FQ(-0.962538468),FQ(-0.962121404),FQ(-0.961702077),FQ(-0.961280486),
-    FQ(-0.960856633),FQ(-0.960430519),FQ(-0.960002146),FQ(-0.959571513),FQ(-0.959138622),
-    FQ(-0.958703475),FQ(-0.958266071),FQ(-0.957826413),FQ(-0.957384501),FQ(-0.956940336),
-    FQ(-0.956493919),FQ(-0.956045251),FQ(-0.955594334),FQ(-0.955141168),FQ(-0.954685755),
-    FQ(-0.954228095),FQ(-0.953768190),FQ(-0.953306040),FQ(-0.952841648),FQ(-0.952375013),
-    FQ(-0.951906137),FQ(-0.951435021),FQ(-0.950961666),FQ(-0.950486074),FQ(-0.950008245),
-    FQ(-0.949528181),FQ(-0.949045882),FQ(-0.948561350),FQ(-0.948074586),FQ(-0.947585591),
-    FQ(-0.947094366),FQ(-0.946600913),FQ(-0.946105232),FQ(-0.945607325),FQ(-0.945107193),
-    FQ(-0.944604837),FQ(-0.944100258),FQ(-0.943593458),FQ(-0.943084437),FQ(-0.942573198),
-    FQ(-0.942059740),FQ(-0.941544065),FQ(-0.941026175),FQ(-0.940506071),FQ(-0.939983753),
-    FQ(-0.939459224),FQ(-0.938932484),FQ(-0.938403534),FQ(-0.937872376),FQ(-0.937339012),
-    FQ(-0.936803442),FQ(-0.936265667),FQ(-0.935725689),FQ(-0.935183510),FQ(-0.934639130),
-    FQ(-0.934092550),FQ(-0.933543773),FQ(-0.932992799),FQ(-0.932439629),FQ(-0.931884266),
-    FQ(-0.931326709),FQ(-0.930766961),FQ(-0.930205023),FQ(-0.929640896),FQ(-0.929074581),
-    FQ(-0.928506080),FQ(-0.927935395),FQ(-0.927362526),FQ(-0.926787474),FQ(-0.926210242),
-    FQ(-0.925630831),FQ(-0.925049241),FQ(-0.924465474),FQ(-0.923879533),FQ(-0.923291417),
-    FQ(-0.922701128),FQ(-0.922108669),FQ(-0.921514039),FQ(-0.920917242),FQ(-0.920318277),
-    FQ(-0.919717146),FQ(-0.919113852),FQ(-0.918508394),FQ(-0.917900776),FQ(-0.917290997),
-    FQ(-0.916679060),FQ(-0.916064966),FQ(-0.915448716),FQ(-0.914830312),FQ(-0.914209756),
-    FQ(-0.913587048),FQ(-0.912962190),FQ(-0.912335185),FQ(-0.911706032),FQ(-0.911074734),
-    FQ(-0.910441292),FQ(-0.909805708),FQ(-0.909167983),FQ(-0.908528119),FQ(-0.907886116),
-    FQ(-0.907241978),FQ(-0.906595705),FQ(-0.905947298),FQ(-0.905296759),FQ(-0.904644091),
-    FQ(-0.903989293),FQ(-0.903332368),FQ(-0.902673318),FQ(-0.902012144),FQ(-0.901348847),
-    FQ(-0.900683429),FQ(-0.900015892),FQ(-0.899346237),FQ(-0.898674466),FQ(-0.898000580),
-    FQ(-0.897324581),FQ(-0.896646470),FQ(-0.895966250),FQ(-0.895283921),FQ(-0.894599486),
-    FQ(-0.893912945),FQ(-0.893224301),FQ(-0.892533555),FQ(-0.891840709),FQ(-0.891145765),
-    FQ(-0.890448723),FQ(-0.889749586),FQ(-0.889048356),FQ(-0.888345033),FQ(-0.887639620),
-    FQ(-0.886932119),FQ(-0.886222530),FQ(-0.885510856),FQ(-0.884797098),FQ(-0.884081259),
-    FQ(-0.883363339),FQ(-0.882643340),FQ(-0.881921264),FQ(-0.881197113),FQ(-0.880470889),
-    FQ(-0.879742593),FQ(-0.879012226),FQ(-0.878279792),FQ(-0.877545290),FQ(-0.876808724),
-    FQ(-0.876070094),FQ(-0.875329403),FQ(-0.874586652),FQ(-0.873841843),FQ(-0.873094978),
-    FQ(-0.872346059),FQ(-0.871595087),FQ(-0.870842063),FQ(-0.870086991),FQ(-0.869329871),
-    FQ(-0.868570706),FQ(-0.867809497),FQ(-0.867046246),FQ(-0.866280954),FQ(-0.865513624),
-    FQ(-0.864744258),FQ(-0.863972856),FQ(-0.863199422),FQ(-0.862423956),FQ(-0.861646461),
-    FQ(-0.860866939),FQ(-0.860085390),FQ(-0.859301818),FQ(-0.858516224),FQ(-0.857728610),
-    FQ(-0.856938977),FQ(-0.856147328),FQ(-0.855353665),FQ(-0.854557988),FQ(-0.853760301),
-    FQ(-0.852960605),FQ(-0.852158902),FQ(-0.851355193),FQ(-0.850549481),FQ(-0.849741768),
-    FQ(-0.848932055),FQ(-0.848120345),FQ(-0.847306639),FQ(-0.846490939),FQ(-0.845673247),
-    FQ(-0.844853565),FQ(-0.844031895),FQ(-0.843208240),FQ(-0.842382600),FQ(-0.841554977),
-    FQ(-0.840725375),FQ(-0.839893794),FQ(-0.839060237),FQ(-0.838224706),FQ(-0.837387202),
-    FQ(-0.836547727),FQ(-0.835706284),FQ(-0.834862875),FQ(-0.834017501),FQ(-0.833170165),
-    FQ(-0.832320868),FQ(-0.831469612),FQ(-0.830616400),FQ(-0.829761234),FQ(-0.828904115),
-    FQ(-0.828045045),FQ(-0.827184027),FQ(-0.826321063),FQ(-0.825456154),FQ(-0.824589303),
-    FQ(-0.823720511),FQ(-0.822849781),FQ(-0.821977115),FQ(-0.821102515),FQ(-0.820225983),
-    FQ(-0.819347520),FQ(-0.818467130),FQ(-0.817584813),FQ(-0.816700573),FQ(-0.815814411),
-    FQ(-0.814926329),FQ(-0.814036330),FQ(-0.813144415),FQ(-0.812250587),FQ(-0.811354847),
-    FQ(-0.810457198),FQ(-0.809557642),FQ(-0.808656182),FQ(-0.807752818),FQ(-0.806847554),
-    FQ(-0.805940391),FQ(-0.805031331),FQ(-0.804120377),FQ(-0.803207531),FQ(-0.802292796),
-    FQ(-0.801376172),FQ(-0.800457662),FQ(-0.799537269),FQ(-0.798614995),FQ(-0.797690841),
-    FQ(-0.796764810),FQ(-0.795836905),FQ(-0.794907126),FQ(-0.793975478),FQ(-0.793041960),
-    FQ(-0.792106577),FQ(-0.791169330),FQ(-0.790230221),FQ(-0.789289253),FQ(-0.788346428),
-    FQ(-0.787401747),FQ(-0.786455214),FQ(-0.785506830),FQ(-0.784556597),FQ(-0.783604519),
-    FQ(-0.782650596),FQ(-0.781694832),FQ(-0.780737229),FQ(-0.779777788),FQ(-0.778816512),
-    FQ(-0.777853404),FQ(-0.776888466),FQ(-0.775921699),FQ(-0.774953107),FQ(-0.773982691),
-    FQ(-0.773010453),FQ(-0.772036397),FQ(-0.771060524),FQ(-0.770082837),FQ(-0.769103338),
-    FQ(-0.768122029),FQ(-0.767138912),FQ(-0.766153990),FQ(-0.765167266),FQ(-0.764178741),
-    FQ(-0.763188417),FQ(-0.762196298),FQ(-0.761202385),FQ(-0.760206682),FQ(-0.759209189),
-    FQ(-0.758209910),FQ(-0.757208847),FQ(-0.756206001),FQ(-0.755201377),FQ(-0.754194975),
-    FQ(-0.753186799),FQ(-0.752176850),FQ(-0.751165132),FQ(-0.750151646),FQ(-0.749136395),
-    FQ(-0.748119380),FQ(-0.747100606),FQ(-0.746080074),FQ(-0.745057785),FQ(-0.744033744),
-    FQ(-0.743007952),FQ(-0.741980412),FQ(-0.740951125),FQ(-0.739920095),FQ(-0.738887324),
-    FQ(-0.737852815),FQ(-0.736816569),FQ(-0.735778589),FQ(-0.734738878),FQ(-0.733697438),
-    FQ(-0.732654272),FQ(-0.731609381),FQ(-0.730562769),FQ(-0.729514438),FQ(-0.728464390),
-    FQ(-0.727412629),FQ(-0.726359155),FQ(-0.725303972),FQ(-0.724247083),FQ(-0.723188489),
-    FQ(-0.722128194),FQ(-0.721066199),FQ(-0.720002508),FQ(-0.718937122),FQ(-0.717870045),
-    FQ(-0.716801279),FQ(-0.715730825),FQ(-0.714658688),FQ(-0.713584869),FQ(-0.712509371),
-    FQ(-0.711432196),FQ(-0.710353347),FQ(-0.709272826),FQ(-0.708190637),FQ(-0.707106781),
-    FQ(-0.706021261),FQ(-0.704934080),FQ(-0.703845241),FQ(-0.702754744),FQ(-0.701662595),
-    FQ(-0.700568794),FQ(-0.699473345),FQ(-0.698376249),FQ(-0.697277511),FQ(-0.696177131),
-    FQ(-0.695075114),FQ(-0.693971461),FQ(-0.692866175),FQ(-0.691759258),FQ(-0.690650714),
-    FQ(-0.689540545),FQ(-0.688428753),FQ(-0.687315341),FQ(-0.686200312),FQ(-0.685083668),
-    FQ(-0.683965412),FQ(-0.682845546),FQ(-0.681724074),FQ(-0.680600998),FQ(-0.679476320),
-    FQ(-0.678350043),FQ(-0.677222170),FQ(-0.676092704),FQ(-0.674961646),FQ(-0.673829000),
-    FQ(-0.672694769),FQ(-0.671558955),FQ(-0.670421560),FQ(-0.669282588),FQ(-0.668142041),
-    FQ(-0.666999922),FQ(-0.665856234),FQ(-0.664710978),FQ(-0.663564159),FQ(-0.662415778),
-    FQ(-0.661265838),FQ(-0.660114342),FQ(-0.658961293),FQ(-0.657806693),FQ(-0.656650546),
-    FQ(-0.655492853),FQ(-0.654333618),FQ(-0.653172843),FQ(-0.652010531),FQ(-0.650846685),
-    FQ(-0.649681307),FQ(-0.648514401),FQ(-0.647345969),FQ(-0.646176013),FQ(-0.645004537),
-    FQ(-0.643831543),FQ(-0.642657034),FQ(-0.641481013),FQ(-0.640303482),FQ(-0.639124445),
-    FQ(-0.637943904),FQ(-0.636761861),FQ(-0.635578320),FQ(-0.634393284),FQ(-0.633206755),
-    FQ(-0.632018736),FQ(-0.630829230),FQ(-0.629638239),FQ(-0.628445767),FQ(-0.627251815),
-    FQ(-0.626056388),FQ(-0.624859488),FQ(-0.623661118),FQ(-0.622461279),FQ(-0.621259977),
-    FQ(-0.620057212),FQ(-0.618852988),FQ(-0.617647308),FQ(-0.616440175),FQ(-0.615231591),
-    FQ(-0.614021559),FQ(-0.612810082),FQ(-0.611597164),FQ(-0.610382806),FQ(-0.609167012),
-    FQ(-0.607949785),FQ(-0.606731127),FQ(-0.605511041),FQ(-0.604289531),FQ(-0.603066599),
-    FQ(-0.601842247),FQ(-0.600616479),FQ(-0.599389298),FQ(-0.598160707),FQ(-0.596930708),
-    FQ(-0.595699304),FQ(-0.594466499),FQ(-0.593232295),FQ(-0.591996695),FQ(-0.590759702),
-    FQ(-0.589521319),FQ(-0.588281548),FQ(-0.587040394),FQ(-0.585797857),FQ(-0.584553943),
-    FQ(-0.583308653),FQ(-0.582061990),FQ(-0.580813958),FQ(-0.579564559),FQ(-0.578313796),
-    FQ(-0.577061673),FQ(-0.575808191),FQ(-0.574553355),FQ(-0.573297167),FQ(-0.572039629),
-    FQ(-0.570780746),FQ(-0.569520519),FQ(-0.568258953),FQ(-0.566996049),FQ(-0.565731811),
-    FQ(-0.564466242),FQ(-0.563199344),FQ(-0.561931121),FQ(-0.560661576),FQ(-0.559390712),
-    FQ(-0.558118531),FQ(-0.556845037),FQ(-0.555570233),FQ(-0.554294121),FQ(-0.553016706),
-    FQ(-0.551737988),FQ(-0.550457973),FQ(-0.549176662),FQ(-0.547894059),FQ(-0.546610167),
-    FQ(-0.545324988),FQ(-0.544038527),FQ(-0.542750785),FQ(-0.541461766),FQ(-0.540171473),
-    FQ(-0.538879909),FQ(-0.537587076),FQ(-0.536292979),FQ(-0.534997620),FQ(-0.533701002),
-    FQ(-0.532403128),FQ(-0.531104001),FQ(-0.529803625),FQ(-0.528502002),FQ(-0.527199135),
-    FQ(-0.525895027),FQ(-0.524589683),FQ(-0.523283103),FQ(-0.521975293),FQ(-0.520666254),
-    FQ(-0.519355990),FQ(-0.518044504),FQ(-0.516731799),FQ(-0.515417878),FQ(-0.514102744),
-    FQ(-0.512786401),FQ(-0.511468850),FQ(-0.510150097),FQ(-0.508830143),FQ(-0.507508991),
-    FQ(-0.506186645),FQ(-0.504863109),FQ(-0.503538384),FQ(-0.502212474),FQ(-0.500885383),
-    FQ(-0.499557113),FQ(-0.498227667),FQ(-0.496897049),FQ(-0.495565262),FQ(-0.494232309),
-    FQ(-0.492898192),FQ(-0.491562916),FQ(-0.490226483),FQ(-0.488888897),FQ(-0.487550160),
-    FQ(-0.486210276),FQ(-0.484869248),FQ(-0.483527079),FQ(-0.482183772),FQ(-0.480839331),
-    FQ(-0.479493758),FQ(-0.478147056),FQ(-0.476799230),FQ(-0.475450282),FQ(-0.474100215),
-    FQ(-0.472749032),FQ(-0.471396737),FQ(-0.470043332),FQ(-0.468688822),FQ(-0.467333209),
-    FQ(-0.465976496),FQ(-0.464618686),FQ(-0.463259784),FQ(-0.461899791),FQ(-0.460538711),
-    FQ(-0.459176548),FQ(-0.457813304),FQ(-0.456448982),FQ(-0.455083587),FQ(-0.453717121),
-    FQ(-0.452349587),FQ(-0.450980989),FQ(-0.449611330),FQ(-0.448240612),FQ(-0.446868840),
-    FQ(-0.445496017),FQ(-0.444122145),FQ(-0.442747228),FQ(-0.441371269),FQ(-0.439994271),
-    FQ(-0.438616239),FQ(-0.437237174),FQ(-0.435857080),FQ(-0.434475961),FQ(-0.433093819),
-    FQ(-0.431710658),FQ(-0.430326481),FQ(-0.428941292),FQ(-0.427555093),FQ(-0.426167889),
-    FQ(-0.424779681),FQ(-0.423390474),FQ(-0.422000271),FQ(-0.420609074),FQ(-0.419216888),
-    FQ(-0.417823716),FQ(-0.416429560),FQ(-0.415034424),FQ(-0.413638312),FQ(-0.412241227),
-    FQ(-0.410843171),FQ(-0.409444149),FQ(-0.408044163),FQ(-0.406643217),FQ(-0.405241314),
-    FQ(-0.403838458),FQ(-0.402434651),FQ(-0.401029897),FQ(-0.399624200),FQ(-0.398217562),
-    FQ(-0.396809987),FQ(-0.395401479),FQ(-0.393992040),FQ(-0.392581674),FQ(-0.391170384),
-    FQ(-0.389758174),FQ(-0.388345047),FQ(-0.386931006),FQ(-0.385516054),FQ(-0.384100195),
-    FQ(-0.382683432),FQ(-0.381265769),FQ(-0.379847209),FQ(-0.378427755),FQ(-0.377007410),
-    FQ(-0.375586178),FQ(-0.374164063),FQ(-0.372741067),FQ(-0.371317194),FQ(-0.369892447),
-    FQ(-0.368466830),FQ(-0.367040346),FQ(-0.365612998),FQ(-0.364184790),FQ(-0.362755724),
-    FQ(-0.361325806),FQ(-0.359895037),FQ(-0.358463421),FQ(-0.357030961),FQ(-0.355597662),
-    FQ(-0.354163525),FQ(-0.352728556),FQ(-0.351292756),FQ(-0.349856130),FQ(-0.348418680),
-    FQ(-0.346980411),FQ(-0.345541325),FQ(-0.344101426),FQ(-0.342660717),FQ(-0.341219202),
-    FQ(-0.339776884),FQ(-0.338333767),FQ(-0.336889853),FQ(-0.335445147),FQ(-0.333999651),
-    FQ(-0.332553370),FQ(-0.331106306),FQ(-0.329658463),FQ(-0.328209844),FQ(-0.326760452),
-    FQ(-0.325310292),FQ(-0.323859367),FQ(-0.322407679),FQ(-0.320955232),FQ(-0.319502031),
-    FQ(-0.318048077),FQ(-0.316593376),FQ(-0.315137929),FQ(-0.313681740),FQ(-0.312224814),
-    FQ(-0.310767153),FQ(-0.309308760),FQ(-0.307849640),FQ(-0.306389795),FQ(-0.304929230),
-    FQ(-0.303467947),FQ(-0.302005949),FQ(-0.300543241),FQ(-0.299079826),FQ(-0.297615707),
-    FQ(-0.296150888),FQ(-0.294685372),FQ(-0.293219163),FQ(-0.291752263),FQ(-0.290284677),
-    FQ(-0.288816408),FQ(-0.287347460),FQ(-0.285877835),FQ(-0.284407537),FQ(-0.282936570),
-    FQ(-0.281464938),FQ(-0.279992643),FQ(-0.278519689),FQ(-0.277046080),FQ(-0.275571819),
-    FQ(-0.274096910),FQ(-0.272621355),FQ(-0.271145160),FQ(-0.269668326),FQ(-0.268190857),
-    FQ(-0.266712757),FQ(-0.265234030),FQ(-0.263754679),FQ(-0.262274707),FQ(-0.260794118),
-    FQ(-0.259312915),FQ(-0.257831102),FQ(-0.256348682),FQ(-0.254865660),FQ(-0.253382037),
-    FQ(-0.251897818),FQ(-0.250413007),FQ(-0.248927606),FQ(-0.247441619),FQ(-0.245955050),
-    FQ(-0.244467903),FQ(-0.242980180),FQ(-0.241491885),FQ(-0.240003022),FQ(-0.238513595),
-    FQ(-0.237023606),FQ(-0.235533059),FQ(-0.234041959),FQ(-0.232550307),FQ(-0.231058108),
-    FQ(-0.229565366),FQ(-0.228072083),FQ(-0.226578264),FQ(-0.225083911),FQ(-0.223589029),
-    FQ(-0.222093621),FQ(-0.220597690),FQ(-0.219101240),FQ(-0.217604275),FQ(-0.216106797),
-    FQ(-0.214608811),FQ(-0.213110320),FQ(-0.211611327),FQ(-0.210111837),FQ(-0.208611852),
-    FQ(-0.207111376),FQ(-0.205610413),FQ(-0.204108966),FQ(-0.202607039),FQ(-0.201104635),
-    FQ(-0.199601758),FQ(-0.198098411),FQ(-0.196594598),FQ(-0.195090322),FQ(-0.193585587),
-    FQ(-0.192080397),FQ(-0.190574755),FQ(-0.189068664),FQ(-0.187562129),FQ(-0.186055152),
-    FQ(-0.184547737),FQ(-0.183039888),FQ(-0.181531608),FQ(-0.180022901),FQ(-0.178513771),
-    FQ(-0.177004220),FQ(-0.175494253),FQ(-0.173983873),FQ(-0.172473084),FQ(-0.170961889),
-    FQ(-0.169450291),FQ(-0.167938295),FQ(-0.166425904),FQ(-0.164913120),FQ(-0.163399949),
-    FQ(-0.161886394),FQ(-0.160372457),FQ(-0.158858143),FQ(-0.157343456),FQ(-0.155828398),
-    FQ(-0.154312973),FQ(-0.152797185),FQ(-0.151281038),FQ(-0.149764535),FQ(-0.148247679),
-    FQ(-0.146730474),FQ(-0.145212925),FQ(-0.143695033),FQ(-0.142176804),FQ(-0.140658239),
-    FQ(-0.139139344),FQ(-0.137620122),FQ(-0.136100575),FQ(-0.134580709),FQ(-0.133060525),
-    FQ(-0.131540029),FQ(-0.130019223),FQ(-0.128498111),FQ(-0.126976696),FQ(-0.125454983),
-    FQ(-0.123932975),FQ(-0.122410675),FQ(-0.120888087),FQ(-0.119365215),FQ(-0.117842062),
-    FQ(-0.116318631),FQ(-0.114794927),FQ(-0.113270952),FQ(-0.111746711),FQ(-0.110222207),
-    FQ(-0.108697444),FQ(-0.107172425),FQ(-0.105647154),FQ(-0.104121634),FQ(-0.102595869),
-    FQ(-0.101069863),FQ(-0.099543619),FQ(-0.098017140),FQ(-0.096490431),FQ(-0.094963495),
-    FQ(-0.093436336),FQ(-0.091908956),FQ(-0.090381361),FQ(-0.088853553),FQ(-0.087325535),
-    FQ(-0.085797312),FQ(-0.084268888),FQ(-0.082740265),FQ(-0.081211447),FQ(-0.079682438),
-    FQ(-0.078153242),FQ(-0.076623861),FQ(-0.075094301),FQ(-0.073564564),FQ(-0.072034653),
-    FQ(-0.070504573),FQ(-0.068974328),FQ(-0.067443920),FQ(-0.065913353),FQ(-0.064382631),
-    FQ(-0.062851758),FQ(-0.061320736),FQ(-0.059789571),FQ(-0.058258265),FQ(-0.056726821),
-    FQ(-0.055195244),FQ(-0.053663538),FQ(-0.052131705),FQ(-0.050599749),FQ(-0.049067674),
-    FQ(-0.047535484),FQ(-0.046003182),FQ(-0.044470772),FQ(-0.042938257),FQ(-0.041405641),
-    FQ(-0.039872928),FQ(-0.038340120),FQ(-0.036807223),FQ(-0.035274239),FQ(-0.033741172),
-    FQ(-0.032208025),FQ(-0.030674803),FQ(-0.029141509),FQ(-0.027608146),FQ(-0.026074718),
-    FQ(-0.024541229),FQ(-0.023007681),FQ(-0.021474080),FQ(-0.019940429),FQ(-0.018406730),
-    FQ(-0.016872988),FQ(-0.015339206),FQ(-0.013805389),FQ(-0.012271538),FQ(-0.010737659),
-    FQ(-0.009203755),FQ(-0.007669829),FQ(-0.006135885),FQ(-0.004601926),FQ(-0.003067957),
-    FQ(-0.001533980)
+    FQ(+0.999981175),FQ(+0.999989411),FQ(+0.999995294),FQ(+0.999998823),FQ(+1.000000000)
 };
 
 int dsp_atan_12[4096] =
@@ -4388,7 +4303,7 @@ int dsp_nexp_12[4096] =
     FQ(+0.999663882)
 };
 
-int dsp_sine_14[16384] =
+int dsp_qsine_14[4097] =
 {
     FQ(+0.000000000),FQ(+0.000383495),FQ(+0.000766990),FQ(+0.001150485),FQ(+0.001533980),
     FQ(+0.001917475),FQ(+0.002300969),FQ(+0.002684463),FQ(+0.003067957),FQ(+0.003451450),
@@ -5209,2464 +5124,7 @@ int dsp_sine_14[16384] =
     FQ(+0.999981175),FQ(+0.999983455),FQ(+0.999985587),FQ(+0.999987573),FQ(+0.999989411),
     FQ(+0.999991102),FQ(+0.999992647),FQ(+0.999994044),FQ(+0.999995294),FQ(+0.999996397),
     FQ(+0.999997353),FQ(+0.999998162),FQ(+0.999998823),FQ(+0.999999338),FQ(+0.999999706),
-    FQ(+0.999999926),FQ(+1.000000000),FQ(+0.999999926),FQ(+0.999999706),FQ(+0.999999338),
-    FQ(+0.999998823),FQ(+0.999998162),FQ(+0.999997353),FQ(+0.999996397),FQ(+0.999995294),
-    FQ(+0.999994044),FQ(+0.999992647),FQ(+0.999991102),FQ(+0.999989411),FQ(+0.999987573),
-    FQ(+0.999985587),FQ(+0.999983455),FQ(+0.999981175),FQ(+0.999978749),FQ(+0.999976175),
-    FQ(+0.999973454),FQ(+0.999970586),FQ(+0.999967572),FQ(+0.999964410),FQ(+0.999961101),
-    FQ(+0.999957645),FQ(+0.999954041),FQ(+0.999950291),FQ(+0.999946394),FQ(+0.999942350),
-    FQ(+0.999938158),FQ(+0.999933820),FQ(+0.999929334),FQ(+0.999924702),FQ(+0.999919922),
-    FQ(+0.999914996),FQ(+0.999909922),FQ(+0.999904701),FQ(+0.999899333),FQ(+0.999893818),
-    FQ(+0.999888156),FQ(+0.999882347),FQ(+0.999876391),FQ(+0.999870288),FQ(+0.999864038),
-    FQ(+0.999857641),FQ(+0.999851097),FQ(+0.999844405),FQ(+0.999837567),FQ(+0.999830582),
-    FQ(+0.999823449),FQ(+0.999816170),FQ(+0.999808743),FQ(+0.999801170),FQ(+0.999793449),
-    FQ(+0.999785582),FQ(+0.999777567),FQ(+0.999769405),FQ(+0.999761097),FQ(+0.999752641),
-    FQ(+0.999744038),FQ(+0.999735288),FQ(+0.999726391),FQ(+0.999717348),FQ(+0.999708157),
-    FQ(+0.999698819),FQ(+0.999689334),FQ(+0.999679702),FQ(+0.999669923),FQ(+0.999659997),
-    FQ(+0.999649924),FQ(+0.999639704),FQ(+0.999629337),FQ(+0.999618822),FQ(+0.999608161),
-    FQ(+0.999597353),FQ(+0.999586398),FQ(+0.999575296),FQ(+0.999564047),FQ(+0.999552651),
-    FQ(+0.999541108),FQ(+0.999529418),FQ(+0.999517580),FQ(+0.999505596),FQ(+0.999493465),
-    FQ(+0.999481187),FQ(+0.999468762),FQ(+0.999456190),FQ(+0.999443471),FQ(+0.999430605),
-    FQ(+0.999417591),FQ(+0.999404431),FQ(+0.999391124),FQ(+0.999377670),FQ(+0.999364069),
-    FQ(+0.999350321),FQ(+0.999336426),FQ(+0.999322385),FQ(+0.999308196),FQ(+0.999293860),
-    FQ(+0.999279377),FQ(+0.999264747),FQ(+0.999249971),FQ(+0.999235047),FQ(+0.999219976),
-    FQ(+0.999204759),FQ(+0.999189394),FQ(+0.999173883),FQ(+0.999158224),FQ(+0.999142419),
-    FQ(+0.999126466),FQ(+0.999110367),FQ(+0.999094121),FQ(+0.999077728),FQ(+0.999061188),
-    FQ(+0.999044501),FQ(+0.999027667),FQ(+0.999010686),FQ(+0.998993558),FQ(+0.998976283),
-    FQ(+0.998958862),FQ(+0.998941293),FQ(+0.998923578),FQ(+0.998905715),FQ(+0.998887706),
-    FQ(+0.998869550),FQ(+0.998851247),FQ(+0.998832797),FQ(+0.998814200),FQ(+0.998795456),
-    FQ(+0.998776566),FQ(+0.998757528),FQ(+0.998738344),FQ(+0.998719012),FQ(+0.998699534),
-    FQ(+0.998679909),FQ(+0.998660137),FQ(+0.998640218),FQ(+0.998620152),FQ(+0.998599940),
-    FQ(+0.998579581),FQ(+0.998559074),FQ(+0.998538421),FQ(+0.998517621),FQ(+0.998496674),
-    FQ(+0.998475581),FQ(+0.998454340),FQ(+0.998432953),FQ(+0.998411418),FQ(+0.998389737),
-    FQ(+0.998367910),FQ(+0.998345935),FQ(+0.998323813),FQ(+0.998301545),FQ(+0.998279130),
-    FQ(+0.998256568),FQ(+0.998233859),FQ(+0.998211003),FQ(+0.998188001),FQ(+0.998164852),
-    FQ(+0.998141556),FQ(+0.998118113),FQ(+0.998094523),FQ(+0.998070787),FQ(+0.998046904),
-    FQ(+0.998022874),FQ(+0.997998697),FQ(+0.997974374),FQ(+0.997949903),FQ(+0.997925286),
-    FQ(+0.997900522),FQ(+0.997875612),FQ(+0.997850554),FQ(+0.997825350),FQ(+0.997800000),
-    FQ(+0.997774502),FQ(+0.997748858),FQ(+0.997723067),FQ(+0.997697129),FQ(+0.997671044),
-    FQ(+0.997644813),FQ(+0.997618435),FQ(+0.997591910),FQ(+0.997565239),FQ(+0.997538421),
-    FQ(+0.997511456),FQ(+0.997484345),FQ(+0.997457086),FQ(+0.997429682),FQ(+0.997402130),
-    FQ(+0.997374432),FQ(+0.997346587),FQ(+0.997318595),FQ(+0.997290457),FQ(+0.997262172),
-    FQ(+0.997233740),FQ(+0.997205162),FQ(+0.997176437),FQ(+0.997147565),FQ(+0.997118547),
-    FQ(+0.997089382),FQ(+0.997060070),FQ(+0.997030612),FQ(+0.997001007),FQ(+0.996971256),
-    FQ(+0.996941358),FQ(+0.996911313),FQ(+0.996881122),FQ(+0.996850784),FQ(+0.996820299),
-    FQ(+0.996789668),FQ(+0.996758890),FQ(+0.996727966),FQ(+0.996696895),FQ(+0.996665678),
-    FQ(+0.996634314),FQ(+0.996602803),FQ(+0.996571146),FQ(+0.996539342),FQ(+0.996507392),
-    FQ(+0.996475295),FQ(+0.996443051),FQ(+0.996410661),FQ(+0.996378125),FQ(+0.996345442),
-    FQ(+0.996312612),FQ(+0.996279636),FQ(+0.996246513),FQ(+0.996213244),FQ(+0.996179829),
-    FQ(+0.996146266),FQ(+0.996112558),FQ(+0.996078703),FQ(+0.996044701),FQ(+0.996010553),
-    FQ(+0.995976258),FQ(+0.995941817),FQ(+0.995907229),FQ(+0.995872495),FQ(+0.995837615),
-    FQ(+0.995802588),FQ(+0.995767414),FQ(+0.995732095),FQ(+0.995696628),FQ(+0.995661016),
-    FQ(+0.995625256),FQ(+0.995589351),FQ(+0.995553299),FQ(+0.995517100),FQ(+0.995480755),
-    FQ(+0.995444264),FQ(+0.995407627),FQ(+0.995370843),FQ(+0.995333912),FQ(+0.995296835),
-    FQ(+0.995259612),FQ(+0.995222243),FQ(+0.995184727),FQ(+0.995147064),FQ(+0.995109256),
-    FQ(+0.995071301),FQ(+0.995033199),FQ(+0.994994952),FQ(+0.994956558),FQ(+0.994918017),
-    FQ(+0.994879331),FQ(+0.994840498),FQ(+0.994801519),FQ(+0.994762393),FQ(+0.994723121),
-    FQ(+0.994683703),FQ(+0.994644138),FQ(+0.994604428),FQ(+0.994564571),FQ(+0.994524567),
-    FQ(+0.994484418),FQ(+0.994444122),FQ(+0.994403680),FQ(+0.994363092),FQ(+0.994322357),
-    FQ(+0.994281476),FQ(+0.994240449),FQ(+0.994199276),FQ(+0.994157957),FQ(+0.994116491),
-    FQ(+0.994074879),FQ(+0.994033121),FQ(+0.993991217),FQ(+0.993949167),FQ(+0.993906970),
-    FQ(+0.993864627),FQ(+0.993822138),FQ(+0.993779503),FQ(+0.993736722),FQ(+0.993693795),
-    FQ(+0.993650721),FQ(+0.993607501),FQ(+0.993564136),FQ(+0.993520624),FQ(+0.993476966),
-    FQ(+0.993433161),FQ(+0.993389211),FQ(+0.993345115),FQ(+0.993300872),FQ(+0.993256484),
-    FQ(+0.993211949),FQ(+0.993167269),FQ(+0.993122442),FQ(+0.993077469),FQ(+0.993032350),
-    FQ(+0.992987085),FQ(+0.992941674),FQ(+0.992896117),FQ(+0.992850414),FQ(+0.992804565),
-    FQ(+0.992758570),FQ(+0.992712429),FQ(+0.992666142),FQ(+0.992619709),FQ(+0.992573130),
-    FQ(+0.992526406),FQ(+0.992479535),FQ(+0.992432518),FQ(+0.992385355),FQ(+0.992338046),
-    FQ(+0.992290591),FQ(+0.992242991),FQ(+0.992195244),FQ(+0.992147352),FQ(+0.992099313),
-    FQ(+0.992051129),FQ(+0.992002799),FQ(+0.991954322),FQ(+0.991905700),FQ(+0.991856933),
-    FQ(+0.991808019),FQ(+0.991758959),FQ(+0.991709754),FQ(+0.991660402),FQ(+0.991610905),
-    FQ(+0.991561262),FQ(+0.991511473),FQ(+0.991461539),FQ(+0.991411458),FQ(+0.991361232),
-    FQ(+0.991310860),FQ(+0.991260342),FQ(+0.991209678),FQ(+0.991158869),FQ(+0.991107914),
-    FQ(+0.991056813),FQ(+0.991005566),FQ(+0.990954174),FQ(+0.990902635),FQ(+0.990850952),
-    FQ(+0.990799122),FQ(+0.990747147),FQ(+0.990695025),FQ(+0.990642759),FQ(+0.990590346),
-    FQ(+0.990537788),FQ(+0.990485084),FQ(+0.990432235),FQ(+0.990379240),FQ(+0.990326099),
-    FQ(+0.990272812),FQ(+0.990219380),FQ(+0.990165803),FQ(+0.990112079),FQ(+0.990058210),
-    FQ(+0.990004196),FQ(+0.989950036),FQ(+0.989895730),FQ(+0.989841278),FQ(+0.989786682),
-    FQ(+0.989731939),FQ(+0.989677051),FQ(+0.989622017),FQ(+0.989566838),FQ(+0.989511514),
-    FQ(+0.989456043),FQ(+0.989400428),FQ(+0.989344667),FQ(+0.989288760),FQ(+0.989232708),
-    FQ(+0.989176510),FQ(+0.989120167),FQ(+0.989063678),FQ(+0.989007044),FQ(+0.988950265),
-    FQ(+0.988893340),FQ(+0.988836269),FQ(+0.988779053),FQ(+0.988721692),FQ(+0.988664185),
-    FQ(+0.988606533),FQ(+0.988548736),FQ(+0.988490793),FQ(+0.988432705),FQ(+0.988374471),
-    FQ(+0.988316092),FQ(+0.988257568),FQ(+0.988198898),FQ(+0.988140083),FQ(+0.988081123),
-    FQ(+0.988022017),FQ(+0.987962766),FQ(+0.987903370),FQ(+0.987843828),FQ(+0.987784142),
-    FQ(+0.987724310),FQ(+0.987664332),FQ(+0.987604210),FQ(+0.987543942),FQ(+0.987483529),
-    FQ(+0.987422970),FQ(+0.987362267),FQ(+0.987301418),FQ(+0.987240424),FQ(+0.987179285),
-    FQ(+0.987118001),FQ(+0.987056571),FQ(+0.986994997),FQ(+0.986933277),FQ(+0.986871412),
-    FQ(+0.986809402),FQ(+0.986747247),FQ(+0.986684946),FQ(+0.986622501),FQ(+0.986559910),
-    FQ(+0.986497175),FQ(+0.986434294),FQ(+0.986371268),FQ(+0.986308097),FQ(+0.986244781),
-    FQ(+0.986181320),FQ(+0.986117714),FQ(+0.986053963),FQ(+0.985990067),FQ(+0.985926026),
-    FQ(+0.985861840),FQ(+0.985797509),FQ(+0.985733033),FQ(+0.985668412),FQ(+0.985603646),
-    FQ(+0.985538735),FQ(+0.985473679),FQ(+0.985408479),FQ(+0.985343133),FQ(+0.985277642),
-    FQ(+0.985212007),FQ(+0.985146226),FQ(+0.985080301),FQ(+0.985014231),FQ(+0.984948016),
-    FQ(+0.984881656),FQ(+0.984815151),FQ(+0.984748502),FQ(+0.984681707),FQ(+0.984614768),
-    FQ(+0.984547684),FQ(+0.984480455),FQ(+0.984413082),FQ(+0.984345563),FQ(+0.984277900),
-    FQ(+0.984210092),FQ(+0.984142140),FQ(+0.984074042),FQ(+0.984005800),FQ(+0.983937413),
-    FQ(+0.983868882),FQ(+0.983800206),FQ(+0.983731385),FQ(+0.983662419),FQ(+0.983593309),
-    FQ(+0.983524054),FQ(+0.983454655),FQ(+0.983385110),FQ(+0.983315422),FQ(+0.983245588),
-    FQ(+0.983175610),FQ(+0.983105487),FQ(+0.983035220),FQ(+0.982964808),FQ(+0.982894252),
-    FQ(+0.982823551),FQ(+0.982752706),FQ(+0.982681716),FQ(+0.982610581),FQ(+0.982539302),
-    FQ(+0.982467879),FQ(+0.982396311),FQ(+0.982324598),FQ(+0.982252741),FQ(+0.982180740),
-    FQ(+0.982108594),FQ(+0.982036304),FQ(+0.981963869),FQ(+0.981891290),FQ(+0.981818566),
-    FQ(+0.981745699),FQ(+0.981672686),FQ(+0.981599530),FQ(+0.981526228),FQ(+0.981452783),
-    FQ(+0.981379193),FQ(+0.981305459),FQ(+0.981231581),FQ(+0.981157558),FQ(+0.981083391),
-    FQ(+0.981009080),FQ(+0.980934624),FQ(+0.980860024),FQ(+0.980785280),FQ(+0.980710392),
-    FQ(+0.980635360),FQ(+0.980560183),FQ(+0.980484862),FQ(+0.980409397),FQ(+0.980333787),
-    FQ(+0.980258034),FQ(+0.980182136),FQ(+0.980106094),FQ(+0.980029908),FQ(+0.979953578),
-    FQ(+0.979877104),FQ(+0.979800485),FQ(+0.979723723),FQ(+0.979646816),FQ(+0.979569766),
-    FQ(+0.979492571),FQ(+0.979415232),FQ(+0.979337749),FQ(+0.979260123),FQ(+0.979182352),
-    FQ(+0.979104437),FQ(+0.979026378),FQ(+0.978948175),FQ(+0.978869829),FQ(+0.978791338),
-    FQ(+0.978712703),FQ(+0.978633924),FQ(+0.978555002),FQ(+0.978475935),FQ(+0.978396725),
-    FQ(+0.978317371),FQ(+0.978237873),FQ(+0.978158231),FQ(+0.978078445),FQ(+0.977998515),
-    FQ(+0.977918441),FQ(+0.977838224),FQ(+0.977757863),FQ(+0.977677358),FQ(+0.977596709),
-    FQ(+0.977515917),FQ(+0.977434980),FQ(+0.977353900),FQ(+0.977272676),FQ(+0.977191309),
-    FQ(+0.977109798),FQ(+0.977028143),FQ(+0.976946344),FQ(+0.976864402),FQ(+0.976782316),
-    FQ(+0.976700086),FQ(+0.976617713),FQ(+0.976535196),FQ(+0.976452535),FQ(+0.976369731),
-    FQ(+0.976286784),FQ(+0.976203692),FQ(+0.976120457),FQ(+0.976037079),FQ(+0.975953557),
-    FQ(+0.975869892),FQ(+0.975786083),FQ(+0.975702130),FQ(+0.975618034),FQ(+0.975533795),
-    FQ(+0.975449412),FQ(+0.975364885),FQ(+0.975280215),FQ(+0.975195402),FQ(+0.975110445),
-    FQ(+0.975025345),FQ(+0.974940102),FQ(+0.974854715),FQ(+0.974769184),FQ(+0.974683511),
-    FQ(+0.974597694),FQ(+0.974511733),FQ(+0.974425630),FQ(+0.974339383),FQ(+0.974252993),
-    FQ(+0.974166459),FQ(+0.974079782),FQ(+0.973992962),FQ(+0.973905999),FQ(+0.973818892),
-    FQ(+0.973731643),FQ(+0.973644250),FQ(+0.973556714),FQ(+0.973469034),FQ(+0.973381212),
-    FQ(+0.973293246),FQ(+0.973205137),FQ(+0.973116885),FQ(+0.973028490),FQ(+0.972939952),
-    FQ(+0.972851271),FQ(+0.972762447),FQ(+0.972673479),FQ(+0.972584369),FQ(+0.972495115),
-    FQ(+0.972405719),FQ(+0.972316180),FQ(+0.972226497),FQ(+0.972136672),FQ(+0.972046703),
-    FQ(+0.971956592),FQ(+0.971866337),FQ(+0.971775940),FQ(+0.971685400),FQ(+0.971594717),
-    FQ(+0.971503891),FQ(+0.971412922),FQ(+0.971321810),FQ(+0.971230556),FQ(+0.971139158),
-    FQ(+0.971047618),FQ(+0.970955935),FQ(+0.970864109),FQ(+0.970772141),FQ(+0.970680029),
-    FQ(+0.970587775),FQ(+0.970495378),FQ(+0.970402839),FQ(+0.970310156),FQ(+0.970217331),
-    FQ(+0.970124364),FQ(+0.970031253),FQ(+0.969938000),FQ(+0.969844604),FQ(+0.969751066),
-    FQ(+0.969657385),FQ(+0.969563562),FQ(+0.969469595),FQ(+0.969375487),FQ(+0.969281235),
-    FQ(+0.969186842),FQ(+0.969092305),FQ(+0.968997626),FQ(+0.968902805),FQ(+0.968807841),
-    FQ(+0.968712734),FQ(+0.968617486),FQ(+0.968522094),FQ(+0.968426561),FQ(+0.968330884),
-    FQ(+0.968235066),FQ(+0.968139105),FQ(+0.968043001),FQ(+0.967946756),FQ(+0.967850368),
-    FQ(+0.967753837),FQ(+0.967657164),FQ(+0.967560349),FQ(+0.967463392),FQ(+0.967366292),
-    FQ(+0.967269050),FQ(+0.967171666),FQ(+0.967074140),FQ(+0.966976471),FQ(+0.966878660),
-    FQ(+0.966780707),FQ(+0.966682612),FQ(+0.966584374),FQ(+0.966485995),FQ(+0.966387473),
-    FQ(+0.966288809),FQ(+0.966190003),FQ(+0.966091055),FQ(+0.965991965),FQ(+0.965892733),
-    FQ(+0.965793359),FQ(+0.965693843),FQ(+0.965594184),FQ(+0.965494384),FQ(+0.965394442),
-    FQ(+0.965294357),FQ(+0.965194131),FQ(+0.965093763),FQ(+0.964993253),FQ(+0.964892601),
-    FQ(+0.964791807),FQ(+0.964690871),FQ(+0.964589793),FQ(+0.964488574),FQ(+0.964387212),
-    FQ(+0.964285709),FQ(+0.964184064),FQ(+0.964082277),FQ(+0.963980348),FQ(+0.963878278),
-    FQ(+0.963776066),FQ(+0.963673712),FQ(+0.963571216),FQ(+0.963468579),FQ(+0.963365800),
-    FQ(+0.963262879),FQ(+0.963159817),FQ(+0.963056613),FQ(+0.962953267),FQ(+0.962849780),
-    FQ(+0.962746151),FQ(+0.962642380),FQ(+0.962538468),FQ(+0.962434414),FQ(+0.962330219),
-    FQ(+0.962225882),FQ(+0.962121404),FQ(+0.962016785),FQ(+0.961912023),FQ(+0.961807121),
-    FQ(+0.961702077),FQ(+0.961596891),FQ(+0.961491564),FQ(+0.961386096),FQ(+0.961280486),
-    FQ(+0.961174735),FQ(+0.961068842),FQ(+0.960962808),FQ(+0.960856633),FQ(+0.960750317),
-    FQ(+0.960643859),FQ(+0.960537260),FQ(+0.960430519),FQ(+0.960323638),FQ(+0.960216615),
-    FQ(+0.960109451),FQ(+0.960002146),FQ(+0.959894699),FQ(+0.959787112),FQ(+0.959679383),
-    FQ(+0.959571513),FQ(+0.959463502),FQ(+0.959355350),FQ(+0.959247057),FQ(+0.959138622),
-    FQ(+0.959030047),FQ(+0.958921331),FQ(+0.958812473),FQ(+0.958703475),FQ(+0.958594335),
-    FQ(+0.958485055),FQ(+0.958375634),FQ(+0.958266071),FQ(+0.958156368),FQ(+0.958046524),
-    FQ(+0.957936539),FQ(+0.957826413),FQ(+0.957716146),FQ(+0.957605739),FQ(+0.957495190),
-    FQ(+0.957384501),FQ(+0.957273671),FQ(+0.957162700),FQ(+0.957051588),FQ(+0.956940336),
-    FQ(+0.956828943),FQ(+0.956717409),FQ(+0.956605734),FQ(+0.956493919),FQ(+0.956381963),
-    FQ(+0.956269866),FQ(+0.956157629),FQ(+0.956045251),FQ(+0.955932733),FQ(+0.955820074),
-    FQ(+0.955707274),FQ(+0.955594334),FQ(+0.955481253),FQ(+0.955368032),FQ(+0.955254671),
-    FQ(+0.955141168),FQ(+0.955027526),FQ(+0.954913742),FQ(+0.954799819),FQ(+0.954685755),
-    FQ(+0.954571551),FQ(+0.954457206),FQ(+0.954342721),FQ(+0.954228095),FQ(+0.954113329),
-    FQ(+0.953998423),FQ(+0.953883377),FQ(+0.953768190),FQ(+0.953652863),FQ(+0.953537396),
-    FQ(+0.953421788),FQ(+0.953306040),FQ(+0.953190152),FQ(+0.953074124),FQ(+0.952957956),
-    FQ(+0.952841648),FQ(+0.952725199),FQ(+0.952608610),FQ(+0.952491882),FQ(+0.952375013),
-    FQ(+0.952258004),FQ(+0.952140855),FQ(+0.952023566),FQ(+0.951906137),FQ(+0.951788568),
-    FQ(+0.951670859),FQ(+0.951553010),FQ(+0.951435021),FQ(+0.951316892),FQ(+0.951198623),
-    FQ(+0.951080215),FQ(+0.950961666),FQ(+0.950842978),FQ(+0.950724150),FQ(+0.950605182),
-    FQ(+0.950486074),FQ(+0.950366826),FQ(+0.950247439),FQ(+0.950127912),FQ(+0.950008245),
-    FQ(+0.949888438),FQ(+0.949768492),FQ(+0.949648406),FQ(+0.949528181),FQ(+0.949407815),
-    FQ(+0.949287310),FQ(+0.949166666),FQ(+0.949045882),FQ(+0.948924958),FQ(+0.948803895),
-    FQ(+0.948682692),FQ(+0.948561350),FQ(+0.948439868),FQ(+0.948318247),FQ(+0.948196486),
-    FQ(+0.948074586),FQ(+0.947952546),FQ(+0.947830367),FQ(+0.947708049),FQ(+0.947585591),
-    FQ(+0.947462994),FQ(+0.947340257),FQ(+0.947217381),FQ(+0.947094366),FQ(+0.946971212),
-    FQ(+0.946847918),FQ(+0.946724485),FQ(+0.946600913),FQ(+0.946477202),FQ(+0.946353351),
-    FQ(+0.946229361),FQ(+0.946105232),FQ(+0.945980964),FQ(+0.945856557),FQ(+0.945732011),
-    FQ(+0.945607325),FQ(+0.945482501),FQ(+0.945357537),FQ(+0.945232435),FQ(+0.945107193),
-    FQ(+0.944981813),FQ(+0.944856293),FQ(+0.944730635),FQ(+0.944604837),FQ(+0.944478901),
-    FQ(+0.944352826),FQ(+0.944226612),FQ(+0.944100258),FQ(+0.943973767),FQ(+0.943847136),
-    FQ(+0.943720366),FQ(+0.943593458),FQ(+0.943466411),FQ(+0.943339225),FQ(+0.943211901),
-    FQ(+0.943084437),FQ(+0.942956836),FQ(+0.942829095),FQ(+0.942701216),FQ(+0.942573198),
-    FQ(+0.942445041),FQ(+0.942316746),FQ(+0.942188312),FQ(+0.942059740),FQ(+0.941931029),
-    FQ(+0.941802179),FQ(+0.941673192),FQ(+0.941544065),FQ(+0.941414800),FQ(+0.941285397),
-    FQ(+0.941155855),FQ(+0.941026175),FQ(+0.940896356),FQ(+0.940766400),FQ(+0.940636304),
-    FQ(+0.940506071),FQ(+0.940375699),FQ(+0.940245188),FQ(+0.940114540),FQ(+0.939983753),
-    FQ(+0.939852828),FQ(+0.939721765),FQ(+0.939590563),FQ(+0.939459224),FQ(+0.939327746),
-    FQ(+0.939196130),FQ(+0.939064376),FQ(+0.938932484),FQ(+0.938800453),FQ(+0.938668285),
-    FQ(+0.938535978),FQ(+0.938403534),FQ(+0.938270952),FQ(+0.938138231),FQ(+0.938005373),
-    FQ(+0.937872376),FQ(+0.937739242),FQ(+0.937605970),FQ(+0.937472560),FQ(+0.937339012),
-    FQ(+0.937205326),FQ(+0.937071502),FQ(+0.936937541),FQ(+0.936803442),FQ(+0.936669205),
-    FQ(+0.936534830),FQ(+0.936400317),FQ(+0.936265667),FQ(+0.936130879),FQ(+0.935995954),
-    FQ(+0.935860890),FQ(+0.935725689),FQ(+0.935590351),FQ(+0.935454875),FQ(+0.935319261),
-    FQ(+0.935183510),FQ(+0.935047621),FQ(+0.934911595),FQ(+0.934775431),FQ(+0.934639130),
-    FQ(+0.934502691),FQ(+0.934366115),FQ(+0.934229401),FQ(+0.934092550),FQ(+0.933955562),
-    FQ(+0.933818436),FQ(+0.933681173),FQ(+0.933543773),FQ(+0.933406235),FQ(+0.933268560),
-    FQ(+0.933130748),FQ(+0.932992799),FQ(+0.932854712),FQ(+0.932716488),FQ(+0.932578127),
-    FQ(+0.932439629),FQ(+0.932300994),FQ(+0.932162222),FQ(+0.932023312),FQ(+0.931884266),
-    FQ(+0.931745082),FQ(+0.931605761),FQ(+0.931466304),FQ(+0.931326709),FQ(+0.931186977),
-    FQ(+0.931047109),FQ(+0.930907103),FQ(+0.930766961),FQ(+0.930626682),FQ(+0.930486266),
-    FQ(+0.930345713),FQ(+0.930205023),FQ(+0.930064196),FQ(+0.929923233),FQ(+0.929782133),
-    FQ(+0.929640896),FQ(+0.929499522),FQ(+0.929358012),FQ(+0.929216365),FQ(+0.929074581),
-    FQ(+0.928932661),FQ(+0.928790604),FQ(+0.928648411),FQ(+0.928506080),FQ(+0.928363614),
-    FQ(+0.928221011),FQ(+0.928078271),FQ(+0.927935395),FQ(+0.927792382),FQ(+0.927649233),
-    FQ(+0.927505948),FQ(+0.927362526),FQ(+0.927218967),FQ(+0.927075273),FQ(+0.926931442),
-    FQ(+0.926787474),FQ(+0.926643371),FQ(+0.926499131),FQ(+0.926354755),FQ(+0.926210242),
-    FQ(+0.926065594),FQ(+0.925920809),FQ(+0.925775888),FQ(+0.925630831),FQ(+0.925485637),
-    FQ(+0.925340308),FQ(+0.925194842),FQ(+0.925049241),FQ(+0.924903503),FQ(+0.924757630),
-    FQ(+0.924611620),FQ(+0.924465474),FQ(+0.924319193),FQ(+0.924172775),FQ(+0.924026222),
-    FQ(+0.923879533),FQ(+0.923732707),FQ(+0.923585746),FQ(+0.923438649),FQ(+0.923291417),
-    FQ(+0.923144048),FQ(+0.922996544),FQ(+0.922848904),FQ(+0.922701128),FQ(+0.922553217),
-    FQ(+0.922405170),FQ(+0.922256987),FQ(+0.922108669),FQ(+0.921960215),FQ(+0.921811625),
-    FQ(+0.921662900),FQ(+0.921514039),FQ(+0.921365043),FQ(+0.921215911),FQ(+0.921066644),
-    FQ(+0.920917242),FQ(+0.920767703),FQ(+0.920618030),FQ(+0.920468221),FQ(+0.920318277),
-    FQ(+0.920168197),FQ(+0.920017982),FQ(+0.919867632),FQ(+0.919717146),FQ(+0.919566525),
-    FQ(+0.919415769),FQ(+0.919264878),FQ(+0.919113852),FQ(+0.918962690),FQ(+0.918811393),
-    FQ(+0.918659961),FQ(+0.918508394),FQ(+0.918356692),FQ(+0.918204855),FQ(+0.918052883),
-    FQ(+0.917900776),FQ(+0.917748533),FQ(+0.917596156),FQ(+0.917443644),FQ(+0.917290997),
-    FQ(+0.917138215),FQ(+0.916985298),FQ(+0.916832246),FQ(+0.916679060),FQ(+0.916525739),
-    FQ(+0.916372282),FQ(+0.916218691),FQ(+0.916064966),FQ(+0.915911105),FQ(+0.915757110),
-    FQ(+0.915602981),FQ(+0.915448716),FQ(+0.915294317),FQ(+0.915139783),FQ(+0.914985115),
-    FQ(+0.914830312),FQ(+0.914675375),FQ(+0.914520303),FQ(+0.914365097),FQ(+0.914209756),
-    FQ(+0.914054280),FQ(+0.913898671),FQ(+0.913742926),FQ(+0.913587048),FQ(+0.913431035),
-    FQ(+0.913274888),FQ(+0.913118606),FQ(+0.912962190),FQ(+0.912805640),FQ(+0.912648956),
-    FQ(+0.912492137),FQ(+0.912335185),FQ(+0.912178098),FQ(+0.912020877),FQ(+0.911863521),
-    FQ(+0.911706032),FQ(+0.911548409),FQ(+0.911390651),FQ(+0.911232760),FQ(+0.911074734),
-    FQ(+0.910916575),FQ(+0.910758281),FQ(+0.910599854),FQ(+0.910441292),FQ(+0.910282597),
-    FQ(+0.910123768),FQ(+0.909964805),FQ(+0.909805708),FQ(+0.909646477),FQ(+0.909487113),
-    FQ(+0.909327615),FQ(+0.909167983),FQ(+0.909008218),FQ(+0.908848318),FQ(+0.908688285),
-    FQ(+0.908528119),FQ(+0.908367819),FQ(+0.908207385),FQ(+0.908046817),FQ(+0.907886116),
-    FQ(+0.907725282),FQ(+0.907564314),FQ(+0.907403213),FQ(+0.907241978),FQ(+0.907080610),
-    FQ(+0.906919108),FQ(+0.906757473),FQ(+0.906595705),FQ(+0.906433803),FQ(+0.906271768),
-    FQ(+0.906109599),FQ(+0.905947298),FQ(+0.905784863),FQ(+0.905622295),FQ(+0.905459594),
-    FQ(+0.905296759),FQ(+0.905133792),FQ(+0.904970691),FQ(+0.904807457),FQ(+0.904644091),
-    FQ(+0.904480591),FQ(+0.904316958),FQ(+0.904153192),FQ(+0.903989293),FQ(+0.903825261),
-    FQ(+0.903661097),FQ(+0.903496799),FQ(+0.903332368),FQ(+0.903167805),FQ(+0.903003109),
-    FQ(+0.902838280),FQ(+0.902673318),FQ(+0.902508224),FQ(+0.902342996),FQ(+0.902177637),
-    FQ(+0.902012144),FQ(+0.901846519),FQ(+0.901680761),FQ(+0.901514870),FQ(+0.901348847),
-    FQ(+0.901182691),FQ(+0.901016403),FQ(+0.900849982),FQ(+0.900683429),FQ(+0.900516744),
-    FQ(+0.900349925),FQ(+0.900182975),FQ(+0.900015892),FQ(+0.899848677),FQ(+0.899681329),
-    FQ(+0.899513849),FQ(+0.899346237),FQ(+0.899178492),FQ(+0.899010616),FQ(+0.898842607),
-    FQ(+0.898674466),FQ(+0.898506192),FQ(+0.898337787),FQ(+0.898169249),FQ(+0.898000580),
-    FQ(+0.897831778),FQ(+0.897662844),FQ(+0.897493778),FQ(+0.897324581),FQ(+0.897155251),
-    FQ(+0.896985789),FQ(+0.896816196),FQ(+0.896646470),FQ(+0.896476613),FQ(+0.896306624),
-    FQ(+0.896136503),FQ(+0.895966250),FQ(+0.895795865),FQ(+0.895625349),FQ(+0.895454701),
-    FQ(+0.895283921),FQ(+0.895113010),FQ(+0.894941967),FQ(+0.894770792),FQ(+0.894599486),
-    FQ(+0.894428048),FQ(+0.894256478),FQ(+0.894084778),FQ(+0.893912945),FQ(+0.893740981),
-    FQ(+0.893568886),FQ(+0.893396659),FQ(+0.893224301),FQ(+0.893051812),FQ(+0.892879191),
-    FQ(+0.892706439),FQ(+0.892533555),FQ(+0.892360541),FQ(+0.892187395),FQ(+0.892014118),
-    FQ(+0.891840709),FQ(+0.891667170),FQ(+0.891493499),FQ(+0.891319698),FQ(+0.891145765),
-    FQ(+0.890971701),FQ(+0.890797506),FQ(+0.890623180),FQ(+0.890448723),FQ(+0.890274135),
-    FQ(+0.890099417),FQ(+0.889924567),FQ(+0.889749586),FQ(+0.889574475),FQ(+0.889399233),
-    FQ(+0.889223860),FQ(+0.889048356),FQ(+0.888872721),FQ(+0.888696956),FQ(+0.888521060),
-    FQ(+0.888345033),FQ(+0.888168876),FQ(+0.887992588),FQ(+0.887816170),FQ(+0.887639620),
-    FQ(+0.887462941),FQ(+0.887286131),FQ(+0.887109190),FQ(+0.886932119),FQ(+0.886754917),
-    FQ(+0.886577585),FQ(+0.886400123),FQ(+0.886222530),FQ(+0.886044807),FQ(+0.885866954),
-    FQ(+0.885688970),FQ(+0.885510856),FQ(+0.885332612),FQ(+0.885154238),FQ(+0.884975733),
-    FQ(+0.884797098),FQ(+0.884618334),FQ(+0.884439439),FQ(+0.884260414),FQ(+0.884081259),
-    FQ(+0.883901974),FQ(+0.883722559),FQ(+0.883543014),FQ(+0.883363339),FQ(+0.883183534),
-    FQ(+0.883003599),FQ(+0.882823534),FQ(+0.882643340),FQ(+0.882463016),FQ(+0.882282562),
-    FQ(+0.882101978),FQ(+0.881921264),FQ(+0.881740421),FQ(+0.881559448),FQ(+0.881378346),
-    FQ(+0.881197113),FQ(+0.881015752),FQ(+0.880834260),FQ(+0.880652639),FQ(+0.880470889),
-    FQ(+0.880289009),FQ(+0.880107000),FQ(+0.879924861),FQ(+0.879742593),FQ(+0.879560195),
-    FQ(+0.879377668),FQ(+0.879195012),FQ(+0.879012226),FQ(+0.878829312),FQ(+0.878646267),
-    FQ(+0.878463094),FQ(+0.878279792),FQ(+0.878096360),FQ(+0.877912799),FQ(+0.877729109),
-    FQ(+0.877545290),FQ(+0.877361342),FQ(+0.877177265),FQ(+0.876993059),FQ(+0.876808724),
-    FQ(+0.876624260),FQ(+0.876439667),FQ(+0.876254945),FQ(+0.876070094),FQ(+0.875885115),
-    FQ(+0.875700006),FQ(+0.875514769),FQ(+0.875329403),FQ(+0.875143908),FQ(+0.874958285),
-    FQ(+0.874772533),FQ(+0.874586652),FQ(+0.874400643),FQ(+0.874214505),FQ(+0.874028239),
-    FQ(+0.873841843),FQ(+0.873655320),FQ(+0.873468668),FQ(+0.873281887),FQ(+0.873094978),
-    FQ(+0.872907941),FQ(+0.872720775),FQ(+0.872533481),FQ(+0.872346059),FQ(+0.872158508),
-    FQ(+0.871970829),FQ(+0.871783022),FQ(+0.871595087),FQ(+0.871407023),FQ(+0.871218831),
-    FQ(+0.871030511),FQ(+0.870842063),FQ(+0.870653487),FQ(+0.870464783),FQ(+0.870275951),
-    FQ(+0.870086991),FQ(+0.869897903),FQ(+0.869708687),FQ(+0.869519343),FQ(+0.869329871),
-    FQ(+0.869140272),FQ(+0.868950544),FQ(+0.868760689),FQ(+0.868570706),FQ(+0.868380595),
-    FQ(+0.868190357),FQ(+0.867999991),FQ(+0.867809497),FQ(+0.867618875),FQ(+0.867428126),
-    FQ(+0.867237250),FQ(+0.867046246),FQ(+0.866855114),FQ(+0.866663855),FQ(+0.866472468),
-    FQ(+0.866280954),FQ(+0.866089313),FQ(+0.865897544),FQ(+0.865705648),FQ(+0.865513624),
-    FQ(+0.865321473),FQ(+0.865129195),FQ(+0.864936790),FQ(+0.864744258),FQ(+0.864551598),
-    FQ(+0.864358811),FQ(+0.864165897),FQ(+0.863972856),FQ(+0.863779688),FQ(+0.863586393),
-    FQ(+0.863392971),FQ(+0.863199422),FQ(+0.863005746),FQ(+0.862811943),FQ(+0.862618013),
-    FQ(+0.862423956),FQ(+0.862229773),FQ(+0.862035462),FQ(+0.861841025),FQ(+0.861646461),
-    FQ(+0.861451771),FQ(+0.861256953),FQ(+0.861062009),FQ(+0.860866939),FQ(+0.860671741),
-    FQ(+0.860476418),FQ(+0.860280967),FQ(+0.860085390),FQ(+0.859889687),FQ(+0.859693857),
-    FQ(+0.859497901),FQ(+0.859301818),FQ(+0.859105609),FQ(+0.858909274),FQ(+0.858712812),
-    FQ(+0.858516224),FQ(+0.858319510),FQ(+0.858122670),FQ(+0.857925703),FQ(+0.857728610),
-    FQ(+0.857531391),FQ(+0.857334046),FQ(+0.857136575),FQ(+0.856938977),FQ(+0.856741254),
-    FQ(+0.856543405),FQ(+0.856345430),FQ(+0.856147328),FQ(+0.855949101),FQ(+0.855750748),
-    FQ(+0.855552269),FQ(+0.855353665),FQ(+0.855154934),FQ(+0.854956078),FQ(+0.854757096),
-    FQ(+0.854557988),FQ(+0.854358755),FQ(+0.854159396),FQ(+0.853959911),FQ(+0.853760301),
-    FQ(+0.853560565),FQ(+0.853360704),FQ(+0.853160717),FQ(+0.852960605),FQ(+0.852760367),
-    FQ(+0.852560004),FQ(+0.852359516),FQ(+0.852158902),FQ(+0.851958162),FQ(+0.851757298),
-    FQ(+0.851556308),FQ(+0.851355193),FQ(+0.851153953),FQ(+0.850952587),FQ(+0.850751097),
-    FQ(+0.850549481),FQ(+0.850347741),FQ(+0.850145875),FQ(+0.849943884),FQ(+0.849741768),
-    FQ(+0.849539527),FQ(+0.849337161),FQ(+0.849134671),FQ(+0.848932055),FQ(+0.848729315),
-    FQ(+0.848526450),FQ(+0.848323460),FQ(+0.848120345),FQ(+0.847917105),FQ(+0.847713741),
-    FQ(+0.847510252),FQ(+0.847306639),FQ(+0.847102901),FQ(+0.846899038),FQ(+0.846695051),
-    FQ(+0.846490939),FQ(+0.846286702),FQ(+0.846082342),FQ(+0.845877857),FQ(+0.845673247),
-    FQ(+0.845468513),FQ(+0.845263655),FQ(+0.845058672),FQ(+0.844853565),FQ(+0.844648334),
-    FQ(+0.844442979),FQ(+0.844237499),FQ(+0.844031895),FQ(+0.843826168),FQ(+0.843620316),
-    FQ(+0.843414340),FQ(+0.843208240),FQ(+0.843002016),FQ(+0.842795668),FQ(+0.842589196),
-    FQ(+0.842382600),FQ(+0.842175880),FQ(+0.841969036),FQ(+0.841762069),FQ(+0.841554977),
-    FQ(+0.841347762),FQ(+0.841140424),FQ(+0.840932961),FQ(+0.840725375),FQ(+0.840517665),
-    FQ(+0.840309832),FQ(+0.840101875),FQ(+0.839893794),FQ(+0.839685590),FQ(+0.839477263),
-    FQ(+0.839268812),FQ(+0.839060237),FQ(+0.838851539),FQ(+0.838642718),FQ(+0.838433773),
-    FQ(+0.838224706),FQ(+0.838015514),FQ(+0.837806200),FQ(+0.837596762),FQ(+0.837387202),
-    FQ(+0.837177518),FQ(+0.836967711),FQ(+0.836757780),FQ(+0.836547727),FQ(+0.836337551),
-    FQ(+0.836127252),FQ(+0.835916830),FQ(+0.835706284),FQ(+0.835495616),FQ(+0.835284825),
-    FQ(+0.835073912),FQ(+0.834862875),FQ(+0.834651716),FQ(+0.834440433),FQ(+0.834229029),
-    FQ(+0.834017501),FQ(+0.833805851),FQ(+0.833594078),FQ(+0.833382183),FQ(+0.833170165),
-    FQ(+0.832958024),FQ(+0.832745761),FQ(+0.832533376),FQ(+0.832320868),FQ(+0.832108237),
-    FQ(+0.831895485),FQ(+0.831682610),FQ(+0.831469612),FQ(+0.831256493),FQ(+0.831043251),
-    FQ(+0.830829887),FQ(+0.830616400),FQ(+0.830402792),FQ(+0.830189061),FQ(+0.829975209),
-    FQ(+0.829761234),FQ(+0.829547137),FQ(+0.829332918),FQ(+0.829118577),FQ(+0.828904115),
-    FQ(+0.828689530),FQ(+0.828474824),FQ(+0.828259995),FQ(+0.828045045),FQ(+0.827829973),
-    FQ(+0.827614780),FQ(+0.827399464),FQ(+0.827184027),FQ(+0.826968469),FQ(+0.826752788),
-    FQ(+0.826536986),FQ(+0.826321063),FQ(+0.826105018),FQ(+0.825888851),FQ(+0.825672563),
-    FQ(+0.825456154),FQ(+0.825239623),FQ(+0.825022971),FQ(+0.824806198),FQ(+0.824589303),
-    FQ(+0.824372287),FQ(+0.824155149),FQ(+0.823937891),FQ(+0.823720511),FQ(+0.823503010),
-    FQ(+0.823285388),FQ(+0.823067645),FQ(+0.822849781),FQ(+0.822631796),FQ(+0.822413690),
-    FQ(+0.822195463),FQ(+0.821977115),FQ(+0.821758646),FQ(+0.821540057),FQ(+0.821321346),
-    FQ(+0.821102515),FQ(+0.820883563),FQ(+0.820664490),FQ(+0.820445297),FQ(+0.820225983),
-    FQ(+0.820006548),FQ(+0.819786992),FQ(+0.819567317),FQ(+0.819347520),FQ(+0.819127603),
-    FQ(+0.818907566),FQ(+0.818687408),FQ(+0.818467130),FQ(+0.818246731),FQ(+0.818026212),
-    FQ(+0.817805573),FQ(+0.817584813),FQ(+0.817363933),FQ(+0.817142933),FQ(+0.816921813),
-    FQ(+0.816700573),FQ(+0.816479212),FQ(+0.816257732),FQ(+0.816036131),FQ(+0.815814411),
-    FQ(+0.815592570),FQ(+0.815370610),FQ(+0.815148529),FQ(+0.814926329),FQ(+0.814704009),
-    FQ(+0.814481569),FQ(+0.814259009),FQ(+0.814036330),FQ(+0.813813530),FQ(+0.813590612),
-    FQ(+0.813367573),FQ(+0.813144415),FQ(+0.812921137),FQ(+0.812697740),FQ(+0.812474223),
-    FQ(+0.812250587),FQ(+0.812026831),FQ(+0.811802956),FQ(+0.811578961),FQ(+0.811354847),
-    FQ(+0.811130614),FQ(+0.810906261),FQ(+0.810681789),FQ(+0.810457198),FQ(+0.810232488),
-    FQ(+0.810007659),FQ(+0.809782710),FQ(+0.809557642),FQ(+0.809332456),FQ(+0.809107150),
-    FQ(+0.808881725),FQ(+0.808656182),FQ(+0.808430519),FQ(+0.808204737),FQ(+0.807978837),
-    FQ(+0.807752818),FQ(+0.807526680),FQ(+0.807300423),FQ(+0.807074048),FQ(+0.806847554),
-    FQ(+0.806620941),FQ(+0.806394209),FQ(+0.806167359),FQ(+0.805940391),FQ(+0.805713303),
-    FQ(+0.805486098),FQ(+0.805258774),FQ(+0.805031331),FQ(+0.804803770),FQ(+0.804576091),
-    FQ(+0.804348293),FQ(+0.804120377),FQ(+0.803892343),FQ(+0.803664191),FQ(+0.803435920),
-    FQ(+0.803207531),FQ(+0.802979025),FQ(+0.802750400),FQ(+0.802521657),FQ(+0.802292796),
-    FQ(+0.802063816),FQ(+0.801834719),FQ(+0.801605505),FQ(+0.801376172),FQ(+0.801146721),
-    FQ(+0.800917153),FQ(+0.800687466),FQ(+0.800457662),FQ(+0.800227740),FQ(+0.799997701),
-    FQ(+0.799767544),FQ(+0.799537269),FQ(+0.799306877),FQ(+0.799076367),FQ(+0.798845740),
-    FQ(+0.798614995),FQ(+0.798384132),FQ(+0.798153153),FQ(+0.797922055),FQ(+0.797690841),
-    FQ(+0.797459509),FQ(+0.797228060),FQ(+0.796996494),FQ(+0.796764810),FQ(+0.796533009),
-    FQ(+0.796301092),FQ(+0.796069057),FQ(+0.795836905),FQ(+0.795604636),FQ(+0.795372249),
-    FQ(+0.795139746),FQ(+0.794907126),FQ(+0.794674389),FQ(+0.794441536),FQ(+0.794208565),
-    FQ(+0.793975478),FQ(+0.793742273),FQ(+0.793508952),FQ(+0.793275515),FQ(+0.793041960),
-    FQ(+0.792808290),FQ(+0.792574502),FQ(+0.792340598),FQ(+0.792106577),FQ(+0.791872440),
-    FQ(+0.791638187),FQ(+0.791403817),FQ(+0.791169330),FQ(+0.790934727),FQ(+0.790700008),
-    FQ(+0.790465173),FQ(+0.790230221),FQ(+0.789995154),FQ(+0.789759970),FQ(+0.789524669),
-    FQ(+0.789289253),FQ(+0.789053721),FQ(+0.788818072),FQ(+0.788582308),FQ(+0.788346428),
-    FQ(+0.788110431),FQ(+0.787874319),FQ(+0.787638091),FQ(+0.787401747),FQ(+0.787165287),
-    FQ(+0.786928712),FQ(+0.786692021),FQ(+0.786455214),FQ(+0.786218291),FQ(+0.785981253),
-    FQ(+0.785744099),FQ(+0.785506830),FQ(+0.785269445),FQ(+0.785031944),FQ(+0.784794328),
-    FQ(+0.784556597),FQ(+0.784318751),FQ(+0.784080789),FQ(+0.783842711),FQ(+0.783604519),
-    FQ(+0.783366211),FQ(+0.783127788),FQ(+0.782889250),FQ(+0.782650596),FQ(+0.782411828),
-    FQ(+0.782172944),FQ(+0.781933946),FQ(+0.781694832),FQ(+0.781455604),FQ(+0.781216260),
-    FQ(+0.780976802),FQ(+0.780737229),FQ(+0.780497541),FQ(+0.780257738),FQ(+0.780017820),
-    FQ(+0.779777788),FQ(+0.779537641),FQ(+0.779297379),FQ(+0.779057003),FQ(+0.778816512),
-    FQ(+0.778575907),FQ(+0.778335187),FQ(+0.778094353),FQ(+0.777853404),FQ(+0.777612341),
-    FQ(+0.777371164),FQ(+0.777129872),FQ(+0.776888466),FQ(+0.776646945),FQ(+0.776405311),
-    FQ(+0.776163562),FQ(+0.775921699),FQ(+0.775679722),FQ(+0.775437631),FQ(+0.775195426),
-    FQ(+0.774953107),FQ(+0.774710673),FQ(+0.774468126),FQ(+0.774225465),FQ(+0.773982691),
-    FQ(+0.773739802),FQ(+0.773496799),FQ(+0.773253683),FQ(+0.773010453),FQ(+0.772767110),
-    FQ(+0.772523652),FQ(+0.772280082),FQ(+0.772036397),FQ(+0.771792599),FQ(+0.771548688),
-    FQ(+0.771304663),FQ(+0.771060524),FQ(+0.770816272),FQ(+0.770571907),FQ(+0.770327429),
-    FQ(+0.770082837),FQ(+0.769838132),FQ(+0.769593314),FQ(+0.769348382),FQ(+0.769103338),
-    FQ(+0.768858180),FQ(+0.768612909),FQ(+0.768367525),FQ(+0.768122029),FQ(+0.767876419),
-    FQ(+0.767630696),FQ(+0.767384860),FQ(+0.767138912),FQ(+0.766892851),FQ(+0.766646677),
-    FQ(+0.766400390),FQ(+0.766153990),FQ(+0.765907478),FQ(+0.765660853),FQ(+0.765414116),
-    FQ(+0.765167266),FQ(+0.764920303),FQ(+0.764673228),FQ(+0.764426040),FQ(+0.764178741),
-    FQ(+0.763931328),FQ(+0.763683804),FQ(+0.763436167),FQ(+0.763188417),FQ(+0.762940556),
-    FQ(+0.762692582),FQ(+0.762444496),FQ(+0.762196298),FQ(+0.761947988),FQ(+0.761699566),
-    FQ(+0.761451032),FQ(+0.761202385),FQ(+0.760953627),FQ(+0.760704757),FQ(+0.760455775),
-    FQ(+0.760206682),FQ(+0.759957476),FQ(+0.759708159),FQ(+0.759458730),FQ(+0.759209189),
-    FQ(+0.758959537),FQ(+0.758709773),FQ(+0.758459897),FQ(+0.758209910),FQ(+0.757959811),
-    FQ(+0.757709601),FQ(+0.757459279),FQ(+0.757208847),FQ(+0.756958302),FQ(+0.756707647),
-    FQ(+0.756456880),FQ(+0.756206001),FQ(+0.755955012),FQ(+0.755703911),FQ(+0.755452700),
-    FQ(+0.755201377),FQ(+0.754949943),FQ(+0.754698398),FQ(+0.754446742),FQ(+0.754194975),
-    FQ(+0.753943098),FQ(+0.753691109),FQ(+0.753439009),FQ(+0.753186799),FQ(+0.752934478),
-    FQ(+0.752682046),FQ(+0.752429504),FQ(+0.752176850),FQ(+0.751924087),FQ(+0.751671212),
-    FQ(+0.751418227),FQ(+0.751165132),FQ(+0.750911926),FQ(+0.750658610),FQ(+0.750405183),
-    FQ(+0.750151646),FQ(+0.749897998),FQ(+0.749644241),FQ(+0.749390373),FQ(+0.749136395),
-    FQ(+0.748882306),FQ(+0.748628108),FQ(+0.748373799),FQ(+0.748119380),FQ(+0.747864852),
-    FQ(+0.747610213),FQ(+0.747355465),FQ(+0.747100606),FQ(+0.746845638),FQ(+0.746590559),
-    FQ(+0.746335371),FQ(+0.746080074),FQ(+0.745824666),FQ(+0.745569149),FQ(+0.745313522),
-    FQ(+0.745057785),FQ(+0.744801939),FQ(+0.744545984),FQ(+0.744289919),FQ(+0.744033744),
-    FQ(+0.743777460),FQ(+0.743521067),FQ(+0.743264564),FQ(+0.743007952),FQ(+0.742751231),
-    FQ(+0.742494400),FQ(+0.742237461),FQ(+0.741980412),FQ(+0.741723254),FQ(+0.741465987),
-    FQ(+0.741208610),FQ(+0.740951125),FQ(+0.740693531),FQ(+0.740435828),FQ(+0.740178016),
-    FQ(+0.739920095),FQ(+0.739662066),FQ(+0.739403927),FQ(+0.739145680),FQ(+0.738887324),
-    FQ(+0.738628860),FQ(+0.738370287),FQ(+0.738111605),FQ(+0.737852815),FQ(+0.737593916),
-    FQ(+0.737334909),FQ(+0.737075793),FQ(+0.736816569),FQ(+0.736557236),FQ(+0.736297796),
-    FQ(+0.736038247),FQ(+0.735778589),FQ(+0.735518824),FQ(+0.735258950),FQ(+0.734998968),
-    FQ(+0.734738878),FQ(+0.734478680),FQ(+0.734218374),FQ(+0.733957960),FQ(+0.733697438),
-    FQ(+0.733436808),FQ(+0.733176071),FQ(+0.732915225),FQ(+0.732654272),FQ(+0.732393211),
-    FQ(+0.732132042),FQ(+0.731870765),FQ(+0.731609381),FQ(+0.731347890),FQ(+0.731086290),
-    FQ(+0.730824583),FQ(+0.730562769),FQ(+0.730300848),FQ(+0.730038818),FQ(+0.729776682),
-    FQ(+0.729514438),FQ(+0.729252087),FQ(+0.728989629),FQ(+0.728727063),FQ(+0.728464390),
-    FQ(+0.728201611),FQ(+0.727938724),FQ(+0.727675730),FQ(+0.727412629),FQ(+0.727149421),
-    FQ(+0.726886106),FQ(+0.726622684),FQ(+0.726359155),FQ(+0.726095520),FQ(+0.725831777),
-    FQ(+0.725567928),FQ(+0.725303972),FQ(+0.725039910),FQ(+0.724775741),FQ(+0.724511465),
-    FQ(+0.724247083),FQ(+0.723982594),FQ(+0.723717999),FQ(+0.723453297),FQ(+0.723188489),
-    FQ(+0.722923575),FQ(+0.722658554),FQ(+0.722393427),FQ(+0.722128194),FQ(+0.721862854),
-    FQ(+0.721597409),FQ(+0.721331857),FQ(+0.721066199),FQ(+0.720800435),FQ(+0.720534566),
-    FQ(+0.720268590),FQ(+0.720002508),FQ(+0.719736320),FQ(+0.719470027),FQ(+0.719203627),
-    FQ(+0.718937122),FQ(+0.718670512),FQ(+0.718403795),FQ(+0.718136973),FQ(+0.717870045),
-    FQ(+0.717603012),FQ(+0.717335873),FQ(+0.717068628),FQ(+0.716801279),FQ(+0.716533823),
-    FQ(+0.716266263),FQ(+0.715998597),FQ(+0.715730825),FQ(+0.715462949),FQ(+0.715194967),
-    FQ(+0.714926880),FQ(+0.714658688),FQ(+0.714390391),FQ(+0.714121988),FQ(+0.713853481),
-    FQ(+0.713584869),FQ(+0.713316152),FQ(+0.713047329),FQ(+0.712778402),FQ(+0.712509371),
-    FQ(+0.712240234),FQ(+0.711970993),FQ(+0.711701646),FQ(+0.711432196),FQ(+0.711162640),
-    FQ(+0.710892980),FQ(+0.710623216),FQ(+0.710353347),FQ(+0.710083373),FQ(+0.709813295),
-    FQ(+0.709543113),FQ(+0.709272826),FQ(+0.709002435),FQ(+0.708731940),FQ(+0.708461341),
-    FQ(+0.708190637),FQ(+0.707919829),FQ(+0.707648917),FQ(+0.707377901),FQ(+0.707106781),
-    FQ(+0.706835557),FQ(+0.706564229),FQ(+0.706292797),FQ(+0.706021261),FQ(+0.705749622),
-    FQ(+0.705477878),FQ(+0.705206031),FQ(+0.704934080),FQ(+0.704662026),FQ(+0.704389868),
-    FQ(+0.704117606),FQ(+0.703845241),FQ(+0.703572772),FQ(+0.703300199),FQ(+0.703027524),
-    FQ(+0.702754744),FQ(+0.702481862),FQ(+0.702208876),FQ(+0.701935787),FQ(+0.701662595),
-    FQ(+0.701389299),FQ(+0.701115901),FQ(+0.700842399),FQ(+0.700568794),FQ(+0.700295086),
-    FQ(+0.700021275),FQ(+0.699747361),FQ(+0.699473345),FQ(+0.699199225),FQ(+0.698925003),
-    FQ(+0.698650677),FQ(+0.698376249),FQ(+0.698101719),FQ(+0.697827085),FQ(+0.697552349),
-    FQ(+0.697277511),FQ(+0.697002570),FQ(+0.696727526),FQ(+0.696452380),FQ(+0.696177131),
-    FQ(+0.695901781),FQ(+0.695626327),FQ(+0.695350772),FQ(+0.695075114),FQ(+0.694799354),
-    FQ(+0.694523492),FQ(+0.694247527),FQ(+0.693971461),FQ(+0.693695292),FQ(+0.693419022),
-    FQ(+0.693142649),FQ(+0.692866175),FQ(+0.692589598),FQ(+0.692312920),FQ(+0.692036140),
-    FQ(+0.691759258),FQ(+0.691482275),FQ(+0.691205190),FQ(+0.690928003),FQ(+0.690650714),
-    FQ(+0.690373324),FQ(+0.690095832),FQ(+0.689818239),FQ(+0.689540545),FQ(+0.689262749),
-    FQ(+0.688984851),FQ(+0.688706853),FQ(+0.688428753),FQ(+0.688150552),FQ(+0.687872249),
-    FQ(+0.687593846),FQ(+0.687315341),FQ(+0.687036735),FQ(+0.686758028),FQ(+0.686479220),
-    FQ(+0.686200312),FQ(+0.685921302),FQ(+0.685642191),FQ(+0.685362980),FQ(+0.685083668),
-    FQ(+0.684804255),FQ(+0.684524741),FQ(+0.684245127),FQ(+0.683965412),FQ(+0.683685596),
-    FQ(+0.683405680),FQ(+0.683125663),FQ(+0.682845546),FQ(+0.682565329),FQ(+0.682285011),
-    FQ(+0.682004593),FQ(+0.681724074),FQ(+0.681443455),FQ(+0.681162736),FQ(+0.680881917),
-    FQ(+0.680600998),FQ(+0.680319978),FQ(+0.680038859),FQ(+0.679757639),FQ(+0.679476320),
-    FQ(+0.679194900),FQ(+0.678913381),FQ(+0.678631762),FQ(+0.678350043),FQ(+0.678068224),
-    FQ(+0.677786306),FQ(+0.677504288),FQ(+0.677222170),FQ(+0.676939953),FQ(+0.676657636),
-    FQ(+0.676375219),FQ(+0.676092704),FQ(+0.675810088),FQ(+0.675527374),FQ(+0.675244559),
-    FQ(+0.674961646),FQ(+0.674678633),FQ(+0.674395522),FQ(+0.674112311),FQ(+0.673829000),
-    FQ(+0.673545591),FQ(+0.673262083),FQ(+0.672978475),FQ(+0.672694769),FQ(+0.672410964),
-    FQ(+0.672127060),FQ(+0.671843057),FQ(+0.671558955),FQ(+0.671274754),FQ(+0.670990455),
-    FQ(+0.670706057),FQ(+0.670421560),FQ(+0.670136965),FQ(+0.669852271),FQ(+0.669567479),
-    FQ(+0.669282588),FQ(+0.668997599),FQ(+0.668712512),FQ(+0.668427326),FQ(+0.668142041),
-    FQ(+0.667856659),FQ(+0.667571178),FQ(+0.667285599),FQ(+0.666999922),FQ(+0.666714147),
-    FQ(+0.666428274),FQ(+0.666142303),FQ(+0.665856234),FQ(+0.665570067),FQ(+0.665283802),
-    FQ(+0.664997439),FQ(+0.664710978),FQ(+0.664424420),FQ(+0.664137764),FQ(+0.663851010),
-    FQ(+0.663564159),FQ(+0.663277210),FQ(+0.662990163),FQ(+0.662703019),FQ(+0.662415778),
-    FQ(+0.662128439),FQ(+0.661841002),FQ(+0.661553469),FQ(+0.661265838),FQ(+0.660978110),
-    FQ(+0.660690284),FQ(+0.660402362),FQ(+0.660114342),FQ(+0.659826225),FQ(+0.659538012),
-    FQ(+0.659249701),FQ(+0.658961293),FQ(+0.658672788),FQ(+0.658384187),FQ(+0.658095488),
-    FQ(+0.657806693),FQ(+0.657517801),FQ(+0.657228813),FQ(+0.656939728),FQ(+0.656650546),
-    FQ(+0.656361267),FQ(+0.656071892),FQ(+0.655782421),FQ(+0.655492853),FQ(+0.655203189),
-    FQ(+0.654913428),FQ(+0.654623571),FQ(+0.654333618),FQ(+0.654043568),FQ(+0.653753423),
-    FQ(+0.653463181),FQ(+0.653172843),FQ(+0.652882409),FQ(+0.652591879),FQ(+0.652301253),
-    FQ(+0.652010531),FQ(+0.651719713),FQ(+0.651428800),FQ(+0.651137790),FQ(+0.650846685),
-    FQ(+0.650555484),FQ(+0.650264187),FQ(+0.649972795),FQ(+0.649681307),FQ(+0.649389724),
-    FQ(+0.649098045),FQ(+0.648806271),FQ(+0.648514401),FQ(+0.648222436),FQ(+0.647930375),
-    FQ(+0.647638220),FQ(+0.647345969),FQ(+0.647053622),FQ(+0.646761181),FQ(+0.646468645),
-    FQ(+0.646176013),FQ(+0.645883286),FQ(+0.645590465),FQ(+0.645297548),FQ(+0.645004537),
-    FQ(+0.644711431),FQ(+0.644418229),FQ(+0.644124934),FQ(+0.643831543),FQ(+0.643538058),
-    FQ(+0.643244478),FQ(+0.642950803),FQ(+0.642657034),FQ(+0.642363170),FQ(+0.642069212),
-    FQ(+0.641775160),FQ(+0.641481013),FQ(+0.641186772),FQ(+0.640892436),FQ(+0.640598006),
-    FQ(+0.640303482),FQ(+0.640008864),FQ(+0.639714152),FQ(+0.639419345),FQ(+0.639124445),
-    FQ(+0.638829450),FQ(+0.638534362),FQ(+0.638239180),FQ(+0.637943904),FQ(+0.637648534),
-    FQ(+0.637353070),FQ(+0.637057512),FQ(+0.636761861),FQ(+0.636466116),FQ(+0.636170278),
-    FQ(+0.635874346),FQ(+0.635578320),FQ(+0.635282202),FQ(+0.634985989),FQ(+0.634689683),
-    FQ(+0.634393284),FQ(+0.634096792),FQ(+0.633800206),FQ(+0.633503527),FQ(+0.633206755),
-    FQ(+0.632909890),FQ(+0.632612932),FQ(+0.632315880),FQ(+0.632018736),FQ(+0.631721499),
-    FQ(+0.631424169),FQ(+0.631126745),FQ(+0.630829230),FQ(+0.630531621),FQ(+0.630233920),
-    FQ(+0.629936126),FQ(+0.629638239),FQ(+0.629340260),FQ(+0.629042188),FQ(+0.628744023),
-    FQ(+0.628445767),FQ(+0.628147417),FQ(+0.627848976),FQ(+0.627550442),FQ(+0.627251815),
-    FQ(+0.626953097),FQ(+0.626654286),FQ(+0.626355383),FQ(+0.626056388),FQ(+0.625757301),
-    FQ(+0.625458122),FQ(+0.625158851),FQ(+0.624859488),FQ(+0.624560033),FQ(+0.624260486),
-    FQ(+0.623960848),FQ(+0.623661118),FQ(+0.623361295),FQ(+0.623061382),FQ(+0.622761376),
-    FQ(+0.622461279),FQ(+0.622161091),FQ(+0.621860811),FQ(+0.621560439),FQ(+0.621259977),
-    FQ(+0.620959422),FQ(+0.620658777),FQ(+0.620358040),FQ(+0.620057212),FQ(+0.619756292),
-    FQ(+0.619455282),FQ(+0.619154181),FQ(+0.618852988),FQ(+0.618551704),FQ(+0.618250330),
-    FQ(+0.617948864),FQ(+0.617647308),FQ(+0.617345661),FQ(+0.617043923),FQ(+0.616742094),
-    FQ(+0.616440175),FQ(+0.616138164),FQ(+0.615836064),FQ(+0.615533872),FQ(+0.615231591),
-    FQ(+0.614929218),FQ(+0.614626756),FQ(+0.614324202),FQ(+0.614021559),FQ(+0.613718825),
-    FQ(+0.613416001),FQ(+0.613113087),FQ(+0.612810082),FQ(+0.612506988),FQ(+0.612203803),
-    FQ(+0.611900529),FQ(+0.611597164),FQ(+0.611293709),FQ(+0.610990165),FQ(+0.610686530),
-    FQ(+0.610382806),FQ(+0.610078992),FQ(+0.609775089),FQ(+0.609471095),FQ(+0.609167012),
-    FQ(+0.608862840),FQ(+0.608558578),FQ(+0.608254226),FQ(+0.607949785),FQ(+0.607645254),
-    FQ(+0.607340635),FQ(+0.607035925),FQ(+0.606731127),FQ(+0.606426239),FQ(+0.606121263),
-    FQ(+0.605816197),FQ(+0.605511041),FQ(+0.605205797),FQ(+0.604900464),FQ(+0.604595042),
-    FQ(+0.604289531),FQ(+0.603983931),FQ(+0.603678242),FQ(+0.603372465),FQ(+0.603066599),
-    FQ(+0.602760644),FQ(+0.602454600),FQ(+0.602148468),FQ(+0.601842247),FQ(+0.601535938),
-    FQ(+0.601229540),FQ(+0.600923054),FQ(+0.600616479),FQ(+0.600309817),FQ(+0.600003065),
-    FQ(+0.599696226),FQ(+0.599389298),FQ(+0.599082283),FQ(+0.598775179),FQ(+0.598467987),
-    FQ(+0.598160707),FQ(+0.597853339),FQ(+0.597545883),FQ(+0.597238340),FQ(+0.596930708),
-    FQ(+0.596622989),FQ(+0.596315182),FQ(+0.596007287),FQ(+0.595699304),FQ(+0.595391234),
-    FQ(+0.595083077),FQ(+0.594774832),FQ(+0.594466499),FQ(+0.594158079),FQ(+0.593849572),
-    FQ(+0.593540977),FQ(+0.593232295),FQ(+0.592923526),FQ(+0.592614669),FQ(+0.592305726),
-    FQ(+0.591996695),FQ(+0.591687577),FQ(+0.591378372),FQ(+0.591069081),FQ(+0.590759702),
-    FQ(+0.590450236),FQ(+0.590140684),FQ(+0.589831045),FQ(+0.589521319),FQ(+0.589211506),
-    FQ(+0.588901607),FQ(+0.588591621),FQ(+0.588281548),FQ(+0.587971389),FQ(+0.587661144),
-    FQ(+0.587350812),FQ(+0.587040394),FQ(+0.586729889),FQ(+0.586419298),FQ(+0.586108621),
-    FQ(+0.585797857),FQ(+0.585487008),FQ(+0.585176072),FQ(+0.584865051),FQ(+0.584553943),
-    FQ(+0.584242749),FQ(+0.583931470),FQ(+0.583620104),FQ(+0.583308653),FQ(+0.582997116),
-    FQ(+0.582685493),FQ(+0.582373785),FQ(+0.582061990),FQ(+0.581750111),FQ(+0.581438145),
-    FQ(+0.581126094),FQ(+0.580813958),FQ(+0.580501736),FQ(+0.580189429),FQ(+0.579877037),
-    FQ(+0.579564559),FQ(+0.579251996),FQ(+0.578939348),FQ(+0.578626615),FQ(+0.578313796),
-    FQ(+0.578000893),FQ(+0.577687905),FQ(+0.577374831),FQ(+0.577061673),FQ(+0.576748430),
-    FQ(+0.576435102),FQ(+0.576121689),FQ(+0.575808191),FQ(+0.575494609),FQ(+0.575180942),
-    FQ(+0.574867191),FQ(+0.574553355),FQ(+0.574239435),FQ(+0.573925430),FQ(+0.573611340),
-    FQ(+0.573297167),FQ(+0.572982909),FQ(+0.572668566),FQ(+0.572354140),FQ(+0.572039629),
-    FQ(+0.571725035),FQ(+0.571410356),FQ(+0.571095593),FQ(+0.570780746),FQ(+0.570465815),
-    FQ(+0.570150800),FQ(+0.569835702),FQ(+0.569520519),FQ(+0.569205253),FQ(+0.568889903),
-    FQ(+0.568574470),FQ(+0.568258953),FQ(+0.567943352),FQ(+0.567627668),FQ(+0.567311900),
-    FQ(+0.566996049),FQ(+0.566680114),FQ(+0.566364096),FQ(+0.566047995),FQ(+0.565731811),
-    FQ(+0.565415543),FQ(+0.565099192),FQ(+0.564782758),FQ(+0.564466242),FQ(+0.564149642),
-    FQ(+0.563832959),FQ(+0.563516193),FQ(+0.563199344),FQ(+0.562882412),FQ(+0.562565398),
-    FQ(+0.562248301),FQ(+0.561931121),FQ(+0.561613859),FQ(+0.561296514),FQ(+0.560979086),
-    FQ(+0.560661576),FQ(+0.560343984),FQ(+0.560026309),FQ(+0.559708551),FQ(+0.559390712),
-    FQ(+0.559072790),FQ(+0.558754786),FQ(+0.558436700),FQ(+0.558118531),FQ(+0.557800281),
-    FQ(+0.557481948),FQ(+0.557163534),FQ(+0.556845037),FQ(+0.556526459),FQ(+0.556207799),
-    FQ(+0.555889057),FQ(+0.555570233),FQ(+0.555251328),FQ(+0.554932340),FQ(+0.554613272),
-    FQ(+0.554294121),FQ(+0.553974890),FQ(+0.553655576),FQ(+0.553336182),FQ(+0.553016706),
-    FQ(+0.552697148),FQ(+0.552377509),FQ(+0.552057790),FQ(+0.551737988),FQ(+0.551418106),
-    FQ(+0.551098143),FQ(+0.550778098),FQ(+0.550457973),FQ(+0.550137767),FQ(+0.549817479),
-    FQ(+0.549497111),FQ(+0.549176662),FQ(+0.548856132),FQ(+0.548535522),FQ(+0.548214831),
-    FQ(+0.547894059),FQ(+0.547573207),FQ(+0.547252274),FQ(+0.546931261),FQ(+0.546610167),
-    FQ(+0.546288993),FQ(+0.545967738),FQ(+0.545646403),FQ(+0.545324988),FQ(+0.545003493),
-    FQ(+0.544681918),FQ(+0.544360262),FQ(+0.544038527),FQ(+0.543716711),FQ(+0.543394816),
-    FQ(+0.543072840),FQ(+0.542750785),FQ(+0.542428650),FQ(+0.542106435),FQ(+0.541784140),
-    FQ(+0.541461766),FQ(+0.541139312),FQ(+0.540816778),FQ(+0.540494165),FQ(+0.540171473),
-    FQ(+0.539848701),FQ(+0.539525849),FQ(+0.539202919),FQ(+0.538879909),FQ(+0.538556819),
-    FQ(+0.538233651),FQ(+0.537910403),FQ(+0.537587076),FQ(+0.537263670),FQ(+0.536940186),
-    FQ(+0.536616622),FQ(+0.536292979),FQ(+0.535969257),FQ(+0.535645457),FQ(+0.535321578),
-    FQ(+0.534997620),FQ(+0.534673583),FQ(+0.534349468),FQ(+0.534025274),FQ(+0.533701002),
-    FQ(+0.533376651),FQ(+0.533052222),FQ(+0.532727714),FQ(+0.532403128),FQ(+0.532078464),
-    FQ(+0.531753721),FQ(+0.531428900),FQ(+0.531104001),FQ(+0.530779024),FQ(+0.530453969),
-    FQ(+0.530128836),FQ(+0.529803625),FQ(+0.529478336),FQ(+0.529152969),FQ(+0.528827524),
-    FQ(+0.528502002),FQ(+0.528176401),FQ(+0.527850723),FQ(+0.527524968),FQ(+0.527199135),
-    FQ(+0.526873224),FQ(+0.526547236),FQ(+0.526221170),FQ(+0.525895027),FQ(+0.525568807),
-    FQ(+0.525242510),FQ(+0.524916135),FQ(+0.524589683),FQ(+0.524263153),FQ(+0.523936547),
-    FQ(+0.523609864),FQ(+0.523283103),FQ(+0.522956266),FQ(+0.522629352),FQ(+0.522302361),
-    FQ(+0.521975293),FQ(+0.521648148),FQ(+0.521320927),FQ(+0.520993629),FQ(+0.520666254),
-    FQ(+0.520338803),FQ(+0.520011275),FQ(+0.519683671),FQ(+0.519355990),FQ(+0.519028233),
-    FQ(+0.518700400),FQ(+0.518372490),FQ(+0.518044504),FQ(+0.517716442),FQ(+0.517388304),
-    FQ(+0.517060089),FQ(+0.516731799),FQ(+0.516403433),FQ(+0.516074990),FQ(+0.515746472),
-    FQ(+0.515417878),FQ(+0.515089208),FQ(+0.514760463),FQ(+0.514431641),FQ(+0.514102744),
-    FQ(+0.513773772),FQ(+0.513444723),FQ(+0.513115600),FQ(+0.512786401),FQ(+0.512457126),
-    FQ(+0.512127776),FQ(+0.511798351),FQ(+0.511468850),FQ(+0.511139275),FQ(+0.510809624),
-    FQ(+0.510479898),FQ(+0.510150097),FQ(+0.509820221),FQ(+0.509490269),FQ(+0.509160243),
-    FQ(+0.508830143),FQ(+0.508499967),FQ(+0.508169716),FQ(+0.507839391),FQ(+0.507508991),
-    FQ(+0.507178516),FQ(+0.506847967),FQ(+0.506517344),FQ(+0.506186645),FQ(+0.505855873),
-    FQ(+0.505525026),FQ(+0.505194104),FQ(+0.504863109),FQ(+0.504532039),FQ(+0.504200894),
-    FQ(+0.503869676),FQ(+0.503538384),FQ(+0.503207017),FQ(+0.502875577),FQ(+0.502544062),
-    FQ(+0.502212474),FQ(+0.501880812),FQ(+0.501549076),FQ(+0.501217266),FQ(+0.500885383),
-    FQ(+0.500553425),FQ(+0.500221395),FQ(+0.499889290),FQ(+0.499557113),FQ(+0.499224861),
-    FQ(+0.498892537),FQ(+0.498560138),FQ(+0.498227667),FQ(+0.497895122),FQ(+0.497562504),
-    FQ(+0.497229813),FQ(+0.496897049),FQ(+0.496564212),FQ(+0.496231301),FQ(+0.495898318),
-    FQ(+0.495565262),FQ(+0.495232133),FQ(+0.494898931),FQ(+0.494565656),FQ(+0.494232309),
-    FQ(+0.493898888),FQ(+0.493565396),FQ(+0.493231830),FQ(+0.492898192),FQ(+0.492564482),
-    FQ(+0.492230699),FQ(+0.491896844),FQ(+0.491562916),FQ(+0.491228916),FQ(+0.490894844),
-    FQ(+0.490560700),FQ(+0.490226483),FQ(+0.489892195),FQ(+0.489557834),FQ(+0.489223401),
-    FQ(+0.488888897),FQ(+0.488554320),FQ(+0.488219672),FQ(+0.487884952),FQ(+0.487550160),
-    FQ(+0.487215297),FQ(+0.486880361),FQ(+0.486545355),FQ(+0.486210276),FQ(+0.485875126),
-    FQ(+0.485539905),FQ(+0.485204612),FQ(+0.484869248),FQ(+0.484533813),FQ(+0.484198306),
-    FQ(+0.483862728),FQ(+0.483527079),FQ(+0.483191359),FQ(+0.482855568),FQ(+0.482519705),
-    FQ(+0.482183772),FQ(+0.481847768),FQ(+0.481511693),FQ(+0.481175547),FQ(+0.480839331),
-    FQ(+0.480503043),FQ(+0.480166685),FQ(+0.479830257),FQ(+0.479493758),FQ(+0.479157188),
-    FQ(+0.478820548),FQ(+0.478483837),FQ(+0.478147056),FQ(+0.477810205),FQ(+0.477473284),
-    FQ(+0.477136292),FQ(+0.476799230),FQ(+0.476462098),FQ(+0.476124896),FQ(+0.475787624),
-    FQ(+0.475450282),FQ(+0.475112870),FQ(+0.474775388),FQ(+0.474437836),FQ(+0.474100215),
-    FQ(+0.473762523),FQ(+0.473424763),FQ(+0.473086932),FQ(+0.472749032),FQ(+0.472411062),
-    FQ(+0.472073023),FQ(+0.471734915),FQ(+0.471396737),FQ(+0.471058490),FQ(+0.470720173),
-    FQ(+0.470381787),FQ(+0.470043332),FQ(+0.469704808),FQ(+0.469366215),FQ(+0.469027553),
-    FQ(+0.468688822),FQ(+0.468350022),FQ(+0.468011153),FQ(+0.467672215),FQ(+0.467333209),
-    FQ(+0.466994133),FQ(+0.466654990),FQ(+0.466315777),FQ(+0.465976496),FQ(+0.465637146),
-    FQ(+0.465297728),FQ(+0.464958241),FQ(+0.464618686),FQ(+0.464279063),FQ(+0.463939371),
-    FQ(+0.463599612),FQ(+0.463259784),FQ(+0.462919887),FQ(+0.462579923),FQ(+0.462239891),
-    FQ(+0.461899791),FQ(+0.461559623),FQ(+0.461219386),FQ(+0.460879083),FQ(+0.460538711),
-    FQ(+0.460198272),FQ(+0.459857765),FQ(+0.459517190),FQ(+0.459176548),FQ(+0.458835838),
-    FQ(+0.458495060),FQ(+0.458154216),FQ(+0.457813304),FQ(+0.457472324),FQ(+0.457131277),
-    FQ(+0.456790164),FQ(+0.456448982),FQ(+0.456107734),FQ(+0.455766419),FQ(+0.455425036),
-    FQ(+0.455083587),FQ(+0.454742071),FQ(+0.454400488),FQ(+0.454058838),FQ(+0.453717121),
-    FQ(+0.453375338),FQ(+0.453033487),FQ(+0.452691571),FQ(+0.452349587),FQ(+0.452007537),
-    FQ(+0.451665421),FQ(+0.451323238),FQ(+0.450980989),FQ(+0.450638674),FQ(+0.450296292),
-    FQ(+0.449953844),FQ(+0.449611330),FQ(+0.449268749),FQ(+0.448926103),FQ(+0.448583391),
-    FQ(+0.448240612),FQ(+0.447897768),FQ(+0.447554858),FQ(+0.447211882),FQ(+0.446868840),
-    FQ(+0.446525733),FQ(+0.446182560),FQ(+0.445839321),FQ(+0.445496017),FQ(+0.445152647),
-    FQ(+0.444809211),FQ(+0.444465711),FQ(+0.444122145),FQ(+0.443778513),FQ(+0.443434816),
-    FQ(+0.443091055),FQ(+0.442747228),FQ(+0.442403335),FQ(+0.442059378),FQ(+0.441715356),
-    FQ(+0.441371269),FQ(+0.441027117),FQ(+0.440682900),FQ(+0.440338618),FQ(+0.439994271),
-    FQ(+0.439649860),FQ(+0.439305384),FQ(+0.438960844),FQ(+0.438616239),FQ(+0.438271569),
-    FQ(+0.437926835),FQ(+0.437582036),FQ(+0.437237174),FQ(+0.436892247),FQ(+0.436547255),
-    FQ(+0.436202200),FQ(+0.435857080),FQ(+0.435511896),FQ(+0.435166648),FQ(+0.434821336),
-    FQ(+0.434475961),FQ(+0.434130521),FQ(+0.433785017),FQ(+0.433439450),FQ(+0.433093819),
-    FQ(+0.432748124),FQ(+0.432402366),FQ(+0.432056544),FQ(+0.431710658),FQ(+0.431364709),
-    FQ(+0.431018696),FQ(+0.430672621),FQ(+0.430326481),FQ(+0.429980279),FQ(+0.429634013),
-    FQ(+0.429287684),FQ(+0.428941292),FQ(+0.428594837),FQ(+0.428248319),FQ(+0.427901738),
-    FQ(+0.427555093),FQ(+0.427208386),FQ(+0.426861617),FQ(+0.426514784),FQ(+0.426167889),
-    FQ(+0.425820931),FQ(+0.425473910),FQ(+0.425126827),FQ(+0.424779681),FQ(+0.424432473),
-    FQ(+0.424085202),FQ(+0.423737869),FQ(+0.423390474),FQ(+0.423043017),FQ(+0.422695497),
-    FQ(+0.422347915),FQ(+0.422000271),FQ(+0.421652565),FQ(+0.421304797),FQ(+0.420956966),
-    FQ(+0.420609074),FQ(+0.420261121),FQ(+0.419913105),FQ(+0.419565027),FQ(+0.419216888),
-    FQ(+0.418868688),FQ(+0.418520425),FQ(+0.418172101),FQ(+0.417823716),FQ(+0.417475269),
-    FQ(+0.417126761),FQ(+0.416778191),FQ(+0.416429560),FQ(+0.416080868),FQ(+0.415732115),
-    FQ(+0.415383300),FQ(+0.415034424),FQ(+0.414685488),FQ(+0.414336490),FQ(+0.413987432),
-    FQ(+0.413638312),FQ(+0.413289132),FQ(+0.412939891),FQ(+0.412590589),FQ(+0.412241227),
-    FQ(+0.411891804),FQ(+0.411542320),FQ(+0.411192776),FQ(+0.410843171),FQ(+0.410493506),
-    FQ(+0.410143781),FQ(+0.409793995),FQ(+0.409444149),FQ(+0.409094242),FQ(+0.408744276),
-    FQ(+0.408394249),FQ(+0.408044163),FQ(+0.407694016),FQ(+0.407343810),FQ(+0.406993543),
-    FQ(+0.406643217),FQ(+0.406292831),FQ(+0.405942385),FQ(+0.405591879),FQ(+0.405241314),
-    FQ(+0.404890689),FQ(+0.404540005),FQ(+0.404189261),FQ(+0.403838458),FQ(+0.403487595),
-    FQ(+0.403136673),FQ(+0.402785691),FQ(+0.402434651),FQ(+0.402083551),FQ(+0.401732392),
-    FQ(+0.401381174),FQ(+0.401029897),FQ(+0.400678561),FQ(+0.400327166),FQ(+0.399975712),
-    FQ(+0.399624200),FQ(+0.399272628),FQ(+0.398920998),FQ(+0.398569310),FQ(+0.398217562),
-    FQ(+0.397865756),FQ(+0.397513892),FQ(+0.397161969),FQ(+0.396809987),FQ(+0.396457948),
-    FQ(+0.396105850),FQ(+0.395753693),FQ(+0.395401479),FQ(+0.395049206),FQ(+0.394696876),
-    FQ(+0.394344487),FQ(+0.393992040),FQ(+0.393639535),FQ(+0.393286973),FQ(+0.392934352),
-    FQ(+0.392581674),FQ(+0.392228938),FQ(+0.391876144),FQ(+0.391523293),FQ(+0.391170384),
-    FQ(+0.390817418),FQ(+0.390464394),FQ(+0.390111313),FQ(+0.389758174),FQ(+0.389404978),
-    FQ(+0.389051725),FQ(+0.388698414),FQ(+0.388345047),FQ(+0.387991622),FQ(+0.387638140),
-    FQ(+0.387284601),FQ(+0.386931006),FQ(+0.386577353),FQ(+0.386223643),FQ(+0.385869877),
-    FQ(+0.385516054),FQ(+0.385162174),FQ(+0.384808238),FQ(+0.384454245),FQ(+0.384100195),
-    FQ(+0.383746089),FQ(+0.383391926),FQ(+0.383037708),FQ(+0.382683432),FQ(+0.382329101),
-    FQ(+0.381974713),FQ(+0.381620269),FQ(+0.381265769),FQ(+0.380911213),FQ(+0.380556601),
-    FQ(+0.380201933),FQ(+0.379847209),FQ(+0.379492429),FQ(+0.379137593),FQ(+0.378782702),
-    FQ(+0.378427755),FQ(+0.378072752),FQ(+0.377717694),FQ(+0.377362580),FQ(+0.377007410),
-    FQ(+0.376652185),FQ(+0.376296905),FQ(+0.375941569),FQ(+0.375586178),FQ(+0.375230732),
-    FQ(+0.374875231),FQ(+0.374519675),FQ(+0.374164063),FQ(+0.373808396),FQ(+0.373452675),
-    FQ(+0.373096898),FQ(+0.372741067),FQ(+0.372385181),FQ(+0.372029240),FQ(+0.371673244),
-    FQ(+0.371317194),FQ(+0.370961089),FQ(+0.370604930),FQ(+0.370248716),FQ(+0.369892447),
-    FQ(+0.369536124),FQ(+0.369179747),FQ(+0.368823316),FQ(+0.368466830),FQ(+0.368110290),
-    FQ(+0.367753696),FQ(+0.367397048),FQ(+0.367040346),FQ(+0.366683590),FQ(+0.366326780),
-    FQ(+0.365969916),FQ(+0.365612998),FQ(+0.365256026),FQ(+0.364899001),FQ(+0.364541922),
-    FQ(+0.364184790),FQ(+0.363827603),FQ(+0.363470364),FQ(+0.363113071),FQ(+0.362755724),
-    FQ(+0.362398325),FQ(+0.362040871),FQ(+0.361683365),FQ(+0.361325806),FQ(+0.360968193),
-    FQ(+0.360610527),FQ(+0.360252808),FQ(+0.359895037),FQ(+0.359537212),FQ(+0.359179334),
-    FQ(+0.358821404),FQ(+0.358463421),FQ(+0.358105385),FQ(+0.357747296),FQ(+0.357389155),
-    FQ(+0.357030961),FQ(+0.356672715),FQ(+0.356314416),FQ(+0.355956065),FQ(+0.355597662),
-    FQ(+0.355239206),FQ(+0.354880698),FQ(+0.354522138),FQ(+0.354163525),FQ(+0.353804861),
-    FQ(+0.353446145),FQ(+0.353087376),FQ(+0.352728556),FQ(+0.352369684),FQ(+0.352010759),
-    FQ(+0.351651784),FQ(+0.351292756),FQ(+0.350933677),FQ(+0.350574546),FQ(+0.350215364),
-    FQ(+0.349856130),FQ(+0.349496844),FQ(+0.349137508),FQ(+0.348778120),FQ(+0.348418680),
-    FQ(+0.348059190),FQ(+0.347699648),FQ(+0.347340055),FQ(+0.346980411),FQ(+0.346620716),
-    FQ(+0.346260970),FQ(+0.345901173),FQ(+0.345541325),FQ(+0.345181426),FQ(+0.344821477),
-    FQ(+0.344461477),FQ(+0.344101426),FQ(+0.343741325),FQ(+0.343381173),FQ(+0.343020970),
-    FQ(+0.342660717),FQ(+0.342300414),FQ(+0.341940060),FQ(+0.341579656),FQ(+0.341219202),
-    FQ(+0.340858698),FQ(+0.340498144),FQ(+0.340137539),FQ(+0.339776884),FQ(+0.339416180),
-    FQ(+0.339055425),FQ(+0.338694621),FQ(+0.338333767),FQ(+0.337972863),FQ(+0.337611909),
-    FQ(+0.337250906),FQ(+0.336889853),FQ(+0.336528751),FQ(+0.336167599),FQ(+0.335806398),
-    FQ(+0.335445147),FQ(+0.335083847),FQ(+0.334722498),FQ(+0.334361099),FQ(+0.333999651),
-    FQ(+0.333638155),FQ(+0.333276609),FQ(+0.332915014),FQ(+0.332553370),FQ(+0.332191677),
-    FQ(+0.331829935),FQ(+0.331468145),FQ(+0.331106306),FQ(+0.330744418),FQ(+0.330382481),
-    FQ(+0.330020496),FQ(+0.329658463),FQ(+0.329296380),FQ(+0.328934250),FQ(+0.328572071),
-    FQ(+0.328209844),FQ(+0.327847568),FQ(+0.327485244),FQ(+0.327122872),FQ(+0.326760452),
-    FQ(+0.326397984),FQ(+0.326035468),FQ(+0.325672904),FQ(+0.325310292),FQ(+0.324947632),
-    FQ(+0.324584925),FQ(+0.324222170),FQ(+0.323859367),FQ(+0.323496516),FQ(+0.323133618),
-    FQ(+0.322770672),FQ(+0.322407679),FQ(+0.322044638),FQ(+0.321681550),FQ(+0.321318415),
-    FQ(+0.320955232),FQ(+0.320592003),FQ(+0.320228726),FQ(+0.319865402),FQ(+0.319502031),
-    FQ(+0.319138613),FQ(+0.318775148),FQ(+0.318411636),FQ(+0.318048077),FQ(+0.317684472),
-    FQ(+0.317320820),FQ(+0.316957121),FQ(+0.316593376),FQ(+0.316229584),FQ(+0.315865745),
-    FQ(+0.315501860),FQ(+0.315137929),FQ(+0.314773951),FQ(+0.314409927),FQ(+0.314045857),
-    FQ(+0.313681740),FQ(+0.313317578),FQ(+0.312953369),FQ(+0.312589115),FQ(+0.312224814),
-    FQ(+0.311860467),FQ(+0.311496075),FQ(+0.311131637),FQ(+0.310767153),FQ(+0.310402623),
-    FQ(+0.310038048),FQ(+0.309673427),FQ(+0.309308760),FQ(+0.308944048),FQ(+0.308579291),
-    FQ(+0.308214488),FQ(+0.307849640),FQ(+0.307484747),FQ(+0.307119808),FQ(+0.306754824),
-    FQ(+0.306389795),FQ(+0.306024721),FQ(+0.305659602),FQ(+0.305294439),FQ(+0.304929230),
-    FQ(+0.304563976),FQ(+0.304198678),FQ(+0.303833334),FQ(+0.303467947),FQ(+0.303102514),
-    FQ(+0.302737037),FQ(+0.302371515),FQ(+0.302005949),FQ(+0.301640339),FQ(+0.301274684),
-    FQ(+0.300908985),FQ(+0.300543241),FQ(+0.300177454),FQ(+0.299811622),FQ(+0.299445746),
-    FQ(+0.299079826),FQ(+0.298713862),FQ(+0.298347855),FQ(+0.297981803),FQ(+0.297615707),
-    FQ(+0.297249568),FQ(+0.296883385),FQ(+0.296517159),FQ(+0.296150888),FQ(+0.295784574),
-    FQ(+0.295418217),FQ(+0.295051816),FQ(+0.294685372),FQ(+0.294318885),FQ(+0.293952354),
-    FQ(+0.293585780),FQ(+0.293219163),FQ(+0.292852502),FQ(+0.292485799),FQ(+0.292119053),
-    FQ(+0.291752263),FQ(+0.291385431),FQ(+0.291018556),FQ(+0.290651638),FQ(+0.290284677),
-    FQ(+0.289917674),FQ(+0.289550628),FQ(+0.289183539),FQ(+0.288816408),FQ(+0.288449235),
-    FQ(+0.288082019),FQ(+0.287714760),FQ(+0.287347460),FQ(+0.286980117),FQ(+0.286612731),
-    FQ(+0.286245304),FQ(+0.285877835),FQ(+0.285510323),FQ(+0.285142770),FQ(+0.284775174),
-    FQ(+0.284407537),FQ(+0.284039858),FQ(+0.283672137),FQ(+0.283304375),FQ(+0.282936570),
-    FQ(+0.282568725),FQ(+0.282200837),FQ(+0.281832908),FQ(+0.281464938),FQ(+0.281096926),
-    FQ(+0.280728873),FQ(+0.280360779),FQ(+0.279992643),FQ(+0.279624466),FQ(+0.279256248),
-    FQ(+0.278887989),FQ(+0.278519689),FQ(+0.278151348),FQ(+0.277782967),FQ(+0.277414544),
-    FQ(+0.277046080),FQ(+0.276677576),FQ(+0.276309031),FQ(+0.275940445),FQ(+0.275571819),
-    FQ(+0.275203153),FQ(+0.274834445),FQ(+0.274465698),FQ(+0.274096910),FQ(+0.273728082),
-    FQ(+0.273359213),FQ(+0.272990304),FQ(+0.272621355),FQ(+0.272252366),FQ(+0.271883337),
-    FQ(+0.271514268),FQ(+0.271145160),FQ(+0.270776011),FQ(+0.270406822),FQ(+0.270037594),
-    FQ(+0.269668326),FQ(+0.269299018),FQ(+0.268929670),FQ(+0.268560283),FQ(+0.268190857),
-    FQ(+0.267821391),FQ(+0.267451886),FQ(+0.267082341),FQ(+0.266712757),FQ(+0.266343134),
-    FQ(+0.265973472),FQ(+0.265603771),FQ(+0.265234030),FQ(+0.264864251),FQ(+0.264494432),
-    FQ(+0.264124575),FQ(+0.263754679),FQ(+0.263384744),FQ(+0.263014770),FQ(+0.262644758),
-    FQ(+0.262274707),FQ(+0.261904617),FQ(+0.261534489),FQ(+0.261164323),FQ(+0.260794118),
-    FQ(+0.260423875),FQ(+0.260053593),FQ(+0.259683273),FQ(+0.259312915),FQ(+0.258942519),
-    FQ(+0.258572085),FQ(+0.258201612),FQ(+0.257831102),FQ(+0.257460554),FQ(+0.257089968),
-    FQ(+0.256719344),FQ(+0.256348682),FQ(+0.255977983),FQ(+0.255607246),FQ(+0.255236472),
-    FQ(+0.254865660),FQ(+0.254494810),FQ(+0.254123923),FQ(+0.253752999),FQ(+0.253382037),
-    FQ(+0.253011038),FQ(+0.252640002),FQ(+0.252268929),FQ(+0.251897818),FQ(+0.251526671),
-    FQ(+0.251155486),FQ(+0.250784265),FQ(+0.250413007),FQ(+0.250041711),FQ(+0.249670380),
-    FQ(+0.249299011),FQ(+0.248927606),FQ(+0.248556164),FQ(+0.248184685),FQ(+0.247813171),
-    FQ(+0.247441619),FQ(+0.247070031),FQ(+0.246698407),FQ(+0.246326747),FQ(+0.245955050),
-    FQ(+0.245583318),FQ(+0.245211549),FQ(+0.244839744),FQ(+0.244467903),FQ(+0.244096026),
-    FQ(+0.243724113),FQ(+0.243352164),FQ(+0.242980180),FQ(+0.242608160),FQ(+0.242236104),
-    FQ(+0.241864012),FQ(+0.241491885),FQ(+0.241119723),FQ(+0.240747525),FQ(+0.240375291),
-    FQ(+0.240003022),FQ(+0.239630718),FQ(+0.239258379),FQ(+0.238886004),FQ(+0.238513595),
-    FQ(+0.238141150),FQ(+0.237768670),FQ(+0.237396156),FQ(+0.237023606),FQ(+0.236651021),
-    FQ(+0.236278402),FQ(+0.235905748),FQ(+0.235533059),FQ(+0.235160336),FQ(+0.234787578),
-    FQ(+0.234414786),FQ(+0.234041959),FQ(+0.233669097),FQ(+0.233296201),FQ(+0.232923271),
-    FQ(+0.232550307),FQ(+0.232177309),FQ(+0.231804276),FQ(+0.231431209),FQ(+0.231058108),
-    FQ(+0.230684974),FQ(+0.230311805),FQ(+0.229938602),FQ(+0.229565366),FQ(+0.229192096),
-    FQ(+0.228818792),FQ(+0.228445454),FQ(+0.228072083),FQ(+0.227698679),FQ(+0.227325240),
-    FQ(+0.226951769),FQ(+0.226578264),FQ(+0.226204726),FQ(+0.225831154),FQ(+0.225457549),
-    FQ(+0.225083911),FQ(+0.224710240),FQ(+0.224336536),FQ(+0.223962799),FQ(+0.223589029),
-    FQ(+0.223215226),FQ(+0.222841391),FQ(+0.222467522),FQ(+0.222093621),FQ(+0.221719687),
-    FQ(+0.221345721),FQ(+0.220971722),FQ(+0.220597690),FQ(+0.220223626),FQ(+0.219849530),
-    FQ(+0.219475401),FQ(+0.219101240),FQ(+0.218727047),FQ(+0.218352822),FQ(+0.217978564),
-    FQ(+0.217604275),FQ(+0.217229953),FQ(+0.216855600),FQ(+0.216481214),FQ(+0.216106797),
-    FQ(+0.215732348),FQ(+0.215357867),FQ(+0.214983355),FQ(+0.214608811),FQ(+0.214234235),
-    FQ(+0.213859628),FQ(+0.213484990),FQ(+0.213110320),FQ(+0.212735619),FQ(+0.212360886),
-    FQ(+0.211986122),FQ(+0.211611327),FQ(+0.211236501),FQ(+0.210861644),FQ(+0.210486756),
-    FQ(+0.210111837),FQ(+0.209736887),FQ(+0.209361906),FQ(+0.208986894),FQ(+0.208611852),
-    FQ(+0.208236779),FQ(+0.207861675),FQ(+0.207486541),FQ(+0.207111376),FQ(+0.206736181),
-    FQ(+0.206360955),FQ(+0.205985699),FQ(+0.205610413),FQ(+0.205235097),FQ(+0.204859750),
-    FQ(+0.204484373),FQ(+0.204108966),FQ(+0.203733529),FQ(+0.203358062),FQ(+0.202982565),
-    FQ(+0.202607039),FQ(+0.202231482),FQ(+0.201855896),FQ(+0.201480280),FQ(+0.201104635),
-    FQ(+0.200728960),FQ(+0.200353255),FQ(+0.199977521),FQ(+0.199601758),FQ(+0.199225965),
-    FQ(+0.198850143),FQ(+0.198474291),FQ(+0.198098411),FQ(+0.197722501),FQ(+0.197346562),
-    FQ(+0.196970594),FQ(+0.196594598),FQ(+0.196218572),FQ(+0.195842517),FQ(+0.195466434),
-    FQ(+0.195090322),FQ(+0.194714181),FQ(+0.194338012),FQ(+0.193961814),FQ(+0.193585587),
-    FQ(+0.193209332),FQ(+0.192833049),FQ(+0.192456737),FQ(+0.192080397),FQ(+0.191704029),
-    FQ(+0.191327632),FQ(+0.190951208),FQ(+0.190574755),FQ(+0.190198274),FQ(+0.189821765),
-    FQ(+0.189445229),FQ(+0.189068664),FQ(+0.188692072),FQ(+0.188315452),FQ(+0.187938804),
-    FQ(+0.187562129),FQ(+0.187185426),FQ(+0.186808695),FQ(+0.186431937),FQ(+0.186055152),
-    FQ(+0.185678339),FQ(+0.185301499),FQ(+0.184924631),FQ(+0.184547737),FQ(+0.184170815),
-    FQ(+0.183793867),FQ(+0.183416891),FQ(+0.183039888),FQ(+0.182662858),FQ(+0.182285802),
-    FQ(+0.181908718),FQ(+0.181531608),FQ(+0.181154471),FQ(+0.180777308),FQ(+0.180400118),
-    FQ(+0.180022901),FQ(+0.179645658),FQ(+0.179268389),FQ(+0.178891093),FQ(+0.178513771),
-    FQ(+0.178136423),FQ(+0.177759048),FQ(+0.177381647),FQ(+0.177004220),FQ(+0.176626768),
-    FQ(+0.176249289),FQ(+0.175871784),FQ(+0.175494253),FQ(+0.175116697),FQ(+0.174739115),
-    FQ(+0.174361507),FQ(+0.173983873),FQ(+0.173606214),FQ(+0.173228530),FQ(+0.172850820),
-    FQ(+0.172473084),FQ(+0.172095323),FQ(+0.171717537),FQ(+0.171339725),FQ(+0.170961889),
-    FQ(+0.170584027),FQ(+0.170206140),FQ(+0.169828228),FQ(+0.169450291),FQ(+0.169072329),
-    FQ(+0.168694343),FQ(+0.168316331),FQ(+0.167938295),FQ(+0.167560234),FQ(+0.167182148),
-    FQ(+0.166804038),FQ(+0.166425904),FQ(+0.166047744),FQ(+0.165669561),FQ(+0.165291353),
-    FQ(+0.164913120),FQ(+0.164534864),FQ(+0.164156583),FQ(+0.163778278),FQ(+0.163399949),
-    FQ(+0.163021596),FQ(+0.162643219),FQ(+0.162264819),FQ(+0.161886394),FQ(+0.161507945),
-    FQ(+0.161129473),FQ(+0.160750977),FQ(+0.160372457),FQ(+0.159993914),FQ(+0.159615347),
-    FQ(+0.159236757),FQ(+0.158858143),FQ(+0.158479506),FQ(+0.158100846),FQ(+0.157722162),
-    FQ(+0.157343456),FQ(+0.156964726),FQ(+0.156585973),FQ(+0.156207197),FQ(+0.155828398),
-    FQ(+0.155449576),FQ(+0.155070731),FQ(+0.154691863),FQ(+0.154312973),FQ(+0.153934060),
-    FQ(+0.153555124),FQ(+0.153176166),FQ(+0.152797185),FQ(+0.152418182),FQ(+0.152039156),
-    FQ(+0.151660108),FQ(+0.151281038),FQ(+0.150901945),FQ(+0.150522831),FQ(+0.150143694),
-    FQ(+0.149764535),FQ(+0.149385354),FQ(+0.149006151),FQ(+0.148626926),FQ(+0.148247679),
-    FQ(+0.147868410),FQ(+0.147489120),FQ(+0.147109808),FQ(+0.146730474),FQ(+0.146351119),
-    FQ(+0.145971742),FQ(+0.145592344),FQ(+0.145212925),FQ(+0.144833484),FQ(+0.144454021),
-    FQ(+0.144074538),FQ(+0.143695033),FQ(+0.143315507),FQ(+0.142935960),FQ(+0.142556392),
-    FQ(+0.142176804),FQ(+0.141797194),FQ(+0.141417563),FQ(+0.141037912),FQ(+0.140658239),
-    FQ(+0.140278546),FQ(+0.139898833),FQ(+0.139519099),FQ(+0.139139344),FQ(+0.138759569),
-    FQ(+0.138379774),FQ(+0.137999958),FQ(+0.137620122),FQ(+0.137240265),FQ(+0.136860389),
-    FQ(+0.136480492),FQ(+0.136100575),FQ(+0.135720638),FQ(+0.135340682),FQ(+0.134960705),
-    FQ(+0.134580709),FQ(+0.134200692),FQ(+0.133820656),FQ(+0.133440600),FQ(+0.133060525),
-    FQ(+0.132680430),FQ(+0.132300316),FQ(+0.131920182),FQ(+0.131540029),FQ(+0.131159856),
-    FQ(+0.130779664),FQ(+0.130399453),FQ(+0.130019223),FQ(+0.129638973),FQ(+0.129258705),
-    FQ(+0.128878417),FQ(+0.128498111),FQ(+0.128117785),FQ(+0.127737441),FQ(+0.127357078),
-    FQ(+0.126976696),FQ(+0.126596296),FQ(+0.126215877),FQ(+0.125835439),FQ(+0.125454983),
-    FQ(+0.125074509),FQ(+0.124694016),FQ(+0.124313505),FQ(+0.123932975),FQ(+0.123552427),
-    FQ(+0.123171861),FQ(+0.122791277),FQ(+0.122410675),FQ(+0.122030055),FQ(+0.121649417),
-    FQ(+0.121268761),FQ(+0.120888087),FQ(+0.120507396),FQ(+0.120126686),FQ(+0.119745959),
-    FQ(+0.119365215),FQ(+0.118984453),FQ(+0.118603673),FQ(+0.118222876),FQ(+0.117842062),
-    FQ(+0.117461230),FQ(+0.117080381),FQ(+0.116699514),FQ(+0.116318631),FQ(+0.115937730),
-    FQ(+0.115556813),FQ(+0.115175878),FQ(+0.114794927),FQ(+0.114413958),FQ(+0.114032973),
-    FQ(+0.113651971),FQ(+0.113270952),FQ(+0.112889917),FQ(+0.112508865),FQ(+0.112127796),
-    FQ(+0.111746711),FQ(+0.111365610),FQ(+0.110984492),FQ(+0.110603358),FQ(+0.110222207),
-    FQ(+0.109841041),FQ(+0.109459858),FQ(+0.109078659),FQ(+0.108697444),FQ(+0.108316213),
-    FQ(+0.107934966),FQ(+0.107553704),FQ(+0.107172425),FQ(+0.106791131),FQ(+0.106409821),
-    FQ(+0.106028495),FQ(+0.105647154),FQ(+0.105265797),FQ(+0.104884425),FQ(+0.104503037),
-    FQ(+0.104121634),FQ(+0.103740215),FQ(+0.103358782),FQ(+0.102977333),FQ(+0.102595869),
-    FQ(+0.102214390),FQ(+0.101832896),FQ(+0.101451387),FQ(+0.101069863),FQ(+0.100688324),
-    FQ(+0.100306770),FQ(+0.099925202),FQ(+0.099543619),FQ(+0.099162021),FQ(+0.098780409),
-    FQ(+0.098398782),FQ(+0.098017140),FQ(+0.097635485),FQ(+0.097253814),FQ(+0.096872130),
-    FQ(+0.096490431),FQ(+0.096108718),FQ(+0.095726991),FQ(+0.095345250),FQ(+0.094963495),
-    FQ(+0.094581726),FQ(+0.094199943),FQ(+0.093818146),FQ(+0.093436336),FQ(+0.093054511),
-    FQ(+0.092672673),FQ(+0.092290822),FQ(+0.091908956),FQ(+0.091527078),FQ(+0.091145185),
-    FQ(+0.090763280),FQ(+0.090381361),FQ(+0.089999429),FQ(+0.089617483),FQ(+0.089235524),
-    FQ(+0.088853553),FQ(+0.088471568),FQ(+0.088089570),FQ(+0.087707559),FQ(+0.087325535),
-    FQ(+0.086943499),FQ(+0.086561449),FQ(+0.086179387),FQ(+0.085797312),FQ(+0.085415225),
-    FQ(+0.085033125),FQ(+0.084651013),FQ(+0.084268888),FQ(+0.083886750),FQ(+0.083504601),
-    FQ(+0.083122439),FQ(+0.082740265),FQ(+0.082358078),FQ(+0.081975880),FQ(+0.081593669),
-    FQ(+0.081211447),FQ(+0.080829212),FQ(+0.080446966),FQ(+0.080064708),FQ(+0.079682438),
-    FQ(+0.079300156),FQ(+0.078917863),FQ(+0.078535558),FQ(+0.078153242),FQ(+0.077770914),
-    FQ(+0.077388574),FQ(+0.077006223),FQ(+0.076623861),FQ(+0.076241488),FQ(+0.075859103),
-    FQ(+0.075476708),FQ(+0.075094301),FQ(+0.074711883),FQ(+0.074329454),FQ(+0.073947014),
-    FQ(+0.073564564),FQ(+0.073182102),FQ(+0.072799630),FQ(+0.072417147),FQ(+0.072034653),
-    FQ(+0.071652149),FQ(+0.071269634),FQ(+0.070887109),FQ(+0.070504573),FQ(+0.070122027),
-    FQ(+0.069739471),FQ(+0.069356904),FQ(+0.068974328),FQ(+0.068591741),FQ(+0.068209144),
-    FQ(+0.067826537),FQ(+0.067443920),FQ(+0.067061293),FQ(+0.066678656),FQ(+0.066296009),
-    FQ(+0.065913353),FQ(+0.065530687),FQ(+0.065148011),FQ(+0.064765326),FQ(+0.064382631),
-    FQ(+0.063999927),FQ(+0.063617213),FQ(+0.063234490),FQ(+0.062851758),FQ(+0.062469016),
-    FQ(+0.062086265),FQ(+0.061703505),FQ(+0.061320736),FQ(+0.060937958),FQ(+0.060555171),
-    FQ(+0.060172375),FQ(+0.059789571),FQ(+0.059406757),FQ(+0.059023935),FQ(+0.058641104),
-    FQ(+0.058258265),FQ(+0.057875416),FQ(+0.057492560),FQ(+0.057109695),FQ(+0.056726821),
-    FQ(+0.056343939),FQ(+0.055961049),FQ(+0.055578151),FQ(+0.055195244),FQ(+0.054812330),
-    FQ(+0.054429407),FQ(+0.054046476),FQ(+0.053663538),FQ(+0.053280591),FQ(+0.052897637),
-    FQ(+0.052514675),FQ(+0.052131705),FQ(+0.051748727),FQ(+0.051365742),FQ(+0.050982749),
-    FQ(+0.050599749),FQ(+0.050216741),FQ(+0.049833726),FQ(+0.049450704),FQ(+0.049067674),
-    FQ(+0.048684637),FQ(+0.048301593),FQ(+0.047918542),FQ(+0.047535484),FQ(+0.047152419),
-    FQ(+0.046769347),FQ(+0.046386268),FQ(+0.046003182),FQ(+0.045620090),FQ(+0.045236990),
-    FQ(+0.044853884),FQ(+0.044470772),FQ(+0.044087653),FQ(+0.043704527),FQ(+0.043321395),
-    FQ(+0.042938257),FQ(+0.042555112),FQ(+0.042171961),FQ(+0.041788804),FQ(+0.041405641),
-    FQ(+0.041022472),FQ(+0.040639296),FQ(+0.040256115),FQ(+0.039872928),FQ(+0.039489734),
-    FQ(+0.039106535),FQ(+0.038723331),FQ(+0.038340120),FQ(+0.037956904),FQ(+0.037573683),
-    FQ(+0.037190456),FQ(+0.036807223),FQ(+0.036423985),FQ(+0.036040742),FQ(+0.035657493),
-    FQ(+0.035274239),FQ(+0.034890980),FQ(+0.034507716),FQ(+0.034124446),FQ(+0.033741172),
-    FQ(+0.033357893),FQ(+0.032974608),FQ(+0.032591319),FQ(+0.032208025),FQ(+0.031824727),
-    FQ(+0.031441424),FQ(+0.031058116),FQ(+0.030674803),FQ(+0.030291486),FQ(+0.029908165),
-    FQ(+0.029524839),FQ(+0.029141509),FQ(+0.028758174),FQ(+0.028374836),FQ(+0.027991493),
-    FQ(+0.027608146),FQ(+0.027224795),FQ(+0.026841440),FQ(+0.026458081),FQ(+0.026074718),
-    FQ(+0.025691351),FQ(+0.025307981),FQ(+0.024924606),FQ(+0.024541229),FQ(+0.024157847),
-    FQ(+0.023774462),FQ(+0.023391073),FQ(+0.023007681),FQ(+0.022624286),FQ(+0.022240887),
-    FQ(+0.021857485),FQ(+0.021474080),FQ(+0.021090672),FQ(+0.020707261),FQ(+0.020323846),
-    FQ(+0.019940429),FQ(+0.019557008),FQ(+0.019173585),FQ(+0.018790159),FQ(+0.018406730),
-    FQ(+0.018023298),FQ(+0.017639864),FQ(+0.017256427),FQ(+0.016872988),FQ(+0.016489546),
-    FQ(+0.016106102),FQ(+0.015722655),FQ(+0.015339206),FQ(+0.014955755),FQ(+0.014572302),
-    FQ(+0.014188846),FQ(+0.013805389),FQ(+0.013421929),FQ(+0.013038467),FQ(+0.012655004),
-    FQ(+0.012271538),FQ(+0.011888071),FQ(+0.011504602),FQ(+0.011121131),FQ(+0.010737659),
-    FQ(+0.010354185),FQ(+0.009970710),FQ(+0.009587233),FQ(+0.009203755),FQ(+0.008820275),
-    FQ(+0.008436794),FQ(+0.008053312),FQ(+0.007669829),FQ(+0.007286344),FQ(+0.006902859),
-    FQ(+0.006519372),FQ(+0.006135885),FQ(+0.005752396),FQ(+0.005368907),FQ(+0.004985417),
-    FQ(+0.004601926),FQ(+0.004218435),FQ(+0.003834943),FQ(+0.003451450),FQ(+0.003067957),
-    FQ(+0.002684463),FQ(+0.002300969),FQ(+0.001917475),FQ(+0.001533980),FQ(+0.001150485),
-    FQ(+0.000766990),FQ(+0.000383495),FQ(+0.000000000),FQ(-0.000383495),FQ(-0.000766990),
-    FQ(-0.001150485),FQ(-0.001533980),FQ(-0.001917475),FQ(-0.002300969),FQ(-0.002684463),
-    FQ(-0.003067957),FQ(-0.003451450),FQ(-0.003834943),FQ(-0.004218435),FQ(-0.004601926),
-    FQ(-0.004985417),FQ(-0.005368907),FQ(-0.005752396),FQ(-0.006135885),FQ(-0.006519372),
-    FQ(-0.006902859),FQ(-0.007286344),FQ(-0.007669829),FQ(-0.008053312),FQ(-0.008436794),
-    FQ(-0.008820275),FQ(-0.009203755),FQ(-0.009587233),FQ(-0.009970710),FQ(-0.010354185),
-    FQ(-0.010737659),FQ(-0.011121131),FQ(-0.011504602),FQ(-0.011888071),FQ(-0.012271538),
-    FQ(-0.012655004),FQ(-0.013038467),FQ(-0.013421929),FQ(-0.013805389),FQ(-0.014188846),
-    FQ(-0.014572302),FQ(-0.014955755),FQ(-0.015339206),FQ(-0.015722655),FQ(-0.016106102),
-    FQ(-0.016489546),FQ(-0.016872988),FQ(-0.017256427),FQ(-0.017639864),FQ(-0.018023298),
-    FQ(-0.018406730),FQ(-0.018790159),FQ(-0.019173585),FQ(-0.019557008),FQ(-0.019940429),
-    FQ(-0.020323846),FQ(-0.020707261),FQ(-0.021090672),FQ(-0.021474080),FQ(-0.021857485),
-    FQ(-0.022240887),FQ(-0.022624286),FQ(-0.023007681),FQ(-0.023391073),FQ(-0.023774462),
-    FQ(-0.024157847),FQ(-0.024541229),FQ(-0.024924606),FQ(-0.025307981),FQ(-0.025691351),
-    FQ(-0.026074718),FQ(-0.026458081),FQ(-0.026841440),FQ(-0.027224795),FQ(-0.027608146),
-    FQ(-0.027991493),FQ(-0.028374836),FQ(-0.028758174),FQ(-0.029141509),FQ(-0.029524839),
-    FQ(-0.029908165),FQ(-0.030291486),FQ(-0.030674803),FQ(-0.031058116),FQ(-0.031441424),
-    FQ(-0.031824727),FQ(-0.032208025),FQ(-0.032591319),FQ(-0.032974608),FQ(-0.033357893),
-    FQ(-0.033741172),FQ(-0.034124446),FQ(-0.034507716),FQ(-0.034890980),FQ(-0.035274239),
-    FQ(-0.035657493),FQ(-0.036040742),FQ(-0.036423985),FQ(-0.036807223),FQ(-0.037190456),
-    FQ(-0.037573683),FQ(-0.037956904),FQ(-0.038340120),FQ(-0.038723331),FQ(-0.039106535),
-    FQ(-0.039489734),FQ(-0.039872928),FQ(-0.040256115),FQ(-0.040639296),FQ(-0.041022472),
-    FQ(-0.041405641),FQ(-0.041788804),FQ(-0.042171961),FQ(-0.042555112),FQ(-0.042938257),
-    FQ(-0.043321395),FQ(-0.043704527),FQ(-0.044087653),FQ(-0.044470772),FQ(-0.044853884),
-    FQ(-0.045236990),FQ(-0.045620090),FQ(-0.046003182),FQ(-0.046386268),FQ(-0.046769347),
-    FQ(-0.047152419),FQ(-0.047535484),FQ(-0.047918542),FQ(-0.048301593),FQ(-0.048684637),
-    FQ(-0.049067674),FQ(-0.049450704),FQ(-0.049833726),FQ(-0.050216741),FQ(-0.050599749),
-    FQ(-0.050982749),FQ(-0.051365742),FQ(-0.051748727),FQ(-0.052131705),FQ(-0.052514675),
-    FQ(-0.052897637),FQ(-0.053280591),FQ(-0.053663538),FQ(-0.054046476),FQ(-0.054429407),
-    FQ(-0.054812330),FQ(-0.055195244),FQ(-0.055578151),FQ(-0.055961049),FQ(-0.056343939),
-    FQ(-0.056726821),FQ(-0.057109695),FQ(-0.057492560),FQ(-0.057875416),FQ(-0.058258265),
-    FQ(-0.058641104),FQ(-0.059023935),FQ(-0.059406757),FQ(-0.059789571),FQ(-0.060172375),
-    FQ(-0.060555171),FQ(-0.060937958),FQ(-0.061320736),FQ(-0.061703505),FQ(-0.062086265),
-    FQ(-0.062469016),FQ(-0.062851758),FQ(-0.063234490),FQ(-0.063617213),FQ(-0.063999927),
-    FQ(-0.064382631),FQ(-0.064765326),FQ(-0.065148011),FQ(-0.065530687),FQ(-0.065913353),
-    FQ(-0.066296009),FQ(-0.066678656),FQ(-0.067061293),FQ(-0.067443920),FQ(-0.067826537),
-    FQ(-0.068209144),FQ(-0.068591741),FQ(-0.068974328),FQ(-0.069356904),FQ(-0.069739471),
-    FQ(-0.070122027),FQ(-0.070504573),FQ(-0.070887109),FQ(-0.071269634),FQ(-0.071652149),
-    FQ(-0.072034653),FQ(-0.072417147),FQ(-0.072799630),FQ(-0.073182102),FQ(-0.073564564),
-    FQ(-0.073947014),FQ(-0.074329454),FQ(-0.074711883),FQ(-0.075094301),FQ(-0.075476708),
-    FQ(-0.075859103),FQ(-0.076241488),FQ(-0.076623861),FQ(-0.077006223),FQ(-0.077388574),
-    FQ(-0.077770914),FQ(-0.078153242),FQ(-0.078535558),FQ(-0.078917863),FQ(-0.079300156),
-    FQ(-0.079682438),FQ(-0.080064708),FQ(-0.080446966),FQ(-0.080829212),FQ(-0.081211447),
-    FQ(-0.081593669),FQ(-0.081975880),FQ(-0.082358078),FQ(-0.082740265),FQ(-0.083122439),
-    FQ(-0.083504601),FQ(-0.083886750),FQ(-0.084268888),FQ(-0.084651013),FQ(-0.085033125),
-    FQ(-0.085415225),FQ(-0.085797312),FQ(-0.086179387),FQ(-0.086561449),FQ(-0.086943499),
-    FQ(-0.087325535),FQ(-0.087707559),FQ(-0.088089570),FQ(-0.088471568),FQ(-0.088853553),
-    FQ(-0.089235524),FQ(-0.089617483),FQ(-0.089999429),FQ(-0.090381361),FQ(-0.090763280),
-    FQ(-0.091145185),FQ(-0.091527078),FQ(-0.091908956),FQ(-0.092290822),FQ(-0.092672673),
-    FQ(-0.093054511),FQ(-0.093436336),FQ(-0.093818146),FQ(-0.094199943),FQ(-0.094581726),
-    FQ(-0.094963495),FQ(-0.095345250),FQ(-0.095726991),FQ(-0.096108718),FQ(-0.096490431),
-    FQ(-0.096872130),FQ(-0.097253814),FQ(-0.097635485),FQ(-0.098017140),FQ(-0.098398782),
-    FQ(-0.098780409),FQ(-0.099162021),FQ(-0.099543619),FQ(-0.099925202),FQ(-0.100306770),
-    FQ(-0.100688324),FQ(-0.101069863),FQ(-0.101451387),FQ(-0.101832896),FQ(-0.102214390),
-    FQ(-0.102595869),FQ(-0.102977333),FQ(-0.103358782),FQ(-0.103740215),FQ(-0.104121634),
-    FQ(-0.104503037),FQ(-0.104884425),FQ(-0.105265797),FQ(-0.105647154),FQ(-0.106028495),
-    FQ(-0.106409821),FQ(-0.106791131),FQ(-0.107172425),FQ(-0.107553704),FQ(-0.107934966),
-    FQ(-0.108316213),FQ(-0.108697444),FQ(-0.109078659),FQ(-0.109459858),FQ(-0.109841041),
-    FQ(-0.110222207),FQ(-0.110603358),FQ(-0.110984492),FQ(-0.111365610),FQ(-0.111746711),
-    FQ(-0.112127796),FQ(-0.112508865),FQ(-0.112889917),FQ(-0.113270952),FQ(-0.113651971),
-    FQ(-0.114032973),FQ(-0.114413958),FQ(-0.114794927),FQ(-0.115175878),FQ(-0.115556813),
-    FQ(-0.115937730),FQ(-0.116318631),FQ(-0.116699514),FQ(-0.117080381),FQ(-0.117461230),
-    FQ(-0.117842062),FQ(-0.118222876),FQ(-0.118603673),FQ(-0.118984453),FQ(-0.119365215),
-    FQ(-0.119745959),FQ(-0.120126686),FQ(-0.120507396),FQ(-0.120888087),FQ(-0.121268761),
-    FQ(-0.121649417),FQ(-0.122030055),FQ(-0.122410675),FQ(-0.122791277),FQ(-0.123171861),
-    FQ(-0.123552427),FQ(-0.123932975),FQ(-0.124313505),FQ(-0.124694016),FQ(-0.125074509),
-    FQ(-0.125454983),FQ(-0.125835439),FQ(-0.126215877),FQ(-0.126596296),FQ(-0.126976696),
-    FQ(-0.127357078),FQ(-0.127737441),FQ(-0.128117785),FQ(-0.128498111),FQ(-0.128878417),
-    FQ(-0.129258705),FQ(-0.129638973),FQ(-0.130019223),FQ(-0.130399453),FQ(-0.130779664),
-    FQ(-0.131159856),FQ(-0.131540029),FQ(-0.131920182),FQ(-0.132300316),FQ(-0.132680430),
-    FQ(-0.133060525),FQ(-0.133440600),FQ(-0.133820656),FQ(-0.134200692),FQ(-0.134580709),
-    FQ(-0.134960705),FQ(-0.135340682),FQ(-0.135720638),FQ(-0.136100575),FQ(-0.136480492),
-    FQ(-0.136860389),FQ(-0.137240265),FQ(-0.137620122),FQ(-0.137999958),FQ(-0.138379774),
-    FQ(-0.138759569),FQ(-0.139139344),FQ(-0.139519099),FQ(-0.139898833),FQ(-0.140278546),
-    FQ(-0.140658239),FQ(-0.141037912),FQ(-0.141417563),FQ(-0.141797194),FQ(-0.142176804),
-    FQ(-0.142556392),FQ(-0.142935960),FQ(-0.143315507),FQ(-0.143695033),FQ(-0.144074538),
-    FQ(-0.144454021),FQ(-0.144833484),FQ(-0.145212925),FQ(-0.145592344),FQ(-0.145971742),
-    FQ(-0.146351119),FQ(-0.146730474),FQ(-0.147109808),FQ(-0.147489120),FQ(-0.147868410),
-    FQ(-0.148247679),FQ(-0.148626926),FQ(-0.149006151),FQ(-0.149385354),FQ(-0.149764535),
-    FQ(-0.150143694),FQ(-0.150522831),FQ(-0.150901945),FQ(-0.151281038),FQ(-0.151660108),
-    FQ(-0.152039156),FQ(-0.152418182),FQ(-0.152797185),FQ(-0.153176166),FQ(-0.153555124),
-    FQ(-0.153934060),FQ(-0.154312973),FQ(-0.154691863),FQ(-0.155070731),FQ(-0.155449576),
-    FQ(-0.155828398),FQ(-0.156207197),FQ(-0.156585973),FQ(-0.156964726),FQ(-0.157343456),
-    FQ(-0.157722162),FQ(-0.158100846),FQ(-0.158479506),FQ(-0.158858143),FQ(-0.159236757),
-    FQ(-0.159615347),FQ(-0.159993914),FQ(-0.160372457),FQ(-0.160750977),FQ(-0.161129473),
-    FQ(-0.161507945),FQ(-0.161886394),FQ(-0.162264819),FQ(-0.162643219),FQ(-0.163021596),
-    FQ(-0.163399949),FQ(-0.163778278),FQ(-0.164156583),FQ(-0.164534864),FQ(-0.164913120),
-    FQ(-0.165291353),FQ(-0.165669561),FQ(-0.166047744),FQ(-0.166425904),FQ(-0.166804038),
-    FQ(-0.167182148),FQ(-0.167560234),FQ(-0.167938295),FQ(-0.168316331),FQ(-0.168694343),
-    FQ(-0.169072329),FQ(-0.169450291),FQ(-0.169828228),FQ(-0.170206140),FQ(-0.170584027),
-    FQ(-0.170961889),FQ(-0.171339725),FQ(-0.171717537),FQ(-0.172095323),FQ(-0.172473084),
-    FQ(-0.172850820),FQ(-0.173228530),FQ(-0.173606214),FQ(-0.173983873),FQ(-0.174361507),
-    FQ(-0.174739115),FQ(-0.175116697),FQ(-0.175494253),FQ(-0.175871784),FQ(-0.176249289),
-    FQ(-0.176626768),FQ(-0.177004220),FQ(-0.177381647),FQ(-0.177759048),FQ(-0.178136423),
-    FQ(-0.178513771),FQ(-0.178891093),FQ(-0.179268389),FQ(-0.179645658),FQ(-0.180022901),
-    FQ(-0.180400118),FQ(-0.180777308),FQ(-0.181154471),FQ(-0.181531608),FQ(-0.181908718),
-    FQ(-0.182285802),FQ(-0.182662858),FQ(-0.183039888),FQ(-0.183416891),FQ(-0.183793867),
-    FQ(-0.184170815),FQ(-0.184547737),FQ(-0.184924631),FQ(-0.185301499),FQ(-0.185678339),
-    FQ(-0.186055152),FQ(-0.186431937),FQ(-0.186808695),FQ(-0.187185426),FQ(-0.187562129),
-    FQ(-0.187938804),FQ(-0.188315452),FQ(-0.188692072),FQ(-0.189068664),FQ(-0.189445229),
-    FQ(-0.189821765),FQ(-0.190198274),FQ(-0.190574755),FQ(-0.190951208),FQ(-0.191327632),
-    FQ(-0.191704029),FQ(-0.192080397),FQ(-0.192456737),FQ(-0.192833049),FQ(-0.193209332),
-    FQ(-0.193585587),FQ(-0.193961814),FQ(-0.194338012),FQ(-0.194714181),FQ(-0.195090322),
-    FQ(-0.195466434),FQ(-0.195842517),FQ(-0.196218572),FQ(-0.196594598),FQ(-0.196970594),
-    FQ(-0.197346562),FQ(-0.197722501),FQ(-0.198098411),FQ(-0.198474291),FQ(-0.198850143),
-    FQ(-0.199225965),FQ(-0.199601758),FQ(-0.199977521),FQ(-0.200353255),FQ(-0.200728960),
-    FQ(-0.201104635),FQ(-0.201480280),FQ(-0.201855896),FQ(-0.202231482),FQ(-0.202607039),
-    FQ(-0.202982565),FQ(-0.203358062),FQ(-0.203733529),FQ(-0.204108966),FQ(-0.204484373),
-    FQ(-0.204859750),FQ(-0.205235097),FQ(-0.205610413),FQ(-0.205985699),FQ(-0.206360955),
-    FQ(-0.206736181),FQ(-0.207111376),FQ(-0.207486541),FQ(-0.207861675),FQ(-0.208236779),
-    FQ(-0.208611852),FQ(-0.208986894),FQ(-0.209361906),FQ(-0.209736887),FQ(-0.210111837),
-    FQ(-0.210486756),FQ(-0.210861644),FQ(-0.211236501),FQ(-0.211611327),FQ(-0.211986122),
-    FQ(-0.212360886),FQ(-0.212735619),FQ(-0.213110320),FQ(-0.213484990),FQ(-0.213859628),
-    FQ(-0.214234235),FQ(-0.214608811),FQ(-0.214983355),FQ(-0.215357867),FQ(-0.215732348),
-    FQ(-0.216106797),FQ(-0.216481214),FQ(-0.216855600),FQ(-0.217229953),FQ(-0.217604275),
-    FQ(-0.217978564),FQ(-0.218352822),FQ(-0.218727047),FQ(-0.219101240),FQ(-0.219475401),
-    FQ(-0.219849530),FQ(-0.220223626),FQ(-0.220597690),FQ(-0.220971722),FQ(-0.221345721),
-    FQ(-0.221719687),FQ(-0.222093621),FQ(-0.222467522),FQ(-0.222841391),FQ(-0.223215226),
-    FQ(-0.223589029),FQ(-0.223962799),FQ(-0.224336536),FQ(-0.224710240),FQ(-0.225083911),
-    FQ(-0.225457549),FQ(-0.225831154),FQ(-0.226204726),FQ(-0.226578264),FQ(-0.226951769),
-    FQ(-0.227325240),FQ(-0.227698679),FQ(-0.228072083),FQ(-0.228445454),FQ(-0.228818792),
-    FQ(-0.229192096),FQ(-0.229565366),FQ(-0.229938602),FQ(-0.230311805),FQ(-0.230684974),
-    FQ(-0.231058108),FQ(-0.231431209),FQ(-0.231804276),FQ(-0.232177309),FQ(-0.232550307),
-    FQ(-0.232923271),FQ(-0.233296201),FQ(-0.233669097),FQ(-0.234041959),FQ(-0.234414786),
-    FQ(-0.234787578),FQ(-0.235160336),FQ(-0.235533059),FQ(-0.235905748),FQ(-0.236278402),
-    FQ(-0.236651021),FQ(-0.237023606),FQ(-0.237396156),FQ(-0.237768670),FQ(-0.238141150),
-    FQ(-0.238513595),FQ(-0.238886004),FQ(-0.239258379),FQ(-0.239630718),FQ(-0.240003022),
-    FQ(-0.240375291),FQ(-0.240747525),FQ(-0.241119723),FQ(-0.241491885),FQ(-0.241864012),
-    FQ(-0.242236104),FQ(-0.242608160),FQ(-0.242980180),FQ(-0.243352164),FQ(-0.243724113),
-    FQ(-0.244096026),FQ(-0.244467903),FQ(-0.244839744),FQ(-0.245211549),FQ(-0.245583318),
-    FQ(-0.245955050),FQ(-0.246326747),FQ(-0.246698407),FQ(-0.247070031),FQ(-0.247441619),
-    FQ(-0.247813171),FQ(-0.248184685),FQ(-0.248556164),FQ(-0.248927606),FQ(-0.249299011),
-    FQ(-0.249670380),FQ(-0.250041711),FQ(-0.250413007),FQ(-0.250784265),FQ(-0.251155486),
-    FQ(-0.251526671),FQ(-0.251897818),FQ(-0.252268929),FQ(-0.252640002),FQ(-0.253011038),
-    FQ(-0.253382037),FQ(-0.253752999),FQ(-0.254123923),FQ(-0.254494810),FQ(-0.254865660),
-    FQ(-0.255236472),FQ(-0.255607246),FQ(-0.255977983),FQ(-0.256348682),FQ(-0.256719344),
-    FQ(-0.257089968),FQ(-0.257460554),FQ(-0.257831102),FQ(-0.258201612),FQ(-0.258572085),
-    FQ(-0.258942519),FQ(-0.259312915),FQ(-0.259683273),FQ(-0.260053593),FQ(-0.260423875),
-    FQ(-0.260794118),FQ(-0.261164323),FQ(-0.261534489),FQ(-0.261904617),FQ(-0.262274707),
-    FQ(-0.262644758),FQ(-0.263014770),FQ(-0.263384744),FQ(-0.263754679),FQ(-0.264124575),
-    FQ(-0.264494432),FQ(-0.264864251),FQ(-0.265234030),FQ(-0.265603771),FQ(-0.265973472),
-    FQ(-0.266343134),FQ(-0.266712757),FQ(-0.267082341),FQ(-0.267451886),FQ(-0.267821391),
-    FQ(-0.268190857),FQ(-0.268560283),FQ(-0.268929670),FQ(-0.269299018),FQ(-0.269668326),
-    FQ(-0.270037594),FQ(-0.270406822),FQ(-0.270776011),FQ(-0.271145160),FQ(-0.271514268),
-    FQ(-0.271883337),FQ(-0.272252366),FQ(-0.272621355),FQ(-0.272990304),FQ(-0.273359213),
-    FQ(-0.273728082),FQ(-0.274096910),FQ(-0.274465698),FQ(-0.274834445),FQ(-0.275203153),
-    FQ(-0.275571819),FQ(-0.275940445),FQ(-0.276309031),FQ(-0.276677576),FQ(-0.277046080),
-    FQ(-0.277414544),FQ(-0.277782967),FQ(-0.278151348),FQ(-0.278519689),FQ(-0.278887989),
-    FQ(-0.279256248),FQ(-0.279624466),FQ(-0.279992643),FQ(-0.280360779),FQ(-0.280728873),
-    FQ(-0.281096926),FQ(-0.281464938),FQ(-0.281832908),FQ(-0.282200837),FQ(-0.282568725),
-    FQ(-0.282936570),FQ(-0.283304375),FQ(-0.283672137),FQ(-0.284039858),FQ(-0.284407537),
-    FQ(-0.284775174),FQ(-0.285142770),FQ(-0.285510323),FQ(-0.285877835),FQ(-0.286245304),
-    FQ(-0.286612731),FQ(-0.286980117),FQ(-0.287347460),FQ(-0.287714760),FQ(-0.288082019),
-    FQ(-0.288449235),FQ(-0.288816408),FQ(-0.289183539),FQ(-0.289550628),FQ(-0.289917674),
-    FQ(-0.290284677),FQ(-0.290651638),FQ(-0.291018556),FQ(-0.291385431),FQ(-0.291752263),
-    FQ(-0.292119053),FQ(-0.292485799),FQ(-0.292852502),FQ(-0.293219163),FQ(-0.293585780),
-    FQ(-0.293952354),FQ(-0.294318885),FQ(-0.294685372),FQ(-0.295051816),FQ(-0.295418217),
-    FQ(-0.295784574),FQ(-0.296150888),FQ(-0.296517159),FQ(-0.296883385),FQ(-0.297249568),
-    FQ(-0.297615707),FQ(-0.297981803),FQ(-0.298347855),FQ(-0.298713862),FQ(-0.299079826),
-    FQ(-0.299445746),FQ(-0.299811622),FQ(-0.300177454),FQ(-0.300543241),FQ(-0.300908985),
-    FQ(-0.301274684),FQ(-0.301640339),FQ(-0.302005949),FQ(-0.302371515),FQ(-0.302737037),
-    FQ(-0.303102514),FQ(-0.303467947),FQ(-0.303833334),FQ(-0.304198678),FQ(-0.304563976),
-    FQ(-0.304929230),FQ(-0.305294439),FQ(-0.305659602),FQ(-0.306024721),FQ(-0.306389795),
-    FQ(-0.306754824),FQ(-0.307119808),FQ(-0.307484747),FQ(-0.307849640),FQ(-0.308214488),
-    FQ(-0.308579291),FQ(-0.308944048),FQ(-0.309308760),FQ(-0.309673427),FQ(-0.310038048),
-    FQ(-0.310402623),FQ(-0.310767153),FQ(-0.311131637),FQ(-0.311496075),FQ(-0.311860467),
-    FQ(-0.312224814),FQ(-0.312589115),FQ(-0.312953369),FQ(-0.313317578),FQ(-0.313681740),
-    FQ(-0.314045857),FQ(-0.314409927),FQ(-0.314773951),FQ(-0.315137929),FQ(-0.315501860),
-    FQ(-0.315865745),FQ(-0.316229584),FQ(-0.316593376),FQ(-0.316957121),FQ(-0.317320820),
-    FQ(-0.317684472),FQ(-0.318048077),FQ(-0.318411636),FQ(-0.318775148),FQ(-0.319138613),
-    FQ(-0.319502031),FQ(-0.319865402),FQ(-0.320228726),FQ(-0.320592003),FQ(-0.320955232),
-    FQ(-0.321318415),FQ(-0.321681550),FQ(-0.322044638),FQ(-0.322407679),FQ(-0.322770672),
-    FQ(-0.323133618),FQ(-0.323496516),FQ(-0.323859367),FQ(-0.324222170),FQ(-0.324584925),
-    FQ(-0.324947632),FQ(-0.325310292),FQ(-0.325672904),FQ(-0.326035468),FQ(-0.326397984),
-    FQ(-0.326760452),FQ(-0.327122872),FQ(-0.327485244),FQ(-0.327847568),FQ(-0.328209844),
-    FQ(-0.328572071),FQ(-0.328934250),FQ(-0.329296380),FQ(-0.329658463),FQ(-0.330020496),
-    FQ(-0.330382481),FQ(-0.330744418),FQ(-0.331106306),FQ(-0.331468145),FQ(-0.331829935),
-    FQ(-0.332191677),FQ(-0.332553370),FQ(-0.332915014),FQ(-0.333276609),FQ(-0.333638155),
-    FQ(-0.333999651),FQ(-0.334361099),FQ(-0.334722498),FQ(-0.335083847),FQ(-0.335445147),
-    FQ(-0.335806398),FQ(-0.336167599),FQ(-0.336528751),FQ(-0.336889853),FQ(-0.337250906),
-    FQ(-0.337611909),FQ(-0.337972863),FQ(-0.338333767),FQ(-0.338694621),FQ(-0.339055425),
-    FQ(-0.339416180),FQ(-0.339776884),FQ(-0.340137539),FQ(-0.340498144),FQ(-0.340858698),
-    FQ(-0.341219202),FQ(-0.341579656),FQ(-0.341940060),FQ(-0.342300414),FQ(-0.342660717),
-    FQ(-0.343020970),FQ(-0.343381173),FQ(-0.343741325),FQ(-0.344101426),FQ(-0.344461477),
-    FQ(-0.344821477),FQ(-0.345181426),FQ(-0.345541325),FQ(-0.345901173),FQ(-0.346260970),
-    FQ(-0.346620716),FQ(-0.346980411),FQ(-0.347340055),FQ(-0.347699648),FQ(-0.348059190),
-    FQ(-0.348418680),FQ(-0.348778120),FQ(-0.349137508),FQ(-0.349496844),FQ(-0.349856130),
-    FQ(-0.350215364),FQ(-0.350574546),FQ(-0.350933677),FQ(-0.351292756),FQ(-0.351651784),
-    FQ(-0.352010759),FQ(-0.352369684),FQ(-0.352728556),FQ(-0.353087376),FQ(-0.353446145),
-    FQ(-0.353804861),FQ(-0.354163525),FQ(-0.354522138),FQ(-0.354880698),FQ(-0.355239206),
-    FQ(-0.355597662),FQ(-0.355956065),FQ(-0.356314416),FQ(-0.356672715),FQ(-0.357030961),
-    FQ(-0.357389155),FQ(-0.357747296),FQ(-0.358105385),FQ(-0.358463421),FQ(-0.358821404),
-    FQ(-0.359179334),FQ(-0.359537212),FQ(-0.359895037),FQ(-0.360252808),FQ(-0.360610527),
-    FQ(-0.360968193),FQ(-0.361325806),FQ(-0.361683365),FQ(-0.362040871),FQ(-0.362398325),
-    FQ(-0.362755724),FQ(-0.363113071),FQ(-0.363470364),FQ(-0.363827603),FQ(-0.364184790),
-    FQ(-0.364541922),FQ(-0.364899001),FQ(-0.365256026),FQ(-0.365612998),FQ(-0.365969916),
-    FQ(-0.366326780),FQ(-0.366683590),FQ(-0.367040346),FQ(-0.367397048),FQ(-0.367753696),
-    FQ(-0.368110290),FQ(-0.368466830),FQ(-0.368823316),FQ(-0.369179747),FQ(-0.369536124),
-    FQ(-0.369892447),FQ(-0.370248716),FQ(-0.370604930),FQ(-0.370961089),FQ(-0.371317194),
-    FQ(-0.371673244),FQ(-0.372029240),FQ(-0.372385181),FQ(-0.372741067),FQ(-0.373096898),
-    FQ(-0.373452675),FQ(-0.373808396),FQ(-0.374164063),FQ(-0.374519675),FQ(-0.374875231),
-    FQ(-0.375230732),FQ(-0.375586178),FQ(-0.375941569),FQ(-0.376296905),FQ(-0.376652185),
-    FQ(-0.377007410),FQ(-0.377362580),FQ(-0.377717694),FQ(-0.378072752),FQ(-0.378427755),
-    FQ(-0.378782702),FQ(-0.379137593),FQ(-0.379492429),FQ(-0.379847209),FQ(-0.380201933),
-    FQ(-0.380556601),FQ(-0.380911213),FQ(-0.381265769),FQ(-0.381620269),FQ(-0.381974713),
-    FQ(-0.382329101),FQ(-0.382683432),FQ(-0.383037708),FQ(-0.383391926),FQ(-0.383746089),
-    FQ(-0.384100195),FQ(-0.384454245),FQ(-0.384808238),FQ(-0.385162174),FQ(-0.385516054),
-    FQ(-0.385869877),FQ(-0.386223643),FQ(-0.386577353),FQ(-0.386931006),FQ(-0.387284601),
-    FQ(-0.387638140),FQ(-0.387991622),FQ(-0.388345047),FQ(-0.388698414),FQ(-0.389051725),
-    FQ(-0.389404978),FQ(-0.389758174),FQ(-0.390111313),FQ(-0.390464394),FQ(-0.390817418),
-    FQ(-0.391170384),FQ(-0.391523293),FQ(-0.391876144),FQ(-0.392228938),FQ(-0.392581674),
-    FQ(-0.392934352),FQ(-0.393286973),FQ(-0.393639535),FQ(-0.393992040),FQ(-0.394344487),
-    FQ(-0.394696876),FQ(-0.395049206),FQ(-0.395401479),FQ(-0.395753693),FQ(-0.396105850),
-    FQ(-0.396457948),FQ(-0.396809987),FQ(-0.397161969),FQ(-0.397513892),FQ(-0.397865756),
-    FQ(-0.398217562),FQ(-0.398569310),FQ(-0.398920998),FQ(-0.399272628),FQ(-0.399624200),
-    FQ(-0.399975712),FQ(-0.400327166),FQ(-0.400678561),FQ(-0.401029897),FQ(-0.401381174),
-    FQ(-0.401732392),FQ(-0.402083551),FQ(-0.402434651),FQ(-0.402785691),FQ(-0.403136673),
-    FQ(-0.403487595),FQ(-0.403838458),FQ(-0.404189261),FQ(-0.404540005),FQ(-0.404890689),
-    FQ(-0.405241314),FQ(-0.405591879),FQ(-0.405942385),FQ(-0.406292831),FQ(-0.406643217),
-    FQ(-0.406993543),FQ(-0.407343810),FQ(-0.407694016),FQ(-0.408044163),FQ(-0.408394249),
-    FQ(-0.408744276),FQ(-0.409094242),FQ(-0.409444149),FQ(-0.409793995),FQ(-0.410143781),
-    FQ(-0.410493506),FQ(-0.410843171),FQ(-0.411192776),FQ(-0.411542320),FQ(-0.411891804),
-    FQ(-0.412241227),FQ(-0.412590589),FQ(-0.412939891),FQ(-0.413289132),FQ(-0.413638312),
-    FQ(-0.413987432),FQ(-0.414336490),FQ(-0.414685488),FQ(-0.415034424),FQ(-0.415383300),
-    FQ(-0.415732115),FQ(-0.416080868),FQ(-0.416429560),FQ(-0.416778191),FQ(-0.417126761),
-    FQ(-0.417475269),FQ(-0.417823716),FQ(-0.418172101),FQ(-0.418520425),FQ(-0.418868688),
-    FQ(-0.419216888),FQ(-0.419565027),FQ(-0.419913105),FQ(-0.420261121),FQ(-0.420609074),
-    FQ(-0.420956966),FQ(-0.421304797),FQ(-0.421652565),FQ(-0.422000271),FQ(-0.422347915),
-    FQ(-0.422695497),FQ(-0.423043017),FQ(-0.423390474),FQ(-0.423737869),FQ(-0.424085202),
-    FQ(-0.424432473),FQ(-0.424779681),FQ(-0.425126827),FQ(-0.425473910),FQ(-0.425820931),
-    FQ(-0.426167889),FQ(-0.426514784),FQ(-0.426861617),FQ(-0.427208386),FQ(-0.427555093),
-    FQ(-0.427901738),FQ(-0.428248319),FQ(-0.428594837),FQ(-0.428941292),FQ(-0.429287684),
-    FQ(-0.429634013),FQ(-0.429980279),FQ(-0.430326481),FQ(-0.430672621),FQ(-0.431018696),
-    FQ(-0.431364709),FQ(-0.431710658),FQ(-0.432056544),FQ(-0.432402366),FQ(-0.432748124),
-    FQ(-0.433093819),FQ(-0.433439450),FQ(-0.433785017),FQ(-0.434130521),FQ(-0.434475961),
-    FQ(-0.434821336),FQ(-0.435166648),FQ(-0.435511896),FQ(-0.435857080),FQ(-0.436202200),
-    FQ(-0.436547255),FQ(-0.436892247),FQ(-0.437237174),FQ(-0.437582036),FQ(-0.437926835),
-    FQ(-0.438271569),FQ(-0.438616239),FQ(-0.438960844),FQ(-0.439305384),FQ(-0.439649860),
-    FQ(-0.439994271),FQ(-0.440338618),FQ(-0.440682900),FQ(-0.441027117),FQ(-0.441371269),
-    FQ(-0.441715356),FQ(-0.442059378),FQ(-0.442403335),FQ(-0.442747228),FQ(-0.443091055),
-    FQ(-0.443434816),FQ(-0.443778513),FQ(-0.444122145),FQ(-0.444465711),FQ(-0.444809211),
-    FQ(-0.445152647),FQ(-0.445496017),FQ(-0.445839321),FQ(-0.446182560),FQ(-0.446525733),
-    FQ(-0.446868840),FQ(-0.447211882),FQ(-0.447554858),FQ(-0.447897768),FQ(-0.448240612),
-    FQ(-0.448583391),FQ(-0.448926103),FQ(-0.449268749),FQ(-0.449611330),FQ(-0.449953844),
-    FQ(-0.450296292),FQ(-0.450638674),FQ(-0.450980989),FQ(-0.451323238),FQ(-0.451665421),
-    FQ(-0.452007537),FQ(-0.452349587),FQ(-0.452691571),FQ(-0.453033487),FQ(-0.453375338),
-    FQ(-0.453717121),FQ(-0.454058838),FQ(-0.454400488),FQ(-0.454742071),FQ(-0.455083587),
-    FQ(-0.455425036),FQ(-0.455766419),FQ(-0.456107734),FQ(-0.456448982),FQ(-0.456790164),
-    FQ(-0.457131277),FQ(-0.457472324),FQ(-0.457813304),FQ(-0.458154216),FQ(-0.458495060),
-    FQ(-0.458835838),FQ(-0.459176548),FQ(-0.459517190),FQ(-0.459857765),FQ(-0.460198272),
-    FQ(-0.460538711),FQ(-0.460879083),FQ(-0.461219386),FQ(-0.461559623),FQ(-0.461899791),
-    FQ(-0.462239891),FQ(-0.462579923),FQ(-0.462919887),FQ(-0.463259784),FQ(-0.463599612),
-    FQ(-0.463939371),FQ(-0.464279063),FQ(-0.464618686),FQ(-0.464958241),FQ(-0.465297728),
-    FQ(-0.465637146),FQ(-0.465976496),FQ(-0.466315777),FQ(-0.466654990),FQ(-0.466994133),
-    FQ(-0.467333209),FQ(-0.467672215),FQ(-0.468011153),FQ(-0.468350022),FQ(-0.468688822),
-    FQ(-0.469027553),FQ(-0.469366215),FQ(-0.469704808),FQ(-0.470043332),FQ(-0.470381787),
-    FQ(-0.470720173),FQ(-0.471058490),FQ(-0.471396737),FQ(-0.471734915),FQ(-0.472073023),
-    FQ(-0.472411062),FQ(-0.472749032),FQ(-0.473086932),FQ(-0.473424763),FQ(-0.473762523),
-    FQ(-0.474100215),FQ(-0.474437836),FQ(-0.474775388),FQ(-0.475112870),FQ(-0.475450282),
-    FQ(-0.475787624),FQ(-0.476124896),FQ(-0.476462098),FQ(-0.476799230),FQ(-0.477136292),
-    FQ(-0.477473284),FQ(-0.477810205),FQ(-0.478147056),FQ(-0.478483837),FQ(-0.478820548),
-    FQ(-0.479157188),FQ(-0.479493758),FQ(-0.479830257),FQ(-0.480166685),FQ(-0.480503043),
-    FQ(-0.480839331),FQ(-0.481175547),FQ(-0.481511693),FQ(-0.481847768),FQ(-0.482183772),
-    FQ(-0.482519705),FQ(-0.482855568),FQ(-0.483191359),FQ(-0.483527079),FQ(-0.483862728),
-    FQ(-0.484198306),FQ(-0.484533813),FQ(-0.484869248),FQ(-0.485204612),FQ(-0.485539905),
-    FQ(-0.485875126),FQ(-0.486210276),FQ(-0.486545355),FQ(-0.486880361),FQ(-0.487215297),
-    FQ(-0.487550160),FQ(-0.487884952),FQ(-0.488219672),FQ(-0.488554320),FQ(-0.488888897),
-    FQ(-0.489223401),FQ(-0.489557834),FQ(-0.489892195),FQ(-0.490226483),FQ(-0.490560700),
-    FQ(-0.490894844),FQ(-0.491228916),FQ(-0.491562916),FQ(-0.491896844),FQ(-0.492230699),
-    FQ(-0.492564482),FQ(-0.492898192),FQ(-0.493231830),FQ(-0.493565396),FQ(-0.493898888),
-    FQ(-0.494232309),FQ(-0.494565656),FQ(-0.494898931),FQ(-0.495232133),FQ(-0.495565262),
-    FQ(-0.495898318),FQ(-0.496231301),FQ(-0.496564212),FQ(-0.496897049),FQ(-0.497229813),
-    FQ(-0.497562504),FQ(-0.497895122),FQ(-0.498227667),FQ(-0.498560138),FQ(-0.498892537),
-    FQ(-0.499224861),FQ(-0.499557113),FQ(-0.499889290),FQ(-0.500221395),FQ(-0.500553425),
-    FQ(-0.500885383),FQ(-0.501217266),FQ(-0.501549076),FQ(-0.501880812),FQ(-0.502212474),
-    FQ(-0.502544062),FQ(-0.502875577),FQ(-0.503207017),FQ(-0.503538384),FQ(-0.503869676),
-    FQ(-0.504200894),FQ(-0.504532039),FQ(-0.504863109),FQ(-0.505194104),FQ(-0.505525026),
-    FQ(-0.505855873),FQ(-0.506186645),FQ(-0.506517344),FQ(-0.506847967),FQ(-0.507178516),
-    FQ(-0.507508991),FQ(-0.507839391),FQ(-0.508169716),FQ(-0.508499967),FQ(-0.508830143),
-    FQ(-0.509160243),FQ(-0.509490269),FQ(-0.509820221),FQ(-0.510150097),FQ(-0.510479898),
-    FQ(-0.510809624),FQ(-0.511139275),FQ(-0.511468850),FQ(-0.511798351),FQ(-0.512127776),
-    FQ(-0.512457126),FQ(-0.512786401),FQ(-0.513115600),FQ(-0.513444723),FQ(-0.513773772),
-    FQ(-0.514102744),FQ(-0.514431641),FQ(-0.514760463),FQ(-0.515089208),FQ(-0.515417878),
-    FQ(-0.515746472),FQ(-0.516074990),FQ(-0.516403433),FQ(-0.516731799),FQ(-0.517060089),
-    FQ(-0.517388304),FQ(-0.517716442),FQ(-0.518044504),FQ(-0.518372490),FQ(-0.518700400),
-    FQ(-0.519028233),FQ(-0.519355990),FQ(-0.519683671),FQ(-0.520011275),FQ(-0.520338803),
-    FQ(-0.520666254),FQ(-0.520993629),FQ(-0.521320927),FQ(-0.521648148),FQ(-0.521975293),
-    FQ(-0.522302361),FQ(-0.522629352),FQ(-0.522956266),FQ(-0.523283103),FQ(-0.523609864),
-    FQ(-0.523936547),FQ(-0.524263153),FQ(-0.524589683),FQ(-0.524916135),FQ(-0.525242510),
-    FQ(-0.525568807),FQ(-0.525895027),FQ(-0.526221170),FQ(-0.526547236),FQ(-0.526873224),
-    FQ(-0.527199135),FQ(-0.527524968),FQ(-0.527850723),FQ(-0.528176401),FQ(-0.528502002),
-    FQ(-0.528827524),FQ(-0.529152969),FQ(-0.529478336),FQ(-0.529803625),FQ(-0.530128836),
-    FQ(-0.530453969),FQ(-0.530779024),FQ(-0.531104001),FQ(-0.531428900),FQ(-0.531753721),
-    FQ(-0.532078464),FQ(-0.532403128),FQ(-0.532727714),FQ(-0.533052222),FQ(-0.533376651),
-    FQ(-0.533701002),FQ(-0.534025274),FQ(-0.534349468),FQ(-0.534673583),FQ(-0.534997620),
-    FQ(-0.535321578),FQ(-0.535645457),FQ(-0.535969257),FQ(-0.536292979),FQ(-0.536616622),
-    FQ(-0.536940186),FQ(-0.537263670),FQ(-0.537587076),FQ(-0.537910403),FQ(-0.538233651),
-    FQ(-0.538556819),FQ(-0.538879909),FQ(-0.539202919),FQ(-0.539525849),FQ(-0.539848701),
-    FQ(-0.540171473),FQ(-0.540494165),FQ(-0.540816778),FQ(-0.541139312),FQ(-0.541461766),
-    FQ(-0.541784140),FQ(-0.542106435),FQ(-0.542428650),FQ(-0.542750785),FQ(-0.543072840),
-    FQ(-0.543394816),FQ(-0.543716711),FQ(-0.544038527),FQ(-0.544360262),FQ(-0.544681918),
-    FQ(-0.545003493),FQ(-0.545324988),FQ(-0.545646403),FQ(-0.545967738),FQ(-0.546288993),
-    FQ(-0.546610167),FQ(-0.546931261),FQ(-0.547252274),FQ(-0.547573207),FQ(-0.547894059),
-    FQ(-0.548214831),FQ(-0.548535522),FQ(-0.548856132),FQ(-0.549176662),FQ(-0.549497111),
-    FQ(-0.549817479),FQ(-0.550137767),FQ(-0.550457973),FQ(-0.550778098),FQ(-0.551098143),
-    FQ(-0.551418106),FQ(-0.551737988),FQ(-0.552057790),FQ(-0.552377509),FQ(-0.552697148),
-    FQ(-0.553016706),FQ(-0.553336182),FQ(-0.553655576),FQ(-0.553974890),FQ(-0.554294121),
-    FQ(-0.554613272),FQ(-0.554932340),FQ(-0.555251328),FQ(-0.555570233),FQ(-0.555889057),
-    FQ(-0.556207799),FQ(-0.556526459),FQ(-0.556845037),FQ(-0.557163534),FQ(-0.557481948),
-    FQ(-0.557800281),FQ(-0.558118531),FQ(-0.558436700),FQ(-0.558754786),FQ(-0.559072790),
-    FQ(-0.559390712),FQ(-0.559708551),FQ(-0.560026309),FQ(-0.560343984),FQ(-0.560661576),
-    FQ(-0.560979086),FQ(-0.561296514),FQ(-0.561613859),FQ(-0.561931121),FQ(-0.562248301),
-    FQ(-0.562565398),FQ(-0.562882412),FQ(-0.563199344),FQ(-0.563516193),FQ(-0.563832959),
-    FQ(-0.564149642),FQ(-0.564466242),FQ(-0.564782758),FQ(-0.565099192),FQ(-0.565415543),
-    FQ(-0.565731811),FQ(-0.566047995),FQ(-0.566364096),FQ(-0.566680114),FQ(-0.566996049),
-    FQ(-0.567311900),FQ(-0.567627668),FQ(-0.567943352),FQ(-0.568258953),FQ(-0.568574470),
-    FQ(-0.568889903),FQ(-0.569205253),FQ(-0.569520519),FQ(-0.569835702),FQ(-0.570150800),
-    FQ(-0.570465815),FQ(-0.570780746),FQ(-0.571095593),FQ(-0.571410356),FQ(-0.571725035),
-    FQ(-0.572039629),FQ(-0.572354140),FQ(-0.572668566),FQ(-0.572982909),FQ(-0.573297167),
-    FQ(-0.573611340),FQ(-0.573925430),FQ(-0.574239435),FQ(-0.574553355),FQ(-0.574867191),
-    FQ(-0.575180942),FQ(-0.575494609),FQ(-0.575808191),FQ(-0.576121689),FQ(-0.576435102),
-    FQ(-0.576748430),FQ(-0.577061673),FQ(-0.577374831),FQ(-0.577687905),FQ(-0.578000893),
-    FQ(-0.578313796),FQ(-0.578626615),FQ(-0.578939348),FQ(-0.579251996),FQ(-0.579564559),
-    FQ(-0.579877037),FQ(-0.580189429),FQ(-0.580501736),FQ(-0.580813958),FQ(-0.581126094),
-    FQ(-0.581438145),FQ(-0.581750111),FQ(-0.582061990),FQ(-0.582373785),FQ(-0.582685493),
-    FQ(-0.582997116),FQ(-0.583308653),FQ(-0.583620104),FQ(-0.583931470),FQ(-0.584242749),
-    FQ(-0.584553943),FQ(-0.584865051),FQ(-0.585176072),FQ(-0.585487008),FQ(-0.585797857),
-    FQ(-0.586108621),FQ(-0.586419298),FQ(-0.586729889),FQ(-0.587040394),FQ(-0.587350812),
-    FQ(-0.587661144),FQ(-0.587971389),FQ(-0.588281548),FQ(-0.588591621),FQ(-0.588901607),
-    FQ(-0.589211506),FQ(-0.589521319),FQ(-0.589831045),FQ(-0.590140684),FQ(-0.590450236),
-    FQ(-0.590759702),FQ(-0.591069081),FQ(-0.591378372),FQ(-0.591687577),FQ(-0.591996695),
-    FQ(-0.592305726),FQ(-0.592614669),FQ(-0.592923526),FQ(-0.593232295),FQ(-0.593540977),
-    FQ(-0.593849572),FQ(-0.594158079),FQ(-0.594466499),FQ(-0.594774832),FQ(-0.595083077),
-    FQ(-0.595391234),FQ(-0.595699304),FQ(-0.596007287),FQ(-0.596315182),FQ(-0.596622989),
-    FQ(-0.596930708),FQ(-0.597238340),FQ(-0.597545883),FQ(-0.597853339),FQ(-0.598160707),
-    FQ(-0.598467987),FQ(-0.598775179),FQ(-0.599082283),FQ(-0.599389298),FQ(-0.599696226),
-    FQ(-0.600003065),FQ(-0.600309817),FQ(-0.600616479),FQ(-0.600923054),FQ(-0.601229540),
-    FQ(-0.601535938),FQ(-0.601842247),FQ(-0.602148468),FQ(-0.602454600),FQ(-0.602760644),
-    FQ(-0.603066599),FQ(-0.603372465),FQ(-0.603678242),FQ(-0.603983931),FQ(-0.604289531),
-    FQ(-0.604595042),FQ(-0.604900464),FQ(-0.605205797),FQ(-0.605511041),FQ(-0.605816197),
-    FQ(-0.606121263),FQ(-0.606426239),FQ(-0.606731127),FQ(-0.607035925),FQ(-0.607340635),
-    FQ(-0.607645254),FQ(-0.607949785),FQ(-0.608254226),FQ(-0.608558578),FQ(-0.608862840),
-    FQ(-0.609167012),FQ(-0.609471095),FQ(-0.609775089),FQ(-0.610078992),FQ(-0.610382806),
-    FQ(-0.610686530),FQ(-0.610990165),FQ(-0.611293709),FQ(-0.611597164),FQ(-0.611900529),
-    FQ(-0.612203803),FQ(-0.612506988),FQ(-0.612810082),FQ(-0.613113087),FQ(-0.613416001),
-    FQ(-0.613718825),FQ(-0.614021559),FQ(-0.614324202),FQ(-0.614626756),FQ(-0.614929218),
-    FQ(-0.615231591),FQ(-0.615533872),FQ(-0.615836064),FQ(-0.616138164),FQ(-0.616440175),
-    FQ(-0.616742094),FQ(-0.617043923),FQ(-0.617345661),FQ(-0.617647308),FQ(-0.617948864),
-    FQ(-0.618250330),FQ(-0.618551704),FQ(-0.618852988),FQ(-0.619154181),FQ(-0.619455282),
-    FQ(-0.619756292),FQ(-0.620057212),FQ(-0.620358040),FQ(-0.620658777),FQ(-0.620959422),
-    FQ(-0.621259977),FQ(-0.621560439),FQ(-0.621860811),FQ(-0.622161091),FQ(-0.622461279),
-    FQ(-0.622761376),FQ(-0.623061382),FQ(-0.623361295),FQ(-0.623661118),FQ(-0.623960848),
-    FQ(-0.624260486),FQ(-0.624560033),FQ(-0.624859488),FQ(-0.625158851),FQ(-0.625458122),
-    FQ(-0.625757301),FQ(-0.626056388),FQ(-0.626355383),FQ(-0.626654286),FQ(-0.626953097),
-    FQ(-0.627251815),FQ(-0.627550442),FQ(-0.627848976),FQ(-0.628147417),FQ(-0.628445767),
-    FQ(-0.628744023),FQ(-0.629042188),FQ(-0.629340260),FQ(-0.629638239),FQ(-0.629936126),
-    FQ(-0.630233920),FQ(-0.630531621),FQ(-0.630829230),FQ(-0.631126745),FQ(-0.631424169),
-    FQ(-0.631721499),FQ(-0.632018736),FQ(-0.632315880),FQ(-0.632612932),FQ(-0.632909890),
-    FQ(-0.633206755),FQ(-0.633503527),FQ(-0.633800206),FQ(-0.634096792),FQ(-0.634393284),
-    FQ(-0.634689683),FQ(-0.634985989),FQ(-0.635282202),FQ(-0.635578320),FQ(-0.635874346),
-    FQ(-0.636170278),FQ(-0.636466116),FQ(-0.636761861),FQ(-0.637057512),FQ(-0.637353070),
-    FQ(-0.637648534),FQ(-0.637943904),FQ(-0.638239180),FQ(-0.638534362),FQ(-0.638829450),
-    FQ(-0.639124445),FQ(-0.639419345),FQ(-0.639714152),FQ(-0.640008864),FQ(-0.640303482),
-    FQ(-0.640598006),FQ(-0.640892436),FQ(-0.641186772),FQ(-0.641481013),FQ(-0.641775160),
-    FQ(-0.642069212),FQ(-0.642363170),FQ(-0.642657034),FQ(-0.642950803),FQ(-0.643244478),
-    FQ(-0.643538058),FQ(-0.643831543),FQ(-0.644124934),FQ(-0.644418229),FQ(-0.644711431),
-    FQ(-0.645004537),FQ(-0.645297548),FQ(-0.645590465),FQ(-0.645883286),FQ(-0.646176013),
-    FQ(-0.646468645),FQ(-0.646761181),FQ(-0.647053622),FQ(-0.647345969),FQ(-0.647638220),
-    FQ(-0.647930375),FQ(-0.648222436),FQ(-0.648514401),FQ(-0.648806271),FQ(-0.649098045),
-    FQ(-0.649389724),FQ(-0.649681307),FQ(-0.649972795),FQ(-0.650264187),FQ(-0.650555484),
-    FQ(-0.650846685),FQ(-0.651137790),FQ(-0.651428800),FQ(-0.651719713),FQ(-0.652010531),
-    FQ(-0.652301253),FQ(-0.652591879),FQ(-0.652882409),FQ(-0.653172843),FQ(-0.653463181),
-    FQ(-0.653753423),FQ(-0.654043568),FQ(-0.654333618),FQ(-0.654623571),FQ(-0.654913428),
-    FQ(-0.655203189),FQ(-0.655492853),FQ(-0.655782421),FQ(-0.656071892),FQ(-0.656361267),
-    FQ(-0.656650546),FQ(-0.656939728),FQ(-0.657228813),FQ(-0.657517801),FQ(-0.657806693),
-    FQ(-0.658095488),FQ(-0.658384187),FQ(-0.658672788),FQ(-0.658961293),FQ(-0.659249701),
-    FQ(-0.659538012),FQ(-0.659826225),FQ(-0.660114342),FQ(-0.660402362),FQ(-0.660690284),
-    FQ(-0.660978110),FQ(-0.661265838),FQ(-0.661553469),FQ(-0.661841002),FQ(-0.662128439),
-    FQ(-0.662415778),FQ(-0.662703019),FQ(-0.662990163),FQ(-0.663277210),FQ(-0.663564159),
-    FQ(-0.663851010),FQ(-0.664137764),FQ(-0.664424420),FQ(-0.664710978),FQ(-0.664997439),
-    FQ(-0.665283802),FQ(-0.665570067),FQ(-0.665856234),FQ(-0.666142303),FQ(-0.666428274),
-    FQ(-0.666714147),FQ(-0.666999922),FQ(-0.667285599),FQ(-0.667571178),FQ(-0.667856659),
-    FQ(-0.668142041),FQ(-0.668427326),FQ(-0.668712512),FQ(-0.668997599),FQ(-0.669282588),
-    FQ(-0.669567479),FQ(-0.669852271),FQ(-0.670136965),FQ(-0.670421560),FQ(-0.670706057),
-    FQ(-0.670990455),FQ(-0.671274754),FQ(-0.671558955),FQ(-0.671843057),FQ(-0.672127060),
-    FQ(-0.672410964),FQ(-0.672694769),FQ(-0.672978475),FQ(-0.673262083),FQ(-0.673545591),
-    FQ(-0.673829000),FQ(-0.674112311),FQ(-0.674395522),FQ(-0.674678633),FQ(-0.674961646),
-    FQ(-0.675244559),FQ(-0.675527374),FQ(-0.675810088),FQ(-0.676092704),FQ(-0.676375219),
-    FQ(-0.676657636),FQ(-0.676939953),FQ(-0.677222170),FQ(-0.677504288),FQ(-0.677786306),
-    FQ(-0.678068224),FQ(-0.678350043),FQ(-0.678631762),FQ(-0.678913381),FQ(-0.679194900),
-    FQ(-0.679476320),FQ(-0.679757639),FQ(-0.680038859),FQ(-0.680319978),FQ(-0.680600998),
-    FQ(-0.680881917),FQ(-0.681162736),FQ(-0.681443455),FQ(-0.681724074),FQ(-0.682004593),
-    FQ(-0.682285011),FQ(-0.682565329),FQ(-0.682845546),FQ(-0.683125663),FQ(-0.683405680),
-    FQ(-0.683685596),FQ(-0.683965412),FQ(-0.684245127),FQ(-0.684524741),FQ(-0.684804255),
-    FQ(-0.685083668),FQ(-0.685362980),FQ(-0.685642191),FQ(-0.685921302),FQ(-0.686200312),
-    FQ(-0.686479220),FQ(-0.686758028),FQ(-0.687036735),FQ(-0.687315341),FQ(-0.687593846),
-    FQ(-0.687872249),FQ(-0.688150552),FQ(-0.688428753),FQ(-0.688706853),FQ(-0.688984851),
-    FQ(-0.689262749),FQ(-0.689540545),FQ(-0.689818239),FQ(-0.690095832),FQ(-0.690373324),
-    FQ(-0.690650714),FQ(-0.690928003),FQ(-0.691205190),FQ(-0.691482275),FQ(-0.691759258),
-    FQ(-0.692036140),FQ(-0.692312920),FQ(-0.692589598),FQ(-0.692866175),FQ(-0.693142649),
-    FQ(-0.693419022),FQ(-0.693695292),FQ(-0.693971461),FQ(-0.694247527),FQ(-0.694523492),
-    FQ(-0.694799354),FQ(-0.695075114),FQ(-0.695350772),FQ(-0.695626327),FQ(-0.695901781),
-    FQ(-0.696177131),FQ(-0.696452380),FQ(-0.696727526),FQ(-0.697002570),FQ(-0.697277511),
-    FQ(-0.697552349),FQ(-0.697827085),FQ(-0.698101719),FQ(-0.698376249),FQ(-0.698650677),
-    FQ(-0.698925003),FQ(-0.699199225),FQ(-0.699473345),FQ(-0.699747361),FQ(-0.700021275),
-    FQ(-0.700295086),FQ(-0.700568794),FQ(-0.700842399),FQ(-0.701115901),FQ(-0.701389299),
-    FQ(-0.701662595),FQ(-0.701935787),FQ(-0.702208876),FQ(-0.702481862),FQ(-0.702754744),
-    FQ(-0.703027524),FQ(-0.703300199),FQ(-0.703572772),FQ(-0.703845241),FQ(-0.704117606),
-    FQ(-0.704389868),FQ(-0.704662026),FQ(-0.704934080),FQ(-0.705206031),FQ(-0.705477878),
-    FQ(-0.705749622),FQ(-0.706021261),FQ(-0.706292797),FQ(-0.706564229),FQ(-0.706835557),
-    FQ(-0.707106781),FQ(-0.707377901),FQ(-0.707648917),FQ(-0.707919829),FQ(-0.708190637),
-    FQ(-0.708461341),FQ(-0.708731940),FQ(-0.709002435),FQ(-0.709272826),FQ(-0.709543113),
-    FQ(-0.709813295),FQ(-0.710083373),FQ(-0.710353347),FQ(-0.710623216),FQ(-0.710892980),
-    FQ(-0.711162640),FQ(-0.711432196),FQ(-0.711701646),FQ(-0.711970993),FQ(-0.712240234),
-    FQ(-0.712509371),FQ(-0.712778402),FQ(-0.713047329),FQ(-0.713316152),FQ(-0.713584869),
-    FQ(-0.713853481),FQ(-0.714121988),FQ(-0.714390391),FQ(-0.714658688),FQ(-0.714926880),
-    FQ(-0.715194967),FQ(-0.715462949),FQ(-0.715730825),FQ(-0.715998597),FQ(-0.716266263),
-    FQ(-0.716533823),FQ(-0.716801279),FQ(-0.717068628),FQ(-0.717335873),FQ(-0.717603012),
-    FQ(-0.717870045),FQ(-0.718136973),FQ(-0.718403795),FQ(-0.718670512),FQ(-0.718937122),
-    FQ(-0.719203627),FQ(-0.719470027),FQ(-0.719736320),FQ(-0.720002508),FQ(-0.720268590),
-    FQ(-0.720534566),FQ(-0.720800435),FQ(-0.721066199),FQ(-0.721331857),FQ(-0.721597409),
-    FQ(-0.721862854),FQ(-0.722128194),FQ(-0.722393427),FQ(-0.722658554),FQ(-0.722923575),
-    FQ(-0.723188489),FQ(-0.723453297),FQ(-0.723717999),FQ(-0.723982594),FQ(-0.724247083),
-    FQ(-0.724511465),FQ(-0.724775741),FQ(-0.725039910),FQ(-0.725303972),FQ(-0.725567928),
-    FQ(-0.725831777),FQ(-0.726095520),FQ(-0.726359155),FQ(-0.726622684),FQ(-0.726886106),
-    FQ(-0.727149421),FQ(-0.727412629),FQ(-0.727675730),FQ(-0.727938724),FQ(-0.728201611),
-    FQ(-0.728464390),FQ(-0.728727063),FQ(-0.728989629),FQ(-0.729252087),FQ(-0.729514438),
-    FQ(-0.729776682),FQ(-0.730038818),FQ(-0.730300848),FQ(-0.730562769),FQ(-0.730824583),
-    FQ(-0.731086290),FQ(-0.731347890),FQ(-0.731609381),FQ(-0.731870765),FQ(-0.732132042),
-    FQ(-0.732393211),FQ(-0.732654272),FQ(-0.732915225),FQ(-0.733176071),FQ(-0.733436808),
-    FQ(-0.733697438),FQ(-0.733957960),FQ(-0.734218374),FQ(-0.734478680),FQ(-0.734738878),
-    FQ(-0.734998968),FQ(-0.735258950),FQ(-0.735518824),FQ(-0.735778589),FQ(-0.736038247),
-    FQ(-0.736297796),FQ(-0.736557236),FQ(-0.736816569),FQ(-0.737075793),FQ(-0.737334909),
-    FQ(-0.737593916),FQ(-0.737852815),FQ(-0.738111605),FQ(-0.738370287),FQ(-0.738628860),
-    FQ(-0.738887324),FQ(-0.739145680),FQ(-0.739403927),FQ(-0.739662066),FQ(-0.739920095),
-    FQ(-0.740178016),FQ(-0.740435828),FQ(-0.740693531),FQ(-0.740951125),FQ(-0.741208610),
-    FQ(-0.741465987),FQ(-0.741723254),FQ(-0.741980412),FQ(-0.742237461),FQ(-0.742494400),
-    FQ(-0.742751231),FQ(-0.743007952),FQ(-0.743264564),FQ(-0.743521067),FQ(-0.743777460),
-    FQ(-0.744033744),FQ(-0.744289919),FQ(-0.744545984),FQ(-0.744801939),FQ(-0.745057785),
-    FQ(-0.745313522),FQ(-0.745569149),FQ(-0.745824666),FQ(-0.746080074),FQ(-0.746335371),
-    FQ(-0.746590559),FQ(-0.746845638),FQ(-0.747100606),FQ(-0.747355465),FQ(-0.747610213),
-    FQ(-0.747864852),FQ(-0.748119380),FQ(-0.748373799),FQ(-0.748628108),FQ(-0.748882306),
-    FQ(-0.749136395),FQ(-0.749390373),FQ(-0.749644241),FQ(-0.749897998),FQ(-0.750151646),
-    FQ(-0.750405183),FQ(-0.750658610),FQ(-0.750911926),FQ(-0.751165132),FQ(-0.751418227),
-    FQ(-0.751671212),FQ(-0.751924087),FQ(-0.752176850),FQ(-0.752429504),FQ(-0.752682046),
-    FQ(-0.752934478),FQ(-0.753186799),FQ(-0.753439009),FQ(-0.753691109),FQ(-0.753943098),
-    FQ(-0.754194975),FQ(-0.754446742),FQ(-0.754698398),FQ(-0.754949943),FQ(-0.755201377),
-    FQ(-0.755452700),FQ(-0.755703911),FQ(-0.755955012),FQ(-0.756206001),FQ(-0.756456880),
-    FQ(-0.756707647),FQ(-0.756958302),FQ(-0.757208847),FQ(-0.757459279),FQ(-0.757709601),
-    FQ(-0.757959811),FQ(-0.758209910),FQ(-0.758459897),FQ(-0.758709773),FQ(-0.758959537),
-    FQ(-0.759209189),FQ(-0.759458730),FQ(-0.759708159),FQ(-0.759957476),FQ(-0.760206682),
-    FQ(-0.760455775),FQ(-0.760704757),FQ(-0.760953627),FQ(-0.761202385),FQ(-0.761451032),
-    FQ(-0.761699566),FQ(-0.761947988),FQ(-0.762196298),FQ(-0.762444496),FQ(-0.762692582),
-    FQ(-0.762940556),FQ(-0.763188417),FQ(-0.763436167),FQ(-0.763683804),FQ(-0.763931328),
-    FQ(-0.764178741),FQ(-0.764426040),FQ(-0.764673228),FQ(-0.764920303),FQ(-0.765167266),
-    FQ(-0.765414116),FQ(-0.765660853),FQ(-0.765907478),FQ(-0.766153990),FQ(-0.766400390),
-    FQ(-0.766646677),FQ(-0.766892851),FQ(-0.767138912),FQ(-0.767384860),FQ(-0.767630696),
-    FQ(-0.767876419),FQ(-0.768122029),FQ(-0.768367525),FQ(-0.768612909),FQ(-0.768858180),
-    FQ(-0.769103338),FQ(-0.769348382),FQ(-0.769593314),FQ(-0.769838132),FQ(-0.770082837),
-    FQ(-0.770327429),FQ(-0.770571907),FQ(-0.770816272),FQ(-0.771060524),FQ(-0.771304663),
-    FQ(-0.771548688),FQ(-0.771792599),FQ(-0.772036397),FQ(-0.772280082),FQ(-0.772523652),
-    FQ(-0.772767110),FQ(-0.773010453),FQ(-0.773253683),FQ(-0.773496799),FQ(-0.773739802),
-    FQ(-0.773982691),FQ(-0.774225465),FQ(-0.774468126),FQ(-0.774710673),FQ(-0.774953107),
-    FQ(-0.775195426),FQ(-0.775437631),FQ(-0.775679722),FQ(-0.775921699),FQ(-0.776163562),
-    FQ(-0.776405311),FQ(-0.776646945),FQ(-0.776888466),FQ(-0.777129872),FQ(-0.777371164),
-    FQ(-0.777612341),FQ(-0.777853404),FQ(-0.778094353),FQ(-0.778335187),FQ(-0.778575907),
-    FQ(-0.778816512),FQ(-0.779057003),FQ(-0.779297379),FQ(-0.779537641),FQ(-0.779777788),
-    FQ(-0.780017820),FQ(-0.780257738),FQ(-0.780497541),FQ(-0.780737229),FQ(-0.780976802),
-    FQ(-0.781216260),FQ(-0.781455604),FQ(-0.781694832),FQ(-0.781933946),FQ(-0.782172944),
-    FQ(-0.782411828),FQ(-0.782650596),FQ(-0.782889250),FQ(-0.783127788),FQ(-0.783366211),
-    FQ(-0.783604519),FQ(-0.783842711),FQ(-0.784080789),FQ(-0.784318751),FQ(-0.784556597),
-    FQ(-0.784794328),FQ(-0.785031944),FQ(-0.785269445),FQ(-0.785506830),FQ(-0.785744099),
-    FQ(-0.785981253),FQ(-0.786218291),FQ(-0.786455214),FQ(-0.786692021),FQ(-0.786928712),
-    FQ(-0.787165287),FQ(-0.787401747),FQ(-0.787638091),FQ(-0.787874319),FQ(-0.788110431),
-    FQ(-0.788346428),FQ(-0.788582308),FQ(-0.788818072),FQ(-0.789053721),FQ(-0.789289253),
-    FQ(-0.789524669),FQ(-0.789759970),FQ(-0.789995154),FQ(-0.790230221),FQ(-0.790465173),
-    FQ(-0.790700008),FQ(-0.790934727),FQ(-0.791169330),FQ(-0.791403817),FQ(-0.791638187),
-    FQ(-0.791872440),FQ(-0.792106577),FQ(-0.792340598),FQ(-0.792574502),FQ(-0.792808290),
-    FQ(-0.793041960),FQ(-0.793275515),FQ(-0.793508952),FQ(-0.793742273),FQ(-0.793975478),
-    FQ(-0.794208565),FQ(-0.794441536),FQ(-0.794674389),FQ(-0.794907126),FQ(-0.795139746),
-    FQ(-0.795372249),FQ(-0.795604636),FQ(-0.795836905),FQ(-0.796069057),FQ(-0.796301092),
-    FQ(-0.796533009),FQ(-0.796764810),FQ(-0.796996494),FQ(-0.797228060),FQ(-0.797459509),
-    FQ(-0.797690841),FQ(-0.797922055),FQ(-0.798153153),FQ(-0.798384132),FQ(-0.798614995),
-    FQ(-0.798845740),FQ(-0.799076367),FQ(-0.799306877),FQ(-0.799537269),FQ(-0.799767544),
-    FQ(-0.799997701),FQ(-0.800227740),FQ(-0.800457662),FQ(-0.800687466),FQ(-0.800917153),
-    FQ(-0.801146721),FQ(-0.801376172),FQ(-0.801605505),FQ(-0.801834719),FQ(-0.802063816),
-    FQ(-0.802292796),FQ(-0.802521657),FQ(-0.802750400),FQ(-0.802979025),FQ(-0.803207531),
-    FQ(-0.803435920),FQ(-0.803664191),FQ(-0.803892343),FQ(-0.804120377),FQ(-0.804348293),
-    FQ(-0.804576091),FQ(-0.804803770),FQ(-0.805031331),FQ(-0.805258774),FQ(-0.805486098),
-    FQ(-0.805713303),FQ(-0.805940391),FQ(-0.806167359),FQ(-0.806394209),FQ(-0.806620941),
-    FQ(-0.806847554),FQ(-0.807074048),FQ(-0.807300423),FQ(-0.807526680),FQ(-0.807752818),
-    FQ(-0.807978837),FQ(-0.808204737),FQ(-0.808430519),FQ(-0.808656182),FQ(-0.808881725),
-    FQ(-0.809107150),FQ(-0.809332456),FQ(-0.809557642),FQ(-0.809782710),FQ(-0.810007659),
-    FQ(-0.810232488),FQ(-0.810457198),FQ(-0.810681789),FQ(-0.810906261),FQ(-0.811130614),
-    FQ(-0.811354847),FQ(-0.811578961),FQ(-0.811802956),FQ(-0.812026831),FQ(-0.812250587),
-    FQ(-0.812474223),FQ(-0.812697740),FQ(-0.812921137),FQ(-0.813144415),FQ(-0.813367573),
-    FQ(-0.813590612),FQ(-0.813813530),FQ(-0.814036330),FQ(-0.814259009),FQ(-0.814481569),
-    FQ(-0.814704009),FQ(-0.814926329),FQ(-0.815148529),FQ(-0.815370610),FQ(-0.815592570),
-    FQ(-0.815814411),FQ(-0.816036131),FQ(-0.816257732),FQ(-0.816479212),FQ(-0.816700573),
-    FQ(-0.816921813),FQ(-0.817142933),FQ(-0.817363933),FQ(-0.817584813),FQ(-0.817805573),
-    FQ(-0.818026212),FQ(-0.818246731),FQ(-0.818467130),FQ(-0.818687408),FQ(-0.818907566),
-    FQ(-0.819127603),FQ(-0.819347520),FQ(-0.819567317),FQ(-0.819786992),FQ(-0.820006548),
-    FQ(-0.820225983),FQ(-0.820445297),FQ(-0.820664490),FQ(-0.820883563),FQ(-0.821102515),
-    FQ(-0.821321346),FQ(-0.821540057),FQ(-0.821758646),FQ(-0.821977115),FQ(-0.822195463),
-    FQ(-0.822413690),FQ(-0.822631796),FQ(-0.822849781),FQ(-0.823067645),FQ(-0.823285388),
-    FQ(-0.823503010),FQ(-0.823720511),FQ(-0.823937891),FQ(-0.824155149),FQ(-0.824372287),
-    FQ(-0.824589303),FQ(-0.824806198),FQ(-0.825022971),FQ(-0.825239623),FQ(-0.825456154),
-    FQ(-0.825672563),FQ(-0.825888851),FQ(-0.826105018),FQ(-0.826321063),FQ(-0.826536986),
-    FQ(-0.826752788),FQ(-0.826968469),FQ(-0.827184027),FQ(-0.827399464),FQ(-0.827614780),
-    FQ(-0.827829973),FQ(-0.828045045),FQ(-0.828259995),FQ(-0.828474824),FQ(-0.828689530),
-    FQ(-0.828904115),FQ(-0.829118577),FQ(-0.829332918),FQ(-0.829547137),FQ(-0.829761234),
-    FQ(-0.829975209),FQ(-0.830189061),FQ(-0.830402792),FQ(-0.830616400),FQ(-0.830829887),
-    FQ(-0.831043251),FQ(-0.831256493),FQ(-0.831469612),FQ(-0.831682610),FQ(-0.831895485),
-    FQ(-0.832108237),FQ(-0.832320868),FQ(-0.832533376),FQ(-0.832745761),FQ(-0.832958024),
-    FQ(-0.833170165),FQ(-0.833382183),FQ(-0.833594078),FQ(-0.833805851),FQ(-0.834017501),
-    FQ(-0.834229029),FQ(-0.834440433),FQ(-0.834651716),FQ(-0.834862875),FQ(-0.835073912),
-    FQ(-0.835284825),FQ(-0.835495616),FQ(-0.835706284),FQ(-0.835916830),FQ(-0.836127252),
-    FQ(-0.836337551),FQ(-0.836547727),FQ(-0.836757780),FQ(-0.836967711),FQ(-0.837177518),
-    FQ(-0.837387202),FQ(-0.837596762),FQ(-0.837806200),FQ(-0.838015514),FQ(-0.838224706),
-    FQ(-0.838433773),FQ(-0.838642718),FQ(-0.838851539),FQ(-0.839060237),FQ(-0.839268812),
-    FQ(-0.839477263),FQ(-0.839685590),FQ(-0.839893794),FQ(-0.840101875),FQ(-0.840309832),
-    FQ(-0.840517665),FQ(-0.840725375),FQ(-0.840932961),FQ(-0.841140424),FQ(-0.841347762),
-    FQ(-0.841554977),FQ(-0.841762069),FQ(-0.841969036),FQ(-0.842175880),FQ(-0.842382600),
-    FQ(-0.842589196),FQ(-0.842795668),FQ(-0.843002016),FQ(-0.843208240),FQ(-0.843414340),
-    FQ(-0.843620316),FQ(-0.843826168),FQ(-0.844031895),FQ(-0.844237499),FQ(-0.844442979),
-    FQ(-0.844648334),FQ(-0.844853565),FQ(-0.845058672),FQ(-0.845263655),FQ(-0.845468513),
-    FQ(-0.845673247),FQ(-0.845877857),FQ(-0.846082342),FQ(-0.846286702),FQ(-0.846490939),
-    FQ(-0.846695051),FQ(-0.846899038),FQ(-0.847102901),FQ(-0.847306639),FQ(-0.847510252),
-    FQ(-0.847713741),FQ(-0.847917105),FQ(-0.848120345),FQ(-0.848323460),FQ(-0.848526450),
-    FQ(-0.848729315),FQ(-0.848932055),FQ(-0.849134671),FQ(-0.849337161),FQ(-0.849539527),
-    FQ(-0.849741768),FQ(-0.849943884),FQ(-0.850145875),FQ(-0.850347741),FQ(-0.850549481),
-    FQ(-0.850751097),FQ(-0.850952587),FQ(-0.851153953),FQ(-0.851355193),FQ(-0.851556308),
-    FQ(-0.851757298),FQ(-0.851958162),FQ(-0.852158902),FQ(-0.852359516),FQ(-0.852560004),
-    FQ(-0.852760367),FQ(-0.852960605),FQ(-0.853160717),FQ(-0.853360704),FQ(-0.853560565),
-    FQ(-0.853760301),FQ(-0.853959911),FQ(-0.854159396),FQ(-0.854358755),FQ(-0.854557988),
-    FQ(-0.854757096),FQ(-0.854956078),FQ(-0.855154934),FQ(-0.855353665),FQ(-0.855552269),
-    FQ(-0.855750748),FQ(-0.855949101),FQ(-0.856147328),FQ(-0.856345430),FQ(-0.856543405),
-    FQ(-0.856741254),FQ(-0.856938977),FQ(-0.857136575),FQ(-0.857334046),FQ(-0.857531391),
-    FQ(-0.857728610),FQ(-0.857925703),FQ(-0.858122670),FQ(-0.858319510),FQ(-0.858516224),
-    FQ(-0.858712812),FQ(-0.858909274),FQ(-0.859105609),FQ(-0.859301818),FQ(-0.859497901),
-    FQ(-0.859693857),FQ(-0.859889687),FQ(-0.860085390),FQ(-0.860280967),FQ(-0.860476418),
-    FQ(-0.860671741),FQ(-0.860866939),FQ(-0.861062009),FQ(-0.861256953),FQ(-0.861451771),
-    FQ(-0.861646461),FQ(-0.861841025),FQ(-0.862035462),FQ(-0.862229773),FQ(-0.862423956),
-    FQ(-0.862618013),FQ(-0.862811943),FQ(-0.863005746),FQ(-0.863199422),FQ(-0.863392971),
-    FQ(-0.863586393),FQ(-0.863779688),FQ(-0.863972856),FQ(-0.864165897),FQ(-0.864358811),
-    FQ(-0.864551598),FQ(-0.864744258),FQ(-0.864936790),FQ(-0.865129195),FQ(-0.865321473),
-    FQ(-0.865513624),FQ(-0.865705648),FQ(-0.865897544),FQ(-0.866089313),FQ(-0.866280954),
-    FQ(-0.866472468),FQ(-0.866663855),FQ(-0.866855114),FQ(-0.867046246),FQ(-0.867237250),
-    FQ(-0.867428126),FQ(-0.867618875),FQ(-0.867809497),FQ(-0.867999991),FQ(-0.868190357),
-    FQ(-0.868380595),FQ(-0.868570706),FQ(-0.868760689),FQ(-0.868950544),FQ(-0.869140272),
-    FQ(-0.869329871),FQ(-0.869519343),FQ(-0.869708687),FQ(-0.869897903),FQ(-0.870086991),
-    FQ(-0.870275951),FQ(-0.870464783),FQ(-0.870653487),FQ(-0.870842063),FQ(-0.871030511),
-    FQ(-0.871218831),FQ(-0.871407023),FQ(-0.871595087),FQ(-0.871783022),FQ(-0.871970829),
-    FQ(-0.872158508),FQ(-0.872346059),FQ(-0.872533481),FQ(-0.872720775),FQ(-0.872907941),
-    FQ(-0.873094978),FQ(-0.873281887),FQ(-0.873468668),FQ(-0.873655320),FQ(-0.873841843),
-    FQ(-0.874028239),FQ(-0.874214505),FQ(-0.874400643),FQ(-0.874586652),FQ(-0.874772533),
-    FQ(-0.874958285),FQ(-0.875143908),FQ(-0.875329403),FQ(-0.875514769),FQ(-0.875700006),
-    FQ(-0.875885115),FQ(-0.876070094),FQ(-0.876254945),FQ(-0.876439667),FQ(-0.876624260),
-    FQ(-0.876808724),FQ(-0.876993059),FQ(-0.877177265),FQ(-0.877361342),FQ(-0.877545290),
-    FQ(-0.877729109),FQ(-0.877912799),FQ(-0.878096360),FQ(-0.878279792),FQ(-0.878463094),
-    FQ(-0.878646267),FQ(-0.878829312),FQ(-0.879012226),FQ(-0.879195012),FQ(-0.879377668),
-    FQ(-0.879560195),FQ(-0.879742593),FQ(-0.879924861),FQ(-0.880107000),FQ(-0.880289009),
-    FQ(-0.880470889),FQ(-0.880652639),FQ(-0.880834260),FQ(-0.881015752),FQ(-0.881197113),
-    FQ(-0.881378346),FQ(-0.881559448),FQ(-0.881740421),FQ(-0.881921264),FQ(-0.882101978),
-    FQ(-0.882282562),FQ(-0.882463016),FQ(-0.882643340),FQ(-0.882823534),FQ(-0.883003599),
-    FQ(-0.883183534),FQ(-0.883363339),FQ(-0.883543014),FQ(-0.883722559),FQ(-0.883901974),
-    FQ(-0.884081259),FQ(-0.884260414),FQ(-0.884439439),FQ(-0.884618334),FQ(-0.884797098),
-    FQ(-0.884975733),FQ(-0.885154238),FQ(-0.885332612),FQ(-0.885510856),FQ(-0.885688970),
-    FQ(-0.885866954),FQ(-0.886044807),FQ(-0.886222530),FQ(-0.886400123),FQ(-0.886577585),
-    FQ(-0.886754917),FQ(-0.886932119),FQ(-0.887109190),FQ(-0.887286131),FQ(-0.887462941),
-    FQ(-0.887639620),FQ(-0.887816170),FQ(-0.887992588),FQ(-0.888168876),FQ(-0.888345033),
-    FQ(-0.888521060),FQ(-0.888696956),FQ(-0.888872721),FQ(-0.889048356),FQ(-0.889223860),
-    FQ(-0.889399233),FQ(-0.889574475),FQ(-0.889749586),FQ(-0.889924567),FQ(-0.890099417),
-    FQ(-0.890274135),FQ(-0.890448723),FQ(-0.890623180),FQ(-0.890797506),FQ(-0.890971701),
-    FQ(-0.891145765),FQ(-0.891319698),FQ(-0.891493499),FQ(-0.891667170),FQ(-0.891840709),
-    FQ(-0.892014118),FQ(-0.892187395),FQ(-0.892360541),FQ(-0.892533555),FQ(-0.892706439),
-    FQ(-0.892879191),FQ(-0.893051812),FQ(-0.893224301),FQ(-0.893396659),FQ(-0.893568886),
-    FQ(-0.893740981),FQ(-0.893912945),FQ(-0.894084778),FQ(-0.894256478),FQ(-0.894428048),
-    FQ(-0.894599486),FQ(-0.894770792),FQ(-0.894941967),FQ(-0.895113010),FQ(-0.895283921),
-    FQ(-0.895454701),FQ(-0.895625349),FQ(-0.895795865),FQ(-0.895966250),FQ(-0.896136503),
-    FQ(-0.896306624),FQ(-0.896476613),FQ(-0.896646470),FQ(-0.896816196),FQ(-0.896985789),
-    FQ(-0.897155251),FQ(-0.897324581),FQ(-0.897493778),FQ(-0.897662844),FQ(-0.897831778),
-    FQ(-0.898000580),FQ(-0.898169249),FQ(-0.898337787),FQ(-0.898506192),FQ(-0.898674466),
-    FQ(-0.898842607),FQ(-0.899010616),FQ(-0.899178492),FQ(-0.899346237),FQ(-0.899513849),
-    FQ(-0.899681329),FQ(-0.899848677),FQ(-0.900015892),FQ(-0.900182975),FQ(-0.900349925),
-    FQ(-0.900516744),FQ(-0.900683429),FQ(-0.900849982),FQ(-0.901016403),FQ(-0.901182691),
-    FQ(-0.901348847),FQ(-0.901514870),FQ(-0.901680761),FQ(-0.901846519),FQ(-0.902012144),
-    FQ(-0.902177637),FQ(-0.902342996),FQ(-0.902508224),FQ(-0.902673318),FQ(-0.902838280),
-    FQ(-0.903003109),FQ(-0.903167805),FQ(-0.903332368),FQ(-0.903496799),FQ(-0.903661097),
-    FQ(-0.903825261),FQ(-0.903989293),FQ(-0.904153192),FQ(-0.904316958),FQ(-0.904480591),
-    FQ(-0.904644091),FQ(-0.904807457),FQ(-0.904970691),FQ(-0.905133792),FQ(-0.905296759),
-    FQ(-0.905459594),FQ(-0.905622295),FQ(-0.905784863),FQ(-0.905947298),FQ(-0.906109599),
-    FQ(-0.906271768),FQ(-0.906433803),FQ(-0.906595705),FQ(-0.906757473),FQ(-0.906919108),
-    FQ(-0.907080610),FQ(-0.907241978),FQ(-0.907403213),FQ(-0.907564314),FQ(-0.907725282),
-    FQ(-0.907886116),FQ(-0.908046817),FQ(-0.908207385),FQ(-0.908367819),FQ(-0.908528119),
-    FQ(-0.908688285),FQ(-0.908848318),FQ(-0.909008218),FQ(-0.909167983),FQ(-0.909327615),
-    FQ(-0.909487113),FQ(-0.909646477),FQ(-0.909805708),FQ(-0.909964805),FQ(-0.910123768),
-    FQ(-0.910282597),FQ(-0.910441292),FQ(-0.910599854),FQ(-0.910758281),FQ(-0.910916575),
-    FQ(-0.911074734),FQ(-0.911232760),FQ(-0.911390651),FQ(-0.911548409),FQ(-0.911706032),
-    FQ(-0.911863521),FQ(-0.912020877),FQ(-0.912178098),FQ(-0.912335185),FQ(-0.912492137),
-    FQ(-0.912648956),FQ(-0.912805640),FQ(-0.912962190),FQ(-0.913118606),FQ(-0.913274888),
-    FQ(-0.913431035),FQ(-0.913587048),FQ(-0.913742926),FQ(-0.913898671),FQ(-0.914054280),
-    FQ(-0.914209756),FQ(-0.914365097),FQ(-0.914520303),FQ(-0.914675375),FQ(-0.914830312),
-    FQ(-0.914985115),FQ(-0.915139783),FQ(-0.915294317),FQ(-0.915448716),FQ(-0.915602981),
-    FQ(-0.915757110),FQ(-0.915911105),FQ(-0.916064966),FQ(-0.916218691),FQ(-0.916372282),
-    FQ(-0.916525739),FQ(-0.916679060),FQ(-0.916832246),FQ(-0.916985298),FQ(-0.917138215),
-    FQ(-0.917290997),FQ(-0.917443644),FQ(-0.917596156),FQ(-0.917748533),FQ(-0.917900776),
-    FQ(-0.918052883),FQ(-0.918204855),FQ(-0.918356692),FQ(-0.918508394),FQ(-0.918659961),
-    FQ(-0.918811393),FQ(-0.918962690),FQ(-0.919113852),FQ(-0.919264878),FQ(-0.919415769),
-    FQ(-0.919566525),FQ(-0.919717146),FQ(-0.919867632),FQ(-0.920017982),FQ(-0.920168197),
-    FQ(-0.920318277),FQ(-0.920468221),FQ(-0.920618030),FQ(-0.920767703),FQ(-0.920917242),
-    FQ(-0.921066644),FQ(-0.921215911),FQ(-0.921365043),FQ(-0.921514039),FQ(-0.921662900),
-    FQ(-0.921811625),FQ(-0.921960215),FQ(-0.922108669),FQ(-0.922256987),FQ(-0.922405170),
-    FQ(-0.922553217),FQ(-0.922701128),FQ(-0.922848904),FQ(-0.922996544),FQ(-0.923144048),
-    FQ(-0.923291417),FQ(-0.923438649),FQ(-0.923585746),FQ(-0.923732707),FQ(-0.923879533),
-    FQ(-0.924026222),FQ(-0.924172775),FQ(-0.924319193),FQ(-0.924465474),FQ(-0.924611620),
-    FQ(-0.924757630),FQ(-0.924903503),FQ(-0.925049241),FQ(-0.925194842),FQ(-0.925340308),
-    FQ(-0.925485637),FQ(-0.925630831),FQ(-0.925775888),FQ(-0.925920809),FQ(-0.926065594),
-    FQ(-0.926210242),FQ(-0.926354755),FQ(-0.926499131),FQ(-0.926643371),FQ(-0.926787474),
-    FQ(-0.926931442),FQ(-0.927075273),FQ(-0.927218967),FQ(-0.927362526),FQ(-0.927505948),
-    FQ(-0.927649233),FQ(-0.927792382),FQ(-0.927935395),FQ(-0.928078271),FQ(-0.928221011),
-    FQ(-0.928363614),FQ(-0.928506080),FQ(-0.928648411),FQ(-0.928790604),FQ(-0.928932661),
-    FQ(-0.929074581),FQ(-0.929216365),FQ(-0.929358012),FQ(-0.929499522),FQ(-0.929640896),
-    FQ(-0.929782133),FQ(-0.929923233),FQ(-0.930064196),FQ(-0.930205023),FQ(-0.930345713),
-    FQ(-0.930486266),FQ(-0.930626682),FQ(-0.930766961),FQ(-0.930907103),FQ(-0.931047109),
-    FQ(-0.931186977),FQ(-0.931326709),FQ(-0.931466304),FQ(-0.931605761),FQ(-0.931745082),
-    FQ(-0.931884266),FQ(-0.932023312),FQ(-0.932162222),FQ(-0.932300994),FQ(-0.932439629),
-    FQ(-0.932578127),FQ(-0.932716488),FQ(-0.932854712),FQ(-0.932992799),FQ(-0.933130748),
-    FQ(-0.933268560),FQ(-0.933406235),FQ(-0.933543773),FQ(-0.933681173),FQ(-0.933818436),
-    FQ(-0.933955562),FQ(-0.934092550),FQ(-0.934229401),FQ(-0.934366115),FQ(-0.934502691),
-    FQ(-0.934639130),FQ(-0.934775431),FQ(-0.934911595),FQ(-0.935047621),FQ(-0.935183510),
-    FQ(-0.935319261),FQ(-0.935454875),FQ(-0.935590351),FQ(-0.935725689),FQ(-0.935860890),
-    FQ(-0.935995954),FQ(-0.936130879),FQ(-0.936265667),FQ(-0.936400317),FQ(-0.936534830),
-    FQ(-0.936669205),FQ(-0.936803442),FQ(-0.936937541),FQ(-0.937071502),FQ(-0.937205326),
-    FQ(-0.937339012),FQ(-0.937472560),FQ(-0.937605970),FQ(-0.937739242),FQ(-0.937872376),
-    FQ(-0.938005373),FQ(-0.938138231),FQ(-0.938270952),FQ(-0.938403534),FQ(-0.938535978),
-    FQ(-0.938668285),FQ(-0.938800453),FQ(-0.938932484),FQ(-0.939064376),FQ(-0.939196130),
-    FQ(-0.939327746),FQ(-0.939459224),FQ(-0.939590563),FQ(-0.939721765),FQ(-0.939852828),
-    FQ(-0.939983753),FQ(-0.940114540),FQ(-0.940245188),FQ(-0.940375699),FQ(-0.940506071),
-    FQ(-0.940636304),FQ(-0.940766400),FQ(-0.940896356),FQ(-0.941026175),FQ(-0.941155855),
-    FQ(-0.941285397),FQ(-0.941414800),FQ(-0.941544065),FQ(-0.941673192),FQ(-0.941802179),
-    FQ(-0.941931029),FQ(-0.942059740),FQ(-0.942188312),FQ(-0.942316746),FQ(-0.942445041),
-    FQ(-0.942573198),FQ(-0.942701216),FQ(-0.942829095),FQ(-0.942956836),FQ(-0.943084437),
-    FQ(-0.943211901),FQ(-0.943339225),FQ(-0.943466411),FQ(-0.943593458),FQ(-0.943720366),
-    FQ(-0.943847136),FQ(-0.943973767),FQ(-0.944100258),FQ(-0.944226612),FQ(-0.944352826),
-    FQ(-0.944478901),FQ(-0.944604837),FQ(-0.944730635),FQ(-0.944856293),FQ(-0.944981813),
-    FQ(-0.945107193),FQ(-0.945232435),FQ(-0.945357537),FQ(-0.945482501),FQ(-0.945607325),
-    FQ(-0.945732011),FQ(-0.945856557),FQ(-0.945980964),FQ(-0.946105232),FQ(-0.946229361),
-    FQ(-0.946353351),FQ(-0.946477202),FQ(-0.946600913),FQ(-0.946724485),FQ(-0.946847918),
-    FQ(-0.946971212),FQ(-0.947094366),FQ(-0.947217381),FQ(-0.947340257),FQ(-0.947462994),
-    FQ(-0.947585591),FQ(-0.947708049),FQ(-0.947830367),FQ(-0.947952546),FQ(-0.948074586),
-    FQ(-0.948196486),FQ(-0.948318247),FQ(-0.948439868),FQ(-0.948561350),FQ(-0.948682692),
-    FQ(-0.948803895),FQ(-0.948924958),FQ(-0.949045882),FQ(-0.949166666),FQ(-0.949287310),
-    FQ(-0.949407815),FQ(-0.949528181),FQ(-0.949648406),FQ(-0.949768492),FQ(-0.949888438),
-    FQ(-0.950008245),FQ(-0.950127912),FQ(-0.950247439),FQ(-0.950366826),FQ(-0.950486074),
-    FQ(-0.950605182),FQ(-0.950724150),FQ(-0.950842978),FQ(-0.950961666),FQ(-0.951080215),
-    FQ(-0.951198623),FQ(-0.951316892),FQ(-0.951435021),FQ(-0.951553010),FQ(-0.951670859),
-    FQ(-0.951788568),FQ(-0.951906137),FQ(-0.952023566),FQ(-0.952140855),FQ(-0.952258004),
-    FQ(-0.952375013),FQ(-0.952491882),FQ(-0.952608610),FQ(-0.952725199),FQ(-0.952841648),
-    FQ(-0.952957956),FQ(-0.953074124),FQ(-0.953190152),FQ(-0.953306040),FQ(-0.953421788),
-    FQ(-0.953537396),FQ(-0.953652863),FQ(-0.953768190),FQ(-0.953883377),FQ(-0.953998423),
-    FQ(-0.954113329),FQ(-0.954228095),FQ(-0.954342721),FQ(-0.954457206),FQ(-0.954571551),
-    FQ(-0.954685755),FQ(-0.954799819),FQ(-0.954913742),FQ(-0.955027526),FQ(-0.955141168),
-    FQ(-0.955254671),FQ(-0.955368032),FQ(-0.955481253),FQ(-0.955594334),FQ(-0.955707274),
-    FQ(-0.955820074),FQ(-0.955932733),FQ(-0.956045251),FQ(-0.956157629),FQ(-0.956269866),
-    FQ(-0.956381963),FQ(-0.956493919),FQ(-0.956605734),FQ(-0.956717409),FQ(-0.956828943),
-    FQ(-0.956940336),FQ(-0.957051588),FQ(-0.957162700),FQ(-0.957273671),FQ(-0.957384501),
-    FQ(-0.957495190),FQ(-0.957605739),FQ(-0.957716146),FQ(-0.957826413),FQ(-0.957936539),
-    FQ(-0.958046524),FQ(-0.958156368),FQ(-0.958266071),FQ(-0.958375634),FQ(-0.958485055),
-    FQ(-0.958594335),FQ(-0.958703475),FQ(-0.958812473),FQ(-0.958921331),FQ(-0.959030047),
-    FQ(-0.959138622),FQ(-0.959247057),FQ(-0.959355350),FQ(-0.959463502),FQ(-0.959571513),
-    FQ(-0.959679383),FQ(-0.959787112),FQ(-0.959894699),FQ(-0.960002146),FQ(-0.960109451),
-    FQ(-0.960216615),FQ(-0.960323638),FQ(-0.960430519),FQ(-0.960537260),FQ(-0.960643859),
-    FQ(-0.960750317),FQ(-0.960856633),FQ(-0.960962808),FQ(-0.961068842),FQ(-0.961174735),
-    FQ(-0.961280486),FQ(-0.961386096),FQ(-0.961491564),FQ(-0.961596891),FQ(-0.961702077),
-    FQ(-0.961807121),FQ(-0.961912023),FQ(-0.962016785),FQ(-0.962121404),FQ(-0.962225882),
-    FQ(-0.962330219),FQ(-0.962434414),FQ(-0.962538468),FQ(-0.962642380),FQ(-0.962746151),
-    FQ(-0.962849780),FQ(-0.962953267),FQ(-0.963056613),FQ(-0.963159817),FQ(-0.963262879),
-    FQ(-0.963365800),FQ(-0.963468579),FQ(-0.963571216),FQ(-0.963673712),FQ(-0.963776066),
-    FQ(-0.963878278),FQ(-0.963980348),FQ(-0.964082277),FQ(-0.964184064),FQ(-0.964285709),
-    FQ(-0.964387212),FQ(-0.964488574),FQ(-0.964589793),FQ(-0.964690871),FQ(-0.964791807),
-    FQ(-0.964892601),FQ(-0.964993253),FQ(-0.965093763),FQ(-0.965194131),FQ(-0.965294357),
-    FQ(-0.965394442),FQ(-0.965494384),FQ(-0.965594184),FQ(-0.965693843),FQ(-0.965793359),
-    FQ(-0.965892733),FQ(-0.965991965),FQ(-0.966091055),FQ(-0.966190003),FQ(-0.966288809),
-    FQ(-0.966387473),FQ(-0.966485995),FQ(-0.966584374),FQ(-0.966682612),FQ(-0.966780707),
-    FQ(-0.966878660),FQ(-0.966976471),FQ(-0.967074140),FQ(-0.967171666),FQ(-0.967269050),
-    FQ(-0.967366292),FQ(-0.967463392),FQ(-0.967560349),FQ(-0.967657164),FQ(-0.967753837),
-    FQ(-0.967850368),FQ(-0.967946756),FQ(-0.968043001),FQ(-0.968139105),FQ(-0.968235066),
-    FQ(-0.968330884),FQ(-0.968426561),FQ(-0.968522094),FQ(-0.968617486),FQ(-0.968712734),
-    FQ(-0.968807841),FQ(-0.968902805),FQ(-0.968997626),FQ(-0.969092305),FQ(-0.969186842),
-    FQ(-0.969281235),FQ(-0.969375487),FQ(-0.969469595),FQ(-0.969563562),FQ(-0.969657385),
-    FQ(-0.969751066),FQ(-0.969844604),FQ(-0.969938000),FQ(-0.970031253),FQ(-0.970124364),
-    FQ(-0.970217331),FQ(-0.970310156),FQ(-0.970402839),FQ(-0.970495378),FQ(-0.970587775),
-    FQ(-0.970680029),FQ(-0.970772141),FQ(-0.970864109),FQ(-0.970955935),FQ(-0.971047618),
-    FQ(-0.971139158),FQ(-0.971230556),FQ(-0.971321810),FQ(-0.971412922),FQ(-0.971503891),
-    FQ(-0.971594717),FQ(-0.971685400),FQ(-0.971775940),FQ(-0.971866337),FQ(-0.971956592),
-    FQ(-0.972046703),FQ(-0.972136672),FQ(-0.972226497),FQ(-0.972316180),FQ(-0.972405719),
-    FQ(-0.972495115),FQ(-0.972584369),FQ(-0.972673479),FQ(-0.972762447),FQ(-0.972851271),
-    FQ(-0.972939952),FQ(-0.973028490),FQ(-0.973116885),FQ(-0.973205137),FQ(-0.973293246),
-    FQ(-0.973381212),FQ(-0.973469034),FQ(-0.973556714),FQ(-0.973644250),FQ(-0.973731643),
-    FQ(-0.973818892),FQ(-0.973905999),FQ(-0.973992962),FQ(-0.974079782),FQ(-0.974166459),
-    FQ(-0.974252993),FQ(-0.974339383),FQ(-0.974425630),FQ(-0.974511733),FQ(-0.974597694),
-    FQ(-0.974683511),FQ(-0.974769184),FQ(-0.974854715),FQ(-0.974940102),FQ(-0.975025345),
-    FQ(-0.975110445),FQ(-0.975195402),FQ(-0.975280215),FQ(-0.975364885),FQ(-0.975449412),
-    FQ(-0.975533795),FQ(-0.975618034),FQ(-0.975702130),FQ(-0.975786083),FQ(-0.975869892),
-    FQ(-0.975953557),FQ(-0.976037079),FQ(-0.976120457),FQ(-0.976203692),FQ(-0.976286784),
-    FQ(-0.976369731),FQ(-0.976452535),FQ(-0.976535196),FQ(-0.976617713),FQ(-0.976700086),
-    FQ(-0.976782316),FQ(-0.976864402),FQ(-0.976946344),FQ(-0.977028143),FQ(-0.977109798),
-    FQ(-0.977191309),FQ(-0.977272676),FQ(-0.977353900),FQ(-0.977434980),FQ(-0.977515917),
-    FQ(-0.977596709),FQ(-0.977677358),FQ(-0.977757863),FQ(-0.977838224),FQ(-0.977918441),
-    FQ(-0.977998515),FQ(-0.978078445),FQ(-0.978158231),FQ(-0.978237873),FQ(-0.978317371),
-    FQ(-0.978396725),FQ(-0.978475935),FQ(-0.978555002),FQ(-0.978633924),FQ(-0.978712703),
-    FQ(-0.978791338),FQ(-0.978869829),FQ(-0.978948175),FQ(-0.979026378),FQ(-0.979104437),
-    FQ(-0.979182352),FQ(-0.979260123),FQ(-0.979337749),FQ(-0.979415232),FQ(-0.979492571),
-    FQ(-0.979569766),FQ(-0.979646816),FQ(-0.979723723),FQ(-0.979800485),FQ(-0.979877104),
-    FQ(-0.979953578),FQ(-0.980029908),FQ(-0.980106094),FQ(-0.980182136),FQ(-0.980258034),
-    FQ(-0.980333787),FQ(-0.980409397),FQ(-0.980484862),FQ(-0.980560183),FQ(-0.980635360),
-    FQ(-0.980710392),FQ(-0.980785280),FQ(-0.980860024),FQ(-0.980934624),FQ(-0.981009080),
-    FQ(-0.981083391),FQ(-0.981157558),FQ(-0.981231581),FQ(-0.981305459),FQ(-0.981379193),
-    FQ(-0.981452783),FQ(-0.981526228),FQ(-0.981599530),FQ(-0.981672686),FQ(-0.981745699),
-    FQ(-0.981818566),FQ(-0.981891290),FQ(-0.981963869),FQ(-0.982036304),FQ(-0.982108594),
-    FQ(-0.982180740),FQ(-0.982252741),FQ(-0.982324598),FQ(-0.982396311),FQ(-0.982467879),
-    FQ(-0.982539302),FQ(-0.982610581),FQ(-0.982681716),FQ(-0.982752706),FQ(-0.982823551),
-    FQ(-0.982894252),FQ(-0.982964808),FQ(-0.983035220),FQ(-0.983105487),FQ(-0.983175610),
-    FQ(-0.983245588),FQ(-0.983315422),FQ(-0.983385110),FQ(-0.983454655),FQ(-0.983524054),
-    FQ(-0.983593309),FQ(-0.983662419),FQ(-0.983731385),FQ(-0.983800206),FQ(-0.983868882),
-    FQ(-0.983937413),FQ(-0.984005800),FQ(-0.984074042),FQ(-0.984142140),FQ(-0.984210092),
-    FQ(-0.984277900),FQ(-0.984345563),FQ(-0.984413082),FQ(-0.984480455),FQ(-0.984547684),
-    FQ(-0.984614768),FQ(-0.984681707),FQ(-0.984748502),FQ(-0.984815151),FQ(-0.984881656),
-    FQ(-0.984948016),FQ(-0.985014231),FQ(-0.985080301),FQ(-0.985146226),FQ(-0.985212007),
-    FQ(-0.985277642),FQ(-0.985343133),FQ(-0.985408479),FQ(-0.985473679),FQ(-0.985538735),
-    FQ(-0.985603646),FQ(-0.985668412),FQ(-0.985733033),FQ(-0.985797509),FQ(-0.985861840),
-    FQ(-0.985926026),FQ(-0.985990067),FQ(-0.986053963),FQ(-0.986117714),FQ(-0.986181320),
-    FQ(-0.986244781),FQ(-0.986308097),FQ(-0.986371268),FQ(-0.986434294),FQ(-0.986497175),
-    FQ(-0.986559910),FQ(-0.986622501),FQ(-0.986684946),FQ(-0.986747247),FQ(-0.986809402),
-    FQ(-0.986871412),FQ(-0.986933277),FQ(-0.986994997),FQ(-0.987056571),FQ(-0.987118001),
-    FQ(-0.987179285),FQ(-0.987240424),FQ(-0.987301418),FQ(-0.987362267),FQ(-0.987422970),
-    FQ(-0.987483529),FQ(-0.987543942),FQ(-0.987604210),FQ(-0.987664332),FQ(-0.987724310),
-    FQ(-0.987784142),FQ(-0.987843828),FQ(-0.987903370),FQ(-0.987962766),FQ(-0.988022017),
-    FQ(-0.988081123),FQ(-0.988140083),FQ(-0.988198898),FQ(-0.988257568),FQ(-0.988316092),
-    FQ(-0.988374471),FQ(-0.988432705),FQ(-0.988490793),FQ(-0.988548736),FQ(-0.988606533),
-    FQ(-0.988664185),FQ(-0.988721692),FQ(-0.988779053),FQ(-0.988836269),FQ(-0.988893340),
-    FQ(-0.988950265),FQ(-0.989007044),FQ(-0.989063678),FQ(-0.989120167),FQ(-0.989176510),
-    FQ(-0.989232708),FQ(-0.989288760),FQ(-0.989344667),FQ(-0.989400428),FQ(-0.989456043),
-    FQ(-0.989511514),FQ(-0.989566838),FQ(-0.989622017),FQ(-0.989677051),FQ(-0.989731939),
-    FQ(-0.989786682),FQ(-0.989841278),FQ(-0.989895730),FQ(-0.989950036),FQ(-0.990004196),
-    FQ(-0.990058210),FQ(-0.990112079),FQ(-0.990165803),FQ(-0.990219380),FQ(-0.990272812),
-    FQ(-0.990326099),FQ(-0.990379240),FQ(-0.990432235),FQ(-0.990485084),FQ(-0.990537788),
-    FQ(-0.990590346),FQ(-0.990642759),FQ(-0.990695025),FQ(-0.990747147),FQ(-0.990799122),
-    FQ(-0.990850952),FQ(-0.990902635),FQ(-0.990954174),FQ(-0.991005566),FQ(-0.991056813),
-    FQ(-0.991107914),FQ(-0.991158869),FQ(-0.991209678),FQ(-0.991260342),FQ(-0.991310860),
-    FQ(-0.991361232),FQ(-0.991411458),FQ(-0.991461539),FQ(-0.991511473),FQ(-0.991561262),
-    FQ(-0.991610905),FQ(-0.991660402),FQ(-0.991709754),FQ(-0.991758959),FQ(-0.991808019),
-    FQ(-0.991856933),FQ(-0.991905700),FQ(-0.991954322),FQ(-0.992002799),FQ(-0.992051129),
-    FQ(-0.992099313),FQ(-0.992147352),FQ(-0.992195244),FQ(-0.992242991),FQ(-0.992290591),
-    FQ(-0.992338046),FQ(-0.992385355),FQ(-0.992432518),FQ(-0.992479535),FQ(-0.992526406),
-    FQ(-0.992573130),FQ(-0.992619709),FQ(-0.992666142),FQ(-0.992712429),FQ(-0.992758570),
-    FQ(-0.992804565),FQ(-0.992850414),FQ(-0.992896117),FQ(-0.992941674),FQ(-0.992987085),
-    FQ(-0.993032350),FQ(-0.993077469),FQ(-0.993122442),FQ(-0.993167269),FQ(-0.993211949),
-    FQ(-0.993256484),FQ(-0.993300872),FQ(-0.993345115),FQ(-0.993389211),FQ(-0.993433161),
-    FQ(-0.993476966),FQ(-0.993520624),FQ(-0.993564136),FQ(-0.993607501),FQ(-0.993650721),
-    FQ(-0.993693795),FQ(-0.993736722),FQ(-0.993779503),FQ(-0.993822138),FQ(-0.993864627),
-    FQ(-0.993906970),FQ(-0.993949167),FQ(-0.993991217),FQ(-0.994033121),FQ(-0.994074879),
-    FQ(-0.994116491),FQ(-0.994157957),FQ(-0.994199276),FQ(-0.994240449),FQ(-0.994281476),
-    FQ(-0.994322357),FQ(-0.994363092),FQ(-0.994403680),FQ(-0.994444122),FQ(-0.994484418),
-    FQ(-0.994524567),FQ(-0.994564571),FQ(-0.994604428),FQ(-0.994644138),FQ(-0.994683703),
-    FQ(-0.994723121),FQ(-0.994762393),FQ(-0.994801519),FQ(-0.994840498),FQ(-0.994879331),
-    FQ(-0.994918017),FQ(-0.994956558),FQ(-0.994994952),FQ(-0.995033199),FQ(-0.995071301),
-    FQ(-0.995109256),FQ(-0.995147064),FQ(-0.995184727),FQ(-0.995222243),FQ(-0.995259612),
-    FQ(-0.995296835),FQ(-0.995333912),FQ(-0.995370843),FQ(-0.995407627),FQ(-0.995444264),
-    FQ(-0.995480755),FQ(-0.995517100),FQ(-0.995553299),FQ(-0.995589351),FQ(-0.995625256),
-    FQ(-0.995661016),FQ(-0.995696628),FQ(-0.995732095),FQ(-0.995767414),FQ(-0.995802588),
-    FQ(-0.995837615),FQ(-0.995872495),FQ(-0.995907229),FQ(-0.995941817),FQ(-0.995976258),
-    FQ(-0.996010553),FQ(-0.996044701),FQ(-0.996078703),FQ(-0.996112558),FQ(-0.996146266),
-    FQ(-0.996179829),FQ(-0.996213244),FQ(-0.996246513),FQ(-0.996279636),FQ(-0.996312612),
-    FQ(-0.996345442),FQ(-0.996378125),FQ(-0.996410661),FQ(-0.996443051),FQ(-0.996475295),
-    FQ(-0.996507392),FQ(-0.996539342),FQ(-0.996571146),FQ(-0.996602803),FQ(-0.996634314),
-    FQ(-0.996665678),FQ(-0.996696895),FQ(-0.996727966),FQ(-0.996758890),FQ(-0.996789668),
-    FQ(-0.996820299),FQ(-0.996850784),FQ(-0.996881122),FQ(-0.996911313),FQ(-0.996941358),
-    FQ(-0.996971256),FQ(-0.997001007),FQ(-0.997030612),FQ(-0.997060070),FQ(-0.997089382),
-    FQ(-0.997118547),FQ(-0.997147565),FQ(-0.997176437),FQ(-0.997205162),FQ(-0.997233740),
-    FQ(-0.997262172),FQ(-0.997290457),FQ(-0.997318595),FQ(-0.997346587),FQ(-0.997374432),
-    FQ(-0.997402130),FQ(-0.997429682),FQ(-0.997457086),FQ(-0.997484345),FQ(-0.997511456),
-    FQ(-0.997538421),FQ(-0.997565239),FQ(-0.997591910),FQ(-0.997618435),FQ(-0.997644813),
-    FQ(-0.997671044),FQ(-0.997697129),FQ(-0.997723067),FQ(-0.997748858),FQ(-0.997774502),
-    FQ(-0.997800000),FQ(-0.997825350),FQ(-0.997850554),FQ(-0.997875612),FQ(-0.997900522),
-    FQ(-0.997925286),FQ(-0.997949903),FQ(-0.997974374),FQ(-0.997998697),FQ(-0.998022874),
-    FQ(-0.998046904),FQ(-0.998070787),FQ(-0.998094523),FQ(-0.998118113),FQ(-0.998141556),
-    FQ(-0.998164852),FQ(-0.998188001),FQ(-0.998211003),FQ(-0.998233859),FQ(-0.998256568),
-    FQ(-0.998279130),FQ(-0.998301545),FQ(-0.998323813),FQ(-0.998345935),FQ(-0.998367910),
-    FQ(-0.998389737),FQ(-0.998411418),FQ(-0.998432953),FQ(-0.998454340),FQ(-0.998475581),
-    FQ(-0.998496674),FQ(-0.998517621),FQ(-0.998538421),FQ(-0.998559074),FQ(-0.998579581),
-    FQ(-0.998599940),FQ(-0.998620152),FQ(-0.998640218),FQ(-0.998660137),FQ(-0.998679909),
-    FQ(-0.998699534),FQ(-0.998719012),FQ(-0.998738344),FQ(-0.998757528),FQ(-0.998776566),
-    FQ(-0.998795456),FQ(-0.998814200),FQ(-0.998832797),FQ(-0.998851247),FQ(-0.998869550),
-    FQ(-0.998887706),FQ(-0.998905715),FQ(-0.998923578),FQ(-0.998941293),FQ(-0.998958862),
-    FQ(-0.998976283),FQ(-0.998993558),FQ(-0.999010686),FQ(-0.999027667),FQ(-0.999044501),
-    FQ(-0.999061188),FQ(-0.999077728),FQ(-0.999094121),FQ(-0.999110367),FQ(-0.999126466),
-    FQ(-0.999142419),FQ(-0.999158224),FQ(-0.999173883),FQ(-0.999189394),FQ(-0.999204759),
-    FQ(-0.999219976),FQ(-0.999235047),FQ(-0.999249971),FQ(-0.999264747),FQ(-0.999279377),
-    FQ(-0.999293860),FQ(-0.999308196),FQ(-0.999322385),FQ(-0.999336426),FQ(-0.999350321),
-    FQ(-0.999364069),FQ(-0.999377670),FQ(-0.999391124),FQ(-0.999404431),FQ(-0.999417591),
-    FQ(-0.999430605),FQ(-0.999443471),FQ(-0.999456190),FQ(-0.999468762),FQ(-0.999481187),
-    FQ(-0.999493465),FQ(-0.999505596),FQ(-0.999517580),FQ(-0.999529418),FQ(-0.999541108),
-    FQ(-0.999552651),FQ(-0.999564047),FQ(-0.999575296),FQ(-0.999586398),FQ(-0.999597353),
-    FQ(-0.999608161),FQ(-0.999618822),FQ(-0.999629337),FQ(-0.999639704),FQ(-0.999649924),
-    FQ(-0.999659997),FQ(-0.999669923),FQ(-0.999679702),FQ(-0.999689334),FQ(-0.999698819),
-    FQ(-0.999708157),FQ(-0.999717348),FQ(-0.999726391),FQ(-0.999735288),FQ(-0.999744038),
-    FQ(-0.999752641),FQ(-0.999761097),FQ(-0.999769405),FQ(-0.999777567),FQ(-0.999785582),
-    FQ(-0.999793449),FQ(-0.999801170),FQ(-0.999808743),FQ(-0.999816170),FQ(-0.999823449),
-    FQ(-0.999830582),FQ(-0.999837567),FQ(-0.999844405),FQ(-0.999851097),FQ(-0.999857641),
-    FQ(-0.999864038),FQ(-0.999870288),FQ(-0.999876391),FQ(-0.999882347),FQ(-0.999888156),
-    FQ(-0.999893818),FQ(-0.999899333),FQ(-0.999904701),FQ(-0.999909922),FQ(-0.999914996),
-    FQ(-0.999919922),FQ(-0.999924702),FQ(-0.999929334),FQ(-0.999933820),FQ(-0.999938158),
-    FQ(-0.999942350),FQ(-0.999946394),FQ(-0.999950291),FQ(-0.999954041),FQ(-0.999957645),
-    FQ(-0.999961101),FQ(-0.999964410),FQ(-0.999967572),FQ(-0.999970586),FQ(-0.999973454),
-    FQ(-0.999976175),FQ(-0.999978749),FQ(-0.999981175),FQ(-0.999983455),FQ(-0.999985587),
-    FQ(-0.999987573),FQ(-0.999989411),FQ(-0.999991102),FQ(-0.999992647),FQ(-0.999994044),
-    FQ(-0.999995294),FQ(-0.999996397),FQ(-0.999997353),FQ(-0.999998162),FQ(-0.999998823),
-    FQ(-0.999999338),FQ(-0.999999706),FQ(-0.999999926),FQ(-1.000000000),FQ(-0.999999926),
-    FQ(-0.999999706),FQ(-0.999999338),FQ(-0.999998823),FQ(-0.999998162),FQ(-0.999997353),
-    FQ(-0.999996397),FQ(-0.999995294),FQ(-0.999994044),FQ(-0.999992647),FQ(-0.999991102),
-    FQ(-0.999989411),FQ(-0.999987573),FQ(-0.999985587),FQ(-0.999983455),FQ(-0.999981175),
-    FQ(-0.999978749),FQ(-0.999976175),FQ(-0.999973454),FQ(-0.999970586),FQ(-0.999967572),
-    FQ(-0.999964410),FQ(-0.999961101),FQ(-0.999957645),FQ(-0.999954041),FQ(-0.999950291),
-    FQ(-0.999946394),FQ(-0.999942350),FQ(-0.999938158),FQ(-0.999933820),FQ(-0.999929334),
-    FQ(-0.999924702),FQ(-0.999919922),FQ(-0.999914996),FQ(-0.999909922),FQ(-0.999904701),
-    FQ(-0.999899333),FQ(-0.999893818),FQ(-0.999888156),FQ(-0.999882347),FQ(-0.999876391),
-    FQ(-0.999870288),FQ(-0.999864038),FQ(-0.999857641),FQ(-0.999851097),FQ(-0.999844405),
-    FQ(-0.999837567),FQ(-0.999830582),FQ(-0.999823449),FQ(-0.999816170),FQ(-0.999808743),
-    FQ(-0.999801170),FQ(-0.999793449),FQ(-0.999785582),FQ(-0.999777567),FQ(-0.999769405),
-    FQ(-0.999761097),FQ(-0.999752641),FQ(-0.999744038),FQ(-0.999735288),FQ(-0.999726391),
-    FQ(-0.999717348),FQ(-0.999708157),FQ(-0.999698819),FQ(-0.999689334),FQ(-0.999679702),
-    FQ(-0.999669923),FQ(-0.999659997),FQ(-0.999649924),FQ(-0.999639704),FQ(-0.999629337),
-    FQ(-0.999618822),FQ(-0.999608161),FQ(-0.999597353),FQ(-0.999586398),FQ(-0.999575296),
-    FQ(-0.999564047),FQ(-0.999552651),FQ(-0.999541108),FQ(-0.999529418),FQ(-0.999517580),
-    FQ(-0.999505596),FQ(-0.999493465),FQ(-0.999481187),FQ(-0.999468762),FQ(-0.999456190),
-    FQ(-0.999443471),FQ(-0.999430605),FQ(-0.999417591),FQ(-0.999404431),FQ(-0.999391124),
-    FQ(-0.999377670),FQ(-0.999364069),FQ(-0.999350321),FQ(-0.999336426),FQ(-0.999322385),
-    FQ(-0.999308196),FQ(-0.999293860),FQ(-0.999279377),FQ(-0.999264747),FQ(-0.999249971),
-    FQ(-0.999235047),FQ(-0.999219976),FQ(-0.999204759),FQ(-0.999189394),FQ(-0.999173883),
-    FQ(-0.999158224),FQ(-0.999142419),FQ(-0.999126466),FQ(-0.999110367),FQ(-0.999094121),
-    FQ(-0.999077728),FQ(-0.999061188),FQ(-0.999044501),FQ(-0.999027667),FQ(-0.999010686),
-    FQ(-0.998993558),FQ(-0.998976283),FQ(-0.998958862),FQ(-0.998941293),FQ(-0.998923578),
-    FQ(-0.998905715),FQ(-0.998887706),FQ(-0.998869550),FQ(-0.998851247),FQ(-0.998832797),
-    FQ(-0.998814200),FQ(-0.998795456),FQ(-0.998776566),FQ(-0.998757528),FQ(-0.998738344),
-    FQ(-0.998719012),FQ(-0.998699534),FQ(-0.998679909),FQ(-0.998660137),FQ(-0.998640218),
-    FQ(-0.998620152),FQ(-0.998599940),FQ(-0.998579581),FQ(-0.998559074),FQ(-0.998538421),
-    FQ(-0.998517621),FQ(-0.998496674),FQ(-0.998475581),FQ(-0.998454340),FQ(-0.998432953),
-    FQ(-0.998411418),FQ(-0.998389737),FQ(-0.998367910),FQ(-0.998345935),FQ(-0.998323813),
-    FQ(-0.998301545),FQ(-0.998279130),FQ(-0.998256568),FQ(-0.998233859),FQ(-0.998211003),
-    FQ(-0.998188001),FQ(-0.998164852),FQ(-0.998141556),FQ(-0.998118113),FQ(-0.998094523),
-    FQ(-0.998070787),FQ(-0.998046904),FQ(-0.998022874),FQ(-0.997998697),FQ(-0.997974374),
-    FQ(-0.997949903),FQ(-0.997925286),FQ(-0.997900522),FQ(-0.997875612),FQ(-0.997850554),
-    FQ(-0.997825350),FQ(-0.997800000),FQ(-0.997774502),FQ(-0.997748858),FQ(-0.997723067),
-    FQ(-0.997697129),FQ(-0.997671044),FQ(-0.997644813),FQ(-0.997618435),FQ(-0.997591910),
-    FQ(-0.997565239),FQ(-0.997538421),FQ(-0.997511456),FQ(-0.997484345),FQ(-0.997457086),
-    FQ(-0.997429682),FQ(-0.997402130),FQ(-0.997374432),FQ(-0.997346587),FQ(-0.997318595),
-    FQ(-0.997290457),FQ(-0.997262172),FQ(-0.997233740),FQ(-0.997205162),FQ(-0.997176437),
-    FQ(-0.997147565),FQ(-0.997118547),FQ(-0.997089382),FQ(-0.997060070),FQ(-0.997030612),
-    FQ(-0.997001007),FQ(-0.996971256),FQ(-0.996941358),FQ(-0.996911313),FQ(-0.996881122),
-    FQ(-0.996850784),FQ(-0.996820299),FQ(-0.996789668),FQ(-0.996758890),FQ(-0.996727966),
-    FQ(-0.996696895),FQ(-0.996665678),FQ(-0.996634314),FQ(-0.996602803),FQ(-0.996571146),
-    FQ(-0.996539342),FQ(-0.996507392),FQ(-0.996475295),FQ(-0.996443051),FQ(-0.996410661),
-    FQ(-0.996378125),FQ(-0.996345442),FQ(-0.996312612),FQ(-0.996279636),FQ(-0.996246513),
-    FQ(-0.996213244),FQ(-0.996179829),FQ(-0.996146266),FQ(-0.996112558),FQ(-0.996078703),
-    FQ(-0.996044701),FQ(-0.996010553),FQ(-0.995976258),FQ(-0.995941817),FQ(-0.995907229),
-    FQ(-0.995872495),FQ(-0.995837615),FQ(-0.995802588),FQ(-0.995767414),FQ(-0.995732095),
-    FQ(-0.995696628),FQ(-0.995661016),FQ(-0.995625256),FQ(-0.995589351),FQ(-0.995553299),
-    FQ(-0.995517100),FQ(-0.995480755),FQ(-0.995444264),FQ(-0.995407627),FQ(-0.995370843),
-    FQ(-0.995333912),FQ(-0.995296835),FQ(-0.995259612),FQ(-0.995222243),FQ(-0.995184727),
-    FQ(-0.995147064),FQ(-0.995109256),FQ(-0.995071301),FQ(-0.995033199),FQ(-0.994994952),
-    FQ(-0.994956558),FQ(-0.994918017),FQ(-0.994879331),FQ(-0.994840498),FQ(-0.994801519),
-    FQ(-0.994762393),FQ(-0.994723121),FQ(-0.994683703),FQ(-0.994644138),FQ(-0.994604428),
-    FQ(-0.994564571),FQ(-0.994524567),FQ(-0.994484418),FQ(-0.994444122),FQ(-0.994403680),
-    FQ(-0.994363092),FQ(-0.994322357),FQ(-0.994281476),FQ(-0.994240449),FQ(-0.994199276),
-    FQ(-0.994157957),FQ(-0.994116491),FQ(-0.994074879),FQ(-0.994033121),FQ(-0.993991217),
-    FQ(-0.993949167),FQ(-0.993906970),FQ(-0.993864627),FQ(-0.993822138),FQ(-0.993779503),
-    FQ(-0.993736722),FQ(-0.993693795),FQ(-0.993650721),FQ(-0.993607501),FQ(-0.993564136),
-    FQ(-0.993520624),FQ(-0.993476966),FQ(-0.993433161),FQ(-0.993389211),FQ(-0.993345115),
-    FQ(-0.993300872),FQ(-0.993256484),FQ(-0.993211949),FQ(-0.993167269),FQ(-0.993122442),
-    FQ(-0.993077469),FQ(-0.993032350),FQ(-0.992987085),FQ(-0.992941674),FQ(-0.992896117),
-    FQ(-0.992850414),FQ(-0.992804565),FQ(-0.992758570),FQ(-0.992712429),FQ(-0.992666142),
-    FQ(-0.992619709),FQ(-0.992573130),FQ(-0.992526406),FQ(-0.992479535),FQ(-0.992432518),
-    FQ(-0.992385355),FQ(-0.992338046),FQ(-0.992290591),FQ(-0.992242991),FQ(-0.992195244),
-    FQ(-0.992147352),FQ(-0.992099313),FQ(-0.992051129),FQ(-0.992002799),FQ(-0.991954322),
-    FQ(-0.991905700),FQ(-0.991856933),FQ(-0.991808019),FQ(-0.991758959),FQ(-0.991709754),
-    FQ(-0.991660402),FQ(-0.991610905),FQ(-0.991561262),FQ(-0.991511473),FQ(-0.991461539),
-    FQ(-0.991411458),FQ(-0.991361232),FQ(-0.991310860),FQ(-0.991260342),FQ(-0.991209678),
-    FQ(-0.991158869),FQ(-0.991107914),FQ(-0.991056813),FQ(-0.991005566),FQ(-0.990954174),
-    FQ(-0.990902635),FQ(-0.990850952),FQ(-0.990799122),FQ(-0.990747147),FQ(-0.990695025),
-    FQ(-0.990642759),FQ(-0.990590346),FQ(-0.990537788),FQ(-0.990485084),FQ(-0.990432235),
-    FQ(-0.990379240),FQ(-0.990326099),FQ(-0.990272812),FQ(-0.990219380),FQ(-0.990165803),
-    FQ(-0.990112079),FQ(-0.990058210),FQ(-0.990004196),FQ(-0.989950036),FQ(-0.989895730),
-    FQ(-0.989841278),FQ(-0.989786682),FQ(-0.989731939),FQ(-0.989677051),FQ(-0.989622017),
-    FQ(-0.989566838),FQ(-0.989511514),FQ(-0.989456043),FQ(-0.989400428),FQ(-0.989344667),
-    FQ(-0.989288760),FQ(-0.989232708),FQ(-0.989176510),FQ(-0.989120167),FQ(-0.989063678),
-    FQ(-0.989007044),FQ(-0.988950265),FQ(-0.988893340),FQ(-0.988836269),FQ(-0.988779053),
-    FQ(-0.988721692),FQ(-0.988664185),FQ(-0.988606533),FQ(-0.988548736),FQ(-0.988490793),
-    FQ(-0.988432705),FQ(-0.988374471),FQ(-0.988316092),FQ(-0.988257568),FQ(-0.988198898),
-    FQ(-0.988140083),FQ(-0.988081123),FQ(-0.988022017),FQ(-0.987962766),FQ(-0.987903370),
-    FQ(-0.987843828),FQ(-0.987784142),FQ(-0.987724310),FQ(-0.987664332),FQ(-0.987604210),
-    FQ(-0.987543942),FQ(-0.987483529),FQ(-0.987422970),FQ(-0.987362267),FQ(-0.987301418),
-    FQ(-0.987240424),FQ(-0.987179285),FQ(-0.987118001),FQ(-0.987056571),FQ(-0.986994997),
-    FQ(-0.986933277),FQ(-0.986871412),FQ(-0.986809402),FQ(-0.986747247),FQ(-0.986684946),
-    FQ(-0.986622501),FQ(-0.986559910),FQ(-0.986497175),FQ(-0.986434294),FQ(-0.986371268),
-    FQ(-0.986308097),FQ(-0.986244781),FQ(-0.986181320),FQ(-0.986117714),FQ(-0.986053963),
-    FQ(-0.985990067),FQ(-0.985926026),FQ(-0.985861840),FQ(-0.985797509),FQ(-0.985733033),
-    FQ(-0.985668412),FQ(-0.985603646),FQ(-0.985538735),FQ(-0.985473679),FQ(-0.985408479),
-    FQ(-0.985343133),FQ(-0.985277642),FQ(-0.985212007),FQ(-0.985146226),FQ(-0.985080301),
-    FQ(-0.985014231),FQ(-0.984948016),FQ(-0.984881656),FQ(-0.984815151),FQ(-0.984748502),
-    FQ(-0.984681707),FQ(-0.984614768),FQ(-0.984547684),FQ(-0.984480455),FQ(-0.984413082),
-    FQ(-0.984345563),FQ(-0.984277900),FQ(-0.984210092),FQ(-0.984142140),FQ(-0.984074042),
-    FQ(-0.984005800),FQ(-0.983937413),FQ(-0.983868882),FQ(-0.983800206),FQ(-0.983731385),
-    FQ(-0.983662419),FQ(-0.983593309),FQ(-0.983524054),FQ(-0.983454655),FQ(-0.983385110),
-    FQ(-0.983315422),FQ(-0.983245588),FQ(-0.983175610),FQ(-0.983105487),FQ(-0.983035220),
-    FQ(-0.982964808),FQ(-0.982894252),FQ(-0.982823551),FQ(-0.982752706),FQ(-0.982681716),
-    FQ(-0.982610581),FQ(-0.982539302),FQ(-0.982467879),FQ(-0.982396311),FQ(-0.982324598),
-    FQ(-0.982252741),FQ(-0.982180740),FQ(-0.982108594),FQ(-0.982036304),FQ(-0.981963869),
-    FQ(-0.981891290),FQ(-0.981818566),FQ(-0.981745699),FQ(-0.981672686),FQ(-0.981599530),
-    FQ(-0.981526228),FQ(-0.981452783),FQ(-0.981379193),FQ(-0.981305459),FQ(-0.981231581),
-    FQ(-0.981157558),FQ(-0.981083391),FQ(-0.981009080),FQ(-0.980934624),FQ(-0.980860024),
-    FQ(-0.980785280),FQ(-0.980710392),FQ(-0.980635360),FQ(-0.980560183),FQ(-0.980484862),
-    FQ(-0.980409397),FQ(-0.980333787),FQ(-0.980258034),FQ(-0.980182136),FQ(-0.980106094),
-    FQ(-0.980029908),FQ(-0.979953578),FQ(-0.979877104),FQ(-0.979800485),FQ(-0.979723723),
-    FQ(-0.979646816),FQ(-0.979569766),FQ(-0.979492571),FQ(-0.979415232),FQ(-0.979337749),
-    FQ(-0.979260123),FQ(-0.979182352),FQ(-0.979104437),FQ(-0.979026378),FQ(-0.978948175),
-    FQ(-0.978869829),FQ(-0.978791338),FQ(-0.978712703),FQ(-0.978633924),FQ(-0.978555002),
-    FQ(-0.978475935),FQ(-0.978396725),FQ(-0.978317371),FQ(-0.978237873),FQ(-0.978158231),
-    FQ(-0.978078445),FQ(-0.977998515),FQ(-0.977918441),FQ(-0.977838224),FQ(-0.977757863),
-    FQ(-0.977677358),FQ(-0.977596709),FQ(-0.977515917),FQ(-0.977434980),FQ(-0.977353900),
-    FQ(-0.977272676),FQ(-0.977191309),FQ(-0.977109798),FQ(-0.977028143),FQ(-0.976946344),
-    FQ(-0.976864402),FQ(-0.976782316),FQ(-0.976700086),FQ(-0.976617713),FQ(-0.976535196),
-    FQ(-0.976452535),FQ(-0.976369731),FQ(-0.976286784),FQ(-0.976203692),FQ(-0.976120457),
-    FQ(-0.976037079),FQ(-0.975953557),FQ(-0.975869892),FQ(-0.975786083),FQ(-0.975702130),
-    FQ(-0.975618034),FQ(-0.975533795),FQ(-0.975449412),FQ(-0.975364885),FQ(-0.975280215),
-    FQ(-0.975195402),FQ(-0.975110445),FQ(-0.975025345),FQ(-0.974940102),FQ(-0.974854715),
-    FQ(-0.974769184),FQ(-0.974683511),FQ(-0.974597694),FQ(-0.974511733),FQ(-0.974425630),
-    FQ(-0.974339383),FQ(-0.974252993),FQ(-0.974166459),FQ(-0.974079782),FQ(-0.973992962),
-    FQ(-0.973905999),FQ(-0.973818892),FQ(-0.973731643),FQ(-0.973644250),FQ(-0.973556714),
-    FQ(-0.973469034),FQ(-0.973381212),FQ(-0.973293246),FQ(-0.973205137),FQ(-0.973116885),
-    FQ(-0.973028490),FQ(-0.972939952),FQ(-0.972851271),FQ(-0.972762447),FQ(-0.972673479),
-    FQ(-0.972584369),FQ(-0.972495115),FQ(-0.972405719),FQ(-0.972316180),FQ(-0.972226497),
-    FQ(-0.972136672),FQ(-0.972046703),FQ(-0.971956592),FQ(-0.971866337),FQ(-0.971775940),
-    FQ(-0.971685400),FQ(-0.971594717),FQ(-0.971503891),FQ(-0.971412922),FQ(-0.971321810),
-    FQ(-0.971230556),FQ(-0.971139158),FQ(-0.971047618),FQ(-0.970955935),FQ(-0.970864109),
-    FQ(-0.970772141),FQ(-0.970680029),FQ(-0.970587775),FQ(-0.970495378),FQ(-0.970402839),
-    FQ(-0.970310156),FQ(-0.970217331),FQ(-0.970124364),FQ(-0.970031253),FQ(-0.969938000),
-    FQ(-0.969844604),FQ(-0.969751066),FQ(-0.969657385),FQ(-0.969563562),FQ(-0.969469595),
-    FQ(-0.969375487),FQ(-0.969281235),FQ(-0.969186842),FQ(-0.969092305),FQ(-0.968997626),
-    FQ(-0.968902805),FQ(-0.968807841),FQ(-0.968712734),FQ(-0.968617486),FQ(-0.968522094),
-    FQ(-0.968426561),FQ(-0.968330884),FQ(-0.968235066),FQ(-0.968139105),FQ(-0.968043001),
-    FQ(-0.967946756),FQ(-0.967850368),FQ(-0.967753837),FQ(-0.967657164),FQ(-0.967560349),
-    FQ(-0.967463392),FQ(-0.967366292),FQ(-0.967269050),FQ(-0.967171666),FQ(-0.967074140),
-    FQ(-0.966976471),FQ(-0.966878660),FQ(-0.966780707),FQ(-0.966682612),FQ(-0.966584374),
-    FQ(-0.966485995),FQ(-0.966387473),FQ(-0.966288809),FQ(-0.966190003),FQ(-0.966091055),
-    FQ(-0.965991965),FQ(-0.965892733),FQ(-0.965793359),FQ(-0.965693843),FQ(-0.965594184),
-    FQ(-0.965494384),FQ(-0.965394442),FQ(-0.965294357),FQ(-0.965194131),FQ(-0.965093763),
-    FQ(-0.964993253),FQ(-0.964892601),FQ(-0.964791807),FQ(-0.964690871),FQ(-0.964589793),
-    FQ(-0.964488574),FQ(-0.964387212),FQ(-0.964285709),FQ(-0.964184064),FQ(-0.964082277),
-    FQ(-0.963980348),FQ(-0.963878278),FQ(-0.963776066),FQ(-0.963673712),FQ(-0.963571216),
-    FQ(-0.963468579),FQ(-0.963365800),FQ(-0.963262879),FQ(-0.963159817),FQ(-0.963056613),
-    FQ(-0.962953267),FQ(-0.962849780),FQ(-0.962746151),FQ(-0.962642380),FQ(-0.962538468),
-    FQ(-0.962434414),FQ(-0.962330219),FQ(-0.962225882),FQ(-0.962121404),FQ(-0.962016785),
-    FQ(-0.961912023),FQ(-0.961807121),FQ(-0.961702077),FQ(-0.961596891),FQ(-0.961491564),
-    FQ(-0.961386096),FQ(-0.961280486),FQ(-0.961174735),FQ(-0.961068842),FQ(-0.960962808),
-    FQ(-0.960856633),FQ(-0.960750317),FQ(-0.960643859),FQ(-0.960537260),FQ(-0.960430519),
-    FQ(-0.960323638),FQ(-0.960216615),FQ(-0.960109451),FQ(-0.960002146),FQ(-0.959894699),
-    FQ(-0.959787112),FQ(-0.959679383),FQ(-0.959571513),FQ(-0.959463502),FQ(-0.959355350),
-    FQ(-0.959247057),FQ(-0.959138622),FQ(-0.959030047),FQ(-0.958921331),FQ(-0.958812473),
-    FQ(-0.958703475),FQ(-0.958594335),FQ(-0.958485055),FQ(-0.958375634),FQ(-0.958266071),
-    FQ(-0.958156368),FQ(-0.958046524),FQ(-0.957936539),FQ(-0.957826413),FQ(-0.957716146),
-    FQ(-0.957605739),FQ(-0.957495190),FQ(-0.957384501),FQ(-0.957273671),FQ(-0.957162700),
-    FQ(-0.957051588),FQ(-0.956940336),FQ(-0.956828943),FQ(-0.956717409),FQ(-0.956605734),
-    FQ(-0.956493919),FQ(-0.956381963),FQ(-0.956269866),FQ(-0.956157629),FQ(-0.956045251),
-    FQ(-0.955932733),FQ(-0.955820074),FQ(-0.955707274),FQ(-0.955594334),FQ(-0.955481253),
-    FQ(-0.955368032),FQ(-0.955254671),FQ(-0.955141168),FQ(-0.955027526),FQ(-0.954913742),
-    FQ(-0.954799819),FQ(-0.954685755),FQ(-0.954571551),FQ(-0.954457206),FQ(-0.954342721),
-    FQ(-0.954228095),FQ(-0.954113329),FQ(-0.953998423),FQ(-0.953883377),FQ(-0.953768190),
-    FQ(-0.953652863),FQ(-0.953537396),FQ(-0.953421788),FQ(-0.953306040),FQ(-0.953190152),
-    FQ(-0.953074124),FQ(-0.952957956),FQ(-0.952841648),FQ(-0.952725199),FQ(-0.952608610),
-    FQ(-0.952491882),FQ(-0.952375013),FQ(-0.952258004),FQ(-0.952140855),FQ(-0.952023566),
-    FQ(-0.951906137),FQ(-0.951788568),FQ(-0.951670859),FQ(-0.951553010),FQ(-0.951435021),
-    FQ(-0.951316892),FQ(-0.951198623),FQ(-0.951080215),FQ(-0.950961666),FQ(-0.950842978),
-    FQ(-0.950724150),FQ(-0.950605182),FQ(-0.950486074),FQ(-0.950366826),FQ(-0.950247439),
-    FQ(-0.950127912),FQ(-0.950008245),FQ(-0.949888438),FQ(-0.949768492),FQ(-0.949648406),
-    FQ(-0.949528181),FQ(-0.949407815),FQ(-0.949287310),FQ(-0.949166666),FQ(-0.949045882),
-    FQ(-0.948924958),FQ(-0.948803895),FQ(-0.948682692),FQ(-0.948561350),FQ(-0.948439868),
-    FQ(-0.948318247),FQ(-0.948196486),FQ(-0.948074586),FQ(-0.947952546),FQ(-0.947830367),
-    FQ(-0.947708049),FQ(-0.947585591),FQ(-0.947462994),FQ(-0.947340257),FQ(-0.947217381),
-    FQ(-0.947094366),FQ(-0.946971212),FQ(-0.946847918),FQ(-0.946724485),FQ(-0.946600913),
-    FQ(-0.946477202),FQ(-0.946353351),FQ(-0.946229361),FQ(-0.946105232),FQ(-0.945980964),
-    FQ(-0.945856557),FQ(-0.945732011),FQ(-0.945607325),FQ(-0.945482501),FQ(-0.945357537),
-    FQ(-0.945232435),FQ(-0.945107193),FQ(-0.944981813),FQ(-0.944856293),FQ(-0.944730635),
-    FQ(-0.944604837),FQ(-0.944478901),FQ(-0.944352826),FQ(-0.944226612),FQ(-0.944100258),
-    FQ(-0.943973767),FQ(-0.943847136),FQ(-0.943720366),FQ(-0.943593458),FQ(-0.943466411),
-    FQ(-0.943339225),FQ(-0.943211901),FQ(-0.943084437),FQ(-0.942956836),FQ(-0.942829095),
-    FQ(-0.942701216),FQ(-0.942573198),FQ(-0.942445041),FQ(-0.942316746),FQ(-0.942188312),
-    FQ(-0.942059740),FQ(-0.941931029),FQ(-0.941802179),FQ(-0.941673192),FQ(-0.941544065),
-    FQ(-0.941414800),FQ(-0.941285397),FQ(-0.941155855),FQ(-0.941026175),FQ(-0.940896356),
-    FQ(-0.940766400),FQ(-0.940636304),FQ(-0.940506071),FQ(-0.940375699),FQ(-0.940245188),
-    FQ(-0.940114540),FQ(-0.939983753),FQ(-0.939852828),FQ(-0.939721765),FQ(-0.939590563),
-    FQ(-0.939459224),FQ(-0.939327746),FQ(-0.939196130),FQ(-0.939064376),FQ(-0.938932484),
-    FQ(-0.938800453),FQ(-0.938668285),FQ(-0.938535978),FQ(-0.938403534),FQ(-0.938270952),
-    FQ(-0.938138231),FQ(-0.938005373),FQ(-0.937872376),FQ(-0.937739242),FQ(-0.937605970),
-    FQ(-0.937472560),FQ(-0.937339012),FQ(-0.937205326),FQ(-0.937071502),FQ(-0.936937541),
-    FQ(-0.936803442),FQ(-0.936669205),FQ(-0.936534830),FQ(-0.936400317),FQ(-0.936265667),
-    FQ(-0.936130879),FQ(-0.935995954),FQ(-0.935860890),FQ(-0.935725689),FQ(-0.935590351),
-    FQ(-0.935454875),FQ(-0.935319261),FQ(-0.935183510),FQ(-0.935047621),FQ(-0.934911595),
-    FQ(-0.934775431),FQ(-0.934639130),FQ(-0.934502691),FQ(-0.934366115),FQ(-0.934229401),
-    FQ(-0.934092550),FQ(-0.933955562),FQ(-0.933818436),FQ(-0.933681173),FQ(-0.933543773),
-    FQ(-0.933406235),FQ(-0.933268560),FQ(-0.933130748),FQ(-0.932992799),FQ(-0.932854712),
-    FQ(-0.932716488),FQ(-0.932578127),FQ(-0.932439629),FQ(-0.932300994),FQ(-0.932162222),
-    FQ(-0.932023312),FQ(-0.931884266),FQ(-0.931745082),FQ(-0.931605761),FQ(-0.931466304),
-    FQ(-0.931326709),FQ(-0.931186977),FQ(-0.931047109),FQ(-0.930907103),FQ(-0.930766961),
-    FQ(-0.930626682),FQ(-0.930486266),FQ(-0.930345713),FQ(-0.930205023),FQ(-0.930064196),
-    FQ(-0.929923233),FQ(-0.929782133),FQ(-0.929640896),FQ(-0.929499522),FQ(-0.929358012),
-    FQ(-0.929216365),FQ(-0.929074581),FQ(-0.928932661),FQ(-0.928790604),FQ(-0.928648411),
-    FQ(-0.928506080),FQ(-0.928363614),FQ(-0.928221011),FQ(-0.928078271),FQ(-0.927935395),
-    FQ(-0.927792382),FQ(-0.927649233),FQ(-0.927505948),FQ(-0.927362526),FQ(-0.927218967),
-    FQ(-0.927075273),FQ(-0.926931442),FQ(-0.926787474),FQ(-0.926643371),FQ(-0.926499131),
-    FQ(-0.926354755),FQ(-0.926210242),FQ(-0.926065594),FQ(-0.925920809),FQ(-0.925775888),
-    FQ(-0.925630831),FQ(-0.925485637),FQ(-0.925340308),FQ(-0.925194842),FQ(-0.925049241),
-    FQ(-0.924903503),FQ(-0.924757630),FQ(-0.924611620),FQ(-0.924465474),FQ(-0.924319193),
-    FQ(-0.924172775),FQ(-0.924026222),FQ(-0.923879533),FQ(-0.923732707),FQ(-0.923585746),
-    FQ(-0.923438649),FQ(-0.923291417),FQ(-0.923144048),FQ(-0.922996544),FQ(-0.922848904),
-    FQ(-0.922701128),FQ(-0.922553217),FQ(-0.922405170),FQ(-0.922256987),FQ(-0.922108669),
-    FQ(-0.921960215),FQ(-0.921811625),FQ(-0.921662900),FQ(-0.921514039),FQ(-0.921365043),
-    FQ(-0.921215911),FQ(-0.921066644),FQ(-0.920917242),FQ(-0.920767703),FQ(-0.920618030),
-    FQ(-0.920468221),FQ(-0.920318277),FQ(-0.920168197),FQ(-0.920017982),FQ(-0.919867632),
-    FQ(-0.919717146),FQ(-0.919566525),FQ(-0.919415769),FQ(-0.919264878),FQ(-0.919113852),
-    FQ(-0.918962690),FQ(-0.918811393),FQ(-0.918659961),FQ(-0.918508394),FQ(-0.918356692),
-    FQ(-0.918204855),FQ(-0.918052883),FQ(-0.917900776),FQ(-0.917748533),FQ(-0.917596156),
-    FQ(-0.917443644),FQ(-0.917290997),FQ(-0.917138215),FQ(-0.916985298),FQ(-0.916832246),
-    FQ(-0.916679060),FQ(-0.916525739),FQ(-0.916372282),FQ(-0.916218691),FQ(-0.916064966),
-    FQ(-0.915911105),FQ(-0.915757110),FQ(-0.915602981),FQ(-0.915448716),FQ(-0.915294317),
-    FQ(-0.915139783),FQ(-0.914985115),FQ(-0.914830312),FQ(-0.914675375),FQ(-0.914520303),
-    FQ(-0.914365097),FQ(-0.914209756),FQ(-0.914054280),FQ(-0.913898671),FQ(-0.913742926),
-    FQ(-0.913587048),FQ(-0.913431035),FQ(-0.913274888),FQ(-0.913118606),FQ(-0.912962190),
-    FQ(-0.912805640),FQ(-0.912648956),FQ(-0.912492137),FQ(-0.912335185),FQ(-0.912178098),
-    FQ(-0.912020877),FQ(-0.911863521),FQ(-0.911706032),FQ(-0.911548409),FQ(-0.911390651),
-    FQ(-0.911232760),FQ(-0.911074734),FQ(-0.910916575),FQ(-0.910758281),FQ(-0.910599854),
-    FQ(-0.910441292),FQ(-0.910282597),FQ(-0.910123768),FQ(-0.909964805),FQ(-0.909805708),
-    FQ(-0.909646477),FQ(-0.909487113),FQ(-0.909327615),FQ(-0.909167983),FQ(-0.909008218),
-    FQ(-0.908848318),FQ(-0.908688285),FQ(-0.908528119),FQ(-0.908367819),FQ(-0.908207385),
-    FQ(-0.908046817),FQ(-0.907886116),FQ(-0.907725282),FQ(-0.907564314),FQ(-0.907403213),
-    FQ(-0.907241978),FQ(-0.907080610),FQ(-0.906919108),FQ(-0.906757473),FQ(-0.906595705),
-    FQ(-0.906433803),FQ(-0.906271768),FQ(-0.906109599),FQ(-0.905947298),FQ(-0.905784863),
-    FQ(-0.905622295),FQ(-0.905459594),FQ(-0.905296759),FQ(-0.905133792),FQ(-0.904970691),
-    FQ(-0.904807457),FQ(-0.904644091),FQ(-0.904480591),FQ(-0.904316958),FQ(-0.904153192),
-    FQ(-0.903989293),FQ(-0.903825261),FQ(-0.903661097),FQ(-0.903496799),FQ(-0.903332368),
-    FQ(-0.903167805),FQ(-0.903003109),FQ(-0.902838280),FQ(-0.902673318),FQ(-0.902508224),
-    FQ(-0.902342996),FQ(-0.902177637),FQ(-0.902012144),FQ(-0.901846519),FQ(-0.901680761),
-    FQ(-0.901514870),FQ(-0.901348847),FQ(-0.901182691),FQ(-0.901016403),FQ(-0.900849982),
-    FQ(-0.900683429),FQ(-0.900516744),FQ(-0.900349925),FQ(-0.900182975),FQ(-0.900015892),
-    FQ(-0.899848677),FQ(-0.899681329),FQ(-0.899513849),FQ(-0.899346237),FQ(-0.899178492),
-    FQ(-0.899010616),FQ(-0.898842607),FQ(-0.898674466),FQ(-0.898506192),FQ(-0.898337787),
-    FQ(-0.898169249),FQ(-0.898000580),FQ(-0.897831778),FQ(-0.897662844),FQ(-0.897493778),
-    FQ(-0.897324581),FQ(-0.897155251),FQ(-0.896985789),FQ(-0.896816196),FQ(-0.896646470),
-    FQ(-0.896476613),FQ(-0.896306624),FQ(-0.896136503),FQ(-0.895966250),FQ(-0.895795865),
-    FQ(-0.895625349),FQ(-0.895454701),FQ(-0.895283921),FQ(-0.895113010),FQ(-0.894941967),
-    FQ(-0.894770792),FQ(-0.894599486),FQ(-0.894428048),FQ(-0.894256478),FQ(-0.894084778),
-    FQ(-0.893912945),FQ(-0.893740981),FQ(-0.893568886),FQ(-0.893396659),FQ(-0.893224301),
-    FQ(-0.893051812),FQ(-0.892879191),FQ(-0.892706439),FQ(-0.892533555),FQ(-0.892360541),
-    FQ(-0.892187395),FQ(-0.892014118),FQ(-0.891840709),FQ(-0.891667170),FQ(-0.891493499),
-    FQ(-0.891319698),FQ(-0.891145765),FQ(-0.890971701),FQ(-0.890797506),FQ(-0.890623180),
-    FQ(-0.890448723),FQ(-0.890274135),FQ(-0.890099417),FQ(-0.889924567),FQ(-0.889749586),
-    FQ(-0.889574475),FQ(-0.889399233),FQ(-0.889223860),FQ(-0.889048356),FQ(-0.888872721),
-    FQ(-0.888696956),FQ(-0.888521060),FQ(-0.888345033),FQ(-0.888168876),FQ(-0.887992588),
-    FQ(-0.887816170),FQ(-0.887639620),FQ(-0.887462941),FQ(-0.887286131),FQ(-0.887109190),
-    FQ(-0.886932119),FQ(-0.886754917),FQ(-0.886577585),FQ(-0.886400123),FQ(-0.886222530),
-    FQ(-0.886044807),FQ(-0.885866954),FQ(-0.885688970),FQ(-0.885510856),FQ(-0.885332612),
-    FQ(-0.885154238),FQ(-0.884975733),FQ(-0.884797098),FQ(-0.884618334),FQ(-0.884439439),
-    FQ(-0.884260414),FQ(-0.884081259),FQ(-0.883901974),FQ(-0.883722559),FQ(-0.883543014),
-    FQ(-0.883363339),FQ(-0.883183534),FQ(-0.883003599),FQ(-0.882823534),FQ(-0.882643340),
-    FQ(-0.882463016),FQ(-0.882282562),FQ(-0.882101978),FQ(-0.881921264),FQ(-0.881740421),
-    FQ(-0.881559448),FQ(-0.881378346),FQ(-0.881197113),FQ(-0.881015752),FQ(-0.880834260),
-    FQ(-0.880652639),FQ(-0.880470889),FQ(-0.880289009),FQ(-0.880107000),FQ(-0.879924861),
-    FQ(-0.879742593),FQ(-0.879560195),FQ(-0.879377668),FQ(-0.879195012),FQ(-0.879012226),
-    FQ(-0.878829312),FQ(-0.878646267),FQ(-0.878463094),FQ(-0.878279792),FQ(-0.878096360),
-    FQ(-0.877912799),FQ(-0.877729109),FQ(-0.877545290),FQ(-0.877361342),FQ(-0.877177265),
-    FQ(-0.876993059),FQ(-0.876808724),FQ(-0.876624260),FQ(-0.876439667),FQ(-0.876254945),
-    FQ(-0.876070094),FQ(-0.875885115),FQ(-0.875700006),FQ(-0.875514769),FQ(-0.875329403),
-    FQ(-0.875143908),FQ(-0.874958285),FQ(-0.874772533),FQ(-0.874586652),FQ(-0.874400643),
-    FQ(-0.874214505),FQ(-0.874028239),FQ(-0.873841843),FQ(-0.873655320),FQ(-0.873468668),
-    FQ(-0.873281887),FQ(-0.873094978),FQ(-0.872907941),FQ(-0.872720775),FQ(-0.872533481),
-    FQ(-0.872346059),FQ(-0.872158508),FQ(-0.871970829),FQ(-0.871783022),FQ(-0.871595087),
-    FQ(-0.871407023),FQ(-0.871218831),FQ(-0.871030511),FQ(-0.870842063),FQ(-0.870653487),
-    FQ(-0.870464783),FQ(-0.870275951),FQ(-0.870086991),FQ(-0.869897903),FQ(-0.869708687),
-    FQ(-0.869519343),FQ(-0.869329871),FQ(-0.869140272),FQ(-0.868950544),FQ(-0.868760689),
-    FQ(-0.868570706),FQ(-0.868380595),FQ(-0.868190357),FQ(-0.867999991),FQ(-0.867809497),
-    FQ(-0.867618875),FQ(-0.867428126),FQ(-0.867237250),FQ(-0.867046246),FQ(-0.866855114),
-    FQ(-0.866663855),FQ(-0.866472468),FQ(-0.866280954),FQ(-0.866089313),FQ(-0.865897544),
-    FQ(-0.865705648),FQ(-0.865513624),FQ(-0.865321473),FQ(-0.865129195),FQ(-0.864936790),
-    FQ(-0.864744258),FQ(-0.864551598),FQ(-0.864358811),FQ(-0.864165897),FQ(-0.863972856),
-    FQ(-0.863779688),FQ(-0.863586393),FQ(-0.863392971),FQ(-0.863199422),FQ(-0.863005746),
-    FQ(-0.862811943),FQ(-0.862618013),FQ(-0.862423956),FQ(-0.862229773),FQ(-0.862035462),
-    FQ(-0.861841025),FQ(-0.861646461),FQ(-0.861451771),FQ(-0.861256953),FQ(-0.861062009),
-    FQ(-0.860866939),FQ(-0.860671741),FQ(-0.860476418),FQ(-0.860280967),FQ(-0.860085390),
-    FQ(-0.859889687),FQ(-0.859693857),FQ(-0.859497901),FQ(-0.859301818),FQ(-0.859105609),
-    FQ(-0.858909274),FQ(-0.858712812),FQ(-0.858516224),FQ(-0.858319510),FQ(-0.858122670),
-    FQ(-0.857925703),FQ(-0.857728610),FQ(-0.857531391),FQ(-0.857334046),FQ(-0.857136575),
-    FQ(-0.856938977),FQ(-0.856741254),FQ(-0.856543405),FQ(-0.856345430),FQ(-0.856147328),
-    FQ(-0.855949101),FQ(-0.855750748),FQ(-0.855552269),FQ(-0.855353665),FQ(-0.855154934),
-    FQ(-0.854956078),FQ(-0.854757096),FQ(-0.854557988),FQ(-0.854358755),FQ(-0.854159396),
-    FQ(-0.853959911),FQ(-0.853760301),FQ(-0.853560565),FQ(-0.853360704),FQ(-0.853160717),
-    FQ(-0.852960605),FQ(-0.852760367),FQ(-0.852560004),FQ(-0.852359516),FQ(-0.852158902),
-    FQ(-0.851958162),FQ(-0.851757298),FQ(-0.851556308),FQ(-0.851355193),FQ(-0.851153953),
-    FQ(-0.850952587),FQ(-0.850751097),FQ(-0.850549481),FQ(-0.850347741),FQ(-0.850145875),
-    FQ(-0.849943884),FQ(-0.849741768),FQ(-0.849539527),FQ(-0.849337161),FQ(-0.849134671),
-    FQ(-0.848932055),FQ(-0.848729315),FQ(-0.848526450),FQ(-0.848323460),FQ(-0.848120345),
-    FQ(-0.847917105),FQ(-0.847713741),FQ(-0.847510252),FQ(-0.847306639),FQ(-0.847102901),
-    FQ(-0.846899038),FQ(-0.846695051),FQ(-0.846490939),FQ(-0.846286702),FQ(-0.846082342),
-    FQ(-0.845877857),FQ(-0.845673247),FQ(-0.845468513),FQ(-0.845263655),FQ(-0.845058672),
-    FQ(-0.844853565),FQ(-0.844648334),FQ(-0.844442979),FQ(-0.844237499),FQ(-0.844031895),
-    FQ(-0.843826168),FQ(-0.843620316),FQ(-0.843414340),FQ(-0.843208240),FQ(-0.843002016),
-    FQ(-0.842795668),FQ(-0.842589196),FQ(-0.842382600),FQ(-0.842175880),FQ(-0.841969036),
-    FQ(-0.841762069),FQ(-0.841554977),FQ(-0.841347762),FQ(-0.841140424),FQ(-0.840932961),
-    FQ(-0.840725375),FQ(-0.840517665),FQ(-0.840309832),FQ(-0.840101875),FQ(-0.839893794),
-    FQ(-0.839685590),FQ(-0.839477263),FQ(-0.839268812),FQ(-0.839060237),FQ(-0.838851539),
-    FQ(-0.838642718),FQ(-0.838433773),FQ(-0.838224706),FQ(-0.838015514),FQ(-0.837806200),
-    FQ(-0.837596762),FQ(-0.837387202),FQ(-0.837177518),FQ(-0.836967711),FQ(-0.836757780),
-    FQ(-0.836547727),FQ(-0.836337551),FQ(-0.836127252),FQ(-0.835916830),FQ(-0.835706284),
-    FQ(-0.835495616),FQ(-0.835284825),FQ(-0.835073912),FQ(-0.834862875),FQ(-0.834651716),
-    FQ(-0.834440433),FQ(-0.834229029),FQ(-0.834017501),FQ(-0.833805851),FQ(-0.833594078),
-    FQ(-0.833382183),FQ(-0.833170165),FQ(-0.832958024),FQ(-0.832745761),FQ(-0.832533376),
-    FQ(-0.832320868),FQ(-0.832108237),FQ(-0.831895485),FQ(-0.831682610),FQ(-0.831469612),
-    FQ(-0.831256493),FQ(-0.831043251),FQ(-0.830829887),FQ(-0.830616400),FQ(-0.830402792),
-    FQ(-0.830189061),FQ(-0.829975209),FQ(-0.829761234),FQ(-0.829547137),FQ(-0.829332918),
-    FQ(-0.829118577),FQ(-0.828904115),FQ(-0.828689530),FQ(-0.828474824),FQ(-0.828259995),
-    FQ(-0.828045045),FQ(-0.827829973),FQ(-0.827614780),FQ(-0.827399464),FQ(-0.827184027),
-    FQ(-0.826968469),FQ(-0.826752788),FQ(-0.826536986),FQ(-0.826321063),FQ(-0.826105018),
-    FQ(-0.825888851),FQ(-0.825672563),FQ(-0.825456154),FQ(-0.825239623),FQ(-0.825022971),
-    FQ(-0.824806198),FQ(-0.824589303),FQ(-0.824372287),FQ(-0.824155149),FQ(-0.823937891),
-    FQ(-0.823720511),FQ(-0.823503010),FQ(-0.823285388),FQ(-0.823067645),FQ(-0.822849781),
-    FQ(-0.822631796),FQ(-0.822413690),FQ(-0.822195463),FQ(-0.821977115),FQ(-0.821758646),
-    FQ(-0.821540057),FQ(-0.821321346),FQ(-0.821102515),FQ(-0.820883563),FQ(-0.820664490),
-    FQ(-0.820445297),FQ(-0.820225983),FQ(-0.820006548),FQ(-0.819786992),FQ(-0.819567317),
-    FQ(-0.819347520),FQ(-0.819127603),FQ(-0.818907566),FQ(-0.818687408),FQ(-0.818467130),
-    FQ(-0.818246731),FQ(-0.818026212),FQ(-0.817805573),FQ(-0.817584813),FQ(-0.817363933),
-    FQ(-0.817142933),FQ(-0.816921813),FQ(-0.816700573),FQ(-0.816479212),FQ(-0.816257732),
-    FQ(-0.816036131),FQ(-0.815814411),FQ(-0.815592570),FQ(-0.815370610),FQ(-0.815148529),
-    FQ(-0.814926329),FQ(-0.814704009),FQ(-0.814481569),FQ(-0.814259009),FQ(-0.814036330),
-    FQ(-0.813813530),FQ(-0.813590612),FQ(-0.813367573),FQ(-0.813144415),FQ(-0.812921137),
-    FQ(-0.812697740),FQ(-0.812474223),FQ(-0.812250587),FQ(-0.812026831),FQ(-0.811802956),
-    FQ(-0.811578961),FQ(-0.811354847),FQ(-0.811130614),FQ(-0.810906261),FQ(-0.810681789),
-    FQ(-0.810457198),FQ(-0.810232488),FQ(-0.810007659),FQ(-0.809782710),FQ(-0.809557642),
-    FQ(-0.809332456),FQ(-0.809107150),FQ(-0.808881725),FQ(-0.808656182),FQ(-0.808430519),
-    FQ(-0.808204737),FQ(-0.807978837),FQ(-0.807752818),FQ(-0.807526680),FQ(-0.807300423),
-    FQ(-0.807074048),FQ(-0.806847554),FQ(-0.806620941),FQ(-0.806394209),FQ(-0.806167359),
-    FQ(-0.805940391),FQ(-0.805713303),FQ(-0.805486098),FQ(-0.805258774),FQ(-0.805031331),
-    FQ(-0.804803770),FQ(-0.804576091),FQ(-0.804348293),FQ(-0.804120377),FQ(-0.803892343),
-    FQ(-0.803664191),FQ(-0.803435920),FQ(-0.803207531),FQ(-0.802979025),FQ(-0.802750400),
-    FQ(-0.802521657),FQ(-0.802292796),FQ(-0.802063816),FQ(-0.801834719),FQ(-0.801605505),
-    FQ(-0.801376172),FQ(-0.801146721),FQ(-0.800917153),FQ(-0.800687466),FQ(-0.800457662),
-    FQ(-0.800227740),FQ(-0.799997701),FQ(-0.799767544),FQ(-0.799537269),FQ(-0.799306877),
-    FQ(-0.799076367),FQ(-0.798845740),FQ(-0.798614995),FQ(-0.798384132),FQ(-0.798153153),
-    FQ(-0.797922055),FQ(-0.797690841),FQ(-0.797459509),FQ(-0.797228060),FQ(-0.796996494),
-    FQ(-0.796764810),FQ(-0.796533009),FQ(-0.796301092),FQ(-0.796069057),FQ(-0.795836905),
-    FQ(-0.795604636),FQ(-0.795372249),FQ(-0.795139746),FQ(-0.794907126),FQ(-0.794674389),
-    FQ(-0.794441536),FQ(-0.794208565),FQ(-0.793975478),FQ(-0.793742273),FQ(-0.793508952),
-    FQ(-0.793275515),FQ(-0.793041960),FQ(-0.792808290),FQ(-0.792574502),FQ(-0.792340598),
-    FQ(-0.792106577),FQ(-0.791872440),FQ(-0.791638187),FQ(-0.791403817),FQ(-0.791169330),
-    FQ(-0.790934727),FQ(-0.790700008),FQ(-0.790465173),FQ(-0.790230221),FQ(-0.789995154),
-    FQ(-0.789759970),FQ(-0.789524669),FQ(-0.789289253),FQ(-0.789053721),FQ(-0.788818072),
-    FQ(-0.788582308),FQ(-0.788346428),FQ(-0.788110431),FQ(-0.787874319),FQ(-0.787638091),
-    FQ(-0.787401747),FQ(-0.787165287),FQ(-0.786928712),FQ(-0.786692021),FQ(-0.786455214),
-    FQ(-0.786218291),FQ(-0.785981253),FQ(-0.785744099),FQ(-0.785506830),FQ(-0.785269445),
-    FQ(-0.785031944),FQ(-0.784794328),FQ(-0.784556597),FQ(-0.784318751),FQ(-0.784080789),
-    FQ(-0.783842711),FQ(-0.783604519),FQ(-0.783366211),FQ(-0.783127788),FQ(-0.782889250),
-    FQ(-0.782650596),FQ(-0.782411828),FQ(-0.782172944),FQ(-0.781933946),FQ(-0.781694832),
-    FQ(-0.781455604),FQ(-0.781216260),FQ(-0.780976802),FQ(-0.780737229),FQ(-0.780497541),
-    FQ(-0.780257738),FQ(-0.780017820),FQ(-0.779777788),FQ(-0.779537641),FQ(-0.779297379),
-    FQ(-0.779057003),FQ(-0.778816512),FQ(-0.778575907),FQ(-0.778335187),FQ(-0.778094353),
-    FQ(-0.777853404),FQ(-0.777612341),FQ(-0.777371164),FQ(-0.777129872),FQ(-0.776888466),
-    FQ(-0.776646945),FQ(-0.776405311),FQ(-0.776163562),FQ(-0.775921699),FQ(-0.775679722),
-    FQ(-0.775437631),FQ(-0.775195426),FQ(-0.774953107),FQ(-0.774710673),FQ(-0.774468126),
-    FQ(-0.774225465),FQ(-0.773982691),FQ(-0.773739802),FQ(-0.773496799),FQ(-0.773253683),
-    FQ(-0.773010453),FQ(-0.772767110),FQ(-0.772523652),FQ(-0.772280082),FQ(-0.772036397),
-    FQ(-0.771792599),FQ(-0.771548688),FQ(-0.771304663),FQ(-0.771060524),FQ(-0.770816272),
-    FQ(-0.770571907),FQ(-0.770327429),FQ(-0.770082837),FQ(-0.769838132),FQ(-0.769593314),
-    FQ(-0.769348382),FQ(-0.769103338),FQ(-0.768858180),FQ(-0.768612909),FQ(-0.768367525),
-    FQ(-0.768122029),FQ(-0.767876419),FQ(-0.767630696),FQ(-0.767384860),FQ(-0.767138912),
-    FQ(-0.766892851),FQ(-0.766646677),FQ(-0.766400390),FQ(-0.766153990),FQ(-0.765907478),
-    FQ(-0.765660853),FQ(-0.765414116),FQ(-0.765167266),FQ(-0.764920303),FQ(-0.764673228),
-    FQ(-0.764426040),FQ(-0.764178741),FQ(-0.763931328),FQ(-0.763683804),FQ(-0.763436167),
-    FQ(-0.763188417),FQ(-0.762940556),FQ(-0.762692582),FQ(-0.762444496),FQ(-0.762196298),
-    FQ(-0.761947988),FQ(-0.761699566),FQ(-0.761451032),FQ(-0.761202385),FQ(-0.760953627),
-    FQ(-0.760704757),FQ(-0.760455775),FQ(-0.760206682),FQ(-0.759957476),FQ(-0.759708159),
-    FQ(-0.759458730),FQ(-0.759209189),FQ(-0.758959537),FQ(-0.758709773),FQ(-0.758459897),
-    FQ(-0.758209910),FQ(-0.757959811),FQ(-0.757709601),FQ(-0.757459279),FQ(-0.757208847),
-    FQ(-0.756958302),FQ(-0.756707647),FQ(-0.756456880),FQ(-0.756206001),FQ(-0.755955012),
-    FQ(-0.755703911),FQ(-0.755452700),FQ(-0.755201377),FQ(-0.754949943),FQ(-0.754698398),
-    FQ(-0.754446742),FQ(-0.754194975),FQ(-0.753943098),FQ(-0.753691109),FQ(-0.753439009),
-    FQ(-0.753186799),FQ(-0.752934478),FQ(-0.752682046),FQ(-0.752429504),FQ(-0.752176850),
-    FQ(-0.751924087),FQ(-0.751671212),FQ(-0.751418227),FQ(-0.751165132),FQ(-0.750911926),
-    FQ(-0.750658610),FQ(-0.750405183),FQ(-0.750151646),FQ(-0.749897998),FQ(-0.749644241),
-    FQ(-0.749390373),FQ(-0.749136395),FQ(-0.748882306),FQ(-0.748628108),FQ(-0.748373799),
-    FQ(-0.748119380),FQ(-0.747864852),FQ(-0.747610213),FQ(-0.747355465),FQ(-0.747100606),
-    FQ(-0.746845638),FQ(-0.746590559),FQ(-0.746335371),FQ(-0.746080074),FQ(-0.745824666),
-    FQ(-0.745569149),FQ(-0.745313522),FQ(-0.745057785),FQ(-0.744801939),FQ(-0.744545984),
-    FQ(-0.744289919),FQ(-0.744033744),FQ(-0.743777460),FQ(-0.743521067),FQ(-0.743264564),
-    FQ(-0.743007952),FQ(-0.742751231),FQ(-0.742494400),FQ(-0.742237461),FQ(-0.741980412),
-    FQ(-0.741723254),FQ(-0.741465987),FQ(-0.741208610),FQ(-0.740951125),FQ(-0.740693531),
-    FQ(-0.740435828),FQ(-0.740178016),FQ(-0.739920095),FQ(-0.739662066),FQ(-0.739403927),
-    FQ(-0.739145680),FQ(-0.738887324),FQ(-0.738628860),FQ(-0.738370287),FQ(-0.738111605),
-    FQ(-0.737852815),FQ(-0.737593916),FQ(-0.737334909),FQ(-0.737075793),FQ(-0.736816569),
-    FQ(-0.736557236),FQ(-0.736297796),FQ(-0.736038247),FQ(-0.735778589),FQ(-0.735518824),
-    FQ(-0.735258950),FQ(-0.734998968),FQ(-0.734738878),FQ(-0.734478680),FQ(-0.734218374),
-    FQ(-0.733957960),FQ(-0.733697438),FQ(-0.733436808),FQ(-0.733176071),FQ(-0.732915225),
-    FQ(-0.732654272),FQ(-0.732393211),FQ(-0.732132042),FQ(-0.731870765),FQ(-0.731609381),
-    FQ(-0.731347890),FQ(-0.731086290),FQ(-0.730824583),FQ(-0.730562769),FQ(-0.730300848),
-    FQ(-0.730038818),FQ(-0.729776682),FQ(-0.729514438),FQ(-0.729252087),FQ(-0.728989629),
-    FQ(-0.728727063),FQ(-0.728464390),FQ(-0.728201611),FQ(-0.727938724),FQ(-0.727675730),
-    FQ(-0.727412629),FQ(-0.727149421),FQ(-0.726886106),FQ(-0.726622684),FQ(-0.726359155),
-    FQ(-0.726095520),FQ(-0.725831777),FQ(-0.725567928),FQ(-0.725303972),FQ(-0.725039910),
-    FQ(-0.724775741),FQ(-0.724511465),FQ(-0.724247083),FQ(-0.723982594),FQ(-0.723717999),
-    FQ(-0.723453297),FQ(-0.723188489),FQ(-0.722923575),FQ(-0.722658554),FQ(-0.722393427),
-    FQ(-0.722128194),FQ(-0.721862854),FQ(-0.721597409),FQ(-0.721331857),FQ(-0.721066199),
-    FQ(-0.720800435),FQ(-0.720534566),FQ(-0.720268590),FQ(-0.720002508),FQ(-0.719736320),
-    FQ(-0.719470027),FQ(-0.719203627),FQ(-0.718937122),FQ(-0.718670512),FQ(-0.718403795),
-    FQ(-0.718136973),FQ(-0.717870045),FQ(-0.717603012),FQ(-0.717335873),FQ(-0.717068628),
-    FQ(-0.716801279),FQ(-0.716533823),FQ(-0.716266263),FQ(-0.715998597),FQ(-0.715730825),
-    FQ(-0.715462949),FQ(-0.715194967),FQ(-0.714926880),FQ(-0.714658688),FQ(-0.714390391),
-    FQ(-0.714121988),FQ(-0.713853481),FQ(-0.713584869),FQ(-0.713316152),FQ(-0.713047329),
-    FQ(-0.712778402),FQ(-0.712509371),FQ(-0.712240234),FQ(-0.711970993),FQ(-0.711701646),
-    FQ(-0.711432196),FQ(-0.711162640),FQ(-0.710892980),FQ(-0.710623216),FQ(-0.710353347),
-    FQ(-0.710083373),FQ(-0.709813295),FQ(-0.709543113),FQ(-0.709272826),FQ(-0.709002435),
-    FQ(-0.708731940),FQ(-0.708461341),FQ(-0.708190637),FQ(-0.707919829),FQ(-0.707648917),
-    FQ(-0.707377901),FQ(-0.707106781),FQ(-0.706835557),FQ(-0.706564229),FQ(-0.706292797),
-    FQ(-0.706021261),FQ(-0.705749622),FQ(-0.705477878),FQ(-0.705206031),FQ(-0.704934080),
-    FQ(-0.704662026),FQ(-0.704389868),FQ(-0.704117606),FQ(-0.703845241),FQ(-0.703572772),
-    FQ(-0.703300199),FQ(-0.703027524),FQ(-0.702754744),FQ(-0.702481862),FQ(-0.702208876),
-    FQ(-0.701935787),FQ(-0.701662595),FQ(-0.701389299),FQ(-0.701115901),FQ(-0.700842399),
-    FQ(-0.700568794),FQ(-0.700295086),FQ(-0.700021275),FQ(-0.699747361),FQ(-0.699473345),
-    FQ(-0.699199225),FQ(-0.698925003),FQ(-0.698650677),FQ(-0.698376249),FQ(-0.698101719),
-    FQ(-0.697827085),FQ(-0.697552349),FQ(-0.697277511),FQ(-0.697002570),FQ(-0.696727526),
-    FQ(-0.696452380),FQ(-0.696177131),FQ(-0.695901781),FQ(-0.695626327),FQ(-0.695350772),
-    FQ(-0.695075114),FQ(-0.694799354),FQ(-0.694523492),FQ(-0.694247527),FQ(-0.693971461),
-    FQ(-0.693695292),FQ(-0.693419022),FQ(-0.693142649),FQ(-0.692866175),FQ(-0.692589598),
-    FQ(-0.692312920),FQ(-0.692036140),FQ(-0.691759258),FQ(-0.691482275),FQ(-0.691205190),
-    FQ(-0.690928003),FQ(-0.690650714),FQ(-0.690373324),FQ(-0.690095832),FQ(-0.689818239),
-    FQ(-0.689540545),FQ(-0.689262749),FQ(-0.688984851),FQ(-0.688706853),FQ(-0.688428753),
-    FQ(-0.688150552),FQ(-0.687872249),FQ(-0.687593846),FQ(-0.687315341),FQ(-0.687036735),
-    FQ(-0.686758028),FQ(-0.686479220),FQ(-0.686200312),FQ(-0.685921302),FQ(-0.685642191),
-    FQ(-0.685362980),FQ(-0.685083668),FQ(-0.684804255),FQ(-0.684524741),FQ(-0.684245127),
-    FQ(-0.683965412),FQ(-0.683685596),FQ(-0.683405680),FQ(-0.683125663),FQ(-0.682845546),
-    FQ(-0.682565329),FQ(-0.682285011),FQ(-0.682004593),FQ(-0.681724074),FQ(-0.681443455),
-    FQ(-0.681162736),FQ(-0.680881917),FQ(-0.680600998),FQ(-0.680319978),FQ(-0.680038859),
-    FQ(-0.679757639),FQ(-0.679476320),FQ(-0.679194900),FQ(-0.678913381),FQ(-0.678631762),
-    FQ(-0.678350043),FQ(-0.678068224),FQ(-0.677786306),FQ(-0.677504288),FQ(-0.677222170),
-    FQ(-0.676939953),FQ(-0.676657636),FQ(-0.676375219),FQ(-0.676092704),FQ(-0.675810088),
-    FQ(-0.675527374),FQ(-0.675244559),FQ(-0.674961646),FQ(-0.674678633),FQ(-0.674395522),
-    FQ(-0.674112311),FQ(-0.673829000),FQ(-0.673545591),FQ(-0.673262083),FQ(-0.672978475),
-    FQ(-0.672694769),FQ(-0.672410964),FQ(-0.672127060),FQ(-0.671843057),FQ(-0.671558955),
-    FQ(-0.671274754),FQ(-0.670990455),FQ(-0.670706057),FQ(-0.670421560),FQ(-0.670136965),
-    FQ(-0.669852271),FQ(-0.669567479),FQ(-0.669282588),FQ(-0.668997599),FQ(-0.668712512),
-    FQ(-0.668427326),FQ(-0.668142041),FQ(-0.667856659),FQ(-0.667571178),FQ(-0.667285599),
-    FQ(-0.666999922),FQ(-0.666714147),FQ(-0.666428274),FQ(-0.666142303),FQ(-0.665856234),
-    FQ(-0.665570067),FQ(-0.665283802),FQ(-0.664997439),FQ(-0.664710978),FQ(-0.664424420),
-    FQ(-0.664137764),FQ(-0.663851010),FQ(-0.663564159),FQ(-0.663277210),FQ(-0.662990163),
-    FQ(-0.662703019),FQ(-0.662415778),FQ(-0.662128439),FQ(-0.661841002),FQ(-0.661553469),
-    FQ(-0.661265838),FQ(-0.660978110),FQ(-0.660690284),FQ(-0.660402362),FQ(-0.660114342),
-    FQ(-0.659826225),FQ(-0.659538012),FQ(-0.659249701),FQ(-0.658961293),FQ(-0.658672788),
-    FQ(-0.658384187),FQ(-0.658095488),FQ(-0.657806693),FQ(-0.657517801),FQ(-0.657228813),
-    FQ(-0.656939728),FQ(-0.656650546),FQ(-0.656361267),FQ(-0.656071892),FQ(-0.655782421),
-    FQ(-0.655492853),FQ(-0.655203189),FQ(-0.654913428),FQ(-0.654623571),FQ(-0.654333618),
-    FQ(-0.654043568),FQ(-0.653753423),FQ(-0.653463181),FQ(-0.653172843),FQ(-0.652882409),
-    FQ(-0.652591879),FQ(-0.652301253),FQ(-0.652010531),FQ(-0.651719713),FQ(-0.651428800),
-    FQ(-0.651137790),FQ(-0.650846685),FQ(-0.650555484),FQ(-0.650264187),FQ(-0.649972795),
-    FQ(-0.649681307),FQ(-0.649389724),FQ(-0.649098045),FQ(-0.648806271),FQ(-0.648514401),
-    FQ(-0.648222436),FQ(-0.647930375),FQ(-0.647638220),FQ(-0.647345969),FQ(-0.647053622),
-    FQ(-0.646761181),FQ(-0.646468645),FQ(-0.646176013),FQ(-0.645883286),FQ(-0.645590465),
-    FQ(-0.645297548),FQ(-0.645004537),FQ(-0.644711431),FQ(-0.644418229),FQ(-0.644124934),
-    FQ(-0.643831543),FQ(-0.643538058),FQ(-0.643244478),FQ(-0.642950803),FQ(-0.642657034),
-    FQ(-0.642363170),FQ(-0.642069212),FQ(-0.641775160),FQ(-0.641481013),FQ(-0.641186772),
-    FQ(-0.640892436),FQ(-0.640598006),FQ(-0.640303482),FQ(-0.640008864),FQ(-0.639714152),
-    FQ(-0.639419345),FQ(-0.639124445),FQ(-0.638829450),FQ(-0.638534362),FQ(-0.638239180),
-    FQ(-0.637943904),FQ(-0.637648534),FQ(-0.637353070),FQ(-0.637057512),FQ(-0.636761861),
-    FQ(-0.636466116),FQ(-0.636170278),FQ(-0.635874346),FQ(-0.635578320),FQ(-0.635282202),
-    FQ(-0.634985989),FQ(-0.634689683),FQ(-0.634393284),FQ(-0.634096792),FQ(-0.633800206),
-    FQ(-0.633503527),FQ(-0.633206755),FQ(-0.632909890),FQ(-0.632612932),FQ(-0.632315880),
-    FQ(-0.632018736),FQ(-0.631721499),FQ(-0.631424169),FQ(-0.631126745),FQ(-0.630829230),
-    FQ(-0.630531621),FQ(-0.630233920),FQ(-0.629936126),FQ(-0.629638239),FQ(-0.629340260),
-    FQ(-0.629042188),FQ(-0.628744023),FQ(-0.628445767),FQ(-0.628147417),FQ(-0.627848976),
-    FQ(-0.627550442),FQ(-0.627251815),FQ(-0.626953097),FQ(-0.626654286),FQ(-0.626355383),
-    FQ(-0.626056388),FQ(-0.625757301),FQ(-0.625458122),FQ(-0.625158851),FQ(-0.624859488),
-    FQ(-0.624560033),FQ(-0.624260486),FQ(-0.623960848),FQ(-0.623661118),FQ(-0.623361295),
-    FQ(-0.623061382),FQ(-0.622761376),FQ(-0.622461279),FQ(-0.622161091),FQ(-0.621860811),
-    FQ(-0.621560439),FQ(-0.621259977),FQ(-0.620959422),FQ(-0.620658777),FQ(-0.620358040),
-    FQ(-0.620057212),FQ(-0.619756292),FQ(-0.619455282),FQ(-0.619154181),FQ(-0.618852988),
-    FQ(-0.618551704),FQ(-0.618250330),FQ(-0.617948864),FQ(-0.617647308),FQ(-0.617345661),
-    FQ(-0.617043923),FQ(-0.616742094),FQ(-0.616440175),FQ(-0.616138164),FQ(-0.615836064),
-    FQ(-0.615533872),FQ(-0.615231591),FQ(-0.614929218),FQ(-0.614626756),FQ(-0.614324202),
-    FQ(-0.614021559),FQ(-0.613718825),FQ(-0.613416001),FQ(-0.613113087),FQ(-0.612810082),
-    FQ(-0.612506988),FQ(-0.612203803),FQ(-0.611900529),FQ(-0.611597164),FQ(-0.611293709),
-    FQ(-0.610990165),FQ(-0.610686530),FQ(-0.610382806),FQ(-0.610078992),FQ(-0.609775089),
-    FQ(-0.609471095),FQ(-0.609167012),FQ(-0.608862840),FQ(-0.608558578),FQ(-0.608254226),
-    FQ(-0.607949785),FQ(-0.607645254),FQ(-0.607340635),FQ(-0.607035925),FQ(-0.606731127),
-    FQ(-0.606426239),FQ(-0.606121263),FQ(-0.605816197),FQ(-0.605511041),FQ(-0.605205797),
-    FQ(-0.604900464),FQ(-0.604595042),FQ(-0.604289531),FQ(-0.603983931),FQ(-0.603678242),
-    FQ(-0.603372465),FQ(-0.603066599),FQ(-0.602760644),FQ(-0.602454600),FQ(-0.602148468),
-    FQ(-0.601842247),FQ(-0.601535938),FQ(-0.601229540),FQ(-0.600923054),FQ(-0.600616479),
-    FQ(-0.600309817),FQ(-0.600003065),FQ(-0.599696226),FQ(-0.599389298),FQ(-0.599082283),
-    FQ(-0.598775179),FQ(-0.598467987),FQ(-0.598160707),FQ(-0.597853339),FQ(-0.597545883),
-    FQ(-0.597238340),FQ(-0.596930708),FQ(-0.596622989),FQ(-0.596315182),FQ(-0.596007287),
-    FQ(-0.595699304),FQ(-0.595391234),FQ(-0.595083077),FQ(-0.594774832),FQ(-0.594466499),
-    FQ(-0.594158079),FQ(-0.593849572),FQ(-0.593540977),FQ(-0.593232295),FQ(-0.592923526),
-    FQ(-0.592614669),FQ(-0.592305726),FQ(-0.591996695),FQ(-0.591687577),FQ(-0.591378372),
-    FQ(-0.591069081),FQ(-0.590759702),FQ(-0.590450236),FQ(-0.590140684),FQ(-0.589831045),
-    FQ(-0.589521319),FQ(-0.589211506),FQ(-0.588901607),FQ(-0.588591621),FQ(-0.588281548),
-    FQ(-0.587971389),FQ(-0.587661144),FQ(-0.587350812),FQ(-0.587040394),FQ(-0.586729889),
-    FQ(-0.586419298),FQ(-0.586108621),FQ(-0.585797857),FQ(-0.585487008),FQ(-0.585176072),
-    FQ(-0.584865051),FQ(-0.584553943),FQ(-0.584242749),FQ(-0.583931470),FQ(-0.583620104),
-    FQ(-0.583308653),FQ(-0.582997116),FQ(-0.582685493),FQ(-0.582373785),FQ(-0.582061990),
-    FQ(-0.581750111),FQ(-0.581438145),FQ(-0.581126094),FQ(-0.580813958),FQ(-0.580501736),
-    FQ(-0.580189429),FQ(-0.579877037),FQ(-0.579564559),FQ(-0.579251996),FQ(-0.578939348),
-    FQ(-0.578626615),FQ(-0.578313796),FQ(-0.578000893),FQ(-0.577687905),FQ(-0.577374831),
-    FQ(-0.577061673),FQ(-0.576748430),FQ(-0.576435102),FQ(-0.576121689),FQ(-0.575808191),
-    FQ(-0.575494609),FQ(-0.575180942),FQ(-0.574867191),FQ(-0.574553355),FQ(-0.574239435),
-    FQ(-0.573925430),FQ(-0.573611340),FQ(-0.573297167),FQ(-0.572982909),FQ(-0.572668566),
-    FQ(-0.572354140),FQ(-0.572039629),FQ(-0.571725035),FQ(-0.571410356),FQ(-0.571095593),
-    FQ(-0.570780746),FQ(-0.570465815),FQ(-0.570150800),FQ(-0.569835702),FQ(-0.569520519),
-    FQ(-0.569205253),FQ(-0.568889903),FQ(-0.568574470),FQ(-0.568258953),FQ(-0.567943352),
-    FQ(-0.567627668),FQ(-0.567311900),FQ(-0.566996049),FQ(-0.566680114),FQ(-0.566364096),
-    FQ(-0.566047995),FQ(-0.565731811),FQ(-0.565415543),FQ(-0.565099192),FQ(-0.564782758),
-    FQ(-0.564466242),FQ(-0.564149642),FQ(-0.563832959),FQ(-0.563516193),FQ(-0.563199344),
-    FQ(-0.562882412),FQ(-0.562565398),FQ(-0.562248301),FQ(-0.561931121),FQ(-0.561613859),
-    FQ(-0.561296514),FQ(-0.560979086),FQ(-0.560661576),FQ(-0.560343984),FQ(-0.560026309),
-    FQ(-0.559708551),FQ(-0.559390712),FQ(-0.559072790),FQ(-0.558754786),FQ(-0.558436700),
-    FQ(-0.558118531),FQ(-0.557800281),FQ(-0.557481948),FQ(-0.557163534),FQ(-0.556845037),
-    FQ(-0.556526459),FQ(-0.556207799),FQ(-0.555889057),FQ(-0.555570233),FQ(-0.555251328),
-    FQ(-0.554932340),FQ(-0.554613272),FQ(-0.554294121),FQ(-0.553974890),FQ(-0.553655576),
-    FQ(-0.553336182),FQ(-0.553016706),FQ(-0.552697148),FQ(-0.552377509),FQ(-0.552057790),
-    FQ(-0.551737988),FQ(-0.551418106),FQ(-0.551098143),FQ(-0.550778098),FQ(-0.550457973),
-    FQ(-0.550137767),FQ(-0.549817479),FQ(-0.549497111),FQ(-0.549176662),FQ(-0.548856132),
-    FQ(-0.548535522),FQ(-0.548214831),FQ(-0.547894059),FQ(-0.547573207),FQ(-0.547252274),
-    FQ(-0.546931261),FQ(-0.546610167),FQ(-0.546288993),FQ(-0.545967738),FQ(-0.545646403),
-    FQ(-0.545324988),FQ(-0.545003493),FQ(-0.544681918),FQ(-0.544360262),FQ(-0.544038527),
-    FQ(-0.543716711),FQ(-0.543394816),FQ(-0.543072840),FQ(-0.542750785),FQ(-0.542428650),
-    FQ(-0.542106435),FQ(-0.541784140),FQ(-0.541461766),FQ(-0.541139312),FQ(-0.540816778),
-    FQ(-0.540494165),FQ(-0.540171473),FQ(-0.539848701),FQ(-0.539525849),FQ(-0.539202919),
-    FQ(-0.538879909),FQ(-0.538556819),FQ(-0.538233651),FQ(-0.537910403),FQ(-0.537587076),
-    FQ(-0.537263670),FQ(-0.536940186),FQ(-0.536616622),FQ(-0.536292979),FQ(-0.535969257),
-    FQ(-0.535645457),FQ(-0.535321578),FQ(-0.534997620),FQ(-0.534673583),FQ(-0.534349468),
-    FQ(-0.534025274),FQ(-0.533701002),FQ(-0.533376651),FQ(-0.533052222),FQ(-0.532727714),
-    FQ(-0.532403128),FQ(-0.532078464),FQ(-0.531753721),FQ(-0.531428900),FQ(-0.531104001),
-    FQ(-0.530779024),FQ(-0.530453969),FQ(-0.530128836),FQ(-0.529803625),FQ(-0.529478336),
-    FQ(-0.529152969),FQ(-0.528827524),FQ(-0.528502002),FQ(-0.528176401),FQ(-0.527850723),
-    FQ(-0.527524968),FQ(-0.527199135),FQ(-0.526873224),FQ(-0.526547236),FQ(-0.526221170),
-    FQ(-0.525895027),FQ(-0.525568807),FQ(-0.525242510),FQ(-0.524916135),FQ(-0.524589683),
-    FQ(-0.524263153),FQ(-0.523936547),FQ(-0.523609864),FQ(-0.523283103),FQ(-0.522956266),
-    FQ(-0.522629352),FQ(-0.522302361),FQ(-0.521975293),FQ(-0.521648148),FQ(-0.521320927),
-    FQ(-0.520993629),FQ(-0.520666254),FQ(-0.520338803),FQ(-0.520011275),FQ(-0.519683671),
-    FQ(-0.519355990),FQ(-0.519028233),FQ(-0.518700400),FQ(-0.518372490),FQ(-0.518044504),
-    FQ(-0.517716442),FQ(-0.517388304),FQ(-0.517060089),FQ(-0.516731799),FQ(-0.516403433),
-    FQ(-0.516074990),FQ(-0.515746472),FQ(-0.515417878),FQ(-0.515089208),FQ(-0.514760463),
-    FQ(-0.514431641),FQ(-0.514102744),FQ(-0.513773772),FQ(-0.513444723),FQ(-0.513115600),
-    FQ(-0.512786401),FQ(-0.512457126),FQ(-0.512127776),FQ(-0.511798351),FQ(-0.511468850),
-    FQ(-0.511139275),FQ(-0.510809624),FQ(-0.510479898),FQ(-0.510150097),FQ(-0.509820221),
-    FQ(-0.509490269),FQ(-0.509160243),FQ(-0.508830143),FQ(-0.508499967),FQ(-0.508169716),
-    FQ(-0.507839391),FQ(-0.507508991),FQ(-0.507178516),FQ(-0.506847967),FQ(-0.506517344),
-    FQ(-0.506186645),FQ(-0.505855873),FQ(-0.505525026),FQ(-0.505194104),FQ(-0.504863109),
-    FQ(-0.504532039),FQ(-0.504200894),FQ(-0.503869676),FQ(-0.503538384),FQ(-0.503207017),
-    FQ(-0.502875577),FQ(-0.502544062),FQ(-0.502212474),FQ(-0.501880812),FQ(-0.501549076),
-    FQ(-0.501217266),FQ(-0.500885383),FQ(-0.500553425),FQ(-0.500221395),FQ(-0.499889290),
-    FQ(-0.499557113),FQ(-0.499224861),FQ(-0.498892537),FQ(-0.498560138),FQ(-0.498227667),
-    FQ(-0.497895122),FQ(-0.497562504),FQ(-0.497229813),FQ(-0.496897049),FQ(-0.496564212),
-    FQ(-0.496231301),FQ(-0.495898318),FQ(-0.495565262),FQ(-0.495232133),FQ(-0.494898931),
-    FQ(-0.494565656),FQ(-0.494232309),FQ(-0.493898888),FQ(-0.493565396),FQ(-0.493231830),
-    FQ(-0.492898192),FQ(-0.492564482),FQ(-0.492230699),FQ(-0.491896844),FQ(-0.491562916),
-    FQ(-0.491228916),FQ(-0.490894844),FQ(-0.490560700),FQ(-0.490226483),FQ(-0.489892195),
-    FQ(-0.489557834),FQ(-0.489223401),FQ(-0.488888897),FQ(-0.488554320),FQ(-0.488219672),
-    FQ(-0.487884952),FQ(-0.487550160),FQ(-0.487215297),FQ(-0.486880361),FQ(-0.486545355),
-    FQ(-0.486210276),FQ(-0.485875126),FQ(-0.485539905),FQ(-0.485204612),FQ(-0.484869248),
-    FQ(-0.484533813),FQ(-0.484198306),FQ(-0.483862728),FQ(-0.483527079),FQ(-0.483191359),
-    FQ(-0.482855568),FQ(-0.482519705),FQ(-0.482183772),FQ(-0.481847768),FQ(-0.481511693),
-    FQ(-0.481175547),FQ(-0.480839331),FQ(-0.480503043),FQ(-0.480166685),FQ(-0.479830257),
-    FQ(-0.479493758),FQ(-0.479157188),FQ(-0.478820548),FQ(-0.478483837),FQ(-0.478147056),
-    FQ(-0.477810205),FQ(-0.477473284),FQ(-0.477136292),FQ(-0.476799230),FQ(-0.476462098),
-    FQ(-0.476124896),FQ(-0.475787624),FQ(-0.475450282),FQ(-0.475112870),FQ(-0.474775388),
-    FQ(-0.474437836),FQ(-0.474100215),FQ(-0.473762523),FQ(-0.473424763),FQ(-0.473086932),
-    FQ(-0.472749032),FQ(-0.472411062),FQ(-0.472073023),FQ(-0.471734915),FQ(-0.471396737),
-    FQ(-0.471058490),FQ(-0.470720173),FQ(-0.470381787),FQ(-0.470043332),FQ(-0.469704808),
-    FQ(-0.469366215),FQ(-0.469027553),FQ(-0.468688822),FQ(-0.468350022),FQ(-0.468011153),
-    FQ(-0.467672215),FQ(-0.467333209),FQ(-0.466994133),FQ(-0.466654990),FQ(-0.466315777),
-    FQ(-0.465976496),FQ(-0.465637146),FQ(-0.465297728),FQ(-0.464958241),FQ(-0.464618686),
-    FQ(-0.464279063),FQ(-0.463939371),FQ(-0.463599612),FQ(-0.463259784),FQ(-0.462919887),
-    FQ(-0.462579923),FQ(-0.462239891),FQ(-0.461899791),FQ(-0.461559623),FQ(-0.461219386),
-    FQ(-0.460879083),FQ(-0.460538711),FQ(-0.460198272),FQ(-0.459857765),FQ(-0.459517190),
-    FQ(-0.459176548),FQ(-0.458835838),FQ(-0.458495060),FQ(-0.458154216),FQ(-0.457813304),
-    FQ(-0.457472324),FQ(-0.457131277),FQ(-0.456790164),FQ(-0.456448982),FQ(-0.456107734),
-    FQ(-0.455766419),FQ(-0.455425036),FQ(-0.455083587),FQ(-0.454742071),FQ(-0.454400488),
-    FQ(-0.454058838),FQ(-0.453717121),FQ(-0.453375338),FQ(-0.453033487),FQ(-0.452691571),
-    FQ(-0.452349587),FQ(-0.452007537),FQ(-0.451665421),FQ(-0.451323238),FQ(-0.450980989),
-    FQ(-0.450638674),FQ(-0.450296292),FQ(-0.449953844),FQ(-0.449611330),FQ(-0.449268749),
-    FQ(-0.448926103),FQ(-0.448583391),FQ(-0.448240612),FQ(-0.447897768),FQ(-0.447554858),
-    FQ(-0.447211882),FQ(-0.446868840),FQ(-0.446525733),FQ(-0.446182560),FQ(-0.445839321),
-    FQ(-0.445496017),FQ(-0.445152647),FQ(-0.444809211),FQ(-0.444465711),FQ(-0.444122145),
-    FQ(-0.443778513),FQ(-0.443434816),FQ(-0.443091055),FQ(-0.442747228),FQ(-0.442403335),
-    FQ(-0.442059378),FQ(-0.441715356),FQ(-0.441371269),FQ(-0.441027117),FQ(-0.440682900),
-    FQ(-0.440338618),FQ(-0.439994271),FQ(-0.439649860),FQ(-0.439305384),FQ(-0.438960844),
-    FQ(-0.438616239),FQ(-0.438271569),FQ(-0.437926835),FQ(-0.437582036),FQ(-0.437237174),
-    FQ(-0.436892247),FQ(-0.436547255),FQ(-0.436202200),FQ(-0.435857080),FQ(-0.435511896),
-    FQ(-0.435166648),FQ(-0.434821336),FQ(-0.434475961),FQ(-0.434130521),FQ(-0.433785017),
-    FQ(-0.433439450),FQ(-0.433093819),FQ(-0.432748124),FQ(-0.432402366),FQ(-0.432056544),
-    FQ(-0.431710658),FQ(-0.431364709),FQ(-0.431018696),FQ(-0.430672621),FQ(-0.430326481),
-    FQ(-0.429980279),FQ(-0.429634013),FQ(-0.429287684),FQ(-0.428941292),FQ(-0.428594837),
-    FQ(-0.428248319),FQ(-0.427901738),FQ(-0.427555093),FQ(-0.427208386),FQ(-0.426861617),
-    FQ(-0.426514784),FQ(-0.426167889),FQ(-0.425820931),FQ(-0.425473910),FQ(-0.425126827),
-    FQ(-0.424779681),FQ(-0.424432473),FQ(-0.424085202),FQ(-0.423737869),FQ(-0.423390474),
-    FQ(-0.423043017),FQ(-0.422695497),FQ(-0.422347915),FQ(-0.422000271),FQ(-0.421652565),
-    FQ(-0.421304797),FQ(-0.420956966),FQ(-0.420609074),FQ(-0.420261121),FQ(-0.419913105),
-    FQ(-0.419565027),FQ(-0.419216888),FQ(-0.418868688),FQ(-0.418520425),FQ(-0.418172101),
-    FQ(-0.417823716),FQ(-0.417475269),FQ(-0.417126761),FQ(-0.416778191),FQ(-0.416429560),
-    FQ(-0.416080868),FQ(-0.415732115),FQ(-0.415383300),FQ(-0.415034424),FQ(-0.414685488),
-    FQ(-0.414336490),FQ(-0.413987432),FQ(-0.413638312),FQ(-0.413289132),FQ(-0.412939891),
-    FQ(-0.412590589),FQ(-0.412241227),FQ(-0.411891804),FQ(-0.411542320),FQ(-0.411192776),
-    FQ(-0.410843171),FQ(-0.410493506),FQ(-0.410143781),FQ(-0.409793995),FQ(-0.409444149),
-    FQ(-0.409094242),FQ(-0.408744276),FQ(-0.408394249),FQ(-0.408044163),FQ(-0.407694016),
-    FQ(-0.407343810),FQ(-0.406993543),FQ(-0.406643217),FQ(-0.406292831),FQ(-0.405942385),
-    FQ(-0.405591879),FQ(-0.405241314),FQ(-0.404890689),FQ(-0.404540005),FQ(-0.404189261),
-    FQ(-0.403838458),FQ(-0.403487595),FQ(-0.403136673),FQ(-0.402785691),FQ(-0.402434651),
-    FQ(-0.402083551),FQ(-0.401732392),FQ(-0.401381174),FQ(-0.401029897),FQ(-0.400678561),
-    FQ(-0.400327166),FQ(-0.399975712),FQ(-0.399624200),FQ(-0.399272628),FQ(-0.398920998),
-    FQ(-0.398569310),FQ(-0.398217562),FQ(-0.397865756),FQ(-0.397513892),FQ(-0.397161969),
-    FQ(-0.396809987),FQ(-0.396457948),FQ(-0.396105850),FQ(-0.395753693),FQ(-0.395401479),
-    FQ(-0.395049206),FQ(-0.394696876),FQ(-0.394344487),FQ(-0.393992040),FQ(-0.393639535),
-    FQ(-0.393286973),FQ(-0.392934352),FQ(-0.392581674),FQ(-0.392228938),FQ(-0.391876144),
-    FQ(-0.391523293),FQ(-0.391170384),FQ(-0.390817418),FQ(-0.390464394),FQ(-0.390111313),
-    FQ(-0.389758174),FQ(-0.389404978),FQ(-0.389051725),FQ(-0.388698414),FQ(-0.388345047),
-    FQ(-0.387991622),FQ(-0.387638140),FQ(-0.387284601),FQ(-0.386931006),FQ(-0.386577353),
-    FQ(-0.386223643),FQ(-0.385869877),FQ(-0.385516054),FQ(-0.385162174),FQ(-0.384808238),
-    FQ(-0.384454245),FQ(-0.384100195),FQ(-0.383746089),FQ(-0.383391926),FQ(-0.383037708),
-    FQ(-0.382683432),FQ(-0.382329101),FQ(-0.381974713),FQ(-0.381620269),FQ(-0.381265769),
-    FQ(-0.380911213),FQ(-0.380556601),FQ(-0.380201933),FQ(-0.379847209),FQ(-0.379492429),
-    FQ(-0.379137593),FQ(-0.378782702),FQ(-0.378427755),FQ(-0.378072752),FQ(-0.377717694),
-    FQ(-0.377362580),FQ(-0.377007410),FQ(-0.376652185),FQ(-0.376296905),FQ(-0.375941569),
-    FQ(-0.375586178),FQ(-0.375230732),FQ(-0.374875231),FQ(-0.374519675),FQ(-0.374164063),
-    FQ(-0.373808396),FQ(-0.373452675),FQ(-0.373096898),FQ(-0.372741067),FQ(-0.372385181),
-    FQ(-0.372029240),FQ(-0.371673244),FQ(-0.371317194),FQ(-0.370961089),FQ(-0.370604930),
-    FQ(-0.370248716),FQ(-0.369892447),FQ(-0.369536124),FQ(-0.369179747),FQ(-0.368823316),
-    FQ(-0.368466830),FQ(-0.368110290),FQ(-0.367753696),FQ(-0.367397048),FQ(-0.367040346),
-    FQ(-0.366683590),FQ(-0.366326780),FQ(-0.365969916),FQ(-0.365612998),FQ(-0.365256026),
-    FQ(-0.364899001),FQ(-0.364541922),FQ(-0.364184790),FQ(-0.363827603),FQ(-0.363470364),
-    FQ(-0.363113071),FQ(-0.362755724),FQ(-0.362398325),FQ(-0.362040871),FQ(-0.361683365),
-    FQ(-0.361325806),FQ(-0.360968193),FQ(-0.360610527),FQ(-0.360252808),FQ(-0.359895037),
-    FQ(-0.359537212),FQ(-0.359179334),FQ(-0.358821404),FQ(-0.358463421),FQ(-0.358105385),
-    FQ(-0.357747296),FQ(-0.357389155),FQ(-0.357030961),FQ(-0.356672715),FQ(-0.356314416),
-    FQ(-0.355956065),FQ(-0.355597662),FQ(-0.355239206),FQ(-0.354880698),FQ(-0.354522138),
-    FQ(-0.354163525),FQ(-0.353804861),FQ(-0.353446145),FQ(-0.353087376),FQ(-0.352728556),
-    FQ(-0.352369684),FQ(-0.352010759),FQ(-0.351651784),FQ(-0.351292756),FQ(-0.350933677),
-    FQ(-0.350574546),FQ(-0.350215364),FQ(-0.349856130),FQ(-0.349496844),FQ(-0.349137508),
-    FQ(-0.348778120),FQ(-0.348418680),FQ(-0.348059190),FQ(-0.347699648),FQ(-0.347340055),
-    FQ(-0.346980411),FQ(-0.346620716),FQ(-0.346260970),FQ(-0.345901173),FQ(-0.345541325),
-    FQ(-0.345181426),FQ(-0.344821477),FQ(-0.344461477),FQ(-0.344101426),FQ(-0.343741325),
-    FQ(-0.343381173),FQ(-0.343020970),FQ(-0.342660717),FQ(-0.342300414),FQ(-0.341940060),
-    FQ(-0.341579656),FQ(-0.341219202),FQ(-0.340858698),FQ(-0.340498144),FQ(-0.340137539),
-    FQ(-0.339776884),FQ(-0.339416180),FQ(-0.339055425),FQ(-0.338694621),FQ(-0.338333767),
-    FQ(-0.337972863),FQ(-0.337611909),FQ(-0.337250906),FQ(-0.336889853),FQ(-0.336528751),
-    FQ(-0.336167599),FQ(-0.335806398),FQ(-0.335445147),FQ(-0.335083847),FQ(-0.334722498),
-    FQ(-0.334361099),FQ(-0.333999651),FQ(-0.333638155),FQ(-0.333276609),FQ(-0.332915014),
-    FQ(-0.332553370),FQ(-0.332191677),FQ(-0.331829935),FQ(-0.331468145),FQ(-0.331106306),
-    FQ(-0.330744418),FQ(-0.330382481),FQ(-0.330020496),FQ(-0.329658463),FQ(-0.329296380),
-    FQ(-0.328934250),FQ(-0.328572071),FQ(-0.328209844),FQ(-0.327847568),FQ(-0.327485244),
-    FQ(-0.327122872),FQ(-0.326760452),FQ(-0.326397984),FQ(-0.326035468),FQ(-0.325672904),
-    FQ(-0.325310292),FQ(-0.324947632),FQ(-0.324584925),FQ(-0.324222170),FQ(-0.323859367),
-    FQ(-0.323496516),FQ(-0.323133618),FQ(-0.322770672),FQ(-0.322407679),FQ(-0.322044638),
-    FQ(-0.321681550),FQ(-0.321318415),FQ(-0.320955232),FQ(-0.320592003),FQ(-0.320228726),
-    FQ(-0.319865402),FQ(-0.319502031),FQ(-0.319138613),FQ(-0.318775148),FQ(-0.318411636),
-    FQ(-0.318048077),FQ(-0.317684472),FQ(-0.317320820),FQ(-0.316957121),FQ(-0.316593376),
-    FQ(-0.316229584),FQ(-0.315865745),FQ(-0.315501860),FQ(-0.315137929),FQ(-0.314773951),
-    FQ(-0.314409927),FQ(-0.314045857),FQ(-0.313681740),FQ(-0.313317578),FQ(-0.312953369),
-    FQ(-0.312589115),FQ(-0.312224814),FQ(-0.311860467),FQ(-0.311496075),FQ(-0.311131637),
-    FQ(-0.310767153),FQ(-0.310402623),FQ(-0.310038048),FQ(-0.309673427),FQ(-0.309308760),
-    FQ(-0.308944048),FQ(-0.308579291),FQ(-0.308214488),FQ(-0.307849640),FQ(-0.307484747),
-    FQ(-0.307119808),FQ(-0.306754824),FQ(-0.306389795),FQ(-0.306024721),FQ(-0.305659602),
-    FQ(-0.305294439),FQ(-0.304929230),FQ(-0.304563976),FQ(-0.304198678),FQ(-0.303833334),
-    FQ(-0.303467947),FQ(-0.303102514),FQ(-0.302737037),FQ(-0.302371515),FQ(-0.302005949),
-    FQ(-0.301640339),FQ(-0.301274684),FQ(-0.300908985),FQ(-0.300543241),FQ(-0.300177454),
-    FQ(-0.299811622),FQ(-0.299445746),FQ(-0.299079826),FQ(-0.298713862),FQ(-0.298347855),
-    FQ(-0.297981803),FQ(-0.297615707),FQ(-0.297249568),FQ(-0.296883385),FQ(-0.296517159),
-    FQ(-0.296150888),FQ(-0.295784574),FQ(-0.295418217),FQ(-0.295051816),FQ(-0.294685372),
-    FQ(-0.294318885),FQ(-0.293952354),FQ(-0.293585780),FQ(-0.293219163),FQ(-0.292852502),
-    FQ(-0.292485799),FQ(-0.292119053),FQ(-0.291752263),FQ(-0.291385431),FQ(-0.291018556),
-    FQ(-0.290651638),FQ(-0.290284677),FQ(-0.289917674),FQ(-0.289550628),FQ(-0.289183539),
-    FQ(-0.288816408),FQ(-0.288449235),FQ(-0.288082019),FQ(-0.287714760),FQ(-0.287347460),
-    FQ(-0.286980117),FQ(-0.286612731),FQ(-0.286245304),FQ(-0.285877835),FQ(-0.285510323),
-    FQ(-0.285142770),FQ(-0.284775174),FQ(-0.284407537),FQ(-0.284039858),FQ(-0.283672137),
-    FQ(-0.283304375),FQ(-0.282936570),FQ(-0.282568725),FQ(-0.282200837),FQ(-0.281832908),
-    FQ(-0.281464938),FQ(-0.281096926),FQ(-0.280728873),FQ(-0.280360779),FQ(-0.279992643),
-    FQ(-0.279624466),FQ(-0.279256248),FQ(-0.278887989),FQ(-0.278519689),FQ(-0.278151348),
-    FQ(-0.277782967),FQ(-0.277414544),FQ(-0.277046080),FQ(-0.276677576),FQ(-0.276309031),
-    FQ(-0.275940445),FQ(-0.275571819),FQ(-0.275203153),FQ(-0.274834445),FQ(-0.274465698),
-    FQ(-0.274096910),FQ(-0.273728082),FQ(-0.273359213),FQ(-0.272990304),FQ(-0.272621355),
-    FQ(-0.272252366),FQ(-0.271883337),FQ(-0.271514268),FQ(-0.271145160),FQ(-0.270776011),
-    FQ(-0.270406822),FQ(-0.270037594),FQ(-0.269668326),FQ(-0.269299018),FQ(-0.268929670),
-    FQ(-0.268560283),FQ(-0.268190857),FQ(-0.267821391),FQ(-0.267451886),FQ(-0.267082341),
-    FQ(-0.266712757),FQ(-0.266343134),FQ(-0.265973472),FQ(-0.265603771),FQ(-0.265234030),
-    FQ(-0.264864251),FQ(-0.264494432),FQ(-0.264124575),FQ(-0.263754679),FQ(-0.263384744),
-    FQ(-0.263014770),FQ(-0.262644758),FQ(-0.262274707),FQ(-0.261904617),FQ(-0.261534489),
-    FQ(-0.261164323),FQ(-0.260794118),FQ(-0.260423875),FQ(-0.260053593),FQ(-0.259683273),
-    FQ(-0.259312915),FQ(-0.258942519),FQ(-0.258572085),FQ(-0.258201612),FQ(-0.257831102),
-    FQ(-0.257460554),FQ(-0.257089968),FQ(-0.256719344),FQ(-0.256348682),FQ(-0.255977983),
-    FQ(-0.255607246),FQ(-0.255236472),FQ(-0.254865660),FQ(-0.254494810),FQ(-0.254123923),
-    FQ(-0.253752999),FQ(-0.253382037),FQ(-0.253011038),FQ(-0.252640002),FQ(-0.252268929),
-    FQ(-0.251897818),FQ(-0.251526671),FQ(-0.251155486),FQ(-0.250784265),FQ(-0.250413007),
-    FQ(-0.250041711),FQ(-0.249670380),FQ(-0.249299011),FQ(-0.248927606),FQ(-0.248556164),
-    FQ(-0.248184685),FQ(-0.247813171),FQ(-0.247441619),FQ(-0.247070031),FQ(-0.246698407),
-    FQ(-0.246326747),FQ(-0.245955050),FQ(-0.245583318),FQ(-0.245211549),FQ(-0.244839744),
-    FQ(-0.244467903),FQ(-0.244096026),FQ(-0.243724113),FQ(-0.243352164),FQ(-0.242980180),
-    FQ(-0.242608160),FQ(-0.242236104),FQ(-0.241864012),FQ(-0.241491885),FQ(-0.241119723),
-    FQ(-0.240747525),FQ(-0.240375291),FQ(-0.240003022),FQ(-0.239630718),FQ(-0.239258379),
-    FQ(-0.238886004),FQ(-0.238513595),FQ(-0.238141150),FQ(-0.237768670),FQ(-0.237396156),
-    FQ(-0.237023606),FQ(-0.236651021),FQ(-0.236278402),FQ(-0.235905748),FQ(-0.235533059),
-    FQ(-0.235160336),FQ(-0.234787578),FQ(-0.234414786),FQ(-0.234041959),FQ(-0.233669097),
-    FQ(-0.233296201),FQ(-0.232923271),FQ(-0.232550307),FQ(-0.232177309),FQ(-0.231804276),
-    FQ(-0.231431209),FQ(-0.231058108),FQ(-0.230684974),FQ(-0.230311805),FQ(-0.229938602),
-    FQ(-0.229565366),FQ(-0.229192096),FQ(-0.228818792),FQ(-0.228445454),FQ(-0.228072083),
-    FQ(-0.227698679),FQ(-0.227325240),FQ(-0.226951769),FQ(-0.226578264),FQ(-0.226204726),
-    FQ(-0.225831154),FQ(-0.225457549),FQ(-0.225083911),FQ(-0.224710240),FQ(-0.224336536),
-    FQ(-0.223962799),FQ(-0.223589029),FQ(-0.223215226),FQ(-0.222841391),FQ(-0.222467522),
-    FQ(-0.222093621),FQ(-0.221719687),FQ(-0.221345721),FQ(-0.220971722),FQ(-0.220597690),
-    FQ(-0.220223626),FQ(-0.219849530),FQ(-0.219475401),FQ(-0.219101240),FQ(-0.218727047),
-    FQ(-0.218352822),FQ(-0.217978564),FQ(-0.217604275),FQ(-0.217229953),FQ(-0.216855600),
-    FQ(-0.216481214),FQ(-0.216106797),FQ(-0.215732348),FQ(-0.215357867),FQ(-0.214983355),
-    FQ(-0.214608811),FQ(-0.214234235),FQ(-0.213859628),FQ(-0.213484990),FQ(-0.213110320),
-    FQ(-0.212735619),FQ(-0.212360886),FQ(-0.211986122),FQ(-0.211611327),FQ(-0.211236501),
-    FQ(-0.210861644),FQ(-0.210486756),FQ(-0.210111837),FQ(-0.209736887),FQ(-0.209361906),
-    FQ(-0.208986894),FQ(-0.208611852),FQ(-0.208236779),FQ(-0.207861675),FQ(-0.207486541),
-    FQ(-0.207111376),FQ(-0.206736181),FQ(-0.206360955),FQ(-0.205985699),FQ(-0.205610413),
-    FQ(-0.205235097),FQ(-0.204859750),FQ(-0.204484373),FQ(-0.204108966),FQ(-0.203733529),
-    FQ(-0.203358062),FQ(-0.202982565),FQ(-0.202607039),FQ(-0.202231482),FQ(-0.201855896),
-    FQ(-0.201480280),FQ(-0.201104635),FQ(-0.200728960),FQ(-0.200353255),FQ(-0.199977521),
-    FQ(-0.199601758),FQ(-0.199225965),FQ(-0.198850143),FQ(-0.198474291),FQ(-0.198098411),
-    FQ(-0.197722501),FQ(-0.197346562),FQ(-0.196970594),FQ(-0.196594598),FQ(-0.196218572),
-    FQ(-0.195842517),FQ(-0.195466434),FQ(-0.195090322),FQ(-0.194714181),FQ(-0.194338012),
-    FQ(-0.193961814),FQ(-0.193585587),FQ(-0.193209332),FQ(-0.192833049),FQ(-0.192456737),
-    FQ(-0.192080397),FQ(-0.191704029),FQ(-0.191327632),FQ(-0.190951208),FQ(-0.190574755),
-    FQ(-0.190198274),FQ(-0.189821765),FQ(-0.189445229),FQ(-0.189068664),FQ(-0.188692072),
-    FQ(-0.188315452),FQ(-0.187938804),FQ(-0.187562129),FQ(-0.187185426),FQ(-0.186808695),
-    FQ(-0.186431937),FQ(-0.186055152),FQ(-0.185678339),FQ(-0.185301499),FQ(-0.184924631),
-    FQ(-0.184547737),FQ(-0.184170815),FQ(-0.183793867),FQ(-0.183416891),FQ(-0.183039888),
-    FQ(-0.182662858),FQ(-0.182285802),FQ(-0.181908718),FQ(-0.181531608),FQ(-0.181154471),
-    FQ(-0.180777308),FQ(-0.180400118),FQ(-0.180022901),FQ(-0.179645658),FQ(-0.179268389),
-    FQ(-0.178891093),FQ(-0.178513771),FQ(-0.178136423),FQ(-0.177759048),FQ(-0.177381647),
-    FQ(-0.177004220),FQ(-0.176626768),FQ(-0.176249289),FQ(-0.175871784),FQ(-0.175494253),
-    FQ(-0.175116697),FQ(-0.174739115),FQ(-0.174361507),FQ(-0.173983873),FQ(-0.173606214),
-    FQ(-0.173228530),FQ(-0.172850820),FQ(-0.172473084),FQ(-0.172095323),FQ(-0.171717537),
-    FQ(-0.171339725),FQ(-0.170961889),FQ(-0.170584027),FQ(-0.170206140),FQ(-0.169828228),
-    FQ(-0.169450291),FQ(-0.169072329),FQ(-0.168694343),FQ(-0.168316331),FQ(-0.167938295),
-    FQ(-0.167560234),FQ(-0.167182148),FQ(-0.166804038),FQ(-0.166425904),FQ(-0.166047744),
-    FQ(-0.165669561),FQ(-0.165291353),FQ(-0.164913120),FQ(-0.164534864),FQ(-0.164156583),
-    FQ(-0.163778278),FQ(-0.163399949),FQ(-0.163021596),FQ(-0.162643219),FQ(-0.162264819),
-    FQ(-0.161886394),FQ(-0.161507945),FQ(-0.161129473),FQ(-0.160750977),FQ(-0.160372457),
-    FQ(-0.159993914),FQ(-0.159615347),FQ(-0.159236757),FQ(-0.158858143),FQ(-0.158479506),
-    FQ(-0.158100846),FQ(-0.157722162),FQ(-0.157343456),FQ(-0.156964726),FQ(-0.156585973),
-    FQ(-0.156207197),FQ(-0.155828398),FQ(-0.155449576),FQ(-0.155070731),FQ(-0.154691863),
-    FQ(-0.154312973),FQ(-0.153934060),FQ(-0.153555124),FQ(-0.153176166),FQ(-0.152797185),
-    FQ(-0.152418182),FQ(-0.152039156),FQ(-0.151660108),FQ(-0.151281038),FQ(-0.150901945),
-    FQ(-0.150522831),FQ(-0.150143694),FQ(-0.149764535),FQ(-0.149385354),FQ(-0.149006151),
-    FQ(-0.148626926),FQ(-0.148247679),FQ(-0.147868410),FQ(-0.147489120),FQ(-0.147109808),
-    FQ(-0.146730474),FQ(-0.146351119),FQ(-0.145971742),FQ(-0.145592344),FQ(-0.145212925),
-    FQ(-0.144833484),FQ(-0.144454021),FQ(-0.144074538),FQ(-0.143695033),FQ(-0.143315507),
-    FQ(-0.142935960),FQ(-0.142556392),FQ(-0.142176804),FQ(-0.141797194),FQ(-0.141417563),
-    FQ(-0.141037912),FQ(-0.140658239),FQ(-0.140278546),FQ(-0.139898833),FQ(-0.139519099),
-    FQ(-0.139139344),FQ(-0.138759569),FQ(-0.138379774),FQ(-0.137999958),FQ(-0.137620122),
-    FQ(-0.137240265),FQ(-0.136860389),FQ(-0.136480492),FQ(-0.136100575),FQ(-0.135720638),
-    FQ(-0.135340682),FQ(-0.134960705),FQ(-0.134580709),FQ(-0.134200692),FQ(-0.133820656),
-    FQ(-0.133440600),FQ(-0.133060525),FQ(-0.132680430),FQ(-0.132300316),FQ(-0.131920182),
-    FQ(-0.131540029),FQ(-0.131159856),FQ(-0.130779664),FQ(-0.130399453),FQ(-0.130019223),
-    FQ(-0.129638973),FQ(-0.129258705),FQ(-0.128878417),FQ(-0.128498111),FQ(-0.128117785),
-    FQ(-0.127737441),FQ(-0.127357078),FQ(-0.126976696),FQ(-0.126596296),FQ(-0.126215877),
-    FQ(-0.125835439),FQ(-0.125454983),FQ(-0.125074509),FQ(-0.124694016),FQ(-0.124313505),
-    FQ(-0.123932975),FQ(-0.123552427),FQ(-0.123171861),FQ(-0.122791277),FQ(-0.122410675),
-    FQ(-0.122030055),FQ(-0.121649417),FQ(-0.121268761),FQ(-0.120888087),FQ(-0.120507396),
-    FQ(-0.120126686),FQ(-0.119745959),FQ(-0.119365215),FQ(-0.118984453),FQ(-0.118603673),
-    FQ(-0.118222876),FQ(-0.117842062),FQ(-0.117461230),FQ(-0.117080381),FQ(-0.116699514),
-    FQ(-0.116318631),FQ(-0.115937730),FQ(-0.115556813),FQ(-0.115175878),FQ(-0.114794927),
-    FQ(-0.114413958),FQ(-0.114032973),FQ(-0.113651971),FQ(-0.113270952),FQ(-0.112889917),
-    FQ(-0.112508865),FQ(-0.112127796),FQ(-0.111746711),FQ(-0.111365610),FQ(-0.110984492),
-    FQ(-0.110603358),FQ(-0.110222207),FQ(-0.109841041),FQ(-0.109459858),FQ(-0.109078659),
-    FQ(-0.108697444),FQ(-0.108316213),FQ(-0.107934966),FQ(-0.107553704),FQ(-0.107172425),
-    FQ(-0.106791131),FQ(-0.106409821),FQ(-0.106028495),FQ(-0.105647154),FQ(-0.105265797),
-    FQ(-0.104884425),FQ(-0.104503037),FQ(-0.104121634),FQ(-0.103740215),FQ(-0.103358782),
-    FQ(-0.102977333),FQ(-0.102595869),FQ(-0.102214390),FQ(-0.101832896),FQ(-0.101451387),
-    FQ(-0.101069863),FQ(-0.100688324),FQ(-0.100306770),FQ(-0.099925202),FQ(-0.099543619),
-    FQ(-0.099162021),FQ(-0.098780409),FQ(-0.098398782),FQ(-0.098017140),FQ(-0.097635485),
-    FQ(-0.097253814),FQ(-0.096872130),FQ(-0.096490431),FQ(-0.096108718),FQ(-0.095726991),
-    FQ(-0.095345250),FQ(-0.094963495),FQ(-0.094581726),FQ(-0.094199943),FQ(-0.093818146),
-    FQ(-0.093436336),FQ(-0.093054511),FQ(-0.092672673),FQ(-0.092290822),FQ(-0.091908956),
-    FQ(-0.091527078),FQ(-0.091145185),FQ(-0.090763280),FQ(-0.090381361),FQ(-0.089999429),
-    FQ(-0.089617483),FQ(-0.089235524),FQ(-0.088853553),FQ(-0.088471568),FQ(-0.088089570),
-    FQ(-0.087707559),FQ(-0.087325535),FQ(-0.086943499),FQ(-0.086561449),FQ(-0.086179387),
-    FQ(-0.085797312),FQ(-0.085415225),FQ(-0.085033125),FQ(-0.084651013),FQ(-0.084268888),
-    FQ(-0.083886750),FQ(-0.083504601),FQ(-0.083122439),FQ(-0.082740265),FQ(-0.082358078),
-    FQ(-0.081975880),FQ(-0.081593669),FQ(-0.081211447),FQ(-0.080829212),FQ(-0.080446966),
-    FQ(-0.080064708),FQ(-0.079682438),FQ(-0.079300156),FQ(-0.078917863),FQ(-0.078535558),
-    FQ(-0.078153242),FQ(-0.077770914),FQ(-0.077388574),FQ(-0.077006223),FQ(-0.076623861),
-    FQ(-0.076241488),FQ(-0.075859103),FQ(-0.075476708),FQ(-0.075094301),FQ(-0.074711883),
-    FQ(-0.074329454),FQ(-0.073947014),FQ(-0.073564564),FQ(-0.073182102),FQ(-0.072799630),
-    FQ(-0.072417147),FQ(-0.072034653),FQ(-0.071652149),FQ(-0.071269634),FQ(-0.070887109),
-    FQ(-0.070504573),FQ(-0.070122027),FQ(-0.069739471),FQ(-0.069356904),FQ(-0.068974328),
-    FQ(-0.068591741),FQ(-0.068209144),FQ(-0.067826537),FQ(-0.067443920),FQ(-0.067061293),
-    FQ(-0.066678656),FQ(-0.066296009),FQ(-0.065913353),FQ(-0.065530687),FQ(-0.065148011),
-    FQ(-0.064765326),FQ(-0.064382631),FQ(-0.063999927),FQ(-0.063617213),FQ(-0.063234490),
-    FQ(-0.062851758),FQ(-0.062469016),FQ(-0.062086265),FQ(-0.061703505),FQ(-0.061320736),
-    FQ(-0.060937958),FQ(-0.060555171),FQ(-0.060172375),FQ(-0.059789571),FQ(-0.059406757),
-    FQ(-0.059023935),FQ(-0.058641104),FQ(-0.058258265),FQ(-0.057875416),FQ(-0.057492560),
-    FQ(-0.057109695),FQ(-0.056726821),FQ(-0.056343939),FQ(-0.055961049),FQ(-0.055578151),
-    FQ(-0.055195244),FQ(-0.054812330),FQ(-0.054429407),FQ(-0.054046476),FQ(-0.053663538),
-    FQ(-0.053280591),FQ(-0.052897637),FQ(-0.052514675),FQ(-0.052131705),FQ(-0.051748727),
-    FQ(-0.051365742),FQ(-0.050982749),FQ(-0.050599749),FQ(-0.050216741),FQ(-0.049833726),
-    FQ(-0.049450704),FQ(-0.049067674),FQ(-0.048684637),FQ(-0.048301593),FQ(-0.047918542),
-    FQ(-0.047535484),FQ(-0.047152419),FQ(-0.046769347),FQ(-0.046386268),FQ(-0.046003182),
-    FQ(-0.045620090),FQ(-0.045236990),FQ(-0.044853884),FQ(-0.044470772),FQ(-0.044087653),
-    FQ(-0.043704527),FQ(-0.043321395),FQ(-0.042938257),FQ(-0.042555112),FQ(-0.042171961),
-    FQ(-0.041788804),FQ(-0.041405641),FQ(-0.041022472),FQ(-0.040639296),FQ(-0.040256115),
-    FQ(-0.039872928),FQ(-0.039489734),FQ(-0.039106535),FQ(-0.038723331),FQ(-0.038340120),
-    FQ(-0.037956904),FQ(-0.037573683),FQ(-0.037190456),FQ(-0.036807223),FQ(-0.036423985),
-    FQ(-0.036040742),FQ(-0.035657493),FQ(-0.035274239),FQ(-0.034890980),FQ(-0.034507716),
-    FQ(-0.034124446),FQ(-0.033741172),FQ(-0.033357893),FQ(-0.032974608),FQ(-0.032591319),
-    FQ(-0.032208025),FQ(-0.031824727),FQ(-0.031441424),FQ(-0.031058116),FQ(-0.030674803),
-    FQ(-0.030291486),FQ(-0.029908165),FQ(-0.029524839),FQ(-0.029141509),FQ(-0.028758174),
-    FQ(-0.028374836),FQ(-0.027991493),FQ(-0.027608146),FQ(-0.027224795),FQ(-0.026841440),
-    FQ(-0.026458081),FQ(-0.026074718),FQ(-0.025691351),FQ(-0.025307981),FQ(-0.024924606),
-    FQ(-0.024541229),FQ(-0.024157847),FQ(-0.023774462),FQ(-0.023391073),FQ(-0.023007681),
-    FQ(-0.022624286),FQ(-0.022240887),FQ(-0.021857485),FQ(-0.021474080),FQ(-0.021090672),
-    FQ(-0.020707261),FQ(-0.020323846),FQ(-0.019940429),FQ(-0.019557008),FQ(-0.019173585),
-    FQ(-0.018790159),FQ(-0.018406730),FQ(-0.018023298),FQ(-0.017639864),FQ(-0.017256427),
-    FQ(-0.016872988),FQ(-0.016489546),FQ(-0.016106102),FQ(-0.015722655),FQ(-0.015339206),
-    FQ(-0.014955755),FQ(-0.014572302),FQ(-0.014188846),FQ(-0.013805389),FQ(-0.013421929),
-    FQ(-0.013038467),FQ(-0.012655004),FQ(-0.012271538),FQ(-0.011888071),FQ(-0.011504602),
-    FQ(-0.011121131),FQ(-0.010737659),FQ(-0.010354185),FQ(-0.009970710),FQ(-0.009587233),
-    FQ(-0.009203755),FQ(-0.008820275),FQ(-0.008436794),FQ(-0.008053312),FQ(-0.007669829),
-    FQ(-0.007286344),FQ(-0.006902859),FQ(-0.006519372),FQ(-0.006135885),FQ(-0.005752396),
-    FQ(-0.005368907),FQ(-0.004985417),FQ(-0.004601926),FQ(-0.004218435),FQ(-0.003834943),
-    FQ(-0.003451450),FQ(-0.003067957),FQ(-0.002684463),FQ(-0.002300969),FQ(-0.001917475),
-    FQ(-0.001533980),FQ(-0.001150485),FQ(-0.000766990),FQ(-0.000383495)
+    FQ(+0.999999926),FQ(+1.000000000)
 };
 
 int dsp_atan_14[16384] =
@@ -17511,3 +14969,5 @@ int dsp_nexp_14[16384] =
     FQ(+0.999663060),FQ(+0.999663224),FQ(+0.999663389),FQ(+0.999663553),FQ(+0.999663717),
     FQ(+0.999663882),FQ(+0.999664046),FQ(+0.999664210),FQ(+0.999664374)
 };
+
+#endif
@@ -10,6 +10,101 @@
 #define FQ(hh) (((hh)<0.0)?((int)((double)(1u<<QQ)*(hh)-0.5)):((int)(((double)(1u<<QQ)-1)*(hh)+0.5)))
 #define QF(xx) (((int)(xx)<0)?((double)(int)(xx))/(1u<<QQ):((double)(xx))/((1u<<QQ)-1))
 
+// Instruction primitives. Every kernel in DSP.I and DSP.C is written in terms of these so that the
+// same source builds for the XS1/XS2 device (inline assembly, the default) or for a host computer
+// with bit-exact results (portable C, selected by compiling with -DDSP_HOST).
+//
+// LDD/STD load/store the two 32-bit words at PP[2*II+1] (HI) and PP[2*II+0] (LO), II is a literal
+// MACCS computes AH:AL = H0:L0 + XX * YY (signed 32x32 multiply, signed 64-bit accumulate)
+// LEXTRACT extracts bits SS+31..SS of the 64-bit value AH:AL into RR
+// LSATS saturates AH:AL to the range of a signed 32+SS bit value
+// CRC32 updates the CRC value RR with data word XX and (reflected) polynomial PP
+// LDIVU divides the unsigned 64-bit value AH:AL by XX giving quotient QQ and remainder RR
+
+#ifdef DSP_HOST
+
+// Counting of executed DSP instructions for the benchmark (see DSP_BENCH.C).
+
+#ifdef DSP_BENCH
+extern unsigned dsp_bench_ops;
+#define DSP_OP() ++dsp_bench_ops
+#else
+#define DSP_OP()
+#endif
+
+#define DSP_LDD( hi, lo, pp, ii ) \
+do { \
+    DSP_OP(); \
+    const int* _pp = (const int*)(pp) + 2*(ii); \
+    (hi) = _pp[1]; (lo) = _pp[0]; \
+} while( 0 )
+
+#define DSP_STD( hi, lo, pp, ii ) \
+do { \
+    DSP_OP(); \
+    int _hi = (hi), _lo = (lo); int* _pp = (int*)(pp) + 2*(ii); \
+    _pp[1] = _hi; _pp[0] = _lo; \
+} while( 0 )
+
+#define DSP_MACCS( ah, al, xx, yy, h0, l0 ) \
+do { \
+    DSP_OP(); \
+    unsigned long long _aa = ((unsigned long long)(unsigned)(h0) << 32) | (unsigned)(l0); \
+    _aa += (unsigned long long)((long long)(int)(xx) * (long long)(int)(yy)); \
+    (ah) = (int)(unsigned)(_aa >> 32); (al) = (unsigned)_aa; \
+} while( 0 )
+
+#define DSP_LEXTRACT( rr, ah, al, ss ) \
+do { \
+    DSP_OP(); \
+    unsigned long long _aa = ((unsigned long long)(unsigned)(ah) << 32) | (unsigned)(al); \
+    (rr) = (int)(unsigned)(_aa >> (ss)); \
+} while( 0 )
+
+#define DSP_LSATS( ah, al, ss ) \
+do { \
+    DSP_OP(); \
+    long long _aa = (long long)(((unsigned long long)(unsigned)(ah) << 32) | (unsigned)(al)); \
+    long long _mx = (long long)((1ull << (31+(ss))) - 1), _mn = -_mx - 1; \
+    if( _aa > _mx ) _aa = _mx; if( _aa < _mn ) _aa = _mn; \
+    (ah) = (int)(unsigned)((unsigned long long)_aa >> 32); (al) = (unsigned)_aa; \
+} while( 0 )
+
+#define DSP_CRC32( rr, xx, pp ) \
+do { \
+    DSP_OP(); \
+    unsigned _rr = (unsigned)(rr) ^ (unsigned)(xx); \
+    for( int _ii = 0; _ii < 32; ++_ii ) _rr = (_rr & 1) ? (_rr >> 1) ^ (unsigned)(pp) : (_rr >> 1); \
+    (rr) = _rr; \
+} while( 0 )
+
+#define DSP_LDIVU( qq, rr, ah, al, xx ) \
+do { \
+    DSP_OP(); \
+    unsigned long long _aa = ((unsigned long long)(unsigned)(ah) << 32) | (unsigned)(al); \
+    unsigned _xx = (unsigned)(xx); \
+    (qq) = (unsigned)(_aa / _xx); (rr) = (unsigned)(_aa % _xx); \
+} while( 0 )
+
+#else
+
+#define DSP_LDD( hi, lo, pp, ii ) \
+    asm volatile("ldd %0,%1,%2[" #ii "]":"=r"(hi),"=r"(lo):"r"(pp))
+#define DSP_STD( hi, lo, pp, ii ) \
+    asm volatile("std %0,%1,%2[" #ii "]"::"r"(hi),"r"(lo),"r"(pp))
+#define DSP_MACCS( ah, al, xx, yy, h0, l0 ) \
+    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(xx),"r"(yy),"0"(h0),"1"(l0))
+#define DSP_LEXTRACT( rr, ah, al, ss ) \
+    asm volatile("lextract %0,%1,%2,%3,32":"=r"(rr):"r"(ah),"r"(al),"r"(ss))
+#define DSP_LSATS( ah, al, ss ) \
+    asm volatile("lsats %0,%1,%2":"=r"(ah),"=r"(al):"r"(ss),"0"(ah),"1"(al))
+#define DSP_CRC32( rr, xx, pp ) \
+    asm volatile("crc32 %0,%2,%3":"=r"(rr):"0"(rr),"r"(xx),"r"(pp))
+#define DSP_LDIVU( qq, rr, ah, al, xx ) \
+    asm volatile("ldivu %0,%1,%2,%3,%4":"=r"(qq),"=r"(rr):"r"(ah),"r"(al),"r"(xx))
+
+#endif
+
 // MAC performs 32x32 multiply and 64-bit accumulation, SAT saturates a 64-bit result, EXT converts
 // a 64-bit result to a 32-bit value (extract 32 from 64), LD2/ST2 loads/stores two 32-values
 // from/to 64-bit aligned 32-bit data arrays at address PP. All 32-bit fixed-point values are QQQ
@@ -19,39 +114,129 @@
 // XX, YY, and AA are 32-bit QQQ fixed point values
 // PP is a 64-bit aligned pointer to two 32-bit QQQ values
 
-#define DSP_LD2( pp, xx, yy )     asm volatile("ldd %0,%1,%2[0]":"=r"(xx),"=r"(yy):"r"(pp));
-#define DSP_ST2( pp, xx, yy )     asm volatile("std %0,%1,%2[0]"::"r"(xx), "r"(yy),"r"(pp));
-#define DSP_MUL( ah, al, xx, yy ) asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(xx),"r"(yy),"0"(0),"1"(1<<(QQ-1)) );
-#define DSP_MAC( ah, al, xx, yy ) asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(xx),"r"(yy),"0"(ah),"1"(al) );
-#define DSP_SAT( ah, al )         asm volatile("lsats %0,%1,%2":"=r"(ah),"=r"(al):"r"(QQ),"0"(ah),"1"(al));
-#define DSP_EXT( ah, al, xx )     asm volatile("lextract %0,%1,%2,%3,32":"=r"(xx):"r"(ah),"r"(al),"r"(QQ));
-#define DSP_DIV( qq,rr,ah,al,xx ) asm volatile("ldivu %0,%1,%2,%3,%4":"=r"(qq):"r"(rr),"r"(ah),"r"(al),"r"(xx));
+#define DSP_LD2( pp, xx, yy )     DSP_LDD( xx, yy, pp, 0 );
+#define DSP_ST2( pp, xx, yy )     DSP_STD( xx, yy, pp, 0 );
+#define DSP_MUL( ah, al, xx, yy ) DSP_MACCS( ah, al, xx, yy, 0, 1<<(QQ-1) );
+#define DSP_MAC( ah, al, xx, yy ) DSP_MACCS( ah, al, xx, yy, ah, al );
+#define DSP_SAT( ah, al )         DSP_LSATS( ah, al, QQ );
+#define DSP_EXT( ah, al, xx )     DSP_LEXTRACT( xx, ah, al, QQ );
+#define DSP_DIV( qq,rr,ah,al,xx ) DSP_LDIVU( qq, rr, ah, al, xx );
 
 inline int dsp_mul( int xx, int yy ) // RR = XX * YY
 {
     int ah = 0; unsigned al = 1<<(QQ-1);
-    asm("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(xx),"r"(yy),"0"(ah),"1"(al) );
-    asm("lextract %0,%1,%2,%3,32":"=r"(ah):"r"(ah),"r"(al),"r"(QQ));
+    DSP_MACCS( ah, al, xx, yy, ah, al );
+    DSP_LEXTRACT( ah, ah, al, QQ );
     return ah;
 }
 
 inline int dsp_mac( int xx, int yy, int zz ) // RR = XX * YY + ZZ
 {
     int ah = 0; unsigned al = 0;
-    asm("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(xx),"r"(yy),"0"(0),"1"(zz) );
-    asm("lextract %0,%1,%2,%3,32":"=r"(ah):"r"(ah),"r"(al),"r"(QQ));
+    DSP_MACCS( ah, al, xx, yy, 0, zz );
+    DSP_LEXTRACT( ah, ah, al, QQ );
     return ah;
 }
 
 inline int dsp_ext( int ah, int al ) // RR = AH:AL >> (64-QQ)
 {
-    asm volatile("lextract %0,%1,%2,%3,32":"=r"(ah):"r"(ah),"r"(al),"r"(QQ));
+    DSP_LEXTRACT( ah, ah, al, QQ );
     return ah;
 }
 
-extern int dsp_sine_10[ 1024], dsp_atan_10[ 1024], dsp_tanh_10[ 1024], dsp_nexp_10[ 1024];
-extern int dsp_sine_12[ 4096], dsp_atan_12[ 4096], dsp_tanh_12[ 4096], dsp_nexp_12[ 4096];
-extern int dsp_sine_14[16384], dsp_atan_14[16384], dsp_tanh_14[16384], dsp_nexp_14[16384];
+extern int dsp_halfband_31[8]; // Half-band filter for 'oversample' stages after the first
+
+// Lookup tables (see DSP.C). Sine tables hold a quarter wave - use 'dsp_sine_10/12/14' to look up
+// sin(2*pi*II/2^10/12/14) for any II (cosine is II plus a quarter cycle). Tables that are not used
+// are not linked. Builds with DSP_TABLES_INIT defined don't ship the tables in the image/flash,
+// instead 'dsp_tables_init' generates the selected tables (a constant OR of DSP_SINE_10 etc.) at
+// boot, e.g. 'dsp_tables_init( DSP_SINE_14 | DSP_TANH_12 )' in 'xio_initialize'.
+
+extern int dsp_qsine_10[  257], dsp_atan_10[ 1024], dsp_tanh_10[ 1024], dsp_nexp_10[ 1024];
+extern int dsp_qsine_12[ 1025], dsp_atan_12[ 4096], dsp_tanh_12[ 4096], dsp_nexp_12[ 4096];
+extern int dsp_qsine_14[ 4097], dsp_atan_14[16384], dsp_tanh_14[16384], dsp_nexp_14[16384];
+
+inline int dsp_sine( const int* tt, int nn, int ii ) // RR = sin(2*pi*II/2^NN), TT is quarter wave
+{
+    int qq = 1 << (nn-2), jj = ii & (qq-1);
+    if( ii & qq ) jj = qq - jj;
+    return (ii & (2*qq)) ? -tt[jj] : tt[jj];
+}
+
+inline int dsp_sine_10( int ii ) { return dsp_sine( dsp_qsine_10, 10, ii ); }
+inline int dsp_sine_12( int ii ) { return dsp_sine( dsp_qsine_12, 12, ii ); }
+inline int dsp_sine_14( int ii ) { return dsp_sine( dsp_qsine_14, 14, ii ); }
+
+#define DSP_SINE_10 0x001
+#define DSP_ATAN_10 0x002
+#define DSP_TANH_10 0x004
+#define DSP_NEXP_10 0x008
+#define DSP_SINE_12 0x010
+#define DSP_ATAN_12 0x020
+#define DSP_TANH_12 0x040
+#define DSP_NEXP_12 0x080
+#define DSP_SINE_14 0x100
+#define DSP_ATAN_14 0x200
+#define DSP_TANH_14 0x400
+#define DSP_NEXP_14 0x800
+
+void dsp_table_make( int* tt, int table ); // Generate one table (not for real-time threads)
+
+#ifdef DSP_TABLES_INIT
+#define dsp_tables_init( tables ) \
+do { \
+    if( (tables) & DSP_SINE_10 ) dsp_table_make( dsp_qsine_10, DSP_SINE_10 ); \
+    if( (tables) & DSP_ATAN_10 ) dsp_table_make( dsp_atan_10,  DSP_ATAN_10 ); \
+    if( (tables) & DSP_TANH_10 ) dsp_table_make( dsp_tanh_10,  DSP_TANH_10 ); \
+    if( (tables) & DSP_NEXP_10 ) dsp_table_make( dsp_nexp_10,  DSP_NEXP_10 ); \
+    if( (tables) & DSP_SINE_12 ) dsp_table_make( dsp_qsine_12, DSP_SINE_12 ); \
+    if( (tables) & DSP_ATAN_12 ) dsp_table_make( dsp_atan_12,  DSP_ATAN_12 ); \
+    if( (tables) & DSP_TANH_12 ) dsp_table_make( dsp_tanh_12,  DSP_TANH_12 ); \
+    if( (tables) & DSP_NEXP_12 ) dsp_table_make( dsp_nexp_12,  DSP_NEXP_12 ); \
+    if( (tables) & DSP_SINE_14 ) dsp_table_make( dsp_qsine_14, DSP_SINE_14 ); \
+    if( (tables) & DSP_ATAN_14 ) dsp_table_make( dsp_atan_14,  DSP_ATAN_14 ); \
+    if( (tables) & DSP_TANH_14 ) dsp_table_make( dsp_tanh_14,  DSP_TANH_14 ); \
+    if( (tables) & DSP_NEXP_14 ) dsp_table_make( dsp_nexp_14,  DSP_NEXP_14 ); \
+} while( 0 )
+#else
+#define dsp_tables_init( tables ) do {} while( 0 ) // Tables are initialized data
+#endif
+
+// Table-free approximations (see DSP.I) - an alternative to the lookup tables and to gain-model LUTs
+// at the cost of a few more instructions. XX and results are QQQ, SIN's XX is the phase in cycles.
+// Error is the measured maximum absolute error over the whole QQQ input range (LSB is 3.7e-9), ops
+// are the MACCS/LEXTRACT/LDIVU count from 'bench.sh host' (run 'bench.sh' for device cycles).
+//
+//   dsp_tanh_poly3  Pade 3/2, saturates at |XX| >= 3.0     error 2.4e-2   9 ops (one LDIVU)
+//   dsp_tanh_poly5  Pade 5/4, saturates at |XX| >= 4.97    error 1.4e-3  13 ops (one LDIVU)
+//   dsp_tanh_poly7  Pade 7/6, saturates at |XX| >= 6.95    error 9.6e-5  17 ops (one LDIVU)
+//   dsp_atan_poly   Minimax degree 17, uses 1/XX if |XX|>1 error 1.9e-8  21 ops (one LDIVU)
+//   dsp_exp2_poly   Minimax degree 6, saturates at XX >= 3 error 6e-9 (relative)  12 ops
+//   dsp_sin_poly    Minimax degree 9, quarter-wave folded  error 1.5e-8  12 ops
+//
+// For comparison 'dsp_tanh_14' with linear interpolation is about 2e-8 and takes 64 KB.
+
+int  dsp_tanh_poly3( int xx );                        // tanh(xx)
+int  dsp_tanh_poly5( int xx );                        // tanh(xx)
+int  dsp_tanh_poly7( int xx );                        // tanh(xx)
+int  dsp_atan_poly ( int xx );                        // atan(xx) in radians
+int  dsp_exp2_poly ( int xx );                        // 2^xx
+int  dsp_sin_poly  ( int xx );                        // sin(2*pi*xx), xx in cycles
+
+// Log-domain conversions for per-sample gain computation (dynamics, metering, gain smoothing). Log2
+// and dB values are Q24 (QQ-4 fractional bits, range +/-128), linear values are QQQ. LOG2 and
+// LIN_TO_DB return -128.0 (0x80000000) for XX <= 0 and LIN_TO_DB also for levels below -128 dB.
+// EXP2 and DB_TO_LIN saturate at 2^3 (+18 dB). See DSP.I for the method.
+//
+//   dsp_log2        CLZ and minimax degree 9 in M-1        error 5.1e-8          18 ops
+//   dsp_exp2        dsp_exp2_poly of the fractional part   error 1.1e-8 (relative)  12 ops
+//   dsp_db_to_lin   exp2(XX*log2(10)/20)                   error 3.3e-8 (relative)  14 ops
+//   dsp_lin_to_db   log2(XX)*20*log10(2)                   error 7.2e-7 dB       20 ops
+
+int  dsp_log2      ( int xx );                        // log2(xx), Q24 result
+int  dsp_exp2      ( int xx );                        // 2^xx, Q24 xx
+int  dsp_db_to_lin ( int xx );                        // 10^(xx/20), Q24 xx in dB
+int  dsp_lin_to_db ( int xx );                        // 20*log10(xx), Q24 result in dB
 
 // Math and filter functions.
 //
@@ -68,14 +253,14 @@ extern int dsp_sine_14[16384], dsp_atan_14[16384], dsp_tanh_14[16384], dsp_nexp_
 // AH (high) and AL (low) form the 64-bit signed accumulator
 
 int  math_random ( int gg, int seed );               // Random number, gg = previous value
-int  math_sqr_x  ( int xx );                         // r = xx^0.5
+int  math_sqr_x  ( int xx );                         // r = xx^0.5 (<1 LSB, 17 ops, 0 if xx<=0)
 int  math_min_X  ( const int* xx, int nn );          // r = min(X[0:N-1])
 int  math_max_X  ( const int* xx, int nn );          // r = max(X[0:N-1])
 int  math_avg_X  ( const int* xx, int nn );          // r = mean(X[0:N-1])
-int  math_rms_X  ( const int* xx, int nn );          // r = sum(X[0:N-1]*X[0:N-1]) ^ 0.5
+int  math_rms_X  ( const int* xx, int nn );          // r = (sum(X[0:N-1]*X[0:N-1])/N) ^ 0.5, N <= 16384
 void math_sum_X  ( const int* xx, int nn, int* ah, unsigned* al ); // ah:al = sum(X[0:N-1])
 void math_asm_X  ( const int* xx, int nn, int* ah, unsigned* al ); // ah:al = sum(abs(X[0:N-1))
-void math_pwr_X  ( const int* xx, int nn, int* ah, unsigned* al ); // ah:al = sum(X[0:N-1]*X[0:N-1])
+void math_pwr_X  ( const int* xx, int nn, int* ah, unsigned* al ); // ah:al = sum(X[0:N-1]*X[0:N-1])/64
 void math_abs_X  ( int* xx, int nn );                // X[0:N-1] = abs(X[0:N-1])
 void math_sqr_X  ( int* xx, int nn );                // X[0:N-1] = X[0:N-1]^0.5
 void math_mac_X1z( int* xx, int        zz, int nn ); // X[0:N-1] = X[0:N-1] + zz
@@ -98,28 +283,162 @@ void math_mac_XYZ( int* xx, const int* yy, const int* zz, int nn ); // X[] = X[]
 // NN is number of samples in XX for scalar and vector math functions
 // CC is array of 32-bit filter coefficients - length is 'nn' for FIR, nn * 5 for IIR
 // CU is array of coefficients specifically for FIR upsampling - see 'mix_fir_coeffs'
-// SS is array of 32-bit filter state - length is 'nn' for FIR, nn * 4 for IIR
+// SS is array of 32-bit filter state - length is 'nn' for FIR, 'nn/rr' for FIR_UP, nn * 4 for IIR
 // SS is array of 32-bit filter state - length is 3 for DCBLOCK, 2 for state-variable filter
+// Fc is the cutoff frequency as a fraction of the sample rate (0 < Fc < 0.5), 1/Q is 0 to 2
 // CC length is 3/5/7 and SS length is 2/4/6 fir IIR1/IIR2/IIR3 respectively
 // RR is the up-sampling/interpolation or down-sampling/decimation ratio
+// NN is the number of non-zero coefficients before the center tap for 'halfband' and 'oversample'
+// functions (4*NN-1 taps, NN multiple of 4), SS length is 2*NN (up) or 3*NN (dn) per 2x stage
+// NN is the number of CIC stages for 'cic' functions (NN*log2(RR) <= 32), CC is NULL or 8 taps of
+// CIC compensation FIR (see 'calc_cic_comp'), SS length is 4*NN+10 and must be zeroed initially
+// BB is the block size (2, 4, 8 or 16) for 'block' functions, XX[0:BB-1] in time order (oldest
+// first), SS length is NN+BB for FIR and NN*24+BB for CONVOLVE (AH and AL are arrays of BB)
 // AH (high) and AL (low) form the 64-bit signed accumulator
 
 int  dsp_blend   ( int dry, int wet, int blend );     // 0 (100% dry) <= MM <= 1 (100% wet)
 int  dsp_interp  ( int  dd, int y1, int y2 );         // 1st order (linear) interpolation
 int  dsp_lagrange( int  dd, int y1, int y2, int y3 ); // 2nd order (Lagrange) interpolation
-void dsp_statevar( int* xx, const int* cc, int* ss ); // x[0]=in,xx[0:2]=lp/bp/hp out, c[0]=Fc,cc[1]=Q
+void dsp_statevar( int* xx, const int* cc, int* ss ); // xx[0]=in,xx[0:3]=lp/bp/hp/notch, cc[0]=Fc,cc[1]=1/Q
 int  dsp_iir1    ( int  xx, const int* cc, int* ss ); // 1st order IIR filter - cc[3]=b0,b1,a1
 int  dsp_iir2    ( int  xx, const int* cc, int* ss ); // 2nd order IIR filter - cc[5]=b0,b1,b2,a1,a2
 int  dsp_iir3    ( int  xx, const int* cc, int* ss ); // 3rd order IIR filter - cc[7]=b0..b3,a1..a3
 int  dsp_biquad  ( int  xx, const int* cc, int* ss, int nn ); // nn Cascaded bi-quad IIR filters
+void dsp_biquad_multi( int* xx, const int* cc, int* ss, int nn, int ch ); // xx[ch], ss[ch*nn*4]
 int  dsp_fir     ( int  xx, const int* cc, int* ss, int nn ); // FIR filter of nn taps
 void dsp_fir_up  ( int* xx, const int* cU, int* ss, int nn, int rr ); // FIR up-sampling/interpolation
 void dsp_fir_dn  ( int* xx, const int* cc, int* ss, int nn, int rr ); // FIR dn-sampling/decimation
+int  dsp_fir_sym ( int  xx, const int* cc, int* ss, int nn ); // Symmetric FIR, cc[nn/2], nn%8==0
+void dsp_fir_dn_sym( int* xx, const int* cc, int* ss, int nn, int rr ); // Symmetric FIR dn-sampling
 void dsp_cic_up  ( int* xx, const int* cc, int* ss, int nn, int rr ); // CIC up-sampling/interpolation
 void dsp_cic_dn  ( int* xx, const int* cc, int* ss, int nn, int rr ); // CIC dn-sampling/decimation
+void dsp_halfband_up( int* xx, const int* cc, int* ss, int nn ); // Half-band 2x up-sampling
+void dsp_halfband_dn( int* xx, const int* cc, int* ss, int nn ); // Half-band 2x dn-sampling
+void dsp_oversample2x_up( int* xx, const int* cc, int* ss, int nn ); // Half-band cascade, 1 stage
+void dsp_oversample4x_up( int* xx, const int* cc, int* ss, int nn ); // Half-band cascade, 2 stages
+void dsp_oversample8x_up( int* xx, const int* cc, int* ss, int nn ); // Half-band cascade, 3 stages
+void dsp_oversample2x_dn( int* xx, const int* cc, int* ss, int nn ); // Half-band cascade, 1 stage
+void dsp_oversample4x_dn( int* xx, const int* cc, int* ss, int nn ); // Half-band cascade, 2 stages
+void dsp_oversample8x_dn( int* xx, const int* cc, int* ss, int nn ); // Half-band cascade, 3 stages
 int  dsp_convolve( int  xx, const int* cc, int* ss, int* ah, int* al, int nn ); // NN*24 taps
+void dsp_fir_block   ( int* xx, const int* cc, int* ss, int nn, int bb ); // BB samples of FIR
+void dsp_biquad_block( int* xx, const int* cc, int* ss, int nn, int bb ); // BB samples of bi-quads
+void dsp_convolve_block( int* xx, const int* cc, int* ss, int* ah, int* al, int nn, int bb );
+
+// Fixed-point FFT's with block floating point scaling (see DSP.C). XX is 64-bit aligned, the return
+// value is the block exponent EE (true values are XX * 2^EE).
+//
+// NN is the number of complex points (4 to 16384) for FFT and IFFT, XX length is 2*NN (re,im)
+// NN is the number of real points (8 to 16384) for RFFT, IRFFT and RFFT_MUL, XX length is NN with
+// XX[0]=DC, XX[1]=Nyquist and re,im of bins 1 to NN/2-1 in XX[2:NN-1]
+
+int  dsp_fft     ( int* xx, int nn );                 // Forward complex FFT
+int  dsp_ifft    ( int* xx, int nn );                 // Inverse complex FFT (including 1/NN)
+int  dsp_rfft    ( int* xx, int nn );                 // Forward real FFT, packed spectrum out
+int  dsp_irfft   ( int* xx, int nn );                 // Inverse real FFT (including 1/NN)
+void dsp_rfft_mul( int* xx, const int* yy, int nn );  // XX = XX * YY (packed spectra)
+
+// Partitioned FFT convolution for long impulse responses (see DSP.C). Output is delayed by 2*BB.
+//
+// CC is the impulse response of NN taps, BB is the partition size (8 to 8192, power of 2)
+// SS length is 24+7*BB+4*BB*PP where PP=(NN+BB-1)/BB is the number of partitions
+// DD is the position (in taps, DD >= 2*BB) of a segment CC of a longer IR, PP=(NN+DD-BB-1)/BB
+
+void dsp_fftconv_init( int* ss, const int* cc, int nn, int bb ); // Not for real-time threads
+void dsp_fftconv_tail( int* ss, const int* cc, int nn, int dd, int bb ); // IR tail, no latency
+int  dsp_fftconv     ( int  xx, int* ss );            // One sample in/out, 1/BB of a block's work
+
+// Sample-accurate coefficient ramping. New coefficients (e.g. from a property) are set as the ramp
+// target in the DSP thread and 'dsp_ramp' moves the live coefficients CC linearly to the target
+// over 2^SS samples, removing zipper noise without re-sending coefficients every millisecond.
+//
+// CC is the live coefficient array used by the filter, NN is the number of coefficients
+// RR is the ramp state - length is 2+2*NN, TT is the new target coefficients (length NN)
+
+void dsp_ramp_init( int* cc, int* rr, int nn );        // Ramp state for CC (not ramping)
+void dsp_ramp_set ( int* cc, int* rr, const int* tt, int ss ); // Ramp CC to TT over 2^SS samples
+void dsp_ramp     ( int* cc, int* rr );                // Call once per sample, before the filter
+
+// Double-buffered coefficient banks for coefficient sets that take more than one property. The
+// properties are written to the inactive (staging) bank and the last one commits the set, which
+// flips the active bank at a sample boundary - filters see either the complete old or the complete
+// new set. The last property carries a check-sum of the complete set so a set is only committed if
+// all of it arrived (the control task may skip properties that have not changed).
+//
+// BK is the bank pair - length is 2+2*NN, NN is the number of coefficients (even) per bank
+// XX is NN words of coefficients written to the staging bank at offset II
+// CS is the check-sum of the complete new set as calculated by 'dsp_bank_sum'
+
+void dsp_bank_init  ( int* bk, const int* cc, int nn );         // Both banks set to CC
+void dsp_bank_stage ( int* bk, const int* xx, int ii, int nn ); // Staging bank[II:II+NN-1] = XX
+int  dsp_bank_commit( int* bk, int cs );              // Returns 1 if the staging bank became active
+int  dsp_bank_sum   ( const int* cc, int nn );        // Check-sum of a complete coefficient set
+int* dsp_bank       ( int* bk );                      // The active bank (use as filter CC)
+
+// Numerically controlled oscillators (LFO's) for modulation effects - a bank of phase accumulators
+// updated together once per sample. Outputs are -1.0 to +1.0 (QQQ). Rate changes keep the phase.
+//
+// NC is the NCO bank - length is 1+6*NN, NN is the number of oscillators
+// II is the oscillator, RATE is the frequency in cycles per sample (QQQ, Fc/Fs, negative runs the
+// phase backwards), OFFSET is the phase offset in cycles (QQQ, e.g. FQ(0.25) for quadrature)
+// YY[0:NN-1] are the oscillator outputs
+// SHAPE is DSP_NCO_SINE (12 ops), TRIANGLE, SAW, SQUARE or HOLD (random value every cycle)
 
-// FIXME: dsp_statevar is not working properly.
+#define DSP_NCO_SINE     0
+#define DSP_NCO_TRIANGLE 1
+#define DSP_NCO_SAW      2
+#define DSP_NCO_SQUARE   3
+#define DSP_NCO_HOLD     4
+
+void dsp_nco_init( int* nc, int nn );                 // All oscillators DSP_NCO_SINE, rate 0
+void dsp_nco_set ( int* nc, int ii, int shape, int rate, int offset ); // Configure oscillator II
+void dsp_nco     ( int* nc, int* yy );                // Advance all oscillators one sample
+
+// Waveshaper for amp/tube gain stages - DC blocker, gain, bias, table lookup with 3-point Lagrange
+// interpolation and slew-rate limiting, plus optional bi-quad pre and post-filters and a 6th order
+// FIR that attenuates the interpolation noise (DSP_SHAPER_FIR). 14 ops, 48 with all stages.
+//
+// LUT is the transfer curve - LUT[0] is the index resolution in bits, LUT[1] is the table length NN
+// and LUT[2:NN+1] is the curve from -1.0 to +1.0 in 2^bits steps (see 'calc_waveshaper')
+// CC is block, gain, bias, slew, 0, 0, pre-filter (5 bi-quad coefficients, 0), post-filter (5, 0)
+// SS length is 18 (4 if FF is zero) and must be zeroed, FF is an OR of the DSP_SHAPER stages
+
+#define DSP_SHAPER_PRE  1
+#define DSP_SHAPER_FIR  2
+#define DSP_SHAPER_POST 4
+
+int dsp_waveshaper( int xx, const int* lut, const int* cc, int* ss, int ff ); // Shape one sample
+
+// Delay lines with power-of-two ring buffers (masked indexing, no wrap-around branches). Write one
+// sample per sample period (or a block), then read any number of taps at integer or fractional
+// delays. DD=0 is the newest sample, FF (0 <= FF < 1, QQQ) is the fractional part of the delay.
+//
+// DL is the delay line - length is 2+NN, NN is the buffer size (power of 2), DD+3 < NN
+// LIN/LAGR interpolate between DD and DD+1 using DD+1 (LIN) or DD+1 and DD+2 (LAGR, 2nd order)
+// HERM is 4-point 3rd order Hermite using DD-1 to DD+2 (DD >= 1)
+// ALLP is 1st order allpass (flat magnitude, 0 < FF < 2, best 0.1 to 1.1, one LDIVU), SS length is 1
+// per tap - use DD-1 and FF+1 for fractions below 0.1 (DD >= 1)
+// XX[0:BB-1] are in time order (oldest first) for block writes and reads, read delay is per sample
+
+void dsp_delay_init ( int* dl, int nn );                  // Clear, NN is a power of 2
+void dsp_delay_write( int* dl, int xx );                  // Write the next sample
+int  dsp_delay_read ( const int* dl, int dd );            // Sample delayed by DD
+int  dsp_delay_lin  ( const int* dl, int dd, int ff );    // Linear interpolation, 3 ops
+int  dsp_delay_lagr ( const int* dl, int dd, int ff );    // 3-point Lagrange interpolation, 10 ops
+int  dsp_delay_herm ( const int* dl, int dd, int ff );    // 4-point Hermite interpolation, 9 ops
+int  dsp_delay_allp ( const int* dl, int dd, int ff, int* ss ); // Allpass interpolation, 4 ops
+void dsp_delay_taps ( const int* dl, int* xx, const int* dd, int nn ); // XX[0:NN-1] at DD[0:NN-1]
+void dsp_delay_write_block( int* dl, const int* xx, int bb );         // Write XX[0:BB-1]
+void dsp_delay_read_block ( const int* dl, int* xx, int dd, int bb ); // XX[0:BB-1] delayed by DD
+
+// Dynamics processor - compressor, limiter, expander and noise gate (see DSP.I). The gain is
+// computed in the log domain from the level of the loudest channel (NN channels share one gain) and
+// smoothed with separate attack and release times. At most 48+3*NN ops per sample (bench.sh).
+//
+// XX is NN channels of one sample, CC is 12 parameters from 'calc_compressor', 'calc_expander',
+// 'calc_gate' or 'calc_limiter', SS length is 3+LL*NN (LL is the look-ahead) and must be zeroed
+
+void dsp_dynamics( int* xx, const int* cc, int* ss, int nn ); // Compress/limit/expand/gate XX[0:NN-1]
 
 void mix_fir_coeffs( int* upsample_cc, int* fir_cc, int nn, int rr );
  
@@ -141,5 +460,26 @@ void calc_peaking  ( int cc[5], double ff, double qq, double gg );
 void calc_lowshelf ( int cc[5], double ff, double qq, double gg );
 void calc_highshelf( int cc[5], double ff, double qq, double gg );
 void calc_tonestack( int cc[7], double gb, double gm, double gt, double vb, double vm, double vt );
+void calc_cic_comp  ( int cc[8], int nn, int rr, double ff ); // CIC compensation, FF=pass-band edge
+
+// Dynamics parameters for 'dsp_dynamics' (do not use these in real-time DSP threads).
+//
+// TH is the threshold and KNEE the knee width in dB (0 dB is QQQ 1.0, which is ADC and DAC full-scale
+// in the C99 effects, QQQ leaves +18 dB of headroom above that)
+// ATTACK, RELEASE and RMS are time constants in samples (RMS=0 selects peak detection)
+// MAKEUP is the make-up gain and RANGE the maximum attenuation in dB
+// CEILING is the limiter's ceiling (QQQ, e.g. 0.977 = -0.2 dBFS), LOOKAHEAD its delay in samples
+
+void calc_compressor( int cc[12], double th, double ratio, double knee,
+                      double attack, double release, double rms, double makeup );
+void calc_expander  ( int cc[12], double th, double ratio, double knee,
+                      double attack, double release, double range );
+void calc_gate      ( int cc[12], double th, double attack, double release, double range );
+void calc_limiter   ( int cc[12], double ceiling, double release, int lookahead );
+
+// Waveshaper transfer curve for 'dsp_waveshaper' - LUT length is 2+NN, BITS is the index resolution
+// and SHAPE maps -1.0..+1.0 to -1.0..+1.0 (e.g. tanh) with NN up to 2^BITS+2 (shorter tables clamp).
+
+void calc_waveshaper( int* lut, int bits, int nn, double (*shape)( double ) );
 
 #endif
@@ -3,107 +3,94 @@
 #define _dsp_mul( xx, yy ) \
 { \
     int ah = 0; unsigned al = 1<<(QQ-1); \
-    asm("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(xx),"r"(yy),"0"(ah),"1"(al) ); \
-    asm("lextract %0,%1,%2,%3,32":"=r"(xx):"r"(ah),"r"(al),"r"(QQ)); \
+    DSP_MACCS( ah, al, xx, yy, ah, al ); \
+    DSP_LEXTRACT( xx, ah, al, QQ ); \
 }
 
 #define _dsp_mac( xx, yy, zz ) \
 { \
     int ah = 0; unsigned al = 0; \
-    asm("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(xx),"r"(yy),"0"(0),"1"(zz) ); \
-    asm("lextract %0,%1,%2,%3,32":"=r"(xx):"r"(ah),"r"(al),"r"(QQ)); \
+    DSP_MACCS( ah, al, xx, yy, 0, zz ); \
+    DSP_LEXTRACT( xx, ah, al, QQ ); \
 }
 
-#define _fir_norm( nn ) \
-\
-    asm volatile("ldd %0,%1,%2[%3]" :"=r"(c1),"=r"(c0):"r"(cc),"r"(2*nn+0)); \
-    asm volatile("ldd %0,%1,%2[%3]" :"=r"(s2),"=r"(s1):"r"(ss),"r"(2*nn+0)); \
-    asm volatile("std %0,%1,%2[%3]"::"r" (s1), "r"(s0),"r"(ss),"r"(2*nn+0)); \
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(c0),"r"(s0),"0"(ah),"1"(al)); \
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(c1),"r"(s1),"0"(ah),"1"(al)); \
-    asm volatile("ldd %0,%1,%2[%3]" :"=r"(c1),"=r"(c0):"r"(cc),"r"(2*nn+1)); \
-    asm volatile("ldd %0,%1,%2[%3]" :"=r"(s0),"=r"(s3):"r"(ss),"r"(2*nn+1)); \
-    asm volatile("std %0,%1,%2[%3]" ::"r"(s3), "r"(s2),"r"(ss),"r"(2*nn+1)); \
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(c0),"r"(s2),"0"(ah),"1"(al)); \
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(c1),"r"(s3),"0"(ah),"1"(al));
-
 #define _fir_norm0() \
 \
-    asm volatile("ldd %0,%1,%2[0]"  :"=r"(c1),"=r"(c0):"r"(cc)); \
-    asm volatile("ldd %0,%1,%2[0]"  :"=r"(s2),"=r"(s1):"r"(ss)); \
-    asm volatile("std %0,%1,%2[0]" ::"r" (s1), "r"(s0),"r"(ss)); \
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(c0),"r"(s0),"0"(ah),"1"(al)); \
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(c1),"r"(s1),"0"(ah),"1"(al)); \
-    asm volatile("ldd %0,%1,%2[1]"  :"=r"(c1),"=r"(c0):"r"(cc)); \
-    asm volatile("ldd %0,%1,%2[1]"  :"=r"(s0),"=r"(s3):"r"(ss)); \
-    asm volatile("std %0,%1,%2[1]"  ::"r"(s3), "r"(s2),"r"(ss)); \
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(c0),"r"(s2),"0"(ah),"1"(al)); \
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(c1),"r"(s3),"0"(ah),"1"(al));
+    DSP_LDD( c1, c0, cc, 0 ); \
+    DSP_LDD( s2, s1, ss, 0 ); \
+    DSP_STD( s1, s0, ss, 0 ); \
+    DSP_MACCS( ah, al, c0, s0, ah, al ); \
+    DSP_MACCS( ah, al, c1, s1, ah, al ); \
+    DSP_LDD( c1, c0, cc, 1 ); \
+    DSP_LDD( s0, s3, ss, 1 ); \
+    DSP_STD( s3, s2, ss, 1 ); \
+    DSP_MACCS( ah, al, c0, s2, ah, al ); \
+    DSP_MACCS( ah, al, c1, s3, ah, al );
 
 #define _fir_norm1() \
 \
-    asm volatile("ldd %0,%1,%2[2]"  :"=r"(c1),"=r"(c0):"r"(cc)); \
-    asm volatile("ldd %0,%1,%2[2]"  :"=r"(s2),"=r"(s1):"r"(ss)); \
-    asm volatile("std %0,%1,%2[2]" ::"r" (s1), "r"(s0),"r"(ss)); \
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(c0),"r"(s0),"0"(ah),"1"(al)); \
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(c1),"r"(s1),"0"(ah),"1"(al)); \
-    asm volatile("ldd %0,%1,%2[3]"  :"=r"(c1),"=r"(c0):"r"(cc)); \
-    asm volatile("ldd %0,%1,%2[3]"  :"=r"(s0),"=r"(s3):"r"(ss)); \
-    asm volatile("std %0,%1,%2[3]"  ::"r"(s3), "r"(s2),"r"(ss)); \
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(c0),"r"(s2),"0"(ah),"1"(al)); \
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(c1),"r"(s3),"0"(ah),"1"(al));
+    DSP_LDD( c1, c0, cc, 2 ); \
+    DSP_LDD( s2, s1, ss, 2 ); \
+    DSP_STD( s1, s0, ss, 2 ); \
+    DSP_MACCS( ah, al, c0, s0, ah, al ); \
+    DSP_MACCS( ah, al, c1, s1, ah, al ); \
+    DSP_LDD( c1, c0, cc, 3 ); \
+    DSP_LDD( s0, s3, ss, 3 ); \
+    DSP_STD( s3, s2, ss, 3 ); \
+    DSP_MACCS( ah, al, c0, s2, ah, al ); \
+    DSP_MACCS( ah, al, c1, s3, ah, al );
 
 #define _fir_norm2() \
 \
-    asm volatile("ldd %0,%1,%2[4]"  :"=r"(c1),"=r"(c0):"r"(cc)); \
-    asm volatile("ldd %0,%1,%2[4]"  :"=r"(s2),"=r"(s1):"r"(ss)); \
-    asm volatile("std %0,%1,%2[4]" ::"r" (s1), "r"(s0),"r"(ss)); \
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(c0),"r"(s0),"0"(ah),"1"(al)); \
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(c1),"r"(s1),"0"(ah),"1"(al)); \
-    asm volatile("ldd %0,%1,%2[5]"  :"=r"(c1),"=r"(c0):"r"(cc)); \
-    asm volatile("ldd %0,%1,%2[5]"  :"=r"(s0),"=r"(s3):"r"(ss)); \
-    asm volatile("std %0,%1,%2[5]"  ::"r"(s3), "r"(s2),"r"(ss)); \
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(c0),"r"(s2),"0"(ah),"1"(al)); \
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(c1),"r"(s3),"0"(ah),"1"(al));
+    DSP_LDD( c1, c0, cc, 4 ); \
+    DSP_LDD( s2, s1, ss, 4 ); \
+    DSP_STD( s1, s0, ss, 4 ); \
+    DSP_MACCS( ah, al, c0, s0, ah, al ); \
+    DSP_MACCS( ah, al, c1, s1, ah, al ); \
+    DSP_LDD( c1, c0, cc, 5 ); \
+    DSP_LDD( s0, s3, ss, 5 ); \
+    DSP_STD( s3, s2, ss, 5 ); \
+    DSP_MACCS( ah, al, c0, s2, ah, al ); \
+    DSP_MACCS( ah, al, c1, s3, ah, al );
 
 #define _fir_norm3() \
 \
-    asm volatile("ldd %0,%1,%2[6]"  :"=r"(c1),"=r"(c0):"r"(cc)); \
-    asm volatile("ldd %0,%1,%2[6]"  :"=r"(s2),"=r"(s1):"r"(ss)); \
-    asm volatile("std %0,%1,%2[6]" ::"r" (s1), "r"(s0),"r"(ss)); \
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(c0),"r"(s0),"0"(ah),"1"(al)); \
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(c1),"r"(s1),"0"(ah),"1"(al)); \
-    asm volatile("ldd %0,%1,%2[7]"  :"=r"(c1),"=r"(c0):"r"(cc)); \
-    asm volatile("ldd %0,%1,%2[7]"  :"=r"(s0),"=r"(s3):"r"(ss)); \
-    asm volatile("std %0,%1,%2[7]"  ::"r"(s3), "r"(s2),"r"(ss)); \
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(c0),"r"(s2),"0"(ah),"1"(al)); \
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(c1),"r"(s3),"0"(ah),"1"(al));
+    DSP_LDD( c1, c0, cc, 6 ); \
+    DSP_LDD( s2, s1, ss, 6 ); \
+    DSP_STD( s1, s0, ss, 6 ); \
+    DSP_MACCS( ah, al, c0, s0, ah, al ); \
+    DSP_MACCS( ah, al, c1, s1, ah, al ); \
+    DSP_LDD( c1, c0, cc, 7 ); \
+    DSP_LDD( s0, s3, ss, 7 ); \
+    DSP_STD( s3, s2, ss, 7 ); \
+    DSP_MACCS( ah, al, c0, s2, ah, al ); \
+    DSP_MACCS( ah, al, c1, s3, ah, al );
 
 #define _fir_norm4() \
 \
-    asm volatile("ldd %0,%1,%2[8]"  :"=r"(c1),"=r"(c0):"r"(cc)); \
-    asm volatile("ldd %0,%1,%2[8]"  :"=r"(s2),"=r"(s1):"r"(ss)); \
-    asm volatile("std %0,%1,%2[8]" ::"r" (s1), "r"(s0),"r"(ss)); \
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(c0),"r"(s0),"0"(ah),"1"(al)); \
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(c1),"r"(s1),"0"(ah),"1"(al)); \
-    asm volatile("ldd %0,%1,%2[9]"  :"=r"(c1),"=r"(c0):"r"(cc)); \
-    asm volatile("ldd %0,%1,%2[9]"  :"=r"(s0),"=r"(s3):"r"(ss)); \
-    asm volatile("std %0,%1,%2[9]"  ::"r"(s3), "r"(s2),"r"(ss)); \
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(c0),"r"(s2),"0"(ah),"1"(al)); \
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(c1),"r"(s3),"0"(ah),"1"(al));
+    DSP_LDD( c1, c0, cc, 8 ); \
+    DSP_LDD( s2, s1, ss, 8 ); \
+    DSP_STD( s1, s0, ss, 8 ); \
+    DSP_MACCS( ah, al, c0, s0, ah, al ); \
+    DSP_MACCS( ah, al, c1, s1, ah, al ); \
+    DSP_LDD( c1, c0, cc, 9 ); \
+    DSP_LDD( s0, s3, ss, 9 ); \
+    DSP_STD( s3, s2, ss, 9 ); \
+    DSP_MACCS( ah, al, c0, s2, ah, al ); \
+    DSP_MACCS( ah, al, c1, s3, ah, al );
 
 #define _fir_norm5() \
 \
-    asm volatile("ldd %0,%1,%2[10]" :"=r"(c1),"=r"(c0):"r"(cc)); \
-    asm volatile("ldd %0,%1,%2[10]" :"=r"(s2),"=r"(s1):"r"(ss)); \
-    asm volatile("std %0,%1,%2[10]"::"r" (s1), "r"(s0),"r"(ss)); \
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(c0),"r"(s0),"0"(ah),"1"(al)); \
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(c1),"r"(s1),"0"(ah),"1"(al)); \
-    asm volatile("ldd %0,%1,%2[11]" :"=r"(c1),"=r"(c0):"r"(cc)); \
-    asm volatile("ldd %0,%1,%2[11]" :"=r"(s0),"=r"(s3):"r"(ss)); \
-    asm volatile("std %0,%1,%2[11]" ::"r"(s3), "r"(s2),"r"(ss)); \
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(c0),"r"(s2),"0"(ah),"1"(al)); \
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(c1),"r"(s3),"0"(ah),"1"(al));
+    DSP_LDD( c1, c0, cc, 10 ); \
+    DSP_LDD( s2, s1, ss, 10 ); \
+    DSP_STD( s1, s0, ss, 10 ); \
+    DSP_MACCS( ah, al, c0, s0, ah, al ); \
+    DSP_MACCS( ah, al, c1, s1, ah, al ); \
+    DSP_LDD( c1, c0, cc, 11 ); \
+    DSP_LDD( s0, s3, ss, 11 ); \
+    DSP_STD( s3, s2, ss, 11 ); \
+    DSP_MACCS( ah, al, c0, s2, ah, al ); \
+    DSP_MACCS( ah, al, c1, s3, ah, al );
 
 static inline int _dsp_fir( int xx, const int* cc, int* ss, int nn )
 {
@@ -119,611 +106,954 @@ static inline int _dsp_fir( int xx, const int* cc, int* ss, int nn )
         case  8: _fir_norm0(); _fir_norm1(); break;
         case  4: _fir_norm0(); break;
     }
-    asm volatile("lextract %0,%1,%2,%3,32":"=r"(ah):"r"(ah),"r"(al),"r"(QQ));
+    DSP_LEXTRACT( ah, ah, al, QQ );
     return ah;
 }
 
-/*
-#define _fir_step( nn, ii, rr ) \
-\
-    c0 = cc[(4*nn+0)*rr+ii]; c1 = cc[(4*nn+1)*rr+ii]; \
-    asm volatile("ldd %0,%1,%2[%3]" :"=r"(s1),"=r"(s0):"r"(ss),"r"(2*nn+0)); \
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(c0),"r"(s0),"0"(ah),"1"(al)); \
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(c1),"r"(s1),"0"(ah),"1"(al)); \
-    c0 = cc[(4*nn+2)*rr+ii]; c1 = cc[(4*nn+3)*rr+ii]; \
-    asm volatile("ldd %0,%1,%2[%3]" :"=r"(s1),"=r"(s0):"r"(ss),"r"(2*nn+1)); \
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(c0),"r"(s0),"0"(ah),"1"(al)); \
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(c1),"r"(s1),"0"(ah),"1"(al));
-*/
-
-#define _fir_step0( ii, rr ) \
+#define _fir_read0() \
 \
-    c0 = cc[(4*0+0)*rr+ii]; c1 = cc[(4*0+1)*rr+ii]; \
-    asm volatile("ldd %0,%1,%2[0]"  :"=r"(s1),"=r"(s0):"r"(ss)); \
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(c0),"r"(s0),"0"(ah),"1"(al)); \
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(c1),"r"(s1),"0"(ah),"1"(al)); \
-    c0 = cc[(4*0+2)*rr+ii]; c1 = cc[(4*0+3)*rr+ii]; \
-    asm volatile("ldd %0,%1,%2[1]"  :"=r"(s1),"=r"(s0):"r"(ss)); \
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(c0),"r"(s0),"0"(ah),"1"(al)); \
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(c1),"r"(s1),"0"(ah),"1"(al));
-
-#define _fir_step1( ii, rr ) \
+    DSP_LDD( c1, c0, cc, 0 ); \
+    DSP_LDD( s1, s0, ss, 0 ); \
+    DSP_MACCS( ah, al, c0, s0, ah, al ); \
+    DSP_MACCS( ah, al, c1, s1, ah, al ); \
+    DSP_LDD( c1, c0, cc, 1 ); \
+    DSP_LDD( s1, s0, ss, 1 ); \
+    DSP_MACCS( ah, al, c0, s0, ah, al ); \
+    DSP_MACCS( ah, al, c1, s1, ah, al );
+
+#define _fir_read1() \
 \
-    c0 = cc[(4*1+0)*rr+ii]; c1 = cc[(4*1+1)*rr+ii]; \
-    asm volatile("ldd %0,%1,%2[2]"  :"=r"(s1),"=r"(s0):"r"(ss)); \
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(c0),"r"(s0),"0"(ah),"1"(al)); \
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(c1),"r"(s1),"0"(ah),"1"(al)); \
-    c0 = cc[(4*1+2)*rr+ii]; c1 = cc[(4*1+3)*rr+ii]; \
-    asm volatile("ldd %0,%1,%2[3]"  :"=r"(s1),"=r"(s0):"r"(ss)); \
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(c0),"r"(s0),"0"(ah),"1"(al)); \
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(c1),"r"(s1),"0"(ah),"1"(al));
-
-#define _fir_step2( ii, rr ) \
+    DSP_LDD( c1, c0, cc, 2 ); \
+    DSP_LDD( s1, s0, ss, 2 ); \
+    DSP_MACCS( ah, al, c0, s0, ah, al ); \
+    DSP_MACCS( ah, al, c1, s1, ah, al ); \
+    DSP_LDD( c1, c0, cc, 3 ); \
+    DSP_LDD( s1, s0, ss, 3 ); \
+    DSP_MACCS( ah, al, c0, s0, ah, al ); \
+    DSP_MACCS( ah, al, c1, s1, ah, al );
+
+#define _fir_read2() \
 \
-    c0 = cc[(4*2+0)*rr+ii]; c1 = cc[(4*2+1)*rr+ii]; \
-    asm volatile("ldd %0,%1,%2[4]"  :"=r"(s1),"=r"(s0):"r"(ss)); \
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(c0),"r"(s0),"0"(ah),"1"(al)); \
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(c1),"r"(s1),"0"(ah),"1"(al)); \
-    c0 = cc[(4*2+2)*rr+ii]; c1 = cc[(4*2+3)*rr+ii]; \
-    asm volatile("ldd %0,%1,%2[5]"  :"=r"(s1),"=r"(s0):"r"(ss)); \
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(c0),"r"(s0),"0"(ah),"1"(al)); \
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(c1),"r"(s1),"0"(ah),"1"(al));
-
-#define _fir_step3( ii, rr ) \
+    DSP_LDD( c1, c0, cc, 4 ); \
+    DSP_LDD( s1, s0, ss, 4 ); \
+    DSP_MACCS( ah, al, c0, s0, ah, al ); \
+    DSP_MACCS( ah, al, c1, s1, ah, al ); \
+    DSP_LDD( c1, c0, cc, 5 ); \
+    DSP_LDD( s1, s0, ss, 5 ); \
+    DSP_MACCS( ah, al, c0, s0, ah, al ); \
+    DSP_MACCS( ah, al, c1, s1, ah, al );
+
+#define _fir_read3() \
 \
-    c0 = cc[(4*3+0)*rr+ii]; c1 = cc[(4*3+1)*rr+ii]; \
-    asm volatile("ldd %0,%1,%2[6]"  :"=r"(s1),"=r"(s0):"r"(ss)); \
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(c0),"r"(s0),"0"(ah),"1"(al)); \
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(c1),"r"(s1),"0"(ah),"1"(al)); \
-    c0 = cc[(4*3+2)*rr+ii]; c1 = cc[(4*3+3)*rr+ii]; \
-    asm volatile("ldd %0,%1,%2[7]"  :"=r"(s1),"=r"(s0):"r"(ss)); \
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(c0),"r"(s0),"0"(ah),"1"(al)); \
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(c1),"r"(s1),"0"(ah),"1"(al));
-
-#define _fir_step4( ii, rr ) \
+    DSP_LDD( c1, c0, cc, 6 ); \
+    DSP_LDD( s1, s0, ss, 6 ); \
+    DSP_MACCS( ah, al, c0, s0, ah, al ); \
+    DSP_MACCS( ah, al, c1, s1, ah, al ); \
+    DSP_LDD( c1, c0, cc, 7 ); \
+    DSP_LDD( s1, s0, ss, 7 ); \
+    DSP_MACCS( ah, al, c0, s0, ah, al ); \
+    DSP_MACCS( ah, al, c1, s1, ah, al );
+
+#define _fir_read4() \
 \
-    c0 = cc[(4*4+0)*rr+ii]; c1 = cc[(4*4+1)*rr+ii]; \
-    asm volatile("ldd %0,%1,%2[8]"  :"=r"(s1),"=r"(s0):"r"(ss)); \
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(c0),"r"(s0),"0"(ah),"1"(al)); \
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(c1),"r"(s1),"0"(ah),"1"(al)); \
-    c0 = cc[(4*4+2)*rr+ii]; c1 = cc[(4*4+3)*rr+ii]; \
-    asm volatile("ldd %0,%1,%2[9]"  :"=r"(s1),"=r"(s0):"r"(ss)); \
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(c0),"r"(s0),"0"(ah),"1"(al)); \
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(c1),"r"(s1),"0"(ah),"1"(al));
-
-#define _fir_step5( ii, rr ) \
+    DSP_LDD( c1, c0, cc, 8 ); \
+    DSP_LDD( s1, s0, ss, 8 ); \
+    DSP_MACCS( ah, al, c0, s0, ah, al ); \
+    DSP_MACCS( ah, al, c1, s1, ah, al ); \
+    DSP_LDD( c1, c0, cc, 9 ); \
+    DSP_LDD( s1, s0, ss, 9 ); \
+    DSP_MACCS( ah, al, c0, s0, ah, al ); \
+    DSP_MACCS( ah, al, c1, s1, ah, al );
+
+#define _fir_read5() \
 \
-    c0 = cc[(4*5+0)*rr+ii]; c1 = cc[(4*5+1)*rr+ii]; \
-    asm volatile("ldd %0,%1,%2[10]" :"=r"(s1),"=r"(s0):"r"(ss)); \
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(c0),"r"(s0),"0"(ah),"1"(al)); \
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(c1),"r"(s1),"0"(ah),"1"(al)); \
-    c0 = cc[(4*5+2)*rr+ii]; c1 = cc[(4*5+3)*rr+ii]; \
-    asm volatile("ldd %0,%1,%2[11]" :"=r"(s1),"=r"(s0):"r"(ss)); \
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(c0),"r"(s0),"0"(ah),"1"(al)); \
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(c1),"r"(s1),"0"(ah),"1"(al));
-
-#define _fir_step_tt( tt_, ii, rr ) \
+    DSP_LDD( c1, c0, cc, 10 ); \
+    DSP_LDD( s1, s0, ss, 10 ); \
+    DSP_MACCS( ah, al, c0, s0, ah, al ); \
+    DSP_MACCS( ah, al, c1, s1, ah, al ); \
+    DSP_LDD( c1, c0, cc, 11 ); \
+    DSP_LDD( s1, s0, ss, 11 ); \
+    DSP_MACCS( ah, al, c0, s0, ah, al ); \
+    DSP_MACCS( ah, al, c1, s1, ah, al );
+
+#define _fir_read_tt( tt_ ) \
 { \
     int tt = tt_; while( tt >= 24 ) { \
-        _fir_step0(ii,rr); _fir_step1(ii,rr); _fir_step2(ii,rr); \
-        _fir_step3(ii,rr); _fir_step4(ii,rr); _fir_step5(ii,rr); \
+        _fir_read0(); _fir_read1(); _fir_read2(); _fir_read3(); _fir_read4(); _fir_read5(); \
         cc += 24; ss += 24; tt -= 24; \
     } \
     switch( tt ) { \
-        case 20: _fir_step0(ii,rr); _fir_step1(ii,rr); _fir_step2(ii,rr); \
-                 _fir_step3(ii,rr); _fir_step4(ii,rr); break; \
-        case 16: _fir_step0(ii,rr); _fir_step1(ii,rr); _fir_step2(ii,rr); \
-                 _fir_step3(ii,rr); break; \
-        case 12: _fir_step0(ii,rr); _fir_step1(ii,rr); _fir_step2(ii,rr); break; \
-        case  8: _fir_step0(ii,rr); _fir_step1(ii,rr); break; \
-        case  4: _fir_step0(ii,rr); break; \
+        case 20: _fir_read0(); _fir_read1(); _fir_read2(); _fir_read3(); _fir_read4(); break; \
+        case 16: _fir_read0(); _fir_read1(); _fir_read2(); _fir_read3(); break; \
+        case 12: _fir_read0(); _fir_read1(); _fir_read2(); break; \
+        case  8: _fir_read0(); _fir_read1(); break; \
+        case  4: _fir_read0(); break; \
     } \
 }
 
+// Polyphase up-sampling with one input history (NN/RR samples) shared by all RR phases. Phase 0
+// shifts the new input into the history, the remaining phases only read it. CC holds the phases
+// one after the other (see 'mix_fir_coeffs').
+
 static inline void _dsp_fir_up( int* xx, const int* cc, int* ss, int nn, int rr )
 {
-    int sample = xx[0], bb = nn / rr, jj = rr;
-    for( int ii = 0; ii < rr; ++ii )
-    {
-        xx[--jj] = rr * dsp_fir( sample, cc, ss, bb );
-        cc += bb; ss += bb;
+    int c0, c1, s0, s1, ah, bb = nn / rr, jj = rr-1; unsigned al;
+    const int* cp = cc; int* sp = ss;
+    xx[jj] = rr * _dsp_fir( xx[0], cc, ss, bb );
+    while( jj-- ) {
+        cc = cp += bb; ss = sp; ah = 0; al = 1<<(QQ-1);
+        _fir_read_tt( bb );
+        DSP_LEXTRACT( ah, ah, al, QQ );
+        xx[jj] = rr * ah;
     }
 }
 
-static inline void __dsp_fir_up( int* xx, const int* cc_, int* ss_, int nn, int rr )
+static inline void _fir_push( const int* xx, int* ss, int nn, int rr ) // Shift RR inputs into SS
 {
-    const int *cc = cc_; int *ss = ss_;
-    int c0, c1, s0, s1, ah; unsigned al;
-    memmove( ss+1, ss, 4*(nn/rr-1) ); ss[0] = xx[0];
+    memmove( ss+rr, ss, 4*(nn-rr) );
     switch( rr ) {
-        case 3:
-        ah = 0; al = 1<<(QQ-1); _fir_step_tt(nn/3,2,3);
-        asm volatile("lextract %0,%1,%2,%3,32":"=r"(xx[2]):"r"(ah),"r"(al),"r"(QQ));
-        asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(xx[2]),"r"(FQ(3.0)),"0"(0),"1"(1<<(QQ-1))); \
-        asm volatile("lextract %0,%1,%2,%3,32":"=r"(xx[2]):"r"(ah),"r"(al),"r"(QQ));
-        ah = 0; al = 1<<(QQ-1); _fir_step_tt(nn/3,1,3);
-        asm volatile("lextract %0,%1,%2,%3,32":"=r"(xx[1]):"r"(ah),"r"(al),"r"(QQ));
-        asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(xx[1]),"r"(FQ(3.0)),"0"(0),"1"(1<<(QQ-1))); \
-        asm volatile("lextract %0,%1,%2,%3,32":"=r"(xx[1]):"r"(ah),"r"(al),"r"(QQ));
-        ah = 0; al = 1<<(QQ-1); _fir_step_tt(nn/3,0,3);
-        asm volatile("lextract %0,%1,%2,%3,32":"=r"(xx[0]):"r"(ah),"r"(al),"r"(QQ));
-        asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(xx[0]),"r"(FQ(3.0)),"0"(0),"1"(1<<(QQ-1))); \
-        asm volatile("lextract %0,%1,%2,%3,32":"=r"(xx[0]):"r"(ah),"r"(al),"r"(QQ));
-        break;
-        case 4:
-        ah = 0; al = 1<<(QQ-1); _fir_step_tt(nn/4,3,4);
-        asm volatile("lextract %0,%1,%2,%3,32":"=r"(xx[3]):"r"(ah),"r"(al),"r"(QQ));
-        asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(xx[3]),"r"(FQ(4.0)),"0"(0),"1"(1<<(QQ-1))); \
-        asm volatile("lextract %0,%1,%2,%3,32":"=r"(xx[3]):"r"(ah),"r"(al),"r"(QQ));
-        ah = 0; al = 1<<(QQ-1); _fir_step_tt(nn/4,2,4);
-        asm volatile("lextract %0,%1,%2,%3,32":"=r"(xx[2]):"r"(ah),"r"(al),"r"(QQ));
-        asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(xx[2]),"r"(FQ(4.0)),"0"(0),"1"(1<<(QQ-1))); \
-        asm volatile("lextract %0,%1,%2,%3,32":"=r"(xx[2]):"r"(ah),"r"(al),"r"(QQ));
-        ah = 0; al = 1<<(QQ-1); _fir_step_tt(nn/4,1,4);
-        asm volatile("lextract %0,%1,%2,%3,32":"=r"(xx[1]):"r"(ah),"r"(al),"r"(QQ));
-        asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(xx[1]),"r"(FQ(4.0)),"0"(0),"1"(1<<(QQ-1))); \
-        asm volatile("lextract %0,%1,%2,%3,32":"=r"(xx[1]):"r"(ah),"r"(al),"r"(QQ));
-        ah = 0; al = 1<<(QQ-1); _fir_step_tt(nn/4,0,4);
-        asm volatile("lextract %0,%1,%2,%3,32":"=r"(xx[0]):"r"(ah),"r"(al),"r"(QQ));
-        asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(xx[0]),"r"(FQ(4.0)),"0"(0),"1"(1<<(QQ-1))); \
-        asm volatile("lextract %0,%1,%2,%3,32":"=r"(xx[0]):"r"(ah),"r"(al),"r"(QQ));
-        break;
-        case 5:
-        ah = 0; al = 1<<(QQ-1); _fir_step_tt(nn/5,4,5);
-        asm volatile("lextract %0,%1,%2,%3,32":"=r"(xx[4]):"r"(ah),"r"(al),"r"(QQ));
-        asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(xx[4]),"r"(FQ(5.0)),"0"(0),"1"(1<<(QQ-1))); \
-        asm volatile("lextract %0,%1,%2,%3,32":"=r"(xx[4]):"r"(ah),"r"(al),"r"(QQ));
-        ah = 0; al = 1<<(QQ-1); _fir_step_tt(nn/5,3,5);
-        asm volatile("lextract %0,%1,%2,%3,32":"=r"(xx[3]):"r"(ah),"r"(al),"r"(QQ));
-        asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(xx[3]),"r"(FQ(5.0)),"0"(0),"1"(1<<(QQ-1))); \
-        asm volatile("lextract %0,%1,%2,%3,32":"=r"(xx[3]):"r"(ah),"r"(al),"r"(QQ));
-        ah = 0; al = 1<<(QQ-1); _fir_step_tt(nn/5,2,5);
-        asm volatile("lextract %0,%1,%2,%3,32":"=r"(xx[2]):"r"(ah),"r"(al),"r"(QQ));
-        asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(xx[2]),"r"(FQ(5.0)),"0"(0),"1"(1<<(QQ-1))); \
-        asm volatile("lextract %0,%1,%2,%3,32":"=r"(xx[2]):"r"(ah),"r"(al),"r"(QQ));
-        ah = 0; al = 1<<(QQ-1); _fir_step_tt(nn/5,1,5);
-        asm volatile("lextract %0,%1,%2,%3,32":"=r"(xx[1]):"r"(ah),"r"(al),"r"(QQ));
-        asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(xx[1]),"r"(FQ(5.0)),"0"(0),"1"(1<<(QQ-1))); \
-        asm volatile("lextract %0,%1,%2,%3,32":"=r"(xx[1]):"r"(ah),"r"(al),"r"(QQ));
-        ah = 0; al = 1<<(QQ-1); _fir_step_tt(nn/5,0,5);
-        asm volatile("lextract %0,%1,%2,%3,32":"=r"(xx[0]):"r"(ah),"r"(al),"r"(QQ));
-        asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(xx[0]),"r"(FQ(5.0)),"0"(0),"1"(1<<(QQ-1))); \
-        asm volatile("lextract %0,%1,%2,%3,32":"=r"(xx[0]):"r"(ah),"r"(al),"r"(QQ));
-        break;
-        case 6:
-        ah = 0; al = 1<<(QQ-1); _fir_step_tt(nn/6,5,6);
-        asm volatile("lextract %0,%1,%2,%3,32":"=r"(xx[5]):"r"(ah),"r"(al),"r"(QQ));
-        asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(xx[5]),"r"(FQ(6)),"0"(0),"1"(1<<(QQ-1))); \
-        asm volatile("lextract %0,%1,%2,%3,32":"=r"(xx[5]):"r"(ah),"r"(al),"r"(QQ));
-        ah = 0; al = 1<<(QQ-1); _fir_step_tt(nn/6,4,6);
-        asm volatile("lextract %0,%1,%2,%3,32":"=r"(xx[4]):"r"(ah),"r"(al),"r"(QQ));
-        asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(xx[4]),"r"(FQ(6)),"0"(0),"1"(1<<(QQ-1))); \
-        asm volatile("lextract %0,%1,%2,%3,32":"=r"(xx[4]):"r"(ah),"r"(al),"r"(QQ));
-        ah = 0; al = 1<<(QQ-1); _fir_step_tt(nn/6,3,6);
-        asm volatile("lextract %0,%1,%2,%3,32":"=r"(xx[3]):"r"(ah),"r"(al),"r"(QQ));
-        asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(xx[3]),"r"(FQ(6)),"0"(0),"1"(1<<(QQ-1))); \
-        asm volatile("lextract %0,%1,%2,%3,32":"=r"(xx[3]):"r"(ah),"r"(al),"r"(QQ));
-        ah = 0; al = 1<<(QQ-1); _fir_step_tt(nn/6,2,6);
-        asm volatile("lextract %0,%1,%2,%3,32":"=r"(xx[2]):"r"(ah),"r"(al),"r"(QQ));
-        asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(xx[2]),"r"(FQ(6)),"0"(0),"1"(1<<(QQ-1))); \
-        asm volatile("lextract %0,%1,%2,%3,32":"=r"(xx[2]):"r"(ah),"r"(al),"r"(QQ));
-        ah = 0; al = 1<<(QQ-1); _fir_step_tt(nn/6,1,6);
-        asm volatile("lextract %0,%1,%2,%3,32":"=r"(xx[1]):"r"(ah),"r"(al),"r"(QQ));
-        asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(xx[1]),"r"(FQ(6)),"0"(0),"1"(1<<(QQ-1))); \
-        asm volatile("lextract %0,%1,%2,%3,32":"=r"(xx[1]):"r"(ah),"r"(al),"r"(QQ));
-        ah = 0; al = 1<<(QQ-1); _fir_step_tt(nn/6,0,6);
-        asm volatile("lextract %0,%1,%2,%3,32":"=r"(xx[0]):"r"(ah),"r"(al),"r"(QQ));
-        asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(xx[0]),"r"(FQ(6)),"0"(0),"1"(1<<(QQ-1))); \
-        asm volatile("lextract %0,%1,%2,%3,32":"=r"(xx[0]):"r"(ah),"r"(al),"r"(QQ));
-        break;
+        case 1: ss[0]=xx[0]; break;
+        case 2: DSP_STD( xx[1], xx[0], ss, 0 ); break;
+        case 3: DSP_STD( xx[1], xx[0], ss, 0 ); ss[2]=xx[2]; break;
+        case 4: DSP_STD( xx[1], xx[0], ss, 0 );
+                DSP_STD( xx[3], xx[2], ss, 1 ); break;
+        case 5: DSP_STD( xx[1], xx[0], ss, 0 );
+                DSP_STD( xx[3], xx[2], ss, 1 ); ss[4]=xx[4]; break;
+        case 6: DSP_STD( xx[1], xx[0], ss, 0 );
+                DSP_STD( xx[3], xx[2], ss, 1 );
+                DSP_STD( xx[5], xx[4], ss, 2 ); break;
+        case 7: DSP_STD( xx[1], xx[0], ss, 0 );
+                DSP_STD( xx[3], xx[2], ss, 1 );
+                DSP_STD( xx[5], xx[4], ss, 2 ); ss[6]=xx[6]; break;
+        case 8: DSP_STD( xx[1], xx[0], ss, 0 );
+                DSP_STD( xx[3], xx[2], ss, 1 );
+                DSP_STD( xx[5], xx[4], ss, 2 );
+                DSP_STD( xx[7], xx[6], ss, 3 ); break;
     }
 }
 
-#define _fir_read( nn ) \
-\
-    asm volatile("ldd %0,%1,%2[%3]" :"=r"(c1),"=r"(c0):"r"(cc),"r"(2*nn+0)); \
-    asm volatile("ldd %0,%1,%2[%3]" :"=r"(s1),"=r"(s0):"r"(ss),"r"(2*nn+0)); \
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(c0),"r"(s0),"0"(ah),"1"(al)); \
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(c1),"r"(s1),"0"(ah),"1"(al)); \
-    asm volatile("ldd %0,%1,%2[%3]" :"=r"(c1),"=r"(c0):"r"(cc),"r"(2*nn+1)); \
-    asm volatile("ldd %0,%1,%2[%3]" :"=r"(s1),"=r"(s0):"r"(ss),"r"(2*nn+1)); \
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(c0),"r"(s0),"0"(ah),"1"(al)); \
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(c1),"r"(s1),"0"(ah),"1"(al));
+static inline void _dsp_fir_dn( int* xx, const int* cc, int* ss, int nn, int rr )
+{
+    int c0, c1, s0, s1, ah = 0; unsigned al = 1<<(QQ-1);
+    _fir_push( xx, ss, nn, rr );
+    _fir_read_tt( nn );
+    DSP_LEXTRACT( xx[0], ah, al, QQ );
+}
 
-#define _fir_read0() \
-\
-    asm volatile("ldd %0,%1,%2[0]"  :"=r"(c1),"=r"(c0):"r"(cc)); \
-    asm volatile("ldd %0,%1,%2[0]"  :"=r"(s1),"=r"(s0):"r"(ss)); \
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(c0),"r"(s0),"0"(ah),"1"(al)); \
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(c1),"r"(s1),"0"(ah),"1"(al)); \
-    asm volatile("ldd %0,%1,%2[1]"  :"=r"(c1),"=r"(c0):"r"(cc)); \
-    asm volatile("ldd %0,%1,%2[1]"  :"=r"(s1),"=r"(s0):"r"(ss)); \
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(c0),"r"(s0),"0"(ah),"1"(al)); \
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(c1),"r"(s1),"0"(ah),"1"(al));
+// Block FIR filtering. Two consecutive outputs are computed per pass over the coefficients so
+// coefficient and state loads are shared (the state is read only, without shifting). AH:AL and
+// BH:BL accumulate the newer (state at SS[0]) and the older (state at SS[1]) output respectively.
 
-#define _fir_read1() \
+#define _fir_pair4( i0, i1, i2 ) \
 \
-    asm volatile("ldd %0,%1,%2[2]"  :"=r"(c1),"=r"(c0):"r"(cc)); \
-    asm volatile("ldd %0,%1,%2[2]"  :"=r"(s1),"=r"(s0):"r"(ss)); \
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(c0),"r"(s0),"0"(ah),"1"(al)); \
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(c1),"r"(s1),"0"(ah),"1"(al)); \
-    asm volatile("ldd %0,%1,%2[3]"  :"=r"(c1),"=r"(c0):"r"(cc)); \
-    asm volatile("ldd %0,%1,%2[3]"  :"=r"(s1),"=r"(s0):"r"(ss)); \
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(c0),"r"(s0),"0"(ah),"1"(al)); \
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(c1),"r"(s1),"0"(ah),"1"(al));
+    DSP_LDD( c1, c0, cc, i0 ); \
+    DSP_LDD( s3, s2, ss, i1 ); \
+    DSP_MACCS( ah, al, c0, s0, ah, al ); \
+    DSP_MACCS( ah, al, c1, s1, ah, al ); \
+    DSP_MACCS( bh, bl, c0, s1, bh, bl ); \
+    DSP_MACCS( bh, bl, c1, s2, bh, bl ); \
+    DSP_LDD( c1, c0, cc, i1 ); \
+    DSP_LDD( s1, s0, ss, i2 ); \
+    DSP_MACCS( ah, al, c0, s2, ah, al ); \
+    DSP_MACCS( ah, al, c1, s3, ah, al ); \
+    DSP_MACCS( bh, bl, c0, s3, bh, bl ); \
+    DSP_MACCS( bh, bl, c1, s0, bh, bl );
+
+static inline void _fir_pair( const int* cc, const int* ss, int nn, int* aa, int* bb )
+{
+    int c0, c1, s0, s1, s2, s3, ah = aa[0], bh = bb[0]; unsigned al = aa[1], bl = bb[1];
+    DSP_LDD( s1, s0, ss, 0 );
+    while( nn >= 24 ) {
+        _fir_pair4(0,1,2); _fir_pair4(2,3,4); _fir_pair4(4,5,6);
+        _fir_pair4(6,7,8); _fir_pair4(8,9,10); _fir_pair4(10,11,12);
+        cc += 24; ss += 24; nn -= 24;
+    }
+    switch( nn ) {
+        case 20: _fir_pair4(0,1,2); _fir_pair4(2,3,4); _fir_pair4(4,5,6);
+                 _fir_pair4(6,7,8); _fir_pair4(8,9,10); break;
+        case 16: _fir_pair4(0,1,2); _fir_pair4(2,3,4); _fir_pair4(4,5,6); _fir_pair4(6,7,8); break;
+        case 12: _fir_pair4(0,1,2); _fir_pair4(2,3,4); _fir_pair4(4,5,6); break;
+        case  8: _fir_pair4(0,1,2); _fir_pair4(2,3,4); break;
+        case  4: _fir_pair4(0,1,2); break;
+    }
+    aa[0] = ah; aa[1] = al; bb[0] = bh; bb[1] = bl;
+}
 
-#define _fir_read2() \
-\
-    asm volatile("ldd %0,%1,%2[4]"  :"=r"(c1),"=r"(c0):"r"(cc)); \
-    asm volatile("ldd %0,%1,%2[4]"  :"=r"(s1),"=r"(s0):"r"(ss)); \
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(c0),"r"(s0),"0"(ah),"1"(al)); \
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(c1),"r"(s1),"0"(ah),"1"(al)); \
-    asm volatile("ldd %0,%1,%2[5]"  :"=r"(c1),"=r"(c0):"r"(cc)); \
-    asm volatile("ldd %0,%1,%2[5]"  :"=r"(s1),"=r"(s0):"r"(ss)); \
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(c0),"r"(s0),"0"(ah),"1"(al)); \
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(c1),"r"(s1),"0"(ah),"1"(al));
+// XX holds BB samples in time order (XX[0] is the oldest), BB is 2, 4, 8 or 16. SS length is NN+BB.
 
-#define _fir_read3() \
-\
-    asm volatile("ldd %0,%1,%2[6]"  :"=r"(c1),"=r"(c0):"r"(cc)); \
-    asm volatile("ldd %0,%1,%2[6]"  :"=r"(s1),"=r"(s0):"r"(ss)); \
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(c0),"r"(s0),"0"(ah),"1"(al)); \
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(c1),"r"(s1),"0"(ah),"1"(al)); \
-    asm volatile("ldd %0,%1,%2[7]"  :"=r"(c1),"=r"(c0):"r"(cc)); \
-    asm volatile("ldd %0,%1,%2[7]"  :"=r"(s1),"=r"(s0):"r"(ss)); \
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(c0),"r"(s0),"0"(ah),"1"(al)); \
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(c1),"r"(s1),"0"(ah),"1"(al));
+static inline void _dsp_fir_block( int* xx, const int* cc, int* ss, int nn, int bb )
+{
+    int ii, aa[2], ab[2];
+    memmove( ss+bb, ss, 4*nn );
+    for( ii = 0; ii < bb; ++ii ) ss[ii] = xx[bb-1-ii];
+    for( ii = bb-1; ii > 0; ii -= 2 ) {
+        aa[0] = ab[0] = 0; aa[1] = ab[1] = 1<<(QQ-1);
+        _fir_pair( cc, ss+bb-1-ii, nn, aa, ab );
+        DSP_LEXTRACT( xx[ii-0], aa[0], aa[1], QQ );
+        DSP_LEXTRACT( xx[ii-1], ab[0], ab[1], QQ );
+    }
+}
 
-#define _fir_read4() \
-\
-    asm volatile("ldd %0,%1,%2[8]"  :"=r"(c1),"=r"(c0):"r"(cc)); \
-    asm volatile("ldd %0,%1,%2[8]"  :"=r"(s1),"=r"(s0):"r"(ss)); \
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(c0),"r"(s0),"0"(ah),"1"(al)); \
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(c1),"r"(s1),"0"(ah),"1"(al)); \
-    asm volatile("ldd %0,%1,%2[9]"  :"=r"(c1),"=r"(c0):"r"(cc)); \
-    asm volatile("ldd %0,%1,%2[9]"  :"=r"(s1),"=r"(s0):"r"(ss)); \
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(c0),"r"(s0),"0"(ah),"1"(al)); \
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(c1),"r"(s1),"0"(ah),"1"(al));
+// Block of cascaded bi-quads. Coefficients and state of each section are loaded once and then the
+// whole block (BB samples in time order) runs through that section before moving to the next.
 
-#define _fir_read5() \
+static inline void _dsp_biquad_block( int* xx, const int* cc, int* ss, int nn, int bb )
+{
+    int b0, b1, b2, a1, a2, x1, x2, y1, y2, ah, ii; unsigned al;
+    while( nn-- > 0 ) {
+        b0 = cc[0]; b1 = cc[1]; b2 = cc[2]; a1 = cc[3]; a2 = cc[4];
+        DSP_LDD( x2, x1, ss, 0 ); DSP_LDD( y2, y1, ss, 1 );
+        for( ii = 0; ii < bb; ++ii ) {
+            DSP_MACCS( ah, al, xx[ii], b0, 0, 1<<(QQ-1) );
+            DSP_MACCS( ah, al, x1, b1, ah, al );
+            DSP_MACCS( ah, al, x2, b2, ah, al );
+            DSP_MACCS( ah, al, y1, a1, ah, al );
+            DSP_MACCS( ah, al, y2, a2, ah, al );
+            x2 = x1; x1 = xx[ii]; y2 = y1;
+            DSP_LEXTRACT( y1, ah, al, QQ );
+            xx[ii] = y1;
+        }
+        DSP_STD( x2, x1, ss, 0 ); DSP_STD( y2, y1, ss, 1 );
+        cc += 5; ss += 4;
+    }
+}
+
+// Cascaded bi-quads applied to CH channels (XX[0:CH-1]) with one set of coefficients. Each section's
+// coefficients are loaded once for all channels. SS holds CH consecutive 'dsp_biquad' state arrays
+// (4*NN each, i.e. channel 1 state starts at SS+4*NN).
+
+static inline void _dsp_biquad_multi( int* xx, const int* cc, int* ss, int nn, int ch )
+{
+    int b0, b1, b2, a1, a2, x1, x2, y1, y2, ah, ii; unsigned al; int* sp;
+    for( int jj = 0; jj < nn; ++jj ) {
+        b0 = cc[0]; b1 = cc[1]; b2 = cc[2]; a1 = cc[3]; a2 = cc[4];
+        for( ii = 0, sp = ss; ii < ch; ++ii, sp += 4*nn ) {
+            DSP_LDD( x2, x1, sp, 0 ); DSP_LDD( y2, y1, sp, 1 );
+            DSP_MACCS( ah, al, xx[ii], b0, 0, 1<<(QQ-1) );
+            DSP_MACCS( ah, al, x1, b1, ah, al );
+            DSP_MACCS( ah, al, x2, b2, ah, al );
+            DSP_MACCS( ah, al, y1, a1, ah, al );
+            DSP_MACCS( ah, al, y2, a2, ah, al );
+            DSP_LEXTRACT( ah, ah, al, QQ );
+            DSP_STD( x1, xx[ii], sp, 0 ); DSP_STD( y1, ah, sp, 1 );
+            xx[ii] = ah;
+        }
+        cc += 5; ss += 4;
+    }
+}
+
+// Symmetric (linear phase) FIR filtering. CC holds the first NN/2 coefficients (the full
+// coefficient array can be passed as well), NN must be a multiple of 8. Mirrored state values are
+// added before multiplying (SS[k]+SS[NN-1-k]) so the sum of two samples must not overflow.
+
+#define _fir_sym( ii ) \
 \
-    asm volatile("ldd %0,%1,%2[10]" :"=r"(c1),"=r"(c0):"r"(cc)); \
-    asm volatile("ldd %0,%1,%2[10]" :"=r"(s1),"=r"(s0):"r"(ss)); \
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(c0),"r"(s0),"0"(ah),"1"(al)); \
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(c1),"r"(s1),"0"(ah),"1"(al)); \
-    asm volatile("ldd %0,%1,%2[11]" :"=r"(c1),"=r"(c0):"r"(cc)); \
-    asm volatile("ldd %0,%1,%2[11]" :"=r"(s1),"=r"(s0):"r"(ss)); \
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(c0),"r"(s0),"0"(ah),"1"(al)); \
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(c1),"r"(s1),"0"(ah),"1"(al));
+    DSP_LDD( c1, c0, cc, ii ); \
+    DSP_LDD( s1, s0, ss, ii ); \
+    DSP_LDD( t0, t1, se, 0 ); se -= 2; \
+    DSP_MACCS( ah, al, c0, s0+t0, ah, al ); \
+    DSP_MACCS( ah, al, c1, s1+t1, ah, al );
 
-static inline void _dsp_fir_dn( int* xx, const int* cc, int* ss, int nn, int rr )
+#define _fir_sym_tt( tt_ ) \
+{ \
+    int tt = tt_; const int* se = ss + 2*tt - 2; \
+    while( tt >= 8 ) { \
+        _fir_sym(0); _fir_sym(1); _fir_sym(2); _fir_sym(3); \
+        cc += 8; ss += 8; tt -= 8; \
+    } \
+    if( tt == 4 ) { _fir_sym(0); _fir_sym(1); } \
+}
+
+static inline int _dsp_fir_sym( int xx, const int* cc, int* ss, int nn )
 {
-    int c0, c1, s0, s1, ah = 0; unsigned al = 1<<(QQ-1);
-    memmove( ss+rr, ss, 4*(nn-rr) );
-    switch( rr ) {
-        case 2: asm volatile("std %0,%1,%2[0]"::"r"(xx[1]),"r"(xx[0]),"r"(ss)); break;
-        case 3: asm volatile("std %0,%1,%2[0]"::"r"(xx[1]),"r"(xx[0]),"r"(ss)); ss[2]=xx[2]; break;
-        case 4: asm volatile("std %0,%1,%2[0]"::"r"(xx[1]),"r"(xx[0]),"r"(ss));
-                asm volatile("std %0,%1,%2[1]"::"r"(xx[3]),"r"(xx[2]),"r"(ss)); break;
-        case 5: asm volatile("std %0,%1,%2[0]"::"r"(xx[1]),"r"(xx[0]),"r"(ss));
-                asm volatile("std %0,%1,%2[1]"::"r"(xx[3]),"r"(xx[2]),"r"(ss)); ss[4]=xx[4]; break;
-        case 6: asm volatile("std %0,%1,%2[0]"::"r"(xx[1]),"r"(xx[0]),"r"(ss));
-                asm volatile("std %0,%1,%2[1]"::"r"(xx[3]),"r"(xx[2]),"r"(ss));
-                asm volatile("std %0,%1,%2[2]"::"r"(xx[5]),"r"(xx[4]),"r"(ss)); break;
-        case 7: asm volatile("std %0,%1,%2[0]"::"r"(xx[1]),"r"(xx[0]),"r"(ss));
-                asm volatile("std %0,%1,%2[1]"::"r"(xx[3]),"r"(xx[2]),"r"(ss));
-                asm volatile("std %0,%1,%2[2]"::"r"(xx[5]),"r"(xx[4]),"r"(ss)); ss[6]=xx[6]; break;
-        case 8: asm volatile("std %0,%1,%2[0]"::"r"(xx[1]),"r"(xx[0]),"r"(ss));
-                asm volatile("std %0,%1,%2[1]"::"r"(xx[3]),"r"(xx[2]),"r"(ss));
-                asm volatile("std %0,%1,%2[2]"::"r"(xx[5]),"r"(xx[4]),"r"(ss));
-                asm volatile("std %0,%1,%2[3]"::"r"(xx[7]),"r"(xx[6]),"r"(ss)); break;
+    int c0, c1, s0, s1, t0, t1, ah = 0; unsigned al = 1<<(QQ-1);
+    _fir_push( &xx, ss, nn, 1 );
+    _fir_sym_tt( nn/2 );
+    DSP_LEXTRACT( ah, ah, al, QQ );
+    return ah;
+}
+
+static inline void _dsp_fir_dn_sym( int* xx, const int* cc, int* ss, int nn, int rr )
+{
+    int c0, c1, s0, s1, t0, t1, ah = 0; unsigned al = 1<<(QQ-1);
+    _fir_push( xx, ss, nn, rr );
+    _fir_sym_tt( nn/2 );
+    DSP_LEXTRACT( xx[0], ah, al, QQ );
+}
+
+// Half-band 2x up/dn-sampling. The half-band filter has 4*NN-1 taps, every other tap is zero
+// except for the center tap which is 0.5. CC holds the NN non-zero coefficients before the center
+// (H[0],H[2],..,H[2*NN-2]), NN must be a multiple of 4. Up-sampling computes one output with NN
+// MACs (pre-added symmetric pairs) and the other output is the delayed input (SS length is 2*NN).
+// Dn-sampling keeps the even and odd input phases separately (SS length is 3*NN).
+
+static inline void _dsp_halfband_up( int* xx, const int* cc, int* ss, int nn )
+{
+    int c0, c1, s0, s1, t0, t1, ah = 0; unsigned al = 1<<(QQ-2);
+    _fir_push( xx, ss, 2*nn, 1 );
+    xx[0] = ss[nn-1];
+    _fir_sym_tt( nn );
+    DSP_LEXTRACT( xx[1], ah, al, QQ-1 );
+}
+
+static inline void _dsp_halfband_dn( int* xx, const int* cc, int* ss, int nn )
+{
+    int c0, c1, s0, s1, t0, t1, ah; unsigned al; int* so = ss + 2*nn;
+    _fir_push( xx+0, ss, 2*nn, 1 );
+    _fir_push( xx+1, so,   nn, 1 );
+    DSP_MACCS( ah, al, so[nn-1], 1<<(QQ-1), 0, 1<<(QQ-1) );
+    _fir_sym_tt( nn );
+    DSP_LEXTRACT( xx[0], ah, al, QQ );
+}
+
+// CIC interpolation/decimation. SS[0:1] hold the gain normalization (shift and Q28 correction for
+// a CIC gain of RR^NN when decimating, RR^(NN-1) when interpolating) set on first use, SS[2:4*NN+1]
+// hold NN 64-bit integrator states and NN 64-bit comb states (low word first), SS[4*NN+2:4*NN+9]
+// hold the state of the optional 8-tap compensation FIR (CC) which runs at the low sample rate.
+// Integrators and combs wrap around which is harmless as long as the CIC gain fits in 32 bits
+// (NN*log2(RR) <= 32).
+
+static inline void _cic_norm( int* ss, int nn, int rr )
+{
+    unsigned gg = 1; int sh = 0;
+    while( nn-- > 0 ) gg *= rr;
+    while( sh < 32 && (1u<<sh) < gg ) ++sh;
+    ss[0] = sh; ss[1] = (unsigned)((1ull << (QQ+sh)) / gg); // 2^(QQ+sh) / gg, set up once
+}
+
+#define _cic_integ( ah, al, ss ) /* SS += AH:AL, AH:AL = SS */ \
+{ \
+    unsigned lo = (unsigned)(ss)[0] + (al); \
+    (ah) = (int)((unsigned)(ah) + (unsigned)(ss)[1] + (lo < (al))); (al) = lo; \
+    (ss)[0] = (int)(al); (ss)[1] = (ah); \
+}
+
+#define _cic_comb( ah, al, ss ) /* AH:AL -= SS, SS = old AH:AL */ \
+{ \
+    unsigned lo = (al) - (unsigned)(ss)[0]; \
+    int hi = (int)((unsigned)(ah) - (unsigned)(ss)[1] - ((al) < (unsigned)(ss)[0])); \
+    (ss)[0] = (int)(al); (ss)[1] = (ah); (ah) = hi; (al) = lo; \
+}
+
+#define _cic_out( yy, ah, al, ss ) \
+{ \
+    DSP_LEXTRACT( yy, ah, al, ss[0] ); \
+    DSP_MACCS( ah, al, yy, ss[1], 0, 1<<(QQ-1) ); \
+    DSP_LEXTRACT( yy, ah, al, QQ ); \
+}
+
+static inline void _dsp_cic_up( int* xx, const int* cc, int* ss, int nn, int rr )
+{
+    int *ii = ss+2, *cs = ss+2+2*nn, ah, kk, jj = rr; unsigned al;
+    if( ss[1] == 0 ) _cic_norm( ss, nn-1, rr );
+    al = cc ? _dsp_fir( xx[0], cc, ss+2+4*nn, 8 ) : xx[0]; ah = (int)al >> 31;
+    for( kk = 0; kk < nn; ++kk ) _cic_comb( ah, al, cs+2*kk ); // Combs
+    while( jj-- ) { // Integrators at the output rate (zero-stuffed input), oldest output first
+        for( kk = 0; kk < nn; ++kk ) _cic_integ( ah, al, ii+2*kk );
+        _cic_out( xx[jj], ah, al, ss ); ah = 0; al = 0;
     }
-    while( nn >= 24 ) {
-        _fir_read0(); _fir_read1(); _fir_read2(); _fir_read3(); _fir_read4(); _fir_read5();
-        cc += 24; ss += 24; nn -= 24;
+}
+
+static inline void _dsp_cic_dn( int* xx, const int* cc, int* ss, int nn, int rr )
+{
+    int *ii = ss+2, *cs = ss+2+2*nn, ah = 0, kk, jj = rr; unsigned al = 0;
+    if( ss[1] == 0 ) _cic_norm( ss, nn, rr );
+    while( jj-- ) { // Integrators at the input rate, oldest input first
+        al = xx[jj]; ah = xx[jj] >> 31;
+        for( kk = 0; kk < nn; ++kk ) _cic_integ( ah, al, ii+2*kk );
     }
-    switch( nn ) {
-        case 20: _fir_read0(); _fir_read1(); _fir_read2(); _fir_read3(); _fir_read4(); break;
-        case 16: _fir_read0(); _fir_read1(); _fir_read2(); _fir_read3(); break;
-        case 12: _fir_read0(); _fir_read1(); _fir_read2(); break;
-        case  8: _fir_read0(); _fir_read1(); break;
-        case  4: _fir_read0(); break;
+    for( kk = 0; kk < nn; ++kk ) _cic_comb( ah, al, cs+2*kk ); // Combs
+    _cic_out( xx[0], ah, al, ss );
+    if( cc ) xx[0] = _dsp_fir( xx[0], cc, ss+2+4*nn, 8 );
+}
+
+// Coefficient ramping (see 'dsp_ramp_set'). RR[0] is NN, RR[1] is the number of samples left in the
+// ramp, RR[2:NN+1] are the target coefficients and RR[NN+2:2*NN+1] are the per-sample increments.
+
+static inline void _dsp_ramp( int* cc, int* rr )
+{
+    int nn = rr[0], kk = rr[1];
+    if( kk == 0 ) return;
+    rr[1] = --kk;
+    if( kk == 0 ) for( int ii = 0; ii < nn; ++ii ) cc[ii] = rr[2+ii]; // Land exactly on target
+    else {
+        const int* dd = rr + 2 + nn;
+        for( int ii = 0; ii < nn; ++ii ) cc[ii] += dd[ii];
     }
-    asm volatile("lextract %0,%1,%2,%3,32":"=r"(xx[0]):"r"(ah),"r"(al),"r"(QQ));
 }
 
+// Double-buffered coefficient banks (see 'dsp_bank_commit'). BK[0] is the active bank (0 or 1), BK[1]
+// is NN and the two banks of NN coefficients follow.
+
+#define _dsp_bank( bk ) ((bk) + 2 + (bk)[0] * (bk)[1])
+
+// State variable filter (topology preserving transform / trapezoidal integration). XX[0] is the
+// input, XX[0:3] return the low-pass, band-pass, high-pass and notch outputs. CC[0] is the cutoff
+// frequency FF (fraction of the sample rate, 0 < FF < 0.5) and CC[1] is the damping KK = 1/Q (0 <
+// KK <= 2) - both may change every sample. The coefficients G=tan(pi*FF), A1=1/(1+G*(G+KK)),
+// A2=G*A1, A3=G*A2 are calculated from S=sin(2*pi*FF) and C=cos(2*pi*FF) ('dsp_sine_14' with
+// linear interpolation) as A1=(1+C)/2/D, A2=S/2/D, A3=(1-C)/2/D with D=1+KK*S/2. SS length is 2.
+
 #define _dsp_statevar( xx, cc, ss ) \
 { \
-    unsigned al; int ah, ff,qq,yl,yb,yh; \
-	/* State variable filter: Yl=Yl+(F)*Yb,Yh=X-Yl+(-Q)*Yb,Yb=F*Yh+Yb,Yn=Yh+Yl */ \
-    asm volatile( "ldd %0,%1,%2[0]":"=r"(qq),"=r"(ff):"r"(cc) ); \
-    asm volatile( "ldd %0,%1,%2[0]":"=r"(yb),"=r"(yl):"r"(ss) ); \
-    asm volatile( "maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(ff),"r"(yb),"0"(0),"1"(yl) ); \
-    asm volatile( "lextract %0,%1,%2,%3,32":"=r"(yl):"r"(ah),"r"(al),"r"(QQ) ); \
-    asm volatile( "maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(qq),"r"(yb),"0"(0),"1"(xx-yl) ); \
-    asm volatile( "lextract %0,%1,%2,%3,32":"=r"(yh):"r"(ah),"r"(al),"r"(QQ) ); \
-    asm volatile( "maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(ff),"r"(yh),"0"(0),"1"(yb) ); \
-    asm volatile( "std %0,%1,%2[0]"::"r"(yb),"r"(yl),"r"(ss) ); \
+    unsigned al; int ah, ff,kk, ii,dd, sn,cs,a1,a2,a3, i1,i2, v1,v2,v3; \
+    DSP_LDD( kk, ff, cc, 0 ); \
+    ii = ff >> (QQ-14); dd = (ff & ((1<<(QQ-14))-1)) << 14; \
+    sn = dsp_sine_14( ii ); cs = dsp_sine_14( ii+4096 ); \
+    DSP_MACCS( ah, al, dd, dsp_sine_14( ii+1 ) - sn, 0, 1<<(QQ-1) ); \
+    DSP_LEXTRACT( ah, ah, al, QQ ); sn += ah; \
+    DSP_MACCS( ah, al, dd, dsp_sine_14( ii+4097 ) - cs, 0, 1<<(QQ-1) ); \
+    DSP_LEXTRACT( ah, ah, al, QQ ); cs += ah; \
+    DSP_MACCS( ah, al, kk, sn, 0, 1<<QQ ); \
+    DSP_LEXTRACT( dd, ah, al, QQ+1 ); dd += 1<<QQ;          /* D = 1 + KK*S/2 */ \
+    DSP_LDIVU( dd, ah, 1<<(2*QQ-32), 0, dd );              /* 1/D */ \
+    DSP_MACCS( ah, al, (1<<QQ)+cs, dd, 0, 1<<QQ ); DSP_LEXTRACT( a1, ah, al, QQ+1 ); \
+    DSP_MACCS( ah, al, sn, dd, 0, 1<<QQ );         DSP_LEXTRACT( a2, ah, al, QQ+1 ); \
+    DSP_MACCS( ah, al, (1<<QQ)-cs, dd, 0, 1<<QQ ); DSP_LEXTRACT( a3, ah, al, QQ+1 ); \
+    DSP_LDD( i2, i1, ss, 0 ); \
+    v3 = xx[0] - i2; \
+    DSP_MACCS( ah, al, a1, i1, 0, 1<<(QQ-1) ); DSP_MACCS( ah, al, a2, v3, ah, al ); \
+    DSP_LEXTRACT( v1, ah, al, QQ ); \
+    DSP_MACCS( ah, al, a2, i1, 0, 1<<(QQ-1) ); DSP_MACCS( ah, al, a3, v3, ah, al ); \
+    DSP_LEXTRACT( v2, ah, al, QQ ); v2 += i2; \
+    DSP_STD( v2+v2-i2, v1+v1-i1, ss, 0 ); \
+    DSP_MACCS( ah, al, kk, v1, 0, 1<<(QQ-1) ); \
+    DSP_LEXTRACT( ah, ah, al, QQ ); \
+    xx[3] = xx[0] - ah; xx[2] = xx[3] - v2; xx[1] = v1; xx[0] = v2; \
 }
 
 #define _dsp_iir1( xx, cc, ss ) \
 { \
     unsigned al; int ah, b0,b1,a1, x1,y1, tmp; \
-    asm volatile("ldd %0,%1,%2[0]":"=r"(b1),"=r"(b0):"r"(cc)); \
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(xx),"r"(b0),"0"(0),"1"(0)); \
-    asm volatile("ldd %0,%1,%2[0]":"=r"(y1),"=r"(x1):"r"(ss)); \
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(x1),"r"(b1),"0"(ah),"1"(al)); \
-    asm volatile("ldd %0,%1,%2[1]":"=r"(tmp),"=r"(a1):"r"(cc)); \
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(y1),"r"(a1),"0"(ah),"1"(al)); \
-    asm volatile("lextract %0,%1,%2,%3,32":"=r"(ah):"r"(ah),"r"(al),"r"(QQ)); \
-    asm volatile("std %0,%1,%2[0]"::"r"(ah),"r"(xx),"r"(ss)); \
+    DSP_LDD( b1, b0, cc, 0 ); \
+    DSP_MACCS( ah, al, xx, b0, 0, 0 ); \
+    DSP_LDD( y1, x1, ss, 0 ); \
+    DSP_MACCS( ah, al, x1, b1, ah, al ); \
+    DSP_LDD( tmp, a1, cc, 1 ); \
+    DSP_MACCS( ah, al, y1, a1, ah, al ); \
+    DSP_LEXTRACT( ah, ah, al, QQ ); \
+    DSP_STD( ah, xx, ss, 0 ); \
     xx = ah; \
 }
 
 #define _dsp_iir2( xx, cc, ss ) \
 { \
     unsigned al; int ah, b0,b1,b2,a1,a2, x1,x2,y1,y2, tmp; \
-    asm volatile("ldd %0,%1,%2[0]":"=r"(b1),"=r"(b0):"r"(cc)); \
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(xx),"r"(b0),"0"(0),"1"(0)); \
-    asm volatile("ldd %0,%1,%2[0]":"=r"(x2),"=r"(x1):"r"(ss)); \
-    asm volatile("std %0,%1,%2[0]"::"r"(x1),"r"(xx),"r"(ss)); \
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(x1),"r"(b1),"0"(ah),"1"(al)); \
-    asm volatile("ldd %0,%1,%2[1]":"=r"(a1),"=r"(b2):"r"(cc)); \
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(x2),"r"(b2),"0"(ah),"1"(al)); \
-    asm volatile("ldd %0,%1,%2[1]":"=r"(y2),"=r"(y1):"r"(ss)); \
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(y1),"r"(a1),"0"(ah),"1"(al)); \
-    asm volatile("ldd %0,%1,%2[2]":"=r"(tmp),"=r"(a2):"r"(cc)); \
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(y2),"r"(a2),"0"(ah),"1"(al)); \
-    asm volatile("lextract %0,%1,%2,%3,32":"=r"(ah):"r"(ah),"r"(al),"r"(QQ)); \
-    asm volatile("std %0,%1,%2[1]"::"r"(y1),"r"(ah),"r"(ss)); \
+    DSP_LDD( b1, b0, cc, 0 ); \
+    DSP_MACCS( ah, al, xx, b0, 0, 0 ); \
+    DSP_LDD( x2, x1, ss, 0 ); \
+    DSP_STD( x1, xx, ss, 0 ); \
+    DSP_MACCS( ah, al, x1, b1, ah, al ); \
+    DSP_LDD( a1, b2, cc, 1 ); \
+    DSP_MACCS( ah, al, x2, b2, ah, al ); \
+    DSP_LDD( y2, y1, ss, 1 ); \
+    DSP_MACCS( ah, al, y1, a1, ah, al ); \
+    DSP_LDD( tmp, a2, cc, 2 ); \
+    DSP_MACCS( ah, al, y2, a2, ah, al ); \
+    DSP_LEXTRACT( ah, ah, al, QQ ); \
+    DSP_STD( y1, ah, ss, 1 ); \
     xx = ah; \
 }
 
 #define _dsp_iir3( xx, cc, ss ) \
 { \
     unsigned al; int ah, b0,b1,b2,b3,a1,a2,a3, x1,x2,x3,y1,y2,y3, tmp; \
-    asm volatile("ldd %0,%1,%2[0]":"=r"(b1),"=r"(b0):"r"(cc)); \
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(xx),"r"(b0),"0"(0),"1"(0)); \
-    asm volatile("ldd %0,%1,%2[0]":"=r"(x2),"=r"(x1):"r"(ss)); \
-    asm volatile("std %0,%1,%2[0]"::"r"(x1),"r"(xx),"r"(ss)); \
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(x1),"r"(b1),"0"(ah),"1"(al)); \
-    asm volatile("ldd %0,%1,%2[1]":"=r"(b3),"=r"(b2):"r"(cc)); \
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(x2),"r"(b2),"0"(ah),"1"(al)); \
-    asm volatile("ldd %0,%1,%2[2]":"=r"(a2),"=r"(a1):"r"(cc)); \
-    asm volatile("ldd %0,%1,%2[3]":"=r"(tmp),"=r"(a3):"r"(cc)); \
-    asm volatile("ldd %0,%1,%2[1]":"=r"(y1),"=r"(x3):"r"(ss)); ss[2] = x2; \
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(x3),"r"(b3),"0"(ah),"1"(al)); \
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(y1),"r"(a1),"0"(ah),"1"(al)); \
-    asm volatile("ldd %0,%1,%2[2]":"=r"(y3),"=r"(y2):"r"(ss)); \
-    asm volatile("std %0,%1,%2[2]"::"r"(y2),"r"(y1),"r"(ss)); \
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(y2),"r"(a2),"0"(ah),"1"(al)); \
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(y3),"r"(a3),"0"(ah),"1"(al)); \
-    asm volatile("lextract %0,%1,%2,%3,32":"=r"(ah):"r"(ah),"r"(al),"r"(QQ)); ss[3] = ah; \
+    DSP_LDD( b1, b0, cc, 0 ); \
+    DSP_MACCS( ah, al, xx, b0, 0, 0 ); \
+    DSP_LDD( x2, x1, ss, 0 ); \
+    DSP_STD( x1, xx, ss, 0 ); \
+    DSP_MACCS( ah, al, x1, b1, ah, al ); \
+    DSP_LDD( b3, b2, cc, 1 ); \
+    DSP_MACCS( ah, al, x2, b2, ah, al ); \
+    DSP_LDD( a2, a1, cc, 2 ); \
+    DSP_LDD( tmp, a3, cc, 3 ); \
+    DSP_LDD( y1, x3, ss, 1 ); ss[2] = x2; \
+    DSP_MACCS( ah, al, x3, b3, ah, al ); \
+    DSP_MACCS( ah, al, y1, a1, ah, al ); \
+    DSP_LDD( y3, y2, ss, 2 ); \
+    DSP_STD( y2, y1, ss, 2 ); \
+    DSP_MACCS( ah, al, y2, a2, ah, al ); \
+    DSP_MACCS( ah, al, y3, a3, ah, al ); \
+    DSP_LEXTRACT( ah, ah, al, QQ ); ss[3] = ah; \
     xx = ah; \
 }
 
 #define _dsp_biquad1( xx, cc, ss ) \
 { \
     unsigned al; int ah, c1,c2, s1,s2; \
-    asm volatile("ldd %0,%1,%2[0]":"=r"(c2),"=r"(c1):"r"(cc)); \
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(xx),"r"(c1),"0"(0),"1"(0)); \
-    asm volatile("ldd %0,%1,%2[0]":"=r"(s2),"=r"(s1):"r"(ss)); \
-    asm volatile("std %0,%1,%2[0]"::"r"(s1),"r"(xx),"r"(ss)); \
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(s1),"r"(c2),"0"(ah),"1"(al)); \
-    asm volatile("ldd %0,%1,%2[1]":"=r"(c2),"=r"(c1):"r"(cc)); \
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(s2),"r"(c1),"0"(ah),"1"(al)); \
-    asm volatile("ldd %0,%1,%2[1]":"=r"(s2),"=r"(s1):"r"(ss)); \
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(s1),"r"(c2),"0"(ah),"1"(al)); \
-    asm volatile("ldd %0,%1,%2[2]":"=r"(c2),"=r"(c1):"r"(cc)); \
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(s2),"r"(c1),"0"(ah),"1"(al)); \
-    asm volatile("lextract %0,%1,%2,%3,32":"=r"(ah):"r"(ah),"r"(al),"r"(QQ)); \
-    asm volatile("std %0,%1,%2[1]"::"r"(s1),"r"(ah),"r"(ss)); \
+    DSP_LDD( c2, c1, cc, 0 ); \
+    DSP_MACCS( ah, al, xx, c1, 0, 0 ); \
+    DSP_LDD( s2, s1, ss, 0 ); \
+    DSP_STD( s1, xx, ss, 0 ); \
+    DSP_MACCS( ah, al, s1, c2, ah, al ); \
+    DSP_LDD( c2, c1, cc, 1 ); \
+    DSP_MACCS( ah, al, s2, c1, ah, al ); \
+    DSP_LDD( s2, s1, ss, 1 ); \
+    DSP_MACCS( ah, al, s1, c2, ah, al ); \
+    DSP_LDD( c2, c1, cc, 2 ); \
+    DSP_MACCS( ah, al, s2, c1, ah, al ); \
+    DSP_LEXTRACT( ah, ah, al, QQ ); \
+    DSP_STD( s1, ah, ss, 1 ); \
     xx = ah; \
 }
 
 #define _dsp_biquad2( xx, cc, ss ) \
 { \
     unsigned al; int ah, b0,b1, s1,s2; \
-    asm volatile("ldd %0,%1,%2[0]":"=r"(b1),"=r"(b0):"r"(cc)); \
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(xx),"r"(b0),"0"(0),"1"(1<<(QQ-1))); \
-    asm volatile("ldd %0,%1,%2[0]":"=r"(s2),"=r"(s1):"r"(ss)); \
-    asm volatile("std %0,%1,%2[0]"::"r"(s1),"r"(xx),"r"(ss)); \
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(s1),"r"(b1),"0"(ah),"1"(al)); \
-    asm volatile("ldd %0,%1,%2[1]":"=r"(b1),"=r"(b0):"r"(cc)); \
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(s2),"r"(b0),"0"(ah),"1"(al)); \
-    asm volatile("ldd %0,%1,%2[1]":"=r"(s2),"=r"(s1):"r"(ss)); \
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(s1),"r"(b1),"0"(ah),"1"(al)); \
-    asm volatile("ldd %0,%1,%2[2]":"=r"(b1),"=r"(b0):"r"(cc)); \
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(s2),"r"(b0),"0"(ah),"1"(al)); \
-    asm volatile("lextract %0,%1,%2,%3,32":"=r"(ah):"r"(ah),"r"(al),"r"(QQ)); \
-    asm volatile("std %0,%1,%2[1]"::"r"(s1),"r"(ah),"r"(ss)); \
+    DSP_LDD( b1, b0, cc, 0 ); \
+    DSP_MACCS( ah, al, xx, b0, 0, 1<<(QQ-1) ); \
+    DSP_LDD( s2, s1, ss, 0 ); \
+    DSP_STD( s1, xx, ss, 0 ); \
+    DSP_MACCS( ah, al, s1, b1, ah, al ); \
+    DSP_LDD( b1, b0, cc, 1 ); \
+    DSP_MACCS( ah, al, s2, b0, ah, al ); \
+    DSP_LDD( s2, s1, ss, 1 ); \
+    DSP_MACCS( ah, al, s1, b1, ah, al ); \
+    DSP_LDD( b1, b0, cc, 2 ); \
+    DSP_MACCS( ah, al, s2, b0, ah, al ); \
+    DSP_LEXTRACT( ah, ah, al, QQ ); \
+    DSP_STD( s1, ah, ss, 1 ); \
     xx = ah; \
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(ah),"r"(b1),"0"(0),"1"(1<<(QQ-1))); \
-    asm volatile("ldd %0,%1,%2[3]":"=r"(b1),"=r"(b0):"r"(cc)); \
-    asm volatile("ldd %0,%1,%2[2]":"=r"(s2),"=r"(s1):"r"(ss)); \
-    asm volatile("std %0,%1,%2[2]"::"r"(s1),"r"(xx),"r"(ss)); \
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(s1),"r"(b0),"0"(ah),"1"(al)); \
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(s2),"r"(b1),"0"(ah),"1"(al)); \
-    asm volatile("ldd %0,%1,%2[4]":"=r"(b1),"=r"(b0):"r"(cc)); \
-    asm volatile("ldd %0,%1,%2[3]":"=r"(s2),"=r"(s1):"r"(ss)); \
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(s1),"r"(b0),"0"(ah),"1"(al)); \
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(s2),"r"(b1),"0"(ah),"1"(al)); \
-    asm volatile("lextract %0,%1,%2,%3,32":"=r"(ah):"r"(ah),"r"(al),"r"(QQ)); \
-    asm volatile("std %0,%1,%2[3]"::"r"(s1),"r"(ah),"r"(ss)); \
+    DSP_MACCS( ah, al, ah, b1, 0, 1<<(QQ-1) ); \
+    DSP_LDD( b1, b0, cc, 3 ); \
+    DSP_LDD( s2, s1, ss, 2 ); \
+    DSP_STD( s1, xx, ss, 2 ); \
+    DSP_MACCS( ah, al, s1, b0, ah, al ); \
+    DSP_MACCS( ah, al, s2, b1, ah, al ); \
+    DSP_LDD( b1, b0, cc, 4 ); \
+    DSP_LDD( s2, s1, ss, 3 ); \
+    DSP_MACCS( ah, al, s1, b0, ah, al ); \
+    DSP_MACCS( ah, al, s2, b1, ah, al ); \
+    DSP_LEXTRACT( ah, ah, al, QQ ); \
+    DSP_STD( s1, ah, ss, 3 ); \
     xx = ah; \
 }
 
 #define _dsp_biquad3( xx, cc, ss ) \
 { \
     unsigned al; int ah, b0,b1, s1,s2; \
-    asm volatile("ldd %0,%1,%2[0]":"=r"(b1),"=r"(b0):"r"(cc)); \
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(xx),"r"(b0),"0"(0),"1"(1<<(QQ-1))); \
-    asm volatile("ldd %0,%1,%2[0]":"=r"(s2),"=r"(s1):"r"(ss)); \
-    asm volatile("std %0,%1,%2[0]"::"r"(s1),"r"(xx),"r"(ss)); \
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(s1),"r"(b1),"0"(ah),"1"(al)); \
-    asm volatile("ldd %0,%1,%2[1]":"=r"(b1),"=r"(b0):"r"(cc)); \
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(s2),"r"(b0),"0"(ah),"1"(al)); \
-    asm volatile("ldd %0,%1,%2[1]":"=r"(s2),"=r"(s1):"r"(ss)); \
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(s1),"r"(b1),"0"(ah),"1"(al)); \
-    asm volatile("ldd %0,%1,%2[2]":"=r"(b1),"=r"(b0):"r"(cc)); \
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(s2),"r"(b0),"0"(ah),"1"(al)); \
-    asm volatile("lextract %0,%1,%2,%3,32":"=r"(ah):"r"(ah),"r"(al),"r"(QQ)); \
-    asm volatile("std %0,%1,%2[1]"::"r"(s1),"r"(ah),"r"(ss)); \
+    DSP_LDD( b1, b0, cc, 0 ); \
+    DSP_MACCS( ah, al, xx, b0, 0, 1<<(QQ-1) ); \
+    DSP_LDD( s2, s1, ss, 0 ); \
+    DSP_STD( s1, xx, ss, 0 ); \
+    DSP_MACCS( ah, al, s1, b1, ah, al ); \
+    DSP_LDD( b1, b0, cc, 1 ); \
+    DSP_MACCS( ah, al, s2, b0, ah, al ); \
+    DSP_LDD( s2, s1, ss, 1 ); \
+    DSP_MACCS( ah, al, s1, b1, ah, al ); \
+    DSP_LDD( b1, b0, cc, 2 ); \
+    DSP_MACCS( ah, al, s2, b0, ah, al ); \
+    DSP_LEXTRACT( ah, ah, al, QQ ); \
+    DSP_STD( s1, ah, ss, 1 ); \
     xx = ah; \
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(ah),"r"(b1),"0"(0),"1"(1<<(QQ-1))); \
-    asm volatile("ldd %0,%1,%2[3]":"=r"(b1),"=r"(b0):"r"(cc)); \
-    asm volatile("ldd %0,%1,%2[2]":"=r"(s2),"=r"(s1):"r"(ss)); \
-    asm volatile("std %0,%1,%2[2]"::"r"(s1),"r"(xx),"r"(ss)); \
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(s1),"r"(b0),"0"(ah),"1"(al)); \
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(s2),"r"(b1),"0"(ah),"1"(al)); \
-    asm volatile("ldd %0,%1,%2[4]":"=r"(b1),"=r"(b0):"r"(cc)); \
-    asm volatile("ldd %0,%1,%2[3]":"=r"(s2),"=r"(s1):"r"(ss)); \
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(s1),"r"(b0),"0"(ah),"1"(al)); \
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(s2),"r"(b1),"0"(ah),"1"(al)); \
-    asm volatile("lextract %0,%1,%2,%3,32":"=r"(ah):"r"(ah),"r"(al),"r"(QQ)); \
-    asm volatile("std %0,%1,%2[3]"::"r"(s1),"r"(ah),"r"(ss)); \
+    DSP_MACCS( ah, al, ah, b1, 0, 1<<(QQ-1) ); \
+    DSP_LDD( b1, b0, cc, 3 ); \
+    DSP_LDD( s2, s1, ss, 2 ); \
+    DSP_STD( s1, xx, ss, 2 ); \
+    DSP_MACCS( ah, al, s1, b0, ah, al ); \
+    DSP_MACCS( ah, al, s2, b1, ah, al ); \
+    DSP_LDD( b1, b0, cc, 4 ); \
+    DSP_LDD( s2, s1, ss, 3 ); \
+    DSP_MACCS( ah, al, s1, b0, ah, al ); \
+    DSP_MACCS( ah, al, s2, b1, ah, al ); \
+    DSP_LEXTRACT( ah, ah, al, QQ ); \
+    DSP_STD( s1, ah, ss, 3 ); \
     xx = ah; \
-    asm volatile("ldd %0,%1,%2[5]":"=r"(b1),"=r"(b0):"r"(cc)); \
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(xx),"r"(b0),"0"(0),"1"(1<<(QQ-1))); \
-    asm volatile("ldd %0,%1,%2[4]":"=r"(s2),"=r"(s1):"r"(ss)); \
-    asm volatile("std %0,%1,%2[4]"::"r"(s1),"r"(xx),"r"(ss)); \
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(s1),"r"(b1),"0"(ah),"1"(al)); \
-    asm volatile("ldd %0,%1,%2[6]":"=r"(b1),"=r"(b0):"r"(cc)); \
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(s2),"r"(b0),"0"(ah),"1"(al)); \
-    asm volatile("ldd %0,%1,%2[5]":"=r"(s2),"=r"(s1):"r"(ss)); \
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(s1),"r"(b1),"0"(ah),"1"(al)); \
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(s2),"r"(cc[14]),"0"(ah),"1"(al)); \
-    asm volatile("lextract %0,%1,%2,%3,32":"=r"(ah):"r"(ah),"r"(al),"r"(QQ)); \
-    asm volatile("std %0,%1,%2[5]"::"r"(s1),"r"(ah),"r"(ss)); \
+    DSP_LDD( b1, b0, cc, 5 ); \
+    DSP_MACCS( ah, al, xx, b0, 0, 1<<(QQ-1) ); \
+    DSP_LDD( s2, s1, ss, 4 ); \
+    DSP_STD( s1, xx, ss, 4 ); \
+    DSP_MACCS( ah, al, s1, b1, ah, al ); \
+    DSP_LDD( b1, b0, cc, 6 ); \
+    DSP_MACCS( ah, al, s2, b0, ah, al ); \
+    DSP_LDD( s2, s1, ss, 5 ); \
+    DSP_MACCS( ah, al, s1, b1, ah, al ); \
+    DSP_MACCS( ah, al, s2, cc[14], ah, al ); \
+    DSP_LEXTRACT( ah, ah, al, QQ ); \
+    DSP_STD( s1, ah, ss, 5 ); \
     xx = ah; \
 }
 
 #define _dsp_biquad4( xx, cc, ss ) \
 { \
     unsigned al; int ah, b0,b1, s1,s2; \
-    asm volatile("ldd %0,%1,%2[0]":"=r"(b1),"=r"(b0):"r"(cc)); \
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(xx),"r"(b0),"0"(0),"1"(1<<(QQ-1))); \
-    asm volatile("ldd %0,%1,%2[0]":"=r"(s2),"=r"(s1):"r"(ss)); \
-    asm volatile("std %0,%1,%2[0]"::"r"(s1),"r"(xx),"r"(ss)); \
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(s1),"r"(b1),"0"(ah),"1"(al)); \
-    asm volatile("ldd %0,%1,%2[1]":"=r"(b1),"=r"(b0):"r"(cc)); \
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(s2),"r"(b0),"0"(ah),"1"(al)); \
-    asm volatile("ldd %0,%1,%2[1]":"=r"(s2),"=r"(s1):"r"(ss)); \
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(s1),"r"(b1),"0"(ah),"1"(al)); \
-    asm volatile("ldd %0,%1,%2[2]":"=r"(b1),"=r"(b0):"r"(cc)); \
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(s2),"r"(b0),"0"(ah),"1"(al)); \
-    asm volatile("lextract %0,%1,%2,%3,32":"=r"(ah):"r"(ah),"r"(al),"r"(QQ)); \
-    asm volatile("std %0,%1,%2[1]"::"r"(s1),"r"(ah),"r"(ss)); \
+    DSP_LDD( b1, b0, cc, 0 ); \
+    DSP_MACCS( ah, al, xx, b0, 0, 1<<(QQ-1) ); \
+    DSP_LDD( s2, s1, ss, 0 ); \
+    DSP_STD( s1, xx, ss, 0 ); \
+    DSP_MACCS( ah, al, s1, b1, ah, al ); \
+    DSP_LDD( b1, b0, cc, 1 ); \
+    DSP_MACCS( ah, al, s2, b0, ah, al ); \
+    DSP_LDD( s2, s1, ss, 1 ); \
+    DSP_MACCS( ah, al, s1, b1, ah, al ); \
+    DSP_LDD( b1, b0, cc, 2 ); \
+    DSP_MACCS( ah, al, s2, b0, ah, al ); \
+    DSP_LEXTRACT( ah, ah, al, QQ ); \
+    DSP_STD( s1, ah, ss, 1 ); \
     xx = ah; \
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(ah),"r"(b1),"0"(0),"1"(1<<(QQ-1))); \
-    asm volatile("ldd %0,%1,%2[3]":"=r"(b1),"=r"(b0):"r"(cc)); \
-    asm volatile("ldd %0,%1,%2[2]":"=r"(s2),"=r"(s1):"r"(ss)); \
-    asm volatile("std %0,%1,%2[2]"::"r"(s1),"r"(xx),"r"(ss)); \
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(s1),"r"(b0),"0"(ah),"1"(al)); \
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(s2),"r"(b1),"0"(ah),"1"(al)); \
-    asm volatile("ldd %0,%1,%2[4]":"=r"(b1),"=r"(b0):"r"(cc)); \
-    asm volatile("ldd %0,%1,%2[3]":"=r"(s2),"=r"(s1):"r"(ss)); \
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(s1),"r"(b0),"0"(ah),"1"(al)); \
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(s2),"r"(b1),"0"(ah),"1"(al)); \
-    asm volatile("lextract %0,%1,%2,%3,32":"=r"(ah):"r"(ah),"r"(al),"r"(QQ)); \
-    asm volatile("std %0,%1,%2[3]"::"r"(s1),"r"(ah),"r"(ss)); \
+    DSP_MACCS( ah, al, ah, b1, 0, 1<<(QQ-1) ); \
+    DSP_LDD( b1, b0, cc, 3 ); \
+    DSP_LDD( s2, s1, ss, 2 ); \
+    DSP_STD( s1, xx, ss, 2 ); \
+    DSP_MACCS( ah, al, s1, b0, ah, al ); \
+    DSP_MACCS( ah, al, s2, b1, ah, al ); \
+    DSP_LDD( b1, b0, cc, 4 ); \
+    DSP_LDD( s2, s1, ss, 3 ); \
+    DSP_MACCS( ah, al, s1, b0, ah, al ); \
+    DSP_MACCS( ah, al, s2, b1, ah, al ); \
+    DSP_LEXTRACT( ah, ah, al, QQ ); \
+    DSP_STD( s1, ah, ss, 3 ); \
     xx = ah; \
-    asm volatile("ldd %0,%1,%2[5]":"=r"(b1),"=r"(b0):"r"(cc)); \
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(xx),"r"(b0),"0"(0),"1"(1<<(QQ-1))); \
-    asm volatile("ldd %0,%1,%2[4]":"=r"(s2),"=r"(s1):"r"(ss)); \
-    asm volatile("std %0,%1,%2[4]"::"r"(s1),"r"(xx),"r"(ss)); \
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(s1),"r"(b1),"0"(ah),"1"(al)); \
-    asm volatile("ldd %0,%1,%2[6]":"=r"(b1),"=r"(b0):"r"(cc)); \
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(s2),"r"(b0),"0"(ah),"1"(al)); \
-    asm volatile("ldd %0,%1,%2[5]":"=r"(s2),"=r"(s1):"r"(ss)); \
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(s1),"r"(b1),"0"(ah),"1"(al)); \
-    asm volatile("ldd %0,%1,%2[7]":"=r"(b1),"=r"(b0):"r"(cc)); \
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(s2),"r"(b0),"0"(ah),"1"(al)); \
-    asm volatile("lextract %0,%1,%2,%3,32":"=r"(ah):"r"(ah),"r"(al),"r"(QQ)); \
-    asm volatile("std %0,%1,%2[5]"::"r"(s1),"r"(ah),"r"(ss)); \
+    DSP_LDD( b1, b0, cc, 5 ); \
+    DSP_MACCS( ah, al, xx, b0, 0, 1<<(QQ-1) ); \
+    DSP_LDD( s2, s1, ss, 4 ); \
+    DSP_STD( s1, xx, ss, 4 ); \
+    DSP_MACCS( ah, al, s1, b1, ah, al ); \
+    DSP_LDD( b1, b0, cc, 6 ); \
+    DSP_MACCS( ah, al, s2, b0, ah, al ); \
+    DSP_LDD( s2, s1, ss, 5 ); \
+    DSP_MACCS( ah, al, s1, b1, ah, al ); \
+    DSP_LDD( b1, b0, cc, 7 ); \
+    DSP_MACCS( ah, al, s2, b0, ah, al ); \
+    DSP_LEXTRACT( ah, ah, al, QQ ); \
+    DSP_STD( s1, ah, ss, 5 ); \
     xx = ah; \
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(ah),"r"(b1),"0"(0),"1"(1<<(QQ-1))); \
-    asm volatile("ldd %0,%1,%2[8]":"=r"(b1),"=r"(b0):"r"(cc)); \
-    asm volatile("ldd %0,%1,%2[6]":"=r"(s2),"=r"(s1):"r"(ss)); \
-    asm volatile("std %0,%1,%2[6]"::"r"(s1),"r"(xx),"r"(ss)); \
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(s1),"r"(b0),"0"(ah),"1"(al)); \
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(s2),"r"(b1),"0"(ah),"1"(al)); \
-    asm volatile("ldd %0,%1,%2[9]":"=r"(b1),"=r"(b0):"r"(cc)); \
-    asm volatile("ldd %0,%1,%2[7]":"=r"(s2),"=r"(s1):"r"(ss)); \
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(s1),"r"(b0),"0"(ah),"1"(al)); \
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(s2),"r"(b1),"0"(ah),"1"(al)); \
-    asm volatile("lextract %0,%1,%2,%3,32":"=r"(ah):"r"(ah),"r"(al),"r"(QQ)); \
-    asm volatile("std %0,%1,%2[7]"::"r"(s1),"r"(ah),"r"(ss)); \
+    DSP_MACCS( ah, al, ah, b1, 0, 1<<(QQ-1) ); \
+    DSP_LDD( b1, b0, cc, 8 ); \
+    DSP_LDD( s2, s1, ss, 6 ); \
+    DSP_STD( s1, xx, ss, 6 ); \
+    DSP_MACCS( ah, al, s1, b0, ah, al ); \
+    DSP_MACCS( ah, al, s2, b1, ah, al ); \
+    DSP_LDD( b1, b0, cc, 9 ); \
+    DSP_LDD( s2, s1, ss, 7 ); \
+    DSP_MACCS( ah, al, s1, b0, ah, al ); \
+    DSP_MACCS( ah, al, s2, b1, ah, al ); \
+    DSP_LEXTRACT( ah, ah, al, QQ ); \
+    DSP_STD( s1, ah, ss, 7 ); \
     xx = ah; \
 }
 
+// Table-free approximations of tanh, atan, 2^x and sine (XX and results in QQQ format). Polynomial
+// coefficients are minimax fits (Lawson's algorithm) and TANH uses Pade approximants (one division).
+// Accuracy and cost are listed in DSP.H. '_poly_step' is one Horner step YY = YY * ZZ + CC.
+
+#define _poly_step( yy, zz, cc ) \
+    DSP_MACCS( ah, al, yy, zz, (cc)>>(32-QQ), ((unsigned)(cc)<<QQ)+(1<<(QQ-1)) ); \
+    DSP_LEXTRACT( yy, ah, al, QQ );
+
+// TANH = XX*P(UU)/Q(UU) (Pade approximant) with UU = (XX/8)^2 and P and Q scaled so that all of the
+// coefficients are exact QQQ values. Saturates to +/-1 where the approximant reaches 1 (XX = 3.0,
+// 4.97 and 6.95 for orders 3, 5 and 7).
+
+static inline int _tanh_div( int xx, int pp, int qq ) // XX * PP / QQ, |result| <= 1
+{
+    unsigned al; int ah, rr;
+    DSP_MACCS( ah, al, xx, pp, 0, 1<<(QQ-1) );
+    DSP_LEXTRACT( pp, ah, al, QQ );
+    if( pp < 0 ) pp = -pp;
+    if( pp >= qq ) rr = FQ(1.0);
+    else DSP_LDIVU( rr, ah, pp >> (32-QQ), (unsigned)pp << QQ, qq );
+    return xx < 0 ? -rr : rr;
+}
+
+static inline int _dsp_tanh_poly3( int xx ) // x*(27+x^2)/(27+9*x^2), scaled by 1/2^10
+{
+    unsigned al; int ah, uu, pp, qq;
+    DSP_MACCS( ah, al, xx, xx, 1<<(QQ+5-32), 0 );
+    DSP_LEXTRACT( uu, ah, al, QQ+6 );
+    pp = FQ(64.0/1024); _poly_step( pp, uu, FQ(27.0/1024) );
+    qq = FQ(576.0/1024); _poly_step( qq, uu, FQ(27.0/1024) );
+    return _tanh_div( xx, pp, qq );
+}
+
+static inline int _dsp_tanh_poly5( int xx ) // x*(945+105*x^2+x^4)/(945+420*x^2+15*x^4), 1/2^16
+{
+    unsigned al; int ah, uu, pp, qq;
+    DSP_MACCS( ah, al, xx, xx, 1<<(QQ+5-32), 0 );
+    DSP_LEXTRACT( uu, ah, al, QQ+6 );
+    pp = FQ(4096.0/65536);
+    _poly_step( pp, uu, FQ(6720.0/65536) );
+    _poly_step( pp, uu, FQ(945.0/65536) );
+    qq = FQ(61440.0/65536);
+    _poly_step( qq, uu, FQ(26880.0/65536) );
+    _poly_step( qq, uu, FQ(945.0/65536) );
+    return _tanh_div( xx, pp, qq );
+}
+
+static inline int _dsp_tanh_poly7( int xx ) // Order 7/6 Pade approximant, scaled by 1/2^23
+{
+    unsigned al; int ah, uu, pp, qq;
+    DSP_MACCS( ah, al, xx, xx, 1<<(QQ+5-32), 0 );
+    DSP_LEXTRACT( uu, ah, al, QQ+6 );
+    pp = FQ(262144.0/8388608);
+    _poly_step( pp, uu, FQ(1548288.0/8388608) );
+    _poly_step( pp, uu, FQ(1108800.0/8388608) );
+    _poly_step( pp, uu, FQ(135135.0/8388608) );
+    qq = FQ(7340032.0/8388608);
+    _poly_step( qq, uu, FQ(12902400.0/8388608) );
+    _poly_step( qq, uu, FQ(3991680.0/8388608) );
+    _poly_step( qq, uu, FQ(135135.0/8388608) );
+    return _tanh_div( xx, pp, qq );
+}
+
+// SIN = sin(2*pi*XX) where XX is the phase in cycles (any value, only the fractional part is used).
+// The phase is folded into -1/4..+1/4 cycle, sin(pi/2*WW) = WW*P(WW^2) with WW in quarter cycles.
+
+static inline int _dsp_sin_poly( int xx )
+{
+    unsigned al; int ah, ww, zz, yy;
+    ww = (int)((unsigned)xx << (32-QQ)) >> (32-QQ); // -0.5 <= WW < +0.5
+    if( ww > FQ(+0.25) ) ww = FQ(+0.5) - ww;
+    if( ww < FQ(-0.25) ) ww = FQ(-0.5) - ww;
+    ww <<= 2;
+    DSP_MACCS( ah, al, ww, ww, 0, 1<<(QQ-1) );
+    DSP_LEXTRACT( zz, ah, al, QQ );
+    yy = FQ(+0.000150821054);
+    _poly_step( yy, zz, FQ(-0.004672229039) );
+    _poly_step( yy, zz, FQ(+0.079688481393) );
+    _poly_step( yy, zz, FQ(-0.645963360109) );
+    _poly_step( yy, zz, FQ(+1.570796290042) );
+    DSP_MACCS( ah, al, yy, ww, 0, 1<<(QQ-1) );
+    DSP_LEXTRACT( yy, ah, al, QQ );
+    return yy;
+}
+
+// EXP2 = 2^XX for XX < 3 (saturates at 3 and above). 2^FF is a polynomial for the fractional part
+// FF of XX (0 <= FF < 1) which is then shifted by the integer part.
+
+static inline int _dsp_exp2_poly( int xx )
+{
+    unsigned al; int ah, nn = xx >> QQ, ff = xx & ((1<<QQ)-1), yy;
+    if( nn >= 3 ) return 0x7FFFFFFF;
+    if( nn < -QQ-1 ) return 0;
+    yy = FQ(+0.000218929903);
+    _poly_step( yy, ff, FQ(+0.001238315296) );
+    _poly_step( yy, ff, FQ(+0.009685108877) );
+    _poly_step( yy, ff, FQ(+0.055480150178) );
+    _poly_step( yy, ff, FQ(+0.240230567442) );
+    _poly_step( yy, ff, FQ(+0.693146923006) );
+    _poly_step( yy, ff, FQ(+1.000000002668) );
+    if( nn >= 0 ) return yy << nn;
+    return (yy + (1 << (-nn-1))) >> -nn;
+}
+
+// ATAN = atan(XX) in radians. |XX| <= 1 uses atan(XX) = XX*P(XX^2) and |XX| > 1 uses atan(XX) =
+// pi/2 - atan(1/XX) with 1/XX from a division.
+
+static inline int _dsp_atan_poly( int xx )
+{
+    unsigned al; int ah, aa, zz, yy;
+    if( xx == (int)0x80000000 ) xx = -0x7FFFFFFF; // -8.0 has no positive counterpart
+    aa = xx < 0 ? -xx : xx;
+    if( aa > FQ(1.0) ) DSP_LDIVU( aa, ah, 1<<(2*QQ-32), 0, aa );
+    DSP_MACCS( ah, al, aa, aa, 0, 1<<(QQ-1) );
+    DSP_LEXTRACT( zz, ah, al, QQ );
+    yy = FQ(+0.002446282488);
+    _poly_step( yy, zz, FQ(-0.014357678726) );
+    _poly_step( yy, zz, FQ(+0.039706245956) );
+    _poly_step( yy, zz, FQ(-0.072280597689) );
+    _poly_step( yy, zz, FQ(+0.104954589978) );
+    _poly_step( yy, zz, FQ(-0.141602241474) );
+    _poly_step( yy, zz, FQ(+0.199857554448) );
+    _poly_step( yy, zz, FQ(-0.333325870577) );
+    _poly_step( yy, zz, FQ(+0.999999884560) );
+    DSP_MACCS( ah, al, yy, aa, 0, 1<<(QQ-1) );
+    DSP_LEXTRACT( yy, ah, al, QQ );
+    if( xx > FQ(1.0) || xx < -FQ(1.0) ) yy = FQ(1.570796327) - yy;
+    return xx < 0 ? -yy : yy;
+}
+
+// NCO/LFO bank (see 'dsp_nco_init'). NC[0] is NN and oscillator II uses NC[1+6*II:6+6*II] = phase,
+// rate, phase offset, shape, held value and random state. Phases are QQQ cycles of which only the
+// 28 fractional bits are kept, so wrap-around is a mask. SINE uses SIN_POLY (no tables), HOLD takes
+// a new CRC32 random value each time the phase wraps.
+
+static inline int _dsp_nco_wave( int pp, int shape, int held )
+{
+    switch( shape ) {
+        case 0: return _dsp_sin_poly( pp );                                   // Sine
+        case 1: pp = ((pp + FQ(0.25)) & ((1<<QQ)-1)) - FQ(0.5);               // Triangle
+                return FQ(1.0) - 4 * (pp < 0 ? -pp : pp);
+        case 2: return 2 * ((pp + FQ(0.5)) & ((1<<QQ)-1)) - FQ(1.0);          // Saw (rising)
+        case 3: return pp < FQ(0.5) ? FQ(1.0) : -FQ(1.0);                     // Square
+        default: return held;                                                 // Sample and hold
+    }
+}
+
+static inline void _dsp_nco( int* nc, int* yy )
+{
+    int nn = nc[0], *oo = nc + 1, pp;
+    while( nn-- ) {
+        pp = oo[0] + oo[1]; // Leaves 0 to 1.0 once per cycle, either direction
+        if( pp != (pp & ((1<<QQ)-1)) && oo[3] == 4 ) { DSP_CRC32( oo[5], 0, 0xEB31D82E ); oo[4] = oo[5] >> (32-QQ-1); }
+        oo[0] = pp = pp & ((1<<QQ)-1);
+        *yy++ = _dsp_nco_wave( (pp + oo[2]) & ((1<<QQ)-1), oo[3], oo[4] );
+        oo += 6;
+    }
+}
+
+// LOG2, EXP2, DB_TO_LIN and LIN_TO_DB work on log-domain values in Q24 (QQ-4 fractional bits, range
+// +/-128) since log2 of the QQQ range (-28 to +3) and dB (-168 to +18) don't fit QQQ. LOG2 uses
+// CLZ to split XX into 2^EE * M with M folded into 0.707..1.414 and log2(M) a polynomial in M-1.
+// EXP2 evaluates 2^FF for the fractional part (as EXP2_POLY) and shifts it by the integer part.
+
+static inline int _dsp_log2( int xx )
+{
+    unsigned al; int ah, ee, tt, yy;
+    if( xx <= 0 ) return 0x80000000;
+    ee = __builtin_clz( xx );
+    tt = xx << (ee - 1); ee = 3 - ee; // XX = 2^EE * TT/2^30, 1 <= TT/2^30 < 2
+    if( tt >= 1518500250 ) { tt >>= 1; ++ee; } // sqrt(2) * 2^30
+    tt = ((tt + 2) >> 2) - FQ(1.0);
+    yy = FQ(+0.119551926186);
+    _poly_step( yy, tt, FQ(-0.207181479053) );
+    _poly_step( yy, tt, FQ(+0.218280415205) );
+    _poly_step( yy, tt, FQ(-0.239089329926) );
+    _poly_step( yy, tt, FQ(+0.287612933165) );
+    _poly_step( yy, tt, FQ(-0.360688485737) );
+    _poly_step( yy, tt, FQ(+0.480923424032) );
+    _poly_step( yy, tt, FQ(-0.721347712691) );
+    _poly_step( yy, tt, FQ(+1.442694858205) );
+    _poly_step( yy, tt, 0 );
+    return (ee << (QQ-4)) + ((yy + 8) >> 4);
+}
+
+static inline int _dsp_exp2( int xx )
+{
+    int nn = xx >> (QQ-4), yy;
+    if( nn >= 3 ) return 0x7FFFFFFF;
+    if( nn < -QQ-1 ) return 0;
+    yy = _dsp_exp2_poly( (xx & ((1<<(QQ-4))-1)) << 4 );
+    if( nn >= 0 ) return yy << nn;
+    return (yy + (1 << (-nn-1))) >> -nn;
+}
+
+static inline int _dsp_db_to_lin( int xx )
+{
+    unsigned al; int ah;
+    DSP_MACCS( ah, al, xx, FQ(0.166096404744), 0, 1<<(QQ-1) ); // log2(10)/20
+    DSP_LEXTRACT( xx, ah, al, QQ );
+    return _dsp_exp2( xx );
+}
+
+static inline int _dsp_lin_to_db( int xx )
+{
+    unsigned al; int ah;
+    xx = _dsp_log2( xx );
+    if( xx < -356689313 ) return 0x80000000; // Below -128 dB (-21.26 octaves in Q24)
+    DSP_MACCS( ah, al, xx, FQ(6.020599913280), 0, 1<<(QQ-1) ); // 20*log10(2)
+    DSP_LEXTRACT( xx, ah, al, QQ );
+    return xx;
+}
+
 static inline void _math_sum_X1z( int* xx, int zz, int nn ) // r = X[0:N-1] * 1.0 + z
 {
     unsigned al = 0; int ah = 0, c1,c2;
     while( nn >= 4 ) {
-        asm volatile("ldd %0,%1,%2[0]":"=r"(c2),"=r"(c1):"r"(xx));
-        asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(c1),"r"(zz),"0"(0),"1"(1<<(QQ-1)));
-        asm volatile("lextract %0,%1,%2,%3,32":"=r"(c1):"r"(ah),"r"(al),"r"(QQ));
-        asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(c2),"r"(zz),"0"(0),"1"(1<<(QQ-1)));
-        asm volatile("lextract %0,%1,%2,%3,32":"=r"(c2):"r"(ah),"r"(al),"r"(QQ));
-        asm volatile("std %0,%1,%2[0]"::"r"(c2), "r"(c1),"r"(xx));
-        asm volatile("ldd %0,%1,%2[1]":"=r"(c2),"=r"(c1):"r"(xx));
-        asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(c1),"r"(zz),"0"(0),"1"(1<<(QQ-1)));
-        asm volatile("lextract %0,%1,%2,%3,32":"=r"(c1):"r"(ah),"r"(al),"r"(QQ));
-        asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(c2),"r"(zz),"0"(0),"1"(1<<(QQ-1)));
-        asm volatile("lextract %0,%1,%2,%3,32":"=r"(c2):"r"(ah),"r"(al),"r"(QQ));
-        asm volatile("std %0,%1,%2[1]"::"r"(c2), "r"(c1),"r"(xx));
+        DSP_LDD( c2, c1, xx, 0 );
+        DSP_MACCS( ah, al, c1, zz, 0, 1<<(QQ-1) );
+        DSP_LEXTRACT( c1, ah, al, QQ );
+        DSP_MACCS( ah, al, c2, zz, 0, 1<<(QQ-1) );
+        DSP_LEXTRACT( c2, ah, al, QQ );
+        DSP_STD( c2, c1, xx, 0 );
+        DSP_LDD( c2, c1, xx, 1 );
+        DSP_MACCS( ah, al, c1, zz, 0, 1<<(QQ-1) );
+        DSP_LEXTRACT( c1, ah, al, QQ );
+        DSP_MACCS( ah, al, c2, zz, 0, 1<<(QQ-1) );
+        DSP_LEXTRACT( c2, ah, al, QQ );
+        DSP_STD( c2, c1, xx, 1 );
         xx += 4; nn -= 4;
     }
     switch( nn ) {
         case 3:
-        asm volatile("ldd %0,%1,%2[0]":"=r"(c2),"=r"(c1):"r"(xx));
-        asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(c1),"r"(zz),"0"(0),"1"(1<<(QQ-1)));
-        asm volatile("lextract %0,%1,%2,%3,32":"=r"(c1):"r"(ah),"r"(al),"r"(QQ));
-        asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(c2),"r"(zz),"0"(0),"1"(1<<(QQ-1)));
-        asm volatile("lextract %0,%1,%2,%3,32":"=r"(c2):"r"(ah),"r"(al),"r"(QQ));
-        asm volatile("std %0,%1,%2[0]"::"r"(c2), "r"(c1),"r"(xx));
-        asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(xx[2]),"r"(zz),"0"(0),"1"(1<<(QQ-1)));
-        asm volatile("lextract %0,%1,%2,%3,32":"=r"(xx[2]):"r"(ah),"r"(al),"r"(QQ));
+        DSP_LDD( c2, c1, xx, 0 );
+        DSP_MACCS( ah, al, c1, zz, 0, 1<<(QQ-1) );
+        DSP_LEXTRACT( c1, ah, al, QQ );
+        DSP_MACCS( ah, al, c2, zz, 0, 1<<(QQ-1) );
+        DSP_LEXTRACT( c2, ah, al, QQ );
+        DSP_STD( c2, c1, xx, 0 );
+        DSP_MACCS( ah, al, xx[2], zz, 0, 1<<(QQ-1) );
+        DSP_LEXTRACT( xx[2], ah, al, QQ );
         break;
         case 2:
-        asm volatile("ldd %0,%1,%2[0]":"=r"(c2),"=r"(c1):"r"(xx));
-        asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(c1),"r"(zz),"0"(0),"1"(1<<(QQ-1)));
-        asm volatile("lextract %0,%1,%2,%3,32":"=r"(c1):"r"(ah),"r"(al),"r"(QQ));
-        asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(c2),"r"(zz),"0"(0),"1"(1<<(QQ-1)));
-        asm volatile("lextract %0,%1,%2,%3,32":"=r"(c2):"r"(ah),"r"(al),"r"(QQ));
-        asm volatile("std %0,%1,%2[0]"::"r"(c2), "r"(c1),"r"(xx));
+        DSP_LDD( c2, c1, xx, 0 );
+        DSP_MACCS( ah, al, c1, zz, 0, 1<<(QQ-1) );
+        DSP_LEXTRACT( c1, ah, al, QQ );
+        DSP_MACCS( ah, al, c2, zz, 0, 1<<(QQ-1) );
+        DSP_LEXTRACT( c2, ah, al, QQ );
+        DSP_STD( c2, c1, xx, 0 );
         break;
         case 1:
-        asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(xx[0]),"r"(zz),"0"(0),"1"(1<<(QQ-1)));
-        asm volatile("lextract %0,%1,%2,%3,32":"=r"(xx[0]):"r"(ah),"r"(al),"r"(QQ));
+        DSP_MACCS( ah, al, xx[0], zz, 0, 1<<(QQ-1) );
+        DSP_LEXTRACT( xx[0], ah, al, QQ );
         break;
     }
 }
 
+// Square root of the unsigned 64-bit value AH:AL (< 2^62, result < 2^31). AH:AL is normalized by an
+// even shift (CLZ) to VV = M * 2^62 (1/4 <= M < 1). RR = 1/sqrt(M) (Q29) is seeded from a 48 entry
+// table (6 bits) and refined by two Newton steps RR = RR*(3-M*RR^2)/2 (no division, 24 bits).
+// YY = M*RR is then corrected once with the exact residual VV-YY^2 giving a result within 1 LSB.
+
+static const int _math_rsqrt_seed[48] = // 2^29/sqrt((ii+16.5)/64)
+{
+    1057347856,1026693558,998559613,972618566,948599586,926276469,905458609,885984104,
+    867714429,850530263,834328203,819018128,804521086,790767575,777696137,765252196,
+    753387102,742057327,731223792,720851298,710908045,701365222,692196655,683378504,
+    674889000,666708225,658817909,651201261,643842818,636728315,629844563,623179354,
+    616721362,610460069,604385689,598489102,592761802,587195840,581783781,576518662,
+    571393950,566403514,561541591,556802759,552181909,547674226,543275165,538980433
+};
+
+static inline int _math_sqrt64( int ah, unsigned al )
+{
+    unsigned long long vv = ((unsigned long long)(unsigned)ah << 32) | al;
+    int rr, mm, tt, yy, ss, jj;
+    if( vv == 0 ) return 0;
+    ss = 61 - (ah ? 31 - __builtin_clz( ah ) + 32 : 31 - __builtin_clz( al )); // Top bit to 60 or 61
+    ss &= ~1; jj = ss / 2;
+    vv = ss >= 0 ? vv << ss : vv >> -ss;
+    mm = (int)(vv >> 32); // M in Q30
+    rr = _math_rsqrt_seed[(mm >> 24) - 16];
+    DSP_MACCS( ah, al, rr, rr, 0, 1<<28 ); DSP_LEXTRACT( tt, ah, al, 29 );
+    DSP_MACCS( ah, al, mm, tt, 0, 1<<29 ); DSP_LEXTRACT( tt, ah, al, 30 );
+    DSP_MACCS( ah, al, rr, (3<<29)-tt, 0, 1<<29 ); DSP_LEXTRACT( rr, ah, al, 30 );
+    DSP_MACCS( ah, al, rr, rr, 0, 1<<28 ); DSP_LEXTRACT( tt, ah, al, 29 );
+    DSP_MACCS( ah, al, mm, tt, 0, 1<<29 ); DSP_LEXTRACT( tt, ah, al, 30 );
+    DSP_MACCS( ah, al, rr, (3<<29)-tt, 0, 1<<29 ); DSP_LEXTRACT( rr, ah, al, 30 );
+    DSP_MACCS( ah, al, mm, rr, 0, 1<<27 ); DSP_LEXTRACT( yy, ah, al, 28 ); // sqrt(VV) to 28 bits
+    DSP_MACCS( ah, al, yy, -yy, (int)(vv >> 32), (unsigned)vv );           // VV - YY^2
+    DSP_LEXTRACT( tt, ah, al, 12 );
+    DSP_MACCS( ah, al, tt, rr, 0, 0 );                                     // (VV-YY^2)/(2*YY)
+    yy += (ah + (1<<16)) >> 17;
+    if( jj < 0 ) return yy >= 0x40000000 ? 0x7FFFFFFF : yy << 1;
+    return jj ? (yy + (1 << (jj-1))) >> jj : yy;
+}
+
 static inline int _math_sqr_x( int xx ) // r = xx^0.5
 {
-    return 0;
+    if( xx <= 0 ) return 0;
+    return _math_sqrt64( xx >> (32-QQ), (unsigned)xx << QQ );
 }
 
 static inline int _math_min_X( const int* xx, int nn ) // r = min(X[0:N-1])
 {
     int c1,c2, yy = 0;
     while( nn >= 4 ) {
-        asm volatile("ldd %0,%1,%2[0]":"=r"(c2),"=r"(c1):"r"(xx));
+        DSP_LDD( c2, c1, xx, 0 );
         if( c1 < yy ) yy = c1; if( c2 < yy ) yy = c2;
-        asm volatile("ldd %0,%1,%2[1]":"=r"(c2),"=r"(c1):"r"(xx));
+        DSP_LDD( c2, c1, xx, 1 );
         if( c1 < yy ) yy = c1; if( c2 < yy ) yy = c2;
         xx += 4; nn -= 4;
     }
     switch( nn ) {
         case 3:
-        asm volatile("ldd %0,%1,%2[0]":"=r"(c2),"=r"(c1):"r"(xx));
+        DSP_LDD( c2, c1, xx, 0 );
         if( c1 < yy ) yy = c1; if( c2 < yy ) yy = c2;
         if( xx[2] < yy ) yy = xx[2];
         break;
         case 2:
-        asm volatile("ldd %0,%1,%2[0]":"=r"(c2),"=r"(c1):"r"(xx));
+        DSP_LDD( c2, c1, xx, 0 );
         if( c1 < yy ) yy = c1; if( c2 < yy ) yy = c2;
         break;
         case 1: if( xx[2] < yy ) yy = xx[2];
@@ -736,20 +1066,20 @@ static inline int _math_max_X( const int* xx, int nn ) // r = max(X[0:N-1])
 {
     int c1,c2, yy = 0;
     while( nn >= 4 ) {
-        asm volatile("ldd %0,%1,%2[0]":"=r"(c2),"=r"(c1):"r"(xx));
+        DSP_LDD( c2, c1, xx, 0 );
         if( c1 > yy ) yy = c1; if( c2 > yy ) yy = c2;
-        asm volatile("ldd %0,%1,%2[1]":"=r"(c2),"=r"(c1):"r"(xx));
+        DSP_LDD( c2, c1, xx, 1 );
         if( c1 > yy ) yy = c1; if( c2 > yy ) yy = c2;
         xx += 4; nn -= 4;
     }
     switch( nn ) {
         case 3:
-        asm volatile("ldd %0,%1,%2[0]":"=r"(c2),"=r"(c1):"r"(xx));
+        DSP_LDD( c2, c1, xx, 0 );
         if( c1 > yy ) yy = c1; if( c2 > yy ) yy = c2;
         if( xx[2] > yy ) yy = xx[2];
         break;
         case 2:
-        asm volatile("ldd %0,%1,%2[0]":"=r"(c2),"=r"(c1):"r"(xx));
+        DSP_LDD( c2, c1, xx, 0 );
         if( c1 > yy ) yy = c1; if( c2 > yy ) yy = c2;
         break;
         case 1: if( xx[2] > yy ) yy = xx[2];
@@ -767,104 +1097,111 @@ static inline void _math_sum_X( const int* xx, int nn, int* ah_, unsigned* al_ )
 {
     unsigned al = 0; int ah = 0, c1,c2;
     while( nn >= 4 ) {
-        asm volatile("ldd %0,%1,%2[0]":"=r"(c2),"=r"(c1):"r"(xx));
-        asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(c1),"r"(1),"0"(0),"1"(1<<(QQ-1)));
-        asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(c2),"r"(1),"0"(0),"1"(1<<(QQ-1)));
-        asm volatile("ldd %0,%1,%2[1]":"=r"(c2),"=r"(c1):"r"(xx));
-        asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(c1),"r"(1),"0"(0),"1"(1<<(QQ-1)));
-        asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(c2),"r"(1),"0"(0),"1"(1<<(QQ-1)));
+        DSP_LDD( c2, c1, xx, 0 );
+        DSP_MACCS( ah, al, c1, 1, 0, 1<<(QQ-1) );
+        DSP_MACCS( ah, al, c2, 1, 0, 1<<(QQ-1) );
+        DSP_LDD( c2, c1, xx, 1 );
+        DSP_MACCS( ah, al, c1, 1, 0, 1<<(QQ-1) );
+        DSP_MACCS( ah, al, c2, 1, 0, 1<<(QQ-1) );
         xx += 4; nn -= 4;
     }
     switch( nn ) {
         case 3:
-        asm volatile("ldd %0,%1,%2[0]":"=r"(c2),"=r"(c1):"r"(xx));
-        asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(c1),"r"(1),"0"(0),"1"(1<<(QQ-1)));
-        asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(c2),"r"(1),"0"(0),"1"(1<<(QQ-1)));
-        asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(xx[2]),"r"(1),"0"(0),"1"(1<<(QQ-1)));
+        DSP_LDD( c2, c1, xx, 0 );
+        DSP_MACCS( ah, al, c1, 1, 0, 1<<(QQ-1) );
+        DSP_MACCS( ah, al, c2, 1, 0, 1<<(QQ-1) );
+        DSP_MACCS( ah, al, xx[2], 1, 0, 1<<(QQ-1) );
         break;
         case 2:
-        asm volatile("ldd %0,%1,%2[0]":"=r"(c2),"=r"(c1):"r"(xx));
-        asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(c1),"r"(1),"0"(0),"1"(1<<(QQ-1)));
-        asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(c2),"r"(1),"0"(0),"1"(1<<(QQ-1)));
+        DSP_LDD( c2, c1, xx, 0 );
+        DSP_MACCS( ah, al, c1, 1, 0, 1<<(QQ-1) );
+        DSP_MACCS( ah, al, c2, 1, 0, 1<<(QQ-1) );
         break;
         case 1:
-        asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(xx[0]),"r"(1),"0"(0),"1"(1<<(QQ-1)));
+        DSP_MACCS( ah, al, xx[0], 1, 0, 1<<(QQ-1) );
         break;
     }
     *ah_ = ah; *al_ = al;
 }
 
-static inline void _math_pwr_X( const int* xx, int nn, int* ah_, unsigned* al_ ) // r = sum(X[0:N-1]*X[0:N-1])
+// PWR_X squares X/8 so the 64-bit sum has 6 bits of headroom (the result is sum(X*X)/64, Q50) and
+// doesn't wrap for N up to 16384 at full-scale (QQQ 1.0) or 256 at the QQQ limit (8.0). RMS_X
+// scales the mean back up by 64 (it fits since the mean is at most 2^56) before the square root.
+
+static inline void _math_pwr_X( const int* xx, int nn, int* ah_, unsigned* al_ ) // r = sum(X[0:N-1]*X[0:N-1])/64
 {
     unsigned al = 0; int ah = 0, c1,c2;
     while( nn >= 4 ) {
-        asm volatile("ldd %0,%1,%2[0]":"=r"(c2),"=r"(c1):"r"(xx));
-        asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(c1),"r"(c1),"0"(0),"1"(1<<(QQ-1)));
-        asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(c2),"r"(c2),"0"(0),"1"(1<<(QQ-1)));
-        asm volatile("ldd %0,%1,%2[1]":"=r"(c2),"=r"(c1):"r"(xx));
-        asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(c1),"r"(c1),"0"(0),"1"(1<<(QQ-1)));
-        asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(c2),"r"(c2),"0"(0),"1"(1<<(QQ-1)));
+        DSP_LDD( c2, c1, xx, 0 ); c1 >>= 3; c2 >>= 3;
+        DSP_MACCS( ah, al, c1, c1, ah, al );
+        DSP_MACCS( ah, al, c2, c2, ah, al );
+        DSP_LDD( c2, c1, xx, 1 ); c1 >>= 3; c2 >>= 3;
+        DSP_MACCS( ah, al, c1, c1, ah, al );
+        DSP_MACCS( ah, al, c2, c2, ah, al );
         xx += 4; nn -= 4;
     }
     switch( nn ) {
         case 3:
-        asm volatile("ldd %0,%1,%2[0]":"=r"(c2),"=r"(c1):"r"(xx));
-        asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(c1),"r"(c1),"0"(0),"1"(1<<(QQ-1)));
-        asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(c2),"r"(c2),"0"(0),"1"(1<<(QQ-1)));
-        asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(xx[2]),"r"(xx[2]),"0"(0),"1"(1<<(QQ-1)));
+        DSP_LDD( c2, c1, xx, 0 ); c1 >>= 3; c2 >>= 3;
+        DSP_MACCS( ah, al, c1, c1, ah, al );
+        DSP_MACCS( ah, al, c2, c2, ah, al );
+        DSP_MACCS( ah, al, xx[2]>>3, xx[2]>>3, ah, al );
         break;
         case 2:
-        asm volatile("ldd %0,%1,%2[0]":"=r"(c2),"=r"(c1):"r"(xx));
-        asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(c1),"r"(c1),"0"(0),"1"(1<<(QQ-1)));
-        asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(c2),"r"(c2),"0"(0),"1"(1<<(QQ-1)));
+        DSP_LDD( c2, c1, xx, 0 ); c1 >>= 3; c2 >>= 3;
+        DSP_MACCS( ah, al, c1, c1, ah, al );
+        DSP_MACCS( ah, al, c2, c2, ah, al );
         break;
         case 1:
-        asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(xx[0]),"r"(xx[0]),"0"(0),"1"(1<<(QQ-1)));
+        DSP_MACCS( ah, al, xx[0]>>3, xx[0]>>3, ah, al );
         break;
     }
     *ah_ = ah; *al_ = al;
 }
 
-static inline int _math_rms_X( const int* xx, int nn ) // r = sum(X[0:N-1]*X[0:N-1]) ^ 0.5
+static inline int _math_rms_X( const int* xx, int nn ) // r = (sum(X[0:N-1]*X[0:N-1])/N) ^ 0.5
 {
     unsigned al; int ah;
+    unsigned hi, lo;
     _math_pwr_X( xx, nn, &ah, &al );
-    // <TODO> ah:al ^ 0.5
-    return 0;
+    hi = (unsigned)ah / nn; ah = (unsigned)ah % nn; // AH:AL / NN (64-bit quotient HI:LO)
+    DSP_LDIVU( lo, ah, ah, al, nn );
+    hi = (hi << 6) | (lo >> 26); lo <<= 6; // Undo the 1/64 of PWR_X
+    return _math_sqrt64( hi, lo );
 }
 
 static inline void _math_asm_X( const int* xx, int nn, int* ah_, unsigned* al_ ) // r = sum(abs(X[0:N-1))
 {
     unsigned al = 0; int ah = 0, c1,c2;
     while( nn >= 4 ) {
-        asm volatile("ldd %0,%1,%2[0]":"=r"(c2),"=r"(c1):"r"(xx));
+        DSP_LDD( c2, c1, xx, 0 );
         if( c1 < 0 ) c1 = -c1; if( c2 < 0 ) c2 = -c2;
-        asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(c1),"r"(1),"0"(0),"1"(1<<(QQ-1)));
-        asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(c2),"r"(1),"0"(0),"1"(1<<(QQ-1)));
-        asm volatile("ldd %0,%1,%2[1]":"=r"(c2),"=r"(c1):"r"(xx));
+        DSP_MACCS( ah, al, c1, 1, 0, 1<<(QQ-1) );
+        DSP_MACCS( ah, al, c2, 1, 0, 1<<(QQ-1) );
+        DSP_LDD( c2, c1, xx, 1 );
         if( c1 < 0 ) c1 = -c1; if( c2 < 0 ) c2 = -c2;
-        asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(c1),"r"(1),"0"(0),"1"(1<<(QQ-1)));
-        asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(c2),"r"(1),"0"(0),"1"(1<<(QQ-1)));
+        DSP_MACCS( ah, al, c1, 1, 0, 1<<(QQ-1) );
+        DSP_MACCS( ah, al, c2, 1, 0, 1<<(QQ-1) );
         xx += 4; nn -= 4;
     }
     switch( nn ) {
         case 3:
-        asm volatile("ldd %0,%1,%2[0]":"=r"(c2),"=r"(c1):"r"(xx));
+        DSP_LDD( c2, c1, xx, 0 );
         if( c1 < 0 ) c1 = -c1; if( c2 < 0 ) c2 = -c2;
-        asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(c1),"r"(1),"0"(0),"1"(1<<(QQ-1)));
-        asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(c2),"r"(1),"0"(0),"1"(1<<(QQ-1)));
-        if( xx[2] > 0 ) asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(xx[2]),"r"(+1),"0"(0),"1"(1<<(QQ-1)));
-        else            asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(xx[2]),"r"(-1),"0"(0),"1"(1<<(QQ-1)));
+        DSP_MACCS( ah, al, c1, 1, 0, 1<<(QQ-1) );
+        DSP_MACCS( ah, al, c2, 1, 0, 1<<(QQ-1) );
+        if( xx[2] > 0 ) DSP_MACCS( ah, al, xx[2], +1, 0, 1<<(QQ-1) );
+        else            DSP_MACCS( ah, al, xx[2], -1, 0, 1<<(QQ-1) );
         break;
         case 2:
-        asm volatile("ldd %0,%1,%2[0]":"=r"(c2),"=r"(c1):"r"(xx));
+        DSP_LDD( c2, c1, xx, 0 );
         if( c1 < 0 ) c1 = -c1; if( c2 < 0 ) c2 = -c2;
-        asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(c1),"r"(1),"0"(0),"1"(1<<(QQ-1)));
-        asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(c2),"r"(1),"0"(0),"1"(1<<(QQ-1)));
+        DSP_MACCS( ah, al, c1, 1, 0, 1<<(QQ-1) );
+        DSP_MACCS( ah, al, c2, 1, 0, 1<<(QQ-1) );
         break;
         case 1:
-        if( xx[2] > 0 ) asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(xx[0]),"r"(+1),"0"(0),"1"(1<<(QQ-1)));
-        else            asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(xx[0]),"r"(-1),"0"(0),"1"(1<<(QQ-1)));
+        if( xx[2] > 0 ) DSP_MACCS( ah, al, xx[0], +1, 0, 1<<(QQ-1) );
+        else            DSP_MACCS( ah, al, xx[0], -1, 0, 1<<(QQ-1) );
         break;
     }
     *ah_ = ah; *al_ = al;
@@ -874,25 +1211,25 @@ static inline void _math_abs_X( int* xx, int nn ) // X[0:N-1] = abs(X[0:N-1])
 {
     int c1,c2;
     while( nn >= 4 ) {
-        asm volatile("ldd %0,%1,%2[0]":"=r"(c2),"=r"(c1):"r"(xx));
+        DSP_LDD( c2, c1, xx, 0 );
         if( c1 < 0 ) c1 = -c1; if( c2 < 0 ) c2 = -c2;
-        asm volatile("std %0,%1,%2[0]"::"r"(c2), "r"(c1),"r"(xx));
-        asm volatile("ldd %0,%1,%2[1]":"=r"(c2),"=r"(c1):"r"(xx));
+        DSP_STD( c2, c1, xx, 0 );
+        DSP_LDD( c2, c1, xx, 1 );
         if( c1 < 0 ) c1 = -c1; if( c2 < 0 ) c2 = -c2;
-        asm volatile("std %0,%1,%2[1]"::"r"(c2), "r"(c1),"r"(xx));
+        DSP_STD( c2, c1, xx, 1 );
         xx += 4; nn -= 4;
     }
     switch( nn ) {
         case 3:
-        asm volatile("ldd %0,%1,%2[0]":"=r"(c2),"=r"(c1):"r"(xx));
+        DSP_LDD( c2, c1, xx, 0 );
         if( c1 < 0 ) c1 = -c1; if( c2 < 0 ) c2 = -c2;
-        asm volatile("std %0,%1,%2[0]"::"r"(c2), "r"(c1),"r"(xx));
+        DSP_STD( c2, c1, xx, 0 );
         if( xx[2] < 0 ) xx[2] = -xx[2];
         break;
         case 2:
-        asm volatile("ldd %0,%1,%2[0]":"=r"(c2),"=r"(c1):"r"(xx));
+        DSP_LDD( c2, c1, xx, 0 );
         if( c1 < 0 ) c1 = -c1; if( c2 < 0 ) c2 = -c2;
-        asm volatile("std %0,%1,%2[0]"::"r"(c2), "r"(c1),"r"(xx));
+        DSP_STD( c2, c1, xx, 0 );
         break;
         case 1: if( xx[2] < 0 ) xx[0] = -xx[0];
         break;
@@ -901,27 +1238,35 @@ static inline void _math_abs_X( int* xx, int nn ) // X[0:N-1] = abs(X[0:N-1])
 
 static inline void _math_sqr_X( int* xx, int nn ) // X[0:N-1] = X[0:N-1]^0.5
 {
+    int c1,c2;
+    while( nn >= 2 ) {
+        DSP_LDD( c2, c1, xx, 0 );
+        c1 = _math_sqr_x( c1 ); c2 = _math_sqr_x( c2 );
+        DSP_STD( c2, c1, xx, 0 );
+        xx += 2; nn -= 2;
+    }
+    if( nn ) xx[0] = _math_sqr_x( xx[0] );
 }
 
 static inline void _math_mac_X1z( int* xx, int zz, int nn ) // X[0:N-1] = X[0:N-1] + zz
 {
     int c1,c2;
     while( nn >= 4 ) {
-        asm volatile("ldd %0,%1,%2[0]":"=r"(c2),"=r"(c1):"r"(xx)); c1 += zz; c2 += zz;
-        asm volatile("std %0,%1,%2[0]"::"r"(c2), "r"(c1),"r"(xx));
-        asm volatile("ldd %0,%1,%2[1]":"=r"(c2),"=r"(c1):"r"(xx)); c1 += zz; c2 += zz;
-        asm volatile("std %0,%1,%2[1]"::"r"(c2), "r"(c1),"r"(xx));
+        DSP_LDD( c2, c1, xx, 0 ); c1 += zz; c2 += zz;
+        DSP_STD( c2, c1, xx, 0 );
+        DSP_LDD( c2, c1, xx, 1 ); c1 += zz; c2 += zz;
+        DSP_STD( c2, c1, xx, 1 );
         xx += 4; nn -= 4;
     }
     switch( nn ) {
         case 3:
-        asm volatile("ldd %0,%1,%2[0]":"=r"(c2),"=r"(c1):"r"(xx)); c1 += zz; c2 += zz;
-        asm volatile("std %0,%1,%2[0]"::"r"(c2), "r"(c1),"r"(xx));
+        DSP_LDD( c2, c1, xx, 0 ); c1 += zz; c2 += zz;
+        DSP_STD( c2, c1, xx, 0 );
         xx[2] += zz;
         break;
         case 2:
-        asm volatile("ldd %0,%1,%2[0]":"=r"(c2),"=r"(c1):"r"(xx)); c1 += zz; c2 += zz;
-        asm volatile("std %0,%1,%2[0]"::"r"(c2), "r"(c1),"r"(xx));
+        DSP_LDD( c2, c1, xx, 0 ); c1 += zz; c2 += zz;
+        DSP_STD( c2, c1, xx, 0 );
         break;
         case 1: xx[0] += zz;
         break;
@@ -932,24 +1277,24 @@ static inline void _math_mac_X1Z( int* xx, const int* zz, int nn ) // X[0:N-1] =
 {
     int c1,c2, s1,s2;
     while( nn >= 4 ) {
-        asm volatile("ldd %0,%1,%2[0]":"=r"(s2),"=r"(s1):"r"(zz));
-        asm volatile("ldd %0,%1,%2[0]":"=r"(c2),"=r"(c1):"r"(xx)); c1 += s1; c2 += s2;
-        asm volatile("std %0,%1,%2[0]"::"r"(c2), "r"(c1),"r"(xx));
-        asm volatile("ldd %0,%1,%2[1]":"=r"(s2),"=r"(s1):"r"(zz));
-        asm volatile("ldd %0,%1,%2[1]":"=r"(c2),"=r"(c1):"r"(xx)); c1 += s2; c2 += s2;
-        asm volatile("std %0,%1,%2[1]"::"r"(c2), "r"(c1),"r"(xx));
+        DSP_LDD( s2, s1, zz, 0 );
+        DSP_LDD( c2, c1, xx, 0 ); c1 += s1; c2 += s2;
+        DSP_STD( c2, c1, xx, 0 );
+        DSP_LDD( s2, s1, zz, 1 );
+        DSP_LDD( c2, c1, xx, 1 ); c1 += s2; c2 += s2;
+        DSP_STD( c2, c1, xx, 1 );
         xx += 4; nn -= 4;
     }
     switch( nn ) {
         case 3:
-        asm volatile("ldd %0,%1,%2[0]":"=r"(s2),"=r"(s1):"r"(zz));
-        asm volatile("ldd %0,%1,%2[0]":"=r"(c2),"=r"(c1):"r"(xx)); c1 += s1; c2 += s2;
-        asm volatile("std %0,%1,%2[0]"::"r"(c2), "r"(c1),"r"(xx));
+        DSP_LDD( s2, s1, zz, 0 );
+        DSP_LDD( c2, c1, xx, 0 ); c1 += s1; c2 += s2;
+        DSP_STD( c2, c1, xx, 0 );
         xx[2] += zz[2];
         break;
         case 2:
-        asm volatile("ldd %0,%1,%2[0]":"=r"(s2),"=r"(s1):"r"(zz));
-        asm volatile("ldd %0,%1,%2[0]":"=r"(c2),"=r"(c1):"r"(xx)); c1 += s1; c2 += s2;
+        DSP_LDD( s2, s1, zz, 0 );
+        DSP_LDD( c2, c1, xx, 0 ); c1 += s1; c2 += s2;
         break;
         case 1: xx[0] += zz[0];
         break;
@@ -960,42 +1305,42 @@ static inline void _math_mac_Xy0( int* xx, int yy, int nn ) // X[0:N-1] = X[0:N-
 {
     unsigned al; int ah, c1,c2;
     while( nn >= 4 ) {
-        asm volatile("ldd %0,%1,%2[0]":"=r"(c2),"=r"(c1):"r"(xx));
-        asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(c1),"r"(yy),"0"(0),"1"(1<<(QQ-1)));
-        asm volatile("lextract %0,%1,%2,%3,32":"=r"(c1):"r"(ah),"r"(al),"r"(QQ));
-        asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(c2),"r"(yy),"0"(0),"1"(1<<(QQ-1)));
-        asm volatile("lextract %0,%1,%2,%3,32":"=r"(c2):"r"(ah),"r"(al),"r"(QQ));
-        asm volatile("std %0,%1,%2[0]"::"r"(c2), "r"(c1),"r"(xx));
-        asm volatile("ldd %0,%1,%2[1]":"=r"(c2),"=r"(c1):"r"(xx));
-        asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(c1),"r"(yy),"0"(0),"1"(1<<(QQ-1)));
-        asm volatile("lextract %0,%1,%2,%3,32":"=r"(c1):"r"(ah),"r"(al),"r"(QQ));
-        asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(c2),"r"(yy),"0"(0),"1"(1<<(QQ-1)));
-        asm volatile("lextract %0,%1,%2,%3,32":"=r"(c2):"r"(ah),"r"(al),"r"(QQ));
-        asm volatile("std %0,%1,%2[1]"::"r"(c2), "r"(c1),"r"(xx));
+        DSP_LDD( c2, c1, xx, 0 );
+        DSP_MACCS( ah, al, c1, yy, 0, 1<<(QQ-1) );
+        DSP_LEXTRACT( c1, ah, al, QQ );
+        DSP_MACCS( ah, al, c2, yy, 0, 1<<(QQ-1) );
+        DSP_LEXTRACT( c2, ah, al, QQ );
+        DSP_STD( c2, c1, xx, 0 );
+        DSP_LDD( c2, c1, xx, 1 );
+        DSP_MACCS( ah, al, c1, yy, 0, 1<<(QQ-1) );
+        DSP_LEXTRACT( c1, ah, al, QQ );
+        DSP_MACCS( ah, al, c2, yy, 0, 1<<(QQ-1) );
+        DSP_LEXTRACT( c2, ah, al, QQ );
+        DSP_STD( c2, c1, xx, 1 );
         xx += 4; nn -= 4;
     }
     switch( nn ) {
         case 3:
-        asm volatile("ldd %0,%1,%2[0]":"=r"(c2),"=r"(c1):"r"(xx));
-        asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(c1),"r"(yy),"0"(0),"1"(1<<(QQ-1)));
-        asm volatile("lextract %0,%1,%2,%3,32":"=r"(c1):"r"(ah),"r"(al),"r"(QQ));
-        asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(c2),"r"(yy),"0"(0),"1"(1<<(QQ-1)));
-        asm volatile("lextract %0,%1,%2,%3,32":"=r"(c2):"r"(ah),"r"(al),"r"(QQ));
-        asm volatile("std %0,%1,%2[0]"::"r"(c2), "r"(c1),"r"(xx));
-        asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(xx[2]),"r"(yy),"0"(0),"1"(1<<(QQ-1)));
-        asm volatile("lextract %0,%1,%2,%3,32":"=r"(xx[2]):"r"(ah),"r"(al),"r"(QQ));
+        DSP_LDD( c2, c1, xx, 0 );
+        DSP_MACCS( ah, al, c1, yy, 0, 1<<(QQ-1) );
+        DSP_LEXTRACT( c1, ah, al, QQ );
+        DSP_MACCS( ah, al, c2, yy, 0, 1<<(QQ-1) );
+        DSP_LEXTRACT( c2, ah, al, QQ );
+        DSP_STD( c2, c1, xx, 0 );
+        DSP_MACCS( ah, al, xx[2], yy, 0, 1<<(QQ-1) );
+        DSP_LEXTRACT( xx[2], ah, al, QQ );
         break;
         case 2:
-        asm volatile("ldd %0,%1,%2[0]":"=r"(c2),"=r"(c1):"r"(xx));
-        asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(c1),"r"(yy),"0"(0),"1"(1<<(QQ-1)));
-        asm volatile("lextract %0,%1,%2,%3,32":"=r"(c1):"r"(ah),"r"(al),"r"(QQ));
-        asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(c2),"r"(yy),"0"(0),"1"(1<<(QQ-1)));
-        asm volatile("lextract %0,%1,%2,%3,32":"=r"(c2):"r"(ah),"r"(al),"r"(QQ));
-        asm volatile("std %0,%1,%2[0]"::"r"(c2), "r"(c1),"r"(xx));
+        DSP_LDD( c2, c1, xx, 0 );
+        DSP_MACCS( ah, al, c1, yy, 0, 1<<(QQ-1) );
+        DSP_LEXTRACT( c1, ah, al, QQ );
+        DSP_MACCS( ah, al, c2, yy, 0, 1<<(QQ-1) );
+        DSP_LEXTRACT( c2, ah, al, QQ );
+        DSP_STD( c2, c1, xx, 0 );
         break;
         case 1:
-        asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(xx[0]),"r"(yy),"0"(0),"1"(1<<(QQ-1)));
-        asm volatile("lextract %0,%1,%2,%3,32":"=r"(xx[0]):"r"(ah),"r"(al),"r"(QQ));
+        DSP_MACCS( ah, al, xx[0], yy, 0, 1<<(QQ-1) );
+        DSP_LEXTRACT( xx[0], ah, al, QQ );
         break;
     }
 }
@@ -1004,46 +1349,46 @@ static inline void _math_mac_XY0( int* xx, const int* yy, int nn ) // X[0:N-1] =
 {
     unsigned al; int ah, c1,c2, s1,s2;
     while( nn >= 4 ) {
-        asm volatile("ldd %0,%1,%2[0]":"=r"(c2),"=r"(c1):"r"(xx));
-        asm volatile("ldd %0,%1,%2[0]":"=r"(s2),"=r"(s1):"r"(yy));
-        asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(c1),"r"(s1),"0"(0),"1"(1<<(QQ-1)));
-        asm volatile("lextract %0,%1,%2,%3,32":"=r"(c1):"r"(ah),"r"(al),"r"(QQ));
-        asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(c2),"r"(s2),"0"(0),"1"(1<<(QQ-1)));
-        asm volatile("lextract %0,%1,%2,%3,32":"=r"(c2):"r"(ah),"r"(al),"r"(QQ));
-        asm volatile("std %0,%1,%2[0]"::"r"(c2), "r"(c1),"r"(xx));
-        asm volatile("ldd %0,%1,%2[1]":"=r"(c2),"=r"(c1):"r"(xx));
-        asm volatile("ldd %0,%1,%2[1]":"=r"(s2),"=r"(s1):"r"(yy));
-        asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(c1),"r"(s1),"0"(0),"1"(1<<(QQ-1)));
-        asm volatile("lextract %0,%1,%2,%3,32":"=r"(c1):"r"(ah),"r"(al),"r"(QQ));
-        asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(c2),"r"(s2),"0"(0),"1"(1<<(QQ-1)));
-        asm volatile("lextract %0,%1,%2,%3,32":"=r"(c2):"r"(ah),"r"(al),"r"(QQ));
-        asm volatile("std %0,%1,%2[1]"::"r"(c2), "r"(c1),"r"(xx));
+        DSP_LDD( c2, c1, xx, 0 );
+        DSP_LDD( s2, s1, yy, 0 );
+        DSP_MACCS( ah, al, c1, s1, 0, 1<<(QQ-1) );
+        DSP_LEXTRACT( c1, ah, al, QQ );
+        DSP_MACCS( ah, al, c2, s2, 0, 1<<(QQ-1) );
+        DSP_LEXTRACT( c2, ah, al, QQ );
+        DSP_STD( c2, c1, xx, 0 );
+        DSP_LDD( c2, c1, xx, 1 );
+        DSP_LDD( s2, s1, yy, 1 );
+        DSP_MACCS( ah, al, c1, s1, 0, 1<<(QQ-1) );
+        DSP_LEXTRACT( c1, ah, al, QQ );
+        DSP_MACCS( ah, al, c2, s2, 0, 1<<(QQ-1) );
+        DSP_LEXTRACT( c2, ah, al, QQ );
+        DSP_STD( c2, c1, xx, 1 );
         xx += 4; nn -= 4;
     }
     switch( nn ) {
         case 3:
-        asm volatile("ldd %0,%1,%2[0]":"=r"(c2),"=r"(c1):"r"(xx));
-        asm volatile("ldd %0,%1,%2[0]":"=r"(s2),"=r"(s1):"r"(yy));
-        asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(c1),"r"(s1),"0"(0),"1"(1<<(QQ-1)));
-        asm volatile("lextract %0,%1,%2,%3,32":"=r"(c1):"r"(ah),"r"(al),"r"(QQ));
-        asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(c2),"r"(s2),"0"(0),"1"(1<<(QQ-1)));
-        asm volatile("lextract %0,%1,%2,%3,32":"=r"(c2):"r"(ah),"r"(al),"r"(QQ));
-        asm volatile("std %0,%1,%2[0]"::"r"(c2), "r"(c1),"r"(xx));
-        asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(xx[2]),"r"(yy[2]),"0"(0),"1"(1<<(QQ-1)));
-        asm volatile("lextract %0,%1,%2,%3,32":"=r"(xx[2]):"r"(ah),"r"(al),"r"(QQ));
+        DSP_LDD( c2, c1, xx, 0 );
+        DSP_LDD( s2, s1, yy, 0 );
+        DSP_MACCS( ah, al, c1, s1, 0, 1<<(QQ-1) );
+        DSP_LEXTRACT( c1, ah, al, QQ );
+        DSP_MACCS( ah, al, c2, s2, 0, 1<<(QQ-1) );
+        DSP_LEXTRACT( c2, ah, al, QQ );
+        DSP_STD( c2, c1, xx, 0 );
+        DSP_MACCS( ah, al, xx[2], yy[2], 0, 1<<(QQ-1) );
+        DSP_LEXTRACT( xx[2], ah, al, QQ );
         break;
         case 2:
-        asm volatile("ldd %0,%1,%2[0]":"=r"(c2),"=r"(c1):"r"(xx));
-        asm volatile("ldd %0,%1,%2[0]":"=r"(s2),"=r"(s1):"r"(yy));
-        asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(c1),"r"(s1),"0"(0),"1"(1<<(QQ-1)));
-        asm volatile("lextract %0,%1,%2,%3,32":"=r"(c1):"r"(ah),"r"(al),"r"(QQ));
-        asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(c2),"r"(s2),"0"(0),"1"(1<<(QQ-1)));
-        asm volatile("lextract %0,%1,%2,%3,32":"=r"(c2):"r"(ah),"r"(al),"r"(QQ));
-        asm volatile("std %0,%1,%2[0]"::"r"(c2), "r"(c1),"r"(xx));
+        DSP_LDD( c2, c1, xx, 0 );
+        DSP_LDD( s2, s1, yy, 0 );
+        DSP_MACCS( ah, al, c1, s1, 0, 1<<(QQ-1) );
+        DSP_LEXTRACT( c1, ah, al, QQ );
+        DSP_MACCS( ah, al, c2, s2, 0, 1<<(QQ-1) );
+        DSP_LEXTRACT( c2, ah, al, QQ );
+        DSP_STD( c2, c1, xx, 0 );
         break;
         case 1:
-        asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(xx[0]),"r"(yy[0]),"0"(0),"1"(1<<(QQ-1)));
-        asm volatile("lextract %0,%1,%2,%3,32":"=r"(xx[0]):"r"(ah),"r"(al),"r"(QQ));
+        DSP_MACCS( ah, al, xx[0], yy[0], 0, 1<<(QQ-1) );
+        DSP_LEXTRACT( xx[0], ah, al, QQ );
         break;
     }
 }
@@ -1052,42 +1397,42 @@ static inline void _math_mac_Xyz( int* xx, int yy, int zz, int nn ) // X[] = X[]
 {
     unsigned al; int ah, c1,c2;
     while( nn >= 4 ) {
-        asm volatile("ldd %0,%1,%2[0]":"=r"(c2),"=r"(c1):"r"(xx));
-        asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(c1),"r"(yy),"0"(0),"1"(1<<(QQ-1)));
-        asm volatile("lextract %0,%1,%2,%3,32":"=r"(c1):"r"(ah),"r"(al),"r"(QQ)); c1 += zz;
-        asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(c2),"r"(yy),"0"(0),"1"(1<<(QQ-1)));
-        asm volatile("lextract %0,%1,%2,%3,32":"=r"(c2):"r"(ah),"r"(al),"r"(QQ)); c2 += zz;
-        asm volatile("std %0,%1,%2[0]"::"r"(c2), "r"(c1),"r"(xx));
-        asm volatile("ldd %0,%1,%2[1]":"=r"(c2),"=r"(c1):"r"(xx));
-        asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(c1),"r"(yy),"0"(0),"1"(1<<(QQ-1)));
-        asm volatile("lextract %0,%1,%2,%3,32":"=r"(c1):"r"(ah),"r"(al),"r"(QQ)); c1 += zz;
-        asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(c2),"r"(yy),"0"(0),"1"(1<<(QQ-1)));
-        asm volatile("lextract %0,%1,%2,%3,32":"=r"(c2):"r"(ah),"r"(al),"r"(QQ)); c2 += zz;
-        asm volatile("std %0,%1,%2[1]"::"r"(c2), "r"(c1),"r"(xx));
+        DSP_LDD( c2, c1, xx, 0 );
+        DSP_MACCS( ah, al, c1, yy, 0, 1<<(QQ-1) );
+        DSP_LEXTRACT( c1, ah, al, QQ ); c1 += zz;
+        DSP_MACCS( ah, al, c2, yy, 0, 1<<(QQ-1) );
+        DSP_LEXTRACT( c2, ah, al, QQ ); c2 += zz;
+        DSP_STD( c2, c1, xx, 0 );
+        DSP_LDD( c2, c1, xx, 1 );
+        DSP_MACCS( ah, al, c1, yy, 0, 1<<(QQ-1) );
+        DSP_LEXTRACT( c1, ah, al, QQ ); c1 += zz;
+        DSP_MACCS( ah, al, c2, yy, 0, 1<<(QQ-1) );
+        DSP_LEXTRACT( c2, ah, al, QQ ); c2 += zz;
+        DSP_STD( c2, c1, xx, 1 );
         xx += 4; nn -= 4;
     }
     switch( nn ) {
         case 3:
-        asm volatile("ldd %0,%1,%2[0]":"=r"(c2),"=r"(c1):"r"(xx));
-        asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(c1),"r"(yy),"0"(0),"1"(1<<(QQ-1)));
-        asm volatile("lextract %0,%1,%2,%3,32":"=r"(c1):"r"(ah),"r"(al),"r"(QQ)); c1 += zz;
-        asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(c2),"r"(yy),"0"(0),"1"(1<<(QQ-1)));
-        asm volatile("lextract %0,%1,%2,%3,32":"=r"(c2):"r"(ah),"r"(al),"r"(QQ)); c2 += zz;
-        asm volatile("std %0,%1,%2[0]"::"r"(c2), "r"(c1),"r"(xx));
-        asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(xx[2]),"r"(yy),"0"(0),"1"(1<<(QQ-1)));
-        asm volatile("lextract %0,%1,%2,%3,32":"=r"(xx[2]):"r"(ah),"r"(al),"r"(QQ)); xx[2] += zz;
+        DSP_LDD( c2, c1, xx, 0 );
+        DSP_MACCS( ah, al, c1, yy, 0, 1<<(QQ-1) );
+        DSP_LEXTRACT( c1, ah, al, QQ ); c1 += zz;
+        DSP_MACCS( ah, al, c2, yy, 0, 1<<(QQ-1) );
+        DSP_LEXTRACT( c2, ah, al, QQ ); c2 += zz;
+        DSP_STD( c2, c1, xx, 0 );
+        DSP_MACCS( ah, al, xx[2], yy, 0, 1<<(QQ-1) );
+        DSP_LEXTRACT( xx[2], ah, al, QQ ); xx[2] += zz;
         break;
         case 2:
-        asm volatile("ldd %0,%1,%2[0]":"=r"(c2),"=r"(c1):"r"(xx));
-        asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(c1),"r"(yy),"0"(0),"1"(1<<(QQ-1)));
-        asm volatile("lextract %0,%1,%2,%3,32":"=r"(c1):"r"(ah),"r"(al),"r"(QQ)); c1 += zz;
-        asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(c2),"r"(yy),"0"(0),"1"(1<<(QQ-1)));
-        asm volatile("lextract %0,%1,%2,%3,32":"=r"(c2):"r"(ah),"r"(al),"r"(QQ)); c2 += zz;
-        asm volatile("std %0,%1,%2[0]"::"r"(c2), "r"(c1),"r"(xx));
+        DSP_LDD( c2, c1, xx, 0 );
+        DSP_MACCS( ah, al, c1, yy, 0, 1<<(QQ-1) );
+        DSP_LEXTRACT( c1, ah, al, QQ ); c1 += zz;
+        DSP_MACCS( ah, al, c2, yy, 0, 1<<(QQ-1) );
+        DSP_LEXTRACT( c2, ah, al, QQ ); c2 += zz;
+        DSP_STD( c2, c1, xx, 0 );
         break;
         case 1:
-        asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(xx[0]),"r"(yy),"0"(0),"1"(1<<(QQ-1)));
-        asm volatile("lextract %0,%1,%2,%3,32":"=r"(xx[0]):"r"(ah),"r"(al),"r"(QQ)); xx[0] += zz;
+        DSP_MACCS( ah, al, xx[0], yy, 0, 1<<(QQ-1) );
+        DSP_LEXTRACT( xx[0], ah, al, QQ ); xx[0] += zz;
         break;
     }
 }
@@ -1096,46 +1441,46 @@ static inline void _math_mac_XyZ( int* xx, int yy, const int* zz, int nn ) // X[
 {
     unsigned al; int ah, c1,c2, s1, s2;
     while( nn >= 4 ) {
-        asm volatile("ldd %0,%1,%2[0]":"=r"(c2),"=r"(c1):"r"(xx));
-        asm volatile("ldd %0,%1,%2[0]":"=r"(s2),"=r"(s1):"r"(yy));
-        asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(c1),"r"(yy),"0"(0),"1"(1<<(QQ-1)));
-        asm volatile("lextract %0,%1,%2,%3,32":"=r"(c1):"r"(ah),"r"(al),"r"(QQ)); c1 += s1;
-        asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(c2),"r"(yy),"0"(0),"1"(1<<(QQ-1)));
-        asm volatile("lextract %0,%1,%2,%3,32":"=r"(c2):"r"(ah),"r"(al),"r"(QQ)); c2 += s2;
-        asm volatile("std %0,%1,%2[0]"::"r"(c2), "r"(c1),"r"(xx));
-        asm volatile("ldd %0,%1,%2[1]":"=r"(c2),"=r"(c1):"r"(xx));
-        asm volatile("ldd %0,%1,%2[1]":"=r"(s2),"=r"(s1):"r"(yy));
-        asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(c1),"r"(yy),"0"(0),"1"(1<<(QQ-1)));
-        asm volatile("lextract %0,%1,%2,%3,32":"=r"(c1):"r"(ah),"r"(al),"r"(QQ)); c1 += s1;
-        asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(c2),"r"(yy),"0"(0),"1"(1<<(QQ-1)));
-        asm volatile("lextract %0,%1,%2,%3,32":"=r"(c2):"r"(ah),"r"(al),"r"(QQ)); c2 += s2;
-        asm volatile("std %0,%1,%2[1]"::"r"(c2), "r"(c1),"r"(xx));
+        DSP_LDD( c2, c1, xx, 0 );
+        DSP_LDD( s2, s1, zz, 0 );
+        DSP_MACCS( ah, al, c1, yy, 0, 1<<(QQ-1) );
+        DSP_LEXTRACT( c1, ah, al, QQ ); c1 += s1;
+        DSP_MACCS( ah, al, c2, yy, 0, 1<<(QQ-1) );
+        DSP_LEXTRACT( c2, ah, al, QQ ); c2 += s2;
+        DSP_STD( c2, c1, xx, 0 );
+        DSP_LDD( c2, c1, xx, 1 );
+        DSP_LDD( s2, s1, zz, 1 );
+        DSP_MACCS( ah, al, c1, yy, 0, 1<<(QQ-1) );
+        DSP_LEXTRACT( c1, ah, al, QQ ); c1 += s1;
+        DSP_MACCS( ah, al, c2, yy, 0, 1<<(QQ-1) );
+        DSP_LEXTRACT( c2, ah, al, QQ ); c2 += s2;
+        DSP_STD( c2, c1, xx, 1 );
         xx += 4; nn -= 4;
     }
     switch( nn ) {
         case 3:
-        asm volatile("ldd %0,%1,%2[0]":"=r"(c2),"=r"(c1):"r"(xx));
-        asm volatile("ldd %0,%1,%2[0]":"=r"(s2),"=r"(s1):"r"(yy));
-        asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(c1),"r"(yy),"0"(0),"1"(1<<(QQ-1)));
-        asm volatile("lextract %0,%1,%2,%3,32":"=r"(c1):"r"(ah),"r"(al),"r"(QQ)); c1 += s1;
-        asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(c2),"r"(yy),"0"(0),"1"(1<<(QQ-1)));
-        asm volatile("lextract %0,%1,%2,%3,32":"=r"(c2):"r"(ah),"r"(al),"r"(QQ)); c2 += s2;
-        asm volatile("std %0,%1,%2[0]"::"r"(c2), "r"(c1),"r"(xx));
-        asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(xx[2]),"r"(yy),"0"(0),"1"(1<<(QQ-1)));
-        asm volatile("lextract %0,%1,%2,%3,32":"=r"(xx[2]):"r"(ah),"r"(al),"r"(QQ)); xx[2] += zz[2];
+        DSP_LDD( c2, c1, xx, 0 );
+        DSP_LDD( s2, s1, zz, 0 );
+        DSP_MACCS( ah, al, c1, yy, 0, 1<<(QQ-1) );
+        DSP_LEXTRACT( c1, ah, al, QQ ); c1 += s1;
+        DSP_MACCS( ah, al, c2, yy, 0, 1<<(QQ-1) );
+        DSP_LEXTRACT( c2, ah, al, QQ ); c2 += s2;
+        DSP_STD( c2, c1, xx, 0 );
+        DSP_MACCS( ah, al, xx[2], yy, 0, 1<<(QQ-1) );
+        DSP_LEXTRACT( xx[2], ah, al, QQ ); xx[2] += zz[2];
         break;
         case 2:
-        asm volatile("ldd %0,%1,%2[0]":"=r"(c2),"=r"(c1):"r"(xx));
-        asm volatile("ldd %0,%1,%2[0]":"=r"(s2),"=r"(s1):"r"(yy));
-        asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(c1),"r"(yy),"0"(0),"1"(1<<(QQ-1)));
-        asm volatile("lextract %0,%1,%2,%3,32":"=r"(c1):"r"(ah),"r"(al),"r"(QQ)); c1 += s1;
-        asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(c2),"r"(yy),"0"(0),"1"(1<<(QQ-1)));
-        asm volatile("lextract %0,%1,%2,%3,32":"=r"(c2):"r"(ah),"r"(al),"r"(QQ)); c2 += s2;
-        asm volatile("std %0,%1,%2[0]"::"r"(c2), "r"(c1),"r"(xx));
+        DSP_LDD( c2, c1, xx, 0 );
+        DSP_LDD( s2, s1, zz, 0 );
+        DSP_MACCS( ah, al, c1, yy, 0, 1<<(QQ-1) );
+        DSP_LEXTRACT( c1, ah, al, QQ ); c1 += s1;
+        DSP_MACCS( ah, al, c2, yy, 0, 1<<(QQ-1) );
+        DSP_LEXTRACT( c2, ah, al, QQ ); c2 += s2;
+        DSP_STD( c2, c1, xx, 0 );
         break;
         case 1:
-        asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(xx[0]),"r"(yy),"0"(0),"1"(1<<(QQ-1)));
-        asm volatile("lextract %0,%1,%2,%3,32":"=r"(xx[0]):"r"(ah),"r"(al),"r"(QQ)); xx[0] += zz[0];
+        DSP_MACCS( ah, al, xx[0], yy, 0, 1<<(QQ-1) );
+        DSP_LEXTRACT( xx[0], ah, al, QQ ); xx[0] += zz[0];
         break;
     }
 }
@@ -1144,46 +1489,46 @@ static inline void _math_mac_XYz( int* xx, const int* yy, int zz, int nn ) // X[
 {
     unsigned al; int ah, c1,c2, s1,s2;
     while( nn >= 4 ) {
-        asm volatile("ldd %0,%1,%2[0]":"=r"(c2),"=r"(c1):"r"(xx));
-        asm volatile("ldd %0,%1,%2[0]":"=r"(s2),"=r"(s1):"r"(yy));
-        asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(c1),"r"(s1),"0"(0),"1"(1<<(QQ-1)));
-        asm volatile("lextract %0,%1,%2,%3,32":"=r"(c1):"r"(ah),"r"(al),"r"(QQ)); c1 += zz;
-        asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(c2),"r"(s2),"0"(0),"1"(1<<(QQ-1)));
-        asm volatile("lextract %0,%1,%2,%3,32":"=r"(c2):"r"(ah),"r"(al),"r"(QQ)); c2 += zz;
-        asm volatile("std %0,%1,%2[0]"::"r"(c2), "r"(c1),"r"(xx));
-        asm volatile("ldd %0,%1,%2[1]":"=r"(c2),"=r"(c1):"r"(xx));
-        asm volatile("ldd %0,%1,%2[1]":"=r"(s2),"=r"(s1):"r"(yy));
-        asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(c1),"r"(s1),"0"(0),"1"(1<<(QQ-1)));
-        asm volatile("lextract %0,%1,%2,%3,32":"=r"(c1):"r"(ah),"r"(al),"r"(QQ)); c1 += zz;
-        asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(c2),"r"(s2),"0"(0),"1"(1<<(QQ-1)));
-        asm volatile("lextract %0,%1,%2,%3,32":"=r"(c2):"r"(ah),"r"(al),"r"(QQ)); c2 += zz;
-        asm volatile("std %0,%1,%2[1]"::"r"(c2), "r"(c1),"r"(xx));
+        DSP_LDD( c2, c1, xx, 0 );
+        DSP_LDD( s2, s1, yy, 0 );
+        DSP_MACCS( ah, al, c1, s1, 0, 1<<(QQ-1) );
+        DSP_LEXTRACT( c1, ah, al, QQ ); c1 += zz;
+        DSP_MACCS( ah, al, c2, s2, 0, 1<<(QQ-1) );
+        DSP_LEXTRACT( c2, ah, al, QQ ); c2 += zz;
+        DSP_STD( c2, c1, xx, 0 );
+        DSP_LDD( c2, c1, xx, 1 );
+        DSP_LDD( s2, s1, yy, 1 );
+        DSP_MACCS( ah, al, c1, s1, 0, 1<<(QQ-1) );
+        DSP_LEXTRACT( c1, ah, al, QQ ); c1 += zz;
+        DSP_MACCS( ah, al, c2, s2, 0, 1<<(QQ-1) );
+        DSP_LEXTRACT( c2, ah, al, QQ ); c2 += zz;
+        DSP_STD( c2, c1, xx, 1 );
         xx += 4; nn -= 4;
     }
     switch( nn ) {
         case 3:
-        asm volatile("ldd %0,%1,%2[0]":"=r"(c2),"=r"(c1):"r"(xx));
-        asm volatile("ldd %0,%1,%2[0]":"=r"(s2),"=r"(s1):"r"(yy));
-        asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(c1),"r"(s1),"0"(0),"1"(1<<(QQ-1)));
-        asm volatile("lextract %0,%1,%2,%3,32":"=r"(c1):"r"(ah),"r"(al),"r"(QQ)); c1 += zz;
-        asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(c2),"r"(s2),"0"(0),"1"(1<<(QQ-1)));
-        asm volatile("lextract %0,%1,%2,%3,32":"=r"(c2):"r"(ah),"r"(al),"r"(QQ)); c2 += zz;
-        asm volatile("std %0,%1,%2[0]"::"r"(c2), "r"(c1),"r"(xx));
-        asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(xx[2]),"r"(yy[2]),"0"(0),"1"(1<<(QQ-1)));
-        asm volatile("lextract %0,%1,%2,%3,32":"=r"(xx[2]):"r"(ah),"r"(al),"r"(QQ)); xx[2] += zz;
+        DSP_LDD( c2, c1, xx, 0 );
+        DSP_LDD( s2, s1, yy, 0 );
+        DSP_MACCS( ah, al, c1, s1, 0, 1<<(QQ-1) );
+        DSP_LEXTRACT( c1, ah, al, QQ ); c1 += zz;
+        DSP_MACCS( ah, al, c2, s2, 0, 1<<(QQ-1) );
+        DSP_LEXTRACT( c2, ah, al, QQ ); c2 += zz;
+        DSP_STD( c2, c1, xx, 0 );
+        DSP_MACCS( ah, al, xx[2], yy[2], 0, 1<<(QQ-1) );
+        DSP_LEXTRACT( xx[2], ah, al, QQ ); xx[2] += zz;
         break;
         case 2:
-        asm volatile("ldd %0,%1,%2[0]":"=r"(c2),"=r"(c1):"r"(xx));
-        asm volatile("ldd %0,%1,%2[0]":"=r"(s2),"=r"(s1):"r"(yy));
-        asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(c1),"r"(s1),"0"(0),"1"(1<<(QQ-1)));
-        asm volatile("lextract %0,%1,%2,%3,32":"=r"(c1):"r"(ah),"r"(al),"r"(QQ)); c1 += zz;
-        asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(c2),"r"(s2),"0"(0),"1"(1<<(QQ-1)));
-        asm volatile("lextract %0,%1,%2,%3,32":"=r"(c2):"r"(ah),"r"(al),"r"(QQ)); c2 += zz;
-        asm volatile("std %0,%1,%2[0]"::"r"(c2), "r"(c1),"r"(xx));
+        DSP_LDD( c2, c1, xx, 0 );
+        DSP_LDD( s2, s1, yy, 0 );
+        DSP_MACCS( ah, al, c1, s1, 0, 1<<(QQ-1) );
+        DSP_LEXTRACT( c1, ah, al, QQ ); c1 += zz;
+        DSP_MACCS( ah, al, c2, s2, 0, 1<<(QQ-1) );
+        DSP_LEXTRACT( c2, ah, al, QQ ); c2 += zz;
+        DSP_STD( c2, c1, xx, 0 );
         break;
         case 1:
-        asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(xx[0]),"r"(yy[0]),"0"(0),"1"(1<<(QQ-1)));
-        asm volatile("lextract %0,%1,%2,%3,32":"=r"(xx[0]):"r"(ah),"r"(al),"r"(QQ)); xx[0] += zz;
+        DSP_MACCS( ah, al, xx[0], yy[0], 0, 1<<(QQ-1) );
+        DSP_LEXTRACT( xx[0], ah, al, QQ ); xx[0] += zz;
         break;
     }
 }
@@ -1192,50 +1537,50 @@ static inline void _math_mac_XYZ( int* xx, const int* yy, const int* zz, int nn
 {
     unsigned al; int ah, c1,c2, s1,s2, h1,h2;
     while( nn >= 4 ) {
-        asm volatile("ldd %0,%1,%2[0]":"=r"(c2),"=r"(c1):"r"(xx));
-        asm volatile("ldd %0,%1,%2[0]":"=r"(s2),"=r"(s1):"r"(yy));
-        asm volatile("ldd %0,%1,%2[0]":"=r"(h2),"=r"(h1):"r"(zz));
-        asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(c1),"r"(s1),"0"(0),"1"(1<<(QQ-1)));
-        asm volatile("lextract %0,%1,%2,%3,32":"=r"(c1):"r"(ah),"r"(al),"r"(QQ)); c1 += h1;
-        asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(c2),"r"(s2),"0"(0),"1"(1<<(QQ-1)));
-        asm volatile("lextract %0,%1,%2,%3,32":"=r"(c2):"r"(ah),"r"(al),"r"(QQ)); c2 += h2;
-        asm volatile("std %0,%1,%2[0]"::"r"(c2), "r"(c1),"r"(xx));
-        asm volatile("ldd %0,%1,%2[1]":"=r"(c2),"=r"(c1):"r"(xx));
-        asm volatile("ldd %0,%1,%2[1]":"=r"(s2),"=r"(s1):"r"(yy));
-        asm volatile("ldd %0,%1,%2[1]":"=r"(h2),"=r"(h1):"r"(zz));
-        asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(c1),"r"(s1),"0"(0),"1"(1<<(QQ-1)));
-        asm volatile("lextract %0,%1,%2,%3,32":"=r"(c1):"r"(ah),"r"(al),"r"(QQ)); c1 += h1;
-        asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(c2),"r"(s2),"0"(0),"1"(1<<(QQ-1)));
-        asm volatile("lextract %0,%1,%2,%3,32":"=r"(c2):"r"(ah),"r"(al),"r"(QQ)); c2 += h2;
-        asm volatile("std %0,%1,%2[1]"::"r"(c2), "r"(c1),"r"(xx));
+        DSP_LDD( c2, c1, xx, 0 );
+        DSP_LDD( s2, s1, yy, 0 );
+        DSP_LDD( h2, h1, zz, 0 );
+        DSP_MACCS( ah, al, c1, s1, 0, 1<<(QQ-1) );
+        DSP_LEXTRACT( c1, ah, al, QQ ); c1 += h1;
+        DSP_MACCS( ah, al, c2, s2, 0, 1<<(QQ-1) );
+        DSP_LEXTRACT( c2, ah, al, QQ ); c2 += h2;
+        DSP_STD( c2, c1, xx, 0 );
+        DSP_LDD( c2, c1, xx, 1 );
+        DSP_LDD( s2, s1, yy, 1 );
+        DSP_LDD( h2, h1, zz, 1 );
+        DSP_MACCS( ah, al, c1, s1, 0, 1<<(QQ-1) );
+        DSP_LEXTRACT( c1, ah, al, QQ ); c1 += h1;
+        DSP_MACCS( ah, al, c2, s2, 0, 1<<(QQ-1) );
+        DSP_LEXTRACT( c2, ah, al, QQ ); c2 += h2;
+        DSP_STD( c2, c1, xx, 1 );
         xx += 4; nn -= 4;
     }
     switch( nn ) {
         case 3:
-        asm volatile("ldd %0,%1,%2[0]":"=r"(c2),"=r"(c1):"r"(xx));
-        asm volatile("ldd %0,%1,%2[0]":"=r"(s2),"=r"(s1):"r"(yy));
-        asm volatile("ldd %0,%1,%2[0]":"=r"(h2),"=r"(h1):"r"(zz));
-        asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(c1),"r"(s1),"0"(0),"1"(1<<(QQ-1)));
-        asm volatile("lextract %0,%1,%2,%3,32":"=r"(c1):"r"(ah),"r"(al),"r"(QQ)); c1 += h1;
-        asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(c2),"r"(s2),"0"(0),"1"(1<<(QQ-1)));
-        asm volatile("lextract %0,%1,%2,%3,32":"=r"(c2):"r"(ah),"r"(al),"r"(QQ)); c2 += h2;
-        asm volatile("std %0,%1,%2[0]"::"r"(c2), "r"(c1),"r"(xx));
-        asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(xx[2]),"r"(yy[2]),"0"(0),"1"(1<<(QQ-1)));
-        asm volatile("lextract %0,%1,%2,%3,32":"=r"(xx[2]):"r"(ah),"r"(al),"r"(QQ)); xx[2] += zz[2];
+        DSP_LDD( c2, c1, xx, 0 );
+        DSP_LDD( s2, s1, yy, 0 );
+        DSP_LDD( h2, h1, zz, 0 );
+        DSP_MACCS( ah, al, c1, s1, 0, 1<<(QQ-1) );
+        DSP_LEXTRACT( c1, ah, al, QQ ); c1 += h1;
+        DSP_MACCS( ah, al, c2, s2, 0, 1<<(QQ-1) );
+        DSP_LEXTRACT( c2, ah, al, QQ ); c2 += h2;
+        DSP_STD( c2, c1, xx, 0 );
+        DSP_MACCS( ah, al, xx[2], yy[2], 0, 1<<(QQ-1) );
+        DSP_LEXTRACT( xx[2], ah, al, QQ ); xx[2] += zz[2];
         break;
         case 2:
-        asm volatile("ldd %0,%1,%2[0]":"=r"(c2),"=r"(c1):"r"(xx));
-        asm volatile("ldd %0,%1,%2[0]":"=r"(s2),"=r"(s1):"r"(yy));
-        asm volatile("ldd %0,%1,%2[0]":"=r"(h2),"=r"(h1):"r"(zz));
-        asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(c1),"r"(s1),"0"(0),"1"(1<<(QQ-1)));
-        asm volatile("lextract %0,%1,%2,%3,32":"=r"(c1):"r"(ah),"r"(al),"r"(QQ)); c1 += h1;
-        asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(c2),"r"(s2),"0"(0),"1"(1<<(QQ-1)));
-        asm volatile("lextract %0,%1,%2,%3,32":"=r"(c2):"r"(ah),"r"(al),"r"(QQ)); c2 += h2;
-        asm volatile("std %0,%1,%2[0]"::"r"(c2), "r"(c1),"r"(xx));
+        DSP_LDD( c2, c1, xx, 0 );
+        DSP_LDD( s2, s1, yy, 0 );
+        DSP_LDD( h2, h1, zz, 0 );
+        DSP_MACCS( ah, al, c1, s1, 0, 1<<(QQ-1) );
+        DSP_LEXTRACT( c1, ah, al, QQ ); c1 += h1;
+        DSP_MACCS( ah, al, c2, s2, 0, 1<<(QQ-1) );
+        DSP_LEXTRACT( c2, ah, al, QQ ); c2 += h2;
+        DSP_STD( c2, c1, xx, 0 );
         break;
         case 1:
-        asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(xx[0]),"r"(yy[0]),"0"(0),"1"(1<<(QQ-1)));
-        asm volatile("lextract %0,%1,%2,%3,32":"=r"(xx[0]):"r"(ah),"r"(al),"r"(QQ)); xx[0] += zz[0];
+        DSP_MACCS( ah, al, xx[0], yy[0], 0, 1<<(QQ-1) );
+        DSP_LEXTRACT( xx[0], ah, al, QQ ); xx[0] += zz[0];
         break;
     }
 }
@@ -1244,22 +1589,75 @@ static inline void _math_mac_XYZ( int* xx, const int* yy, const int* zz, int nn
 #define _dsp_blend( xx, dry, wet, blend ) \
 { \
     int ah = 0; unsigned al = 1<<(QQ-1); \
-    asm("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(dry),"r"(FQ(1.0)-blend),"0"(ah),"1"(al) ); \
-    asm("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(wet),"r"(blend),"0"(ah),"1"(al) ); \
-    asm("lextract %0,%1,%2,%3,32":"=r"(xx):"r"(ah),"r"(al),"r"(QQ)); \
+    DSP_MACCS( ah, al, dry, FQ(1.0)-blend, ah, al ); \
+    DSP_MACCS( ah, al, wet, blend, ah, al ); \
+    DSP_LEXTRACT( xx, ah, al, QQ ); \
 }
 
 // Envelope detector (digital RC circuit, wp279.pdf): y[n] = y[n–1] + k * (x[n] – y[n–1])
 #define _dsp_envelope( yy, xx, kk, ss ) \
 { \
     int ah; unsigned al; \
-    asm("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(FQ(1.0)),"r"(ss[0]),"0"(0),"1"(1<<(QQ-1))); \
-    if( xx >= 0 ) asm("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(kk),"r"(+xx-ss[0]),"0"(ah),"1"(al)); \
-    else          asm("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(kk),"r"(-xx-ss[0]),"0"(ah),"1"(al)); \
-    asm("lextract %0,%1,%2,%3,32":"=r"(ss[0]):"r"(ah),"r"(al),"r"(QQ)); \
+    DSP_MACCS( ah, al, FQ(1.0), ss[0], 0, 1<<(QQ-1) ); \
+    if( xx >= 0 ) DSP_MACCS( ah, al, kk, +xx-ss[0], ah, al ); \
+    else          DSP_MACCS( ah, al, kk, -xx-ss[0], ah, al ); \
+    DSP_LEXTRACT( ss[0], ah, al, QQ ); \
     yy = ss[0]; \
 }
 
+// Dynamics processor (see 'calc_compressor'). The level of the loudest channel (stereo-linking) is
+// converted to dB and fed to a soft-knee gain computer, the resulting gain (dB) is smoothed with
+// separate attack and release coefficients and applied to the channels after an optional look-ahead
+// delay. All levels and gains are dB in Q24 relative to QQQ 1.0 (a full-scale sample is +18 dB).
+//
+// CC[0]=threshold, CC[1]=+1 (compress/limit above threshold) or -1 (expand/gate below threshold),
+// CC[2]=slope 1/ratio-1 or 1-ratio, CC[3]=half knee width, CC[4]=1/knee width (QQQ), CC[5]=floor,
+// CC[6]=make-up gain, CC[7]/CC[8]=attack/release coefficients and CC[9]=RMS coefficient (QQQ, zero
+// for peak detection), CC[10]=look-ahead samples LL, CC[11]=output ceiling (QQQ, zero for none).
+// SS[0]=detector, SS[1]=smoothed gain, SS[2]=look-ahead index, SS[3:3+LL*NN-1]=look-ahead delay.
+
+static inline void _dsp_dynamics( int* xx, const int* cc, int* ss, int nn )
+{
+    unsigned al; int ah, lv = 0, gg, dd, kk, ii;
+    for( ii = 0; ii < nn; ++ii ) { dd = xx[ii] < 0 ? -xx[ii] : xx[ii]; if( dd > lv ) lv = dd; }
+    if( cc[9] ) { // Mean square of XX/8 (no overflow at full-scale), dB is half of LIN_TO_DB
+        DSP_MACCS( ah, al, lv, lv, 0, 1<<(QQ+5-32) ); DSP_LEXTRACT( lv, ah, al, QQ+6 );
+        DSP_MACCS( ah, al, FQ(1.0), ss[0], 0, 1<<(QQ-1) );
+        DSP_MACCS( ah, al, cc[9], lv-ss[0], ah, al );
+        DSP_LEXTRACT( ss[0], ah, al, QQ );
+        lv = _dsp_lin_to_db( ss[0] );
+        if( lv != (int)0x80000000 ) lv = (lv >> 1) + 303026716; // + 20*log10(8) in Q24
+    }
+    else lv = _dsp_lin_to_db( lv );
+    if( lv < -(100<<(QQ-4)) ) lv = -(100<<(QQ-4)); // Floor, keeps LV-CC[0] within Q24
+    dd = cc[1] > 0 ? lv - cc[0] : cc[0] - lv;
+    if( dd <= -cc[3] ) gg = 0;
+    else if( dd >= cc[3] ) gg = dd;
+    else { // Quadratic knee (DD+W/2)^2/(2*W)
+        dd += cc[3];
+        DSP_MACCS( ah, al, dd, cc[4], 0, 1<<QQ ); DSP_LEXTRACT( gg, ah, al, QQ+1 );
+        DSP_MACCS( ah, al, dd, gg, 0, 1<<(QQ-5) ); DSP_LEXTRACT( gg, ah, al, QQ-4 );
+    }
+    DSP_MACCS( ah, al, cc[2], gg, 0, 1<<(QQ-5) ); DSP_LSATS( ah, al, QQ-4 );
+    DSP_LEXTRACT( gg, ah, al, QQ-4 );
+    if( gg < cc[5] ) gg = cc[5];
+    kk = (cc[1] > 0 ? gg < ss[1] : gg > ss[1]) ? cc[7] : cc[8];
+    DSP_MACCS( ah, al, FQ(1.0), ss[1], 0, 1<<(QQ-1) );
+    DSP_MACCS( ah, al, kk, gg-ss[1], ah, al );
+    DSP_LEXTRACT( ss[1], ah, al, QQ );
+    gg = _dsp_db_to_lin( ss[1] + cc[6] );
+    if( cc[10] ) {
+        int* bb = ss + 3 + ss[2];
+        for( ii = 0; ii < nn; ++ii ) { dd = bb[ii]; bb[ii] = xx[ii]; xx[ii] = dd; }
+        ss[2] += nn; if( ss[2] >= cc[10] * nn ) ss[2] = 0;
+    }
+    for( ii = 0; ii < nn; ++ii ) {
+        DSP_MACCS( ah, al, xx[ii], gg, 0, 1<<(QQ-1) ); DSP_LSATS( ah, al, QQ );
+        DSP_LEXTRACT( xx[ii], ah, al, QQ );
+        if( cc[11] ) { if( xx[ii] > cc[11] ) xx[ii] = cc[11]; if( xx[ii] < -cc[11] ) xx[ii] = -cc[11]; }
+    }
+}
+
 // Differentiator: y[n]=x[n] - x[n-1]
 // Leaky Integrator: y[n]=pole*y[n-1] + x[n]
 // y[n] = x[n] - x[n-1] + R*y[n-1]
@@ -1267,8 +1665,8 @@ static inline void _math_mac_XYZ( int* xx, const int* yy, const int* zz, int nn
 #define _dsp_dcblock( xx, kk, ss ) \
 { \
     int ah; unsigned al; \
-    asm("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(kk),"r"(ss[1]),"0"(0),"1"(1<<(QQ-1))); \
-    asm("lextract %0,%1,%2,%3,32":"=r"(ah):"r"(ah),"r"(al),"r"(QQ)); \
+    DSP_MACCS( ah, al, kk, ss[1], 0, 1<<(QQ-1) ); \
+    DSP_LEXTRACT( ah, ah, al, QQ ); \
     ss[1] = xx - ss[0] + ah; ss[0] = xx; xx = ss[1]; \
 }
 
@@ -1289,110 +1687,222 @@ static inline void _math_mac_XYZ( int* xx, const int* yy, const int* zz, int nn
 #define _dsp_interp( xx, ff, y1, y2 ) \
 { \
     int ah; unsigned al; \
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(y1),"r"(FQ(1.0)-ff),"0"(0),"1"(1<<(QQ-1))); \
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(y2),"r"(ff),"0"(ah),"1"(al)); \
-    asm volatile("lextract %0,%1,%2,%3,32":"=r"(xx):"r"(ah),"r"(al),"r"(QQ)); \
+    DSP_MACCS( ah, al, y1, FQ(1.0)-ff, 0, 1<<(QQ-1) ); \
+    DSP_MACCS( ah, al, y2, ff, ah, al ); \
+    DSP_LEXTRACT( xx, ah, al, QQ ); \
 }
 
 #define _dsp_lagrange( xx, ff, y1, y2, y3 ) \
 { \
     int z1, z2, z3, ah; unsigned al; \
     int x0 = ff - FQ(0.0), x1 = ff - FQ(1.0), x2 = ff - FQ(2.0); \
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(x1),"r"(x2),"0"(0),"1"(1<<(QQ-1))); \
-    asm volatile("lextract %0,%1,%2,%3,32":"=r"(z1):"r"(ah),"r"(al),"r"((QQ+1))); \
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(x0),"r"(-x2),"0"(0),"1"(1<<(QQ-1))); \
-    asm volatile("lextract %0,%1,%2,%3,32":"=r"(z2):"r"(ah),"r"(al),"r"((QQ+0))); \
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(x0),"r"(x1),"0"(0),"1"(1<<(QQ-1))); \
-    asm volatile("lextract %0,%1,%2,%3,32":"=r"(z3):"r"(ah),"r"(al),"r"((QQ+1))); \
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(y1),"r"(z1),"0"(0),"1"(1<<(QQ-1))); \
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(y2),"r"(z2),"0"(ah),"1"(al)); \
-    asm volatile("maccs %0,%1,%2,%3":"=r"(ah),"=r"(al):"r"(y3),"r"(z3),"0"(ah),"1"(al)); \
-    asm volatile("lextract %0,%1,%2,%3,32":"=r"(xx):"r"(ah),"r"(al),"r"(QQ)); \
+    DSP_MACCS( ah, al, x1, x2, 0, 1<<(QQ-1) ); \
+    DSP_LEXTRACT( z1, ah, al, (QQ+1) ); \
+    DSP_MACCS( ah, al, x0, -x2, 0, 1<<(QQ-1) ); \
+    DSP_LEXTRACT( z2, ah, al, (QQ+0) ); \
+    DSP_MACCS( ah, al, x0, x1, 0, 1<<(QQ-1) ); \
+    DSP_LEXTRACT( z3, ah, al, (QQ+1) ); \
+    DSP_MACCS( ah, al, y1, z1, 0, 1<<(QQ-1) ); \
+    DSP_MACCS( ah, al, y2, z2, ah, al ); \
+    DSP_MACCS( ah, al, y3, z3, ah, al ); \
+    DSP_LEXTRACT( xx, ah, al, QQ ); \
+}
+
+// Waveshaper (see 'dsp_waveshaper'). CC[0:3] is block, gain, bias and slew, CC[6:10] and CC[12:16]
+// are the pre and post-filter bi-quads. SS[0:1] is the DC blocker, SS[2] the previous output, SS[4:7]
+// and SS[8:11] the bi-quads and SS[12:16] the FIR. X/2+bias+0.5 (0.0 to 1.0) is split into the
+// LUT[0] index bits (clamped to LUT[1]-3) and the fraction for 3-point Lagrange interpolation. Since
+// FF is a constant at the call site the unused stages fold away when inlined.
+
+static inline int _dsp_waveshaper( int xx, const int* lut, const int* cc, int* ss, int ff )
+{
+    int ah, ii, dd, bb = lut[0]; unsigned al;
+    _dsp_dcblock( xx, cc[0], ss );
+    DSP_MACCS( ah, al, xx, cc[1], 0, 1<<(QQ-1) );
+    DSP_LEXTRACT( xx, ah, al, QQ );
+    if( ff & DSP_SHAPER_PRE ) _dsp_biquad1( xx, cc+6, ss+4 );
+    xx = xx/2 + cc[2];
+    if( xx < FQ(-0.499999) ) xx = FQ(-0.499999);
+    if( xx > FQ(+0.499999) ) xx = FQ(+0.499999);
+    xx += FQ(+0.5); ii = xx >> (QQ-bb); dd = (xx & ((1<<(QQ-bb))-1)) << bb;
+    if( ii > lut[1]-3 ) ii = lut[1]-3;
+    _dsp_lagrange( xx, dd, lut[2+ii], lut[3+ii], lut[4+ii] );
+    if( ff & DSP_SHAPER_FIR ) { // 6th order FIR noise attenuation, util_fir.py 0 0.5 1.0 40
+        int s1,s2,s3,s4,s5 = ss[16];
+        DSP_LDD( s2, s1, ss, 6 ); DSP_LDD( s4, s3, ss, 7 );
+        DSP_STD( s1, xx, ss, 6 ); DSP_STD( s3, s2, ss, 7 ); ss[16] = s4;
+        DSP_MACCS( ah, al, FQ(-0.013268164), xx + s5, 0, 1<<(QQ-1) );
+        DSP_MACCS( ah, al, FQ(+0.087136613), s1 + s4, ah, al );
+        DSP_MACCS( ah, al, FQ(+0.426131551), s2 + s3, ah, al );
+        DSP_LEXTRACT( xx, ah, al, QQ );
+    }
+    if( ff & DSP_SHAPER_POST ) _dsp_biquad1( xx, cc+12, ss+8 );
+    if( xx > ss[2] + cc[3] ) xx = ss[2] + cc[3]; // Slew-rate limiting
+    if( xx < ss[2] - cc[3] ) xx = ss[2] - cc[3];
+    return ss[2] = xx;
+}
+
+// Delay lines (see 'dsp_delay_init'). DL[0] is the mask (NN-1), DL[1] is the write index and
+// DL[2:NN+1] is the ring buffer. Writes move the index down so that the sample delayed by DD (0 is
+// the newest sample) is at index+DD - one AND per read and no wrap-around branches.
+
+#define _dsp_delay_at( dl, dd ) ((dl)[2 + (((dl)[1] + (dd)) & (dl)[0])])
+
+static inline void _dsp_delay_write( int* dl, int xx )
+{
+    dl[1] = (dl[1] - 1) & dl[0]; dl[2+dl[1]] = xx;
+}
+
+static inline int _dsp_delay_read( const int* dl, int dd )
+{
+    return _dsp_delay_at( dl, dd );
+}
+
+static inline int _dsp_delay_lin( const int* dl, int dd, int ff )
+{
+    int yy; _dsp_interp( yy, ff, _dsp_delay_at( dl, dd ), _dsp_delay_at( dl, dd+1 ) ); return yy;
+}
+
+static inline int _dsp_delay_lagr( const int* dl, int dd, int ff )
+{
+    int yy, y1 = _dsp_delay_at( dl, dd ), y2 = _dsp_delay_at( dl, dd+1 ), y3 = _dsp_delay_at( dl, dd+2 );
+    _dsp_lagrange( yy, ff, y1, y2, y3 ); return yy;
+}
+
+// 4-point Hermite (Catmull-Rom) between DD and DD+1 using DD-1 and DD+2, as weights on the four
+// samples so that the sum is accumulated in 64 bits (no intermediate overflow).
+
+static inline int _dsp_delay_herm( const int* dl, int dd, int ff )
+{
+    unsigned al; int ah, t2, t3;
+    DSP_MACCS( ah, al, ff, ff, 0, 1<<(QQ-1) ); DSP_LEXTRACT( t2, ah, al, QQ );
+    DSP_MACCS( ah, al, t2, ff, 0, 1<<(QQ-1) ); DSP_LEXTRACT( t3, ah, al, QQ );
+    DSP_MACCS( ah, al, _dsp_delay_at( dl, dd-1 ), (2*t2 - t3 - ff) >> 1, 0, 1<<(QQ-1) );
+    DSP_MACCS( ah, al, _dsp_delay_at( dl, dd+0 ), (3*t3 - 5*t2 + FQ(2.0)) >> 1, ah, al );
+    DSP_MACCS( ah, al, _dsp_delay_at( dl, dd+1 ), (4*t2 - 3*t3 + ff) >> 1, ah, al );
+    DSP_MACCS( ah, al, _dsp_delay_at( dl, dd+2 ), (t3 - t2) >> 1, ah, al );
+    DSP_LEXTRACT( ah, ah, al, QQ );
+    return ah;
+}
+
+// First-order allpass interpolation, y = a*x[DD] + x[DD+1] - a*y[n-1] with a = (1-FF)/(1+FF). Flat
+// magnitude (no low-pass effect as with linear interpolation), valid for 0 < FF < 2 and best for
+// 0.1 <= FF <= 1.1 and slowly changing DD and FF. SS[0] is the previous output. LDIVU is unsigned
+// so |1-FF| is divided and the sign of 'a' restored afterwards (FF > 1 gives a < 0).
+
+static inline int _dsp_delay_allp( const int* dl, int dd, int ff, int* ss )
+{
+    unsigned al; int ah, aa, x1 = _dsp_delay_at( dl, dd+1 );
+    int nn = FQ(1.0) - ff, sg = nn >> 31; nn = (nn ^ sg) - sg;
+    DSP_LDIVU( aa, ah, nn >> (32-QQ), (unsigned)nn << QQ, FQ(1.0)+ff );
+    aa = (aa ^ sg) - sg;
+    DSP_MACCS( ah, al, aa, _dsp_delay_at( dl, dd ), x1 >> (32-QQ), ((unsigned)x1 << QQ)+(1<<(QQ-1)) );
+    DSP_MACCS( ah, al, -aa, ss[0], ah, al );
+    DSP_LEXTRACT( ss[0], ah, al, QQ );
+    return ss[0];
+}
+
+static inline void _dsp_delay_taps( const int* dl, int* xx, const int* dd, int nn )
+{
+    while( nn-- ) *xx++ = _dsp_delay_at( dl, *dd++ );
+}
+
+static inline void _dsp_delay_write_block( int* dl, const int* xx, int bb )
+{
+    int ii = dl[1], mm = dl[0];
+    while( bb-- ) { ii = (ii - 1) & mm; dl[2+ii] = *xx++; }
+    dl[1] = ii;
+}
+
+static inline void _dsp_delay_read_block( const int* dl, int* xx, int dd, int bb )
+{
+    int ii = dl[1] + dd + bb - 1, mm = dl[0];
+    while( bb-- ) *xx++ = dl[2 + (ii-- & mm)];
 }
 
 #define __CONVOLVE_00(cc,ss) \
-    asm("ldd   %0,%1,%2[0]":"=r"(b1),"=r"(b0):"r"(cc)); \
-    asm("ldd   %0,%1,%2[0]":"=r"(s2),"=r"(s1):"r"(ss)); \
-    asm("std   %0,%1,%2[0]"::"r"(s1), "r"(s0),"r"(ss)); \
-    asm("maccs %0,%1,%2,%3" :"=r"(ah),"=r"(al):"r"(b0),"r"(s0), "0"(ah),"1"(al)); \
-    asm("maccs %0,%1,%2,%3" :"=r"(ah),"=r"(al):"r"(b1),"r"(s1), "0"(ah),"1"(al));
+    DSP_LDD( b1, b0, cc, 0 ); \
+    DSP_LDD( s2, s1, ss, 0 ); \
+    DSP_STD( s1, s0, ss, 0 ); \
+    DSP_MACCS( ah, al, b0, s0, ah, al ); \
+    DSP_MACCS( ah, al, b1, s1, ah, al );
 
 #define __CONVOLVE_01(cc,ss) \
-    asm("ldd   %0,%1,%2[1]":"=r"(b1),"=r"(b0):"r"(cc)); \
-    asm("ldd   %0,%1,%2[1]":"=r"(s0),"=r"(s3):"r"(ss)); \
-    asm("std   %0,%1,%2[1]"::"r"(s3), "r"(s2),"r"(ss)); \
-    asm("maccs %0,%1,%2,%3" :"=r"(ah),"=r"(al):"r"(b0),"r"(s2), "0"(ah),"1"(al)); \
-    asm("maccs %0,%1,%2,%3" :"=r"(ah),"=r"(al):"r"(b1),"r"(s3), "0"(ah),"1"(al));
+    DSP_LDD( b1, b0, cc, 1 ); \
+    DSP_LDD( s0, s3, ss, 1 ); \
+    DSP_STD( s3, s2, ss, 1 ); \
+    DSP_MACCS( ah, al, b0, s2, ah, al ); \
+    DSP_MACCS( ah, al, b1, s3, ah, al );
 
 #define __CONVOLVE_02(cc,ss) \
-    asm("ldd   %0,%1,%2[2]":"=r"(b1),"=r"(b0):"r"(cc)); \
-    asm("ldd   %0,%1,%2[2]":"=r"(s2),"=r"(s1):"r"(ss)); \
-    asm("std   %0,%1,%2[2]"::"r"(s1), "r"(s0),"r"(ss)); \
-    asm("maccs %0,%1,%2,%3" :"=r"(ah),"=r"(al):"r"(b0),"r"(s0), "0"(ah),"1"(al)); \
-    asm("maccs %0,%1,%2,%3" :"=r"(ah),"=r"(al):"r"(b1),"r"(s1), "0"(ah),"1"(al));
+    DSP_LDD( b1, b0, cc, 2 ); \
+    DSP_LDD( s2, s1, ss, 2 ); \
+    DSP_STD( s1, s0, ss, 2 ); \
+    DSP_MACCS( ah, al, b0, s0, ah, al ); \
+    DSP_MACCS( ah, al, b1, s1, ah, al );
 
 #define __CONVOLVE_03(cc,ss) \
-    asm("ldd   %0,%1,%2[3]":"=r"(b1),"=r"(b0):"r"(cc)); \
-    asm("ldd   %0,%1,%2[3]":"=r"(s0),"=r"(s3):"r"(ss)); \
-    asm("std   %0,%1,%2[3]"::"r"(s3), "r"(s2),"r"(ss)); \
-    asm("maccs %0,%1,%2,%3" :"=r"(ah),"=r"(al):"r"(b0),"r"(s2), "0"(ah),"1"(al)); \
-    asm("maccs %0,%1,%2,%3" :"=r"(ah),"=r"(al):"r"(b1),"r"(s3), "0"(ah),"1"(al));
+    DSP_LDD( b1, b0, cc, 3 ); \
+    DSP_LDD( s0, s3, ss, 3 ); \
+    DSP_STD( s3, s2, ss, 3 ); \
+    DSP_MACCS( ah, al, b0, s2, ah, al ); \
+    DSP_MACCS( ah, al, b1, s3, ah, al );
 
 #define __CONVOLVE_04(cc,ss) \
-    asm("ldd   %0,%1,%2[4]":"=r"(b1),"=r"(b0):"r"(cc)); \
-    asm("ldd   %0,%1,%2[4]":"=r"(s2),"=r"(s1):"r"(ss)); \
-    asm("std   %0,%1,%2[4]"::"r"(s1), "r"(s0),"r"(ss)); \
-    asm("maccs %0,%1,%2,%3" :"=r"(ah),"=r"(al):"r"(b0),"r"(s0), "0"(ah),"1"(al)); \
-    asm("maccs %0,%1,%2,%3" :"=r"(ah),"=r"(al):"r"(b1),"r"(s1), "0"(ah),"1"(al));
+    DSP_LDD( b1, b0, cc, 4 ); \
+    DSP_LDD( s2, s1, ss, 4 ); \
+    DSP_STD( s1, s0, ss, 4 ); \
+    DSP_MACCS( ah, al, b0, s0, ah, al ); \
+    DSP_MACCS( ah, al, b1, s1, ah, al );
 
 #define __CONVOLVE_05(cc,ss) \
-    asm("ldd   %0,%1,%2[5]":"=r"(b1),"=r"(b0):"r"(cc)); \
-    asm("ldd   %0,%1,%2[5]":"=r"(s0),"=r"(s3):"r"(ss)); \
-    asm("std   %0,%1,%2[5]"::"r"(s3), "r"(s2),"r"(ss)); \
-    asm("maccs %0,%1,%2,%3" :"=r"(ah),"=r"(al):"r"(b0),"r"(s2), "0"(ah),"1"(al)); \
-    asm("maccs %0,%1,%2,%3" :"=r"(ah),"=r"(al):"r"(b1),"r"(s3), "0"(ah),"1"(al));
+    DSP_LDD( b1, b0, cc, 5 ); \
+    DSP_LDD( s0, s3, ss, 5 ); \
+    DSP_STD( s3, s2, ss, 5 ); \
+    DSP_MACCS( ah, al, b0, s2, ah, al ); \
+    DSP_MACCS( ah, al, b1, s3, ah, al );
 
 #define __CONVOLVE_06(cc,ss) \
-    asm("ldd   %0,%1,%2[6]":"=r"(b1),"=r"(b0):"r"(cc)); \
-    asm("ldd   %0,%1,%2[6]":"=r"(s2),"=r"(s1):"r"(ss)); \
-    asm("std   %0,%1,%2[6]"::"r"(s1), "r"(s0),"r"(ss)); \
-    asm("maccs %0,%1,%2,%3" :"=r"(ah),"=r"(al):"r"(b0),"r"(s0), "0"(ah),"1"(al)); \
-    asm("maccs %0,%1,%2,%3" :"=r"(ah),"=r"(al):"r"(b1),"r"(s1), "0"(ah),"1"(al));
+    DSP_LDD( b1, b0, cc, 6 ); \
+    DSP_LDD( s2, s1, ss, 6 ); \
+    DSP_STD( s1, s0, ss, 6 ); \
+    DSP_MACCS( ah, al, b0, s0, ah, al ); \
+    DSP_MACCS( ah, al, b1, s1, ah, al );
 
 #define __CONVOLVE_07(cc,ss) \
-    asm("ldd   %0,%1,%2[7]":"=r"(b1),"=r"(b0):"r"(cc)); \
-    asm("ldd   %0,%1,%2[7]":"=r"(s0),"=r"(s3):"r"(ss)); \
-    asm("std   %0,%1,%2[7]"::"r"(s3), "r"(s2),"r"(ss)); \
-    asm("maccs %0,%1,%2,%3" :"=r"(ah),"=r"(al):"r"(b0),"r"(s2), "0"(ah),"1"(al)); \
-    asm("maccs %0,%1,%2,%3" :"=r"(ah),"=r"(al):"r"(b1),"r"(s3), "0"(ah),"1"(al));
+    DSP_LDD( b1, b0, cc, 7 ); \
+    DSP_LDD( s0, s3, ss, 7 ); \
+    DSP_STD( s3, s2, ss, 7 ); \
+    DSP_MACCS( ah, al, b0, s2, ah, al ); \
+    DSP_MACCS( ah, al, b1, s3, ah, al );
 
 #define __CONVOLVE_08(cc,ss) \
-    asm("ldd   %0,%1,%2[8]":"=r"(b1),"=r"(b0):"r"(cc)); \
-    asm("ldd   %0,%1,%2[8]":"=r"(s2),"=r"(s1):"r"(ss)); \
-    asm("std   %0,%1,%2[8]"::"r"(s1), "r"(s0),"r"(ss)); \
-    asm("maccs %0,%1,%2,%3" :"=r"(ah),"=r"(al):"r"(b0),"r"(s0), "0"(ah),"1"(al)); \
-    asm("maccs %0,%1,%2,%3" :"=r"(ah),"=r"(al):"r"(b1),"r"(s1), "0"(ah),"1"(al));
+    DSP_LDD( b1, b0, cc, 8 ); \
+    DSP_LDD( s2, s1, ss, 8 ); \
+    DSP_STD( s1, s0, ss, 8 ); \
+    DSP_MACCS( ah, al, b0, s0, ah, al ); \
+    DSP_MACCS( ah, al, b1, s1, ah, al );
 
 #define __CONVOLVE_09(cc,ss) \
-    asm("ldd   %0,%1,%2[9]":"=r"(b1),"=r"(b0):"r"(cc)); \
-    asm("ldd   %0,%1,%2[9]":"=r"(s0),"=r"(s3):"r"(ss)); \
-    asm("std   %0,%1,%2[9]"::"r"(s3), "r"(s2),"r"(ss)); \
-    asm("maccs %0,%1,%2,%3" :"=r"(ah),"=r"(al):"r"(b0),"r"(s2), "0"(ah),"1"(al)); \
-    asm("maccs %0,%1,%2,%3" :"=r"(ah),"=r"(al):"r"(b1),"r"(s3), "0"(ah),"1"(al));
+    DSP_LDD( b1, b0, cc, 9 ); \
+    DSP_LDD( s0, s3, ss, 9 ); \
+    DSP_STD( s3, s2, ss, 9 ); \
+    DSP_MACCS( ah, al, b0, s2, ah, al ); \
+    DSP_MACCS( ah, al, b1, s3, ah, al );
 
 #define __CONVOLVE_10(cc,ss) \
-    asm("ldd   %0,%1,%2[10]":"=r"(b1),"=r"(b0):"r"(cc)); \
-    asm("ldd   %0,%1,%2[10]":"=r"(s2),"=r"(s1):"r"(ss)); \
-    asm("std   %0,%1,%2[10]"::"r"(s1), "r"(s0),"r"(ss)); \
-    asm("maccs %0,%1,%2,%3" :"=r"(ah),"=r"(al):"r"(b0),"r"(s0), "0"(ah),"1"(al)); \
-    asm("maccs %0,%1,%2,%3" :"=r"(ah),"=r"(al):"r"(b1),"r"(s1), "0"(ah),"1"(al));
+    DSP_LDD( b1, b0, cc, 10 ); \
+    DSP_LDD( s2, s1, ss, 10 ); \
+    DSP_STD( s1, s0, ss, 10 ); \
+    DSP_MACCS( ah, al, b0, s0, ah, al ); \
+    DSP_MACCS( ah, al, b1, s1, ah, al );
 
 #define __CONVOLVE_11(cc,ss) \
-    asm("ldd   %0,%1,%2[11]":"=r"(b1),"=r"(b0):"r"(cc)); \
-    asm("ldd   %0,%1,%2[11]":"=r"(s0),"=r"(s3):"r"(ss)); \
-    asm("std   %0,%1,%2[11]"::"r"(s3), "r"(s2),"r"(ss)); \
-    asm("maccs %0,%1,%2,%3" :"=r"(ah),"=r"(al):"r"(b0),"r"(s2), "0"(ah),"1"(al)); \
-    asm("maccs %0,%1,%2,%3" :"=r"(ah),"=r"(al):"r"(b1),"r"(s3), "0"(ah),"1"(al));
+    DSP_LDD( b1, b0, cc, 11 ); \
+    DSP_LDD( s0, s3, ss, 11 ); \
+    DSP_STD( s3, s2, ss, 11 ); \
+    DSP_MACCS( ah, al, b0, s2, ah, al ); \
+    DSP_MACCS( ah, al, b1, s3, ah, al );
 
 #define _dsp_convolve( xx, ah, al, cc, ss ) \
 { \
@@ -6,6 +6,11 @@ if len(sys.argv) < 5:
     print( "Usage: python dsp.py fir <samp_freq> <pass_freq> <stop_freq> <-attenuation>" )
     print( "       python dsp.py fir <samp_freq> <pass_freq> <stop_freq> <+tap_count>" )
     print( "" )
+    print( "Usage: python dsp.py halfband <samp_freq> <pass_freq> <-attenuation>" )
+    print( "" )
+    print( "       <samp_freq> is the up-sampled (2x) rate, stop-band starts at samp_freq/2-pass_freq" )
+    print( "       Prints the NN non-zero coefficients before the center tap (4*NN-1 taps)" )
+    print( "" )
     print( "Usage: python dsp.py iir <samp_freq> <type> <cutoff_freq> <Q> <gain>" )
     print( "" )
     print( "       <type> filter type (notch, lowpass, highpass, allpass, bandpass," )
@@ -86,6 +91,44 @@ if sys.argv[1] == "fir":
 
     print( "%u Taps" % len(taps) )
 
+if sys.argv[1] == "halfband":
+
+    import numpy as np
+    from scipy.signal import kaiserord, firwin, freqz
+
+    fs = float( sys.argv[2] )
+    passband_freq   = float( sys.argv[3] ) / fs
+    stopband_atten  = float( sys.argv[4] )
+
+    width = abs(0.5 - 2 * passband_freq) / 0.5
+    (tap_count,beta) = kaiserord( ripple = stopband_atten, width = width )
+    nn = max( 4, (tap_count + 1 + 15) // 16 * 4 ) # 4*nn-1 taps, nn multiple of 4
+
+    taps = firwin( numtaps = 4*nn-1, cutoff = 0.5, window = ('kaiser', beta) )
+    taps[1::2] = 0; taps[2*nn-1] = 0.5
+    taps[0::2] *= 0.5 / sum( taps[0::2] ) # Unity DC gain
+
+    import matplotlib.pyplot as plt
+    w, h = freqz( taps, worN=8000 )
+    fig = plt.figure()
+    plt.title('Digital filter frequency response')
+    ax1 = fig.add_subplot(111)
+    plt.plot(w/(2*np.pi)*1.001, 20 * np.log10(abs(h)), 'b')
+    plt.ylabel('Amplitude [dB]', color='b')
+    plt.xlabel('Frequency [Normalized to Fs]')
+    plt.grid()
+    plt.axis('tight')
+    plt.show()
+
+    ii = 0
+    for cc in taps[0:2*nn-1:2]:
+        if (ii % 4) == 0: sys.stdout.write('    ')
+        sys.stdout.write( "FQ(%+1.9f)," % cc )
+        ii += 1
+        if (ii % 4) == 0: sys.stdout.write('\n')
+
+    print( "NN=%u (%u Taps)" % (nn,4*nn-1) )
+
 def plot_response( bb, aa, xmin=None, xmax=None, ymin=-60.0, ymax=6.0 ):
 
     import matplotlib.pyplot as plt
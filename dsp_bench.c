@@ -0,0 +1,238 @@
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+
+#include "xio.h"
+#include "dsp.h"
+
+// DSP kernel benchmark. Measures the cost of each DSP.H function per call and reports it as a
+// percentage of the per-thread instruction budget for one audio sample at 48, 96, 192 and 384 kHz.
+// Each DSP thread is allocated 100 MIPS (up to five active threads on a 500 MHz core) which gives
+// 2083, 1041, 520 and 260 instructions per sample respectively.
+//
+// Device (bench.sh):      Instructions measured with the 100 MHz reference timer (one instruction
+//                         per timer tick for a 100 MIPS thread) including call overhead.
+// Host (bench.sh host):   XS1 DSP instructions (LDD,STD,MACCS,LEXTRACT,LSATS,CRC32,LDIVU) counted
+//                         by the DSP_HOST instruction primitives ("dsp ops" column, no budget shares).
+//                         These are not cycles - single word loads/stores, memmove/memcpy (e.g. the
+//                         FIR history shift), ALU, address arithmetic and branches are not counted,
+//                         so pure ALU functions show 0.0. Use them to compare DSP instruction counts
+//                         between variants of a kernel, and the device build for thread budgets.
+//
+// Block functions (BB samples per call) are reported per sample.
+
+#define REPS 64
+
+#ifdef DSP_HOST
+unsigned dsp_bench_ops = 0;
+static unsigned _bench_count( void ) { return dsp_bench_ops; }
+#else
+static unsigned _bench_count( void ) { unsigned tt; asm volatile("gettime %0":"=r"(tt)); return tt; }
+#endif
+
+static double _bench_overhead = 0;
+volatile int  _bench_sink = 0;
+
+int _bench_coeff[512], _bench_state[512], _bench_samples[32], _bench_fft[2*2048];
+int _bench_fftconv[24+7*128+4*128*19]; // 2400 taps, 128 tap partitions
+
+static void _bench_print( const char* name, const char* args, double count )
+{
+    printf( "%-18s %-11s %8.1f", name, args, count );
+    #ifndef DSP_HOST
+    static const int rates[4] = { 48000, 96000, 192000, 384000 };
+    for( int ii = 0; ii < 4; ++ii ) printf( " %7.1f%%", 100.0 * count / (100e6 / rates[ii]) );
+    #endif
+    printf( "\n" );
+}
+
+#define BENCHN( name, args, nn, call ) \
+{ \
+    unsigned t0 = _bench_count(); \
+    for( int ii = 0; ii < REPS; ++ii ) { call; } \
+    _bench_print( name, args, ((double)(_bench_count() - t0) / REPS - _bench_overhead) / (nn) ); \
+}
+
+#define BENCH( name, args, call ) BENCHN( name, args, 1, call )
+
+int main( void )
+{
+    char args[32]; int ah, al;
+
+    for( int ii = 0; ii < 512; ++ii ) _bench_coeff[ii] = FQ(0.001) * (ii % 7 - 3);
+    for( int ii = 0; ii < 32;  ++ii ) _bench_samples[ii] = FQ(0.01) * (ii % 5 - 2);
+    memset( _bench_state, 0, sizeof(_bench_state) );
+
+    #ifndef DSP_HOST
+    { unsigned t0 = _bench_count();
+      for( int ii = 0; ii < REPS; ++ii ) { _bench_sink = ii; }
+      _bench_overhead = (double)(_bench_count() - t0) / REPS; }
+    #endif
+
+    #ifdef DSP_HOST
+    printf( "%-18s %-11s %8s   (host - DSP instructions only, not MIPS)\n", "function", "args", "dsp ops" );
+    #else
+    printf( "%-18s %-11s %8s %8s %8s %8s %8s\n", "function", "args", "instr",
+            "48kHz", "96kHz", "192kHz", "384kHz" );
+    #endif
+
+    BENCH( "dsp_blend",    "",     _bench_sink = dsp_blend( _bench_sink, FQ(0.3), FQ(0.5) ) );
+    BENCH( "dsp_interp",   "",     _bench_sink = dsp_interp( FQ(0.3), _bench_sink, FQ(0.5) ) );
+    BENCH( "dsp_lagrange", "",     _bench_sink = dsp_lagrange( FQ(0.3), _bench_sink, FQ(0.5), 0 ) );
+    BENCH( "dsp_tanh_poly3", "",   _bench_sink = dsp_tanh_poly3( _bench_sink + FQ(0.1) ) );
+    BENCH( "dsp_tanh_poly5", "",   _bench_sink = dsp_tanh_poly5( _bench_sink + FQ(0.1) ) );
+    BENCH( "dsp_tanh_poly7", "",   _bench_sink = dsp_tanh_poly7( _bench_sink + FQ(0.1) ) );
+    BENCH( "dsp_atan_poly",  "",   _bench_sink = dsp_atan_poly ( _bench_sink + FQ(1.5) ) );
+    BENCH( "dsp_atan_poly",  "xx=-8.0", _bench_sink += dsp_atan_poly( (int)0x80000000 ) );
+    BENCH( "dsp_exp2_poly",  "",   _bench_sink = dsp_exp2_poly ( _bench_sink - FQ(1.5) ) );
+    BENCH( "dsp_sin_poly",   "",   _bench_sink = dsp_sin_poly  ( _bench_sink + FQ(0.1) ) );
+    BENCH( "dsp_log2",       "",   _bench_sink = dsp_log2      ( (_bench_sink & 0xFFFFFFF) + 1 ) );
+    BENCH( "dsp_exp2",       "",   _bench_sink = dsp_exp2      ( (_bench_sink & 0x3FFFFFF) - (4<<(QQ-4)) ) );
+    BENCH( "dsp_db_to_lin",  "",   _bench_sink = dsp_db_to_lin ( (_bench_sink & 0x1FFFFFFF) - (40<<(QQ-4)) ) );
+    BENCH( "dsp_lin_to_db",  "",   _bench_sink = dsp_lin_to_db ( (_bench_sink & 0xFFFFFFF) + 1 ) );
+    { int nc[1+6*4]; dsp_nco_init( nc, 4 );
+      for( int ii = 0; ii < 4; ++ii ) dsp_nco_set( nc, ii, ii, FQ(0.001) * (ii+1), 0 );
+      BENCH( "dsp_nco",      "nn=4", dsp_nco( nc, _bench_samples ); _bench_sink += _bench_samples[0] ); }
+    BENCH( "dsp_iir1",     "",     _bench_sink = dsp_iir1( _bench_sink, _bench_coeff, _bench_state ) );
+    BENCH( "dsp_iir2",     "",     _bench_sink = dsp_iir2( _bench_sink, _bench_coeff, _bench_state ) );
+    BENCH( "dsp_iir3",     "",     _bench_sink = dsp_iir3( _bench_sink, _bench_coeff, _bench_state ) );
+    { int cc[2] = { FQ(0.02), FQ(0.7) }; // Swept every sample (auto-wah)
+      BENCH( "dsp_statevar", "",   _bench_samples[0] = _bench_sink; cc[0] = (cc[0] + 7) & 0x03FFFFFF;
+                                   dsp_statevar( _bench_samples, cc, _bench_state ) ); }
+    { static int dl[2+1024]; int ss = 0; dsp_delay_init( dl, 1024 );
+      BENCH( "dsp_delay_lin",  "",   dsp_delay_write( dl, _bench_sink );
+                                   _bench_sink = dsp_delay_lin ( dl, 100, FQ(0.3) ) + FQ(0.1) );
+      BENCH( "dsp_delay_lagr", "",   dsp_delay_write( dl, _bench_sink );
+                                   _bench_sink = dsp_delay_lagr( dl, 100, FQ(0.3) ) + FQ(0.1) );
+      BENCH( "dsp_delay_herm", "",   dsp_delay_write( dl, _bench_sink );
+                                   _bench_sink = dsp_delay_herm( dl, 100, FQ(0.3) ) + FQ(0.1) );
+      BENCH( "dsp_delay_allp", "",   dsp_delay_write( dl, _bench_sink );
+                                   _bench_sink = dsp_delay_allp( dl, 100, FQ(0.3), &ss ) + FQ(0.1) );
+      BENCH( "dsp_delay_allp", "ff=1.05", dsp_delay_write( dl, _bench_sink ); // DD-1 and FF+1
+                                   _bench_sink = dsp_delay_allp( dl, 99, FQ(1.05), &ss ) + FQ(0.1) ); }
+    { int cc[12]; calc_compressor( cc, -20, 4, 6, 48, 4800, 480, 3 ); cc[10] = 64; // RMS, knee
+      memset( _bench_state, 0, sizeof(_bench_state) );
+      BENCH( "dsp_dynamics", "nn=2", _bench_samples[0] = _bench_sink; _bench_samples[1] = -_bench_sink;
+                                   dsp_dynamics( _bench_samples, cc, _bench_state, 2 );
+                                   _bench_sink = _bench_samples[0] + FQ(0.3) ); }
+    { static int lut[2+1026]; int cc[18] = { FQ(0.999), FQ(0.8), 0, FQ(0.1) }, ff = 0;
+      calc_waveshaper( lut, 10, 1026, tanh ); // All stages with a peaking pre and a low-pass post
+      calc_peaking( cc+6, 0.002, 0.5, 6.0 ); calc_lowpass( cc+12, 0.02, 0.5 );
+      memset( _bench_state, 0, sizeof(_bench_state) );
+      BENCH( "dsp_waveshaper", "", _bench_sink = dsp_waveshaper( _bench_sink, lut, cc, _bench_state, ff ) );
+      ff = DSP_SHAPER_PRE | DSP_SHAPER_FIR | DSP_SHAPER_POST;
+      BENCH( "dsp_waveshaper", "all", _bench_sink = dsp_waveshaper( _bench_sink, lut, cc, _bench_state, ff ) ); }
+
+    for( int nn = 1; nn <= 16; ++nn ) {
+        sprintf( args, "nn=%i", nn );
+        BENCH( "dsp_biquad", args, _bench_sink = dsp_biquad( _bench_sink, _bench_coeff, _bench_state, nn ) );
+    }
+    for( int ch = 2; ch <= 8; ch *= 2 ) { // 15-band EQ
+        sprintf( args, "nn=15,ch=%i", ch );
+        BENCH( "dsp_biquad_multi", args, dsp_biquad_multi( _bench_samples, _bench_coeff, _bench_state, 15, ch ) );
+    }
+    for( int nn = 4; nn <= 240; nn += (nn < 24 ? 4 : 24) ) {
+        sprintf( args, "nn=%i", nn );
+        BENCH( "dsp_fir", args, _bench_sink = dsp_fir( _bench_sink, _bench_coeff, _bench_state, nn ) );
+    }
+    for( int nn = 8; nn <= 240; nn += (nn < 24 ? 8 : 24) ) {
+        sprintf( args, "nn=%i", nn );
+        BENCH( "dsp_fir_sym", args, _bench_sink = dsp_fir_sym( _bench_sink, _bench_coeff, _bench_state, nn ) );
+    }
+    for( int rr = 2; rr <= 8; ++rr ) { // 24 taps per phase
+        sprintf( args, "nn=%i,rr=%i", 24*rr, rr );
+        BENCH( "dsp_fir_up", args, dsp_fir_up( _bench_samples, _bench_coeff, _bench_state, 24*rr, rr ) );
+    }
+    for( int rr = 2; rr <= 8; ++rr ) {
+        sprintf( args, "nn=%i,rr=%i", 24*rr, rr );
+        BENCH( "dsp_fir_dn", args, dsp_fir_dn( _bench_samples, _bench_coeff, _bench_state, 24*rr, rr ) );
+    }
+    for( int rr = 2; rr <= 8; ++rr ) {
+        sprintf( args, "nn=%i,rr=%i", 24*rr, rr );
+        BENCH( "dsp_fir_dn_sym", args, dsp_fir_dn_sym( _bench_samples, _bench_coeff, _bench_state, 24*rr, rr ) );
+    }
+    for( int nn = 4; nn <= 24; nn += 4 ) { // 4*nn-1 taps
+        sprintf( args, "nn=%i", nn );
+        BENCH( "dsp_halfband_up", args, dsp_halfband_up( _bench_samples, _bench_coeff, _bench_state, nn ) );
+    }
+    for( int nn = 4; nn <= 24; nn += 4 ) {
+        sprintf( args, "nn=%i", nn );
+        BENCH( "dsp_halfband_dn", args, dsp_halfband_dn( _bench_samples, _bench_coeff, _bench_state, nn ) );
+    }
+    BENCH( "dsp_oversample", "2x_up,nn=12", dsp_oversample2x_up( _bench_samples, _bench_coeff, _bench_state, 12 ) );
+    BENCH( "dsp_oversample", "4x_up,nn=12", dsp_oversample4x_up( _bench_samples, _bench_coeff, _bench_state, 12 ) );
+    BENCH( "dsp_oversample", "8x_up,nn=12", dsp_oversample8x_up( _bench_samples, _bench_coeff, _bench_state, 12 ) );
+    BENCH( "dsp_oversample", "2x_dn,nn=12", dsp_oversample2x_dn( _bench_samples, _bench_coeff, _bench_state, 12 ) );
+    BENCH( "dsp_oversample", "4x_dn,nn=12", dsp_oversample4x_dn( _bench_samples, _bench_coeff, _bench_state, 12 ) );
+    BENCH( "dsp_oversample", "8x_dn,nn=12", dsp_oversample8x_dn( _bench_samples, _bench_coeff, _bench_state, 12 ) );
+    for( int rr = 2; rr <= 8; ++rr ) { // 4 stages with 8-tap compensation
+        sprintf( args, "nn=4,rr=%i", rr ); memset( _bench_state, 0, sizeof(_bench_state) );
+        BENCH( "dsp_cic_up", args, dsp_cic_up( _bench_samples, _bench_coeff, _bench_state, 4, rr ) );
+    }
+    for( int rr = 2; rr <= 8; ++rr ) {
+        sprintf( args, "nn=4,rr=%i", rr ); memset( _bench_state, 0, sizeof(_bench_state) );
+        BENCH( "dsp_cic_dn", args, dsp_cic_dn( _bench_samples, _bench_coeff, _bench_state, 4, rr ) );
+    }
+    for( int bb = 2; bb <= 16; bb *= 2 ) {
+        sprintf( args, "nn=96,bb=%i", bb );
+        BENCHN( "dsp_fir_block", args, bb, dsp_fir_block( _bench_samples, _bench_coeff, _bench_state, 96, bb ) );
+    }
+    for( int bb = 2; bb <= 16; bb *= 2 ) {
+        sprintf( args, "nn=4,bb=%i", bb );
+        BENCHN( "dsp_biquad_block", args, bb, dsp_biquad_block( _bench_samples, _bench_coeff, _bench_state, 4, bb ) );
+    }
+    for( int nn = 1; nn <= 20; nn += (nn < 4 ? 1 : 4) ) { // NN blocks of 24 taps
+        sprintf( args, "nn=%i", nn );
+        BENCH( "dsp_convolve", args, ah = 0; al = 1<<(QQ-1);
+               _bench_sink = dsp_convolve( _bench_sink, _bench_coeff, _bench_state, &ah, &al, nn ) );
+    }
+    for( int bb = 2; bb <= 16; bb *= 2 ) { // 4 blocks of 24 taps
+        int bh[16], bl[16]; sprintf( args, "nn=4,bb=%i", bb );
+        BENCHN( "dsp_convolve_block", args, bb,
+                dsp_convolve_block( _bench_samples, _bench_coeff, _bench_state, bh, bl, 4, bb ) );
+    }
+
+    for( int nn = 64; nn <= 1024; nn *= 4 ) {
+        sprintf( args, "nn=%i", nn );
+        BENCH( "dsp_fft", args, _bench_sink = dsp_fft( _bench_fft, nn ) );
+    }
+    for( int nn = 128; nn <= 2048; nn *= 2 ) {
+        sprintf( args, "nn=%i", nn );
+        BENCH( "dsp_rfft", args, _bench_sink = dsp_rfft( _bench_fft, nn ) );
+    }
+    // Fast (FFT) convolution of LL taps: one real FFT of 2*LL points, a spectrum multiplication and
+    // an inverse real FFT per LL samples (reported per sample, compare with 'dsp_convolve' rows of
+    // LL/24 blocks to find the crossover length).
+    for( int ll = 32; ll <= 1024; ll *= 2 ) {
+        sprintf( args, "ll=%i", ll );
+        BENCHN( "fft_convolve", args, ll, dsp_rfft( _bench_fft, 2*ll );
+                dsp_rfft_mul( _bench_fft, _bench_fft+2*ll, 2*ll ); dsp_irfft( _bench_fft, 2*ll ) );
+    }
+    for( int ii = 0; ii < 2400; ++ii ) _bench_fft[ii] = _bench_coeff[ii % 512] / (1 + ii/256);
+    dsp_fftconv_init( _bench_fftconv, _bench_fft, 2400, 128 );
+    BENCHN( "dsp_fftconv", "nn=2400,bb=128", 128, // Average over one block
+            for( int jj = 0; jj < 128; ++jj ) _bench_sink = dsp_fftconv( _bench_sink, _bench_fftconv ) );
+
+    BENCH( "math_random",  "",      _bench_sink = math_random( _bench_sink, 12345 ) );
+    BENCH( "math_sqr_x",   "",      _bench_sink = math_sqr_x( (_bench_sink & 0x7FFFFFF) + 1 ) );
+    BENCH( "math_min_X",   "nn=32", _bench_sink = math_min_X( _bench_samples, 32 ) );
+    BENCH( "math_max_X",   "nn=32", _bench_sink = math_max_X( _bench_samples, 32 ) );
+    BENCH( "math_avg_X",   "nn=32", _bench_sink = math_avg_X( _bench_samples, 32 ) );
+    BENCH( "math_rms_X",   "nn=32", _bench_sink = math_rms_X( _bench_samples, 32 ) );
+    BENCH( "math_sum_X",   "nn=32", math_sum_X( _bench_samples, 32, &ah, (unsigned*)&al ) );
+    BENCH( "math_asm_X",   "nn=32", math_asm_X( _bench_samples, 32, &ah, (unsigned*)&al ) );
+    BENCH( "math_pwr_X",   "nn=32", math_pwr_X( _bench_samples, 32, &ah, (unsigned*)&al ) );
+    BENCH( "math_abs_X",   "nn=32", math_abs_X( _bench_state, 32 ) );
+    for( int ii = 0; ii < 32; ++ii ) _bench_state[ii] = FQ(0.01) * (ii + 1); // Positive (0 returns early)
+    BENCH( "math_sqr_X",   "nn=32", math_sqr_X( _bench_state, 32 ) );
+    BENCH( "math_mac_X1z", "nn=32", math_mac_X1z( _bench_state, FQ(0.1), 32 ) );
+    BENCH( "math_mac_X1Z", "nn=32", math_mac_X1Z( _bench_state, _bench_samples, 32 ) );
+    BENCH( "math_mac_Xy0", "nn=32", math_mac_Xy0( _bench_state, FQ(0.1), 32 ) );
+    BENCH( "math_mac_XY0", "nn=32", math_mac_XY0( _bench_state, _bench_samples, 32 ) );
+    BENCH( "math_mac_Xyz", "nn=32", math_mac_Xyz( _bench_state, FQ(0.1), FQ(0.1), 32 ) );
+    BENCH( "math_mac_XyZ", "nn=32", math_mac_XyZ( _bench_state, FQ(0.1), _bench_samples, 32 ) );
+    BENCH( "math_mac_XYz", "nn=32", math_mac_XYz( _bench_state, _bench_samples, FQ(0.1), 32 ) );
+    BENCH( "math_mac_XYZ", "nn=32", math_mac_XYZ( _bench_state, _bench_samples, _bench_samples, 32 ) );
+
+    return 0;
+}
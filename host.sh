@@ -0,0 +1 @@
+gcc -std=gnu99 -O2 -DDSP_HOST -DC99_LOAD=1 -ffunction-sections -fdata-sections -Wl,--gc-sections xio_host.c dsp.c c99.c $1.c $2 -o $1 -lm
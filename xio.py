@@ -75,6 +75,10 @@ if len(sys.argv) < 2: # Usage 1 - Show help message
     print "         represent one property per line with property data rendered as ASCII/HEX"
     print "         (e.g. F001 11111111 22222222 33333333 44444444 55555555)"
     print ""
+    print "Usage 8: python flexfx.py <midi_port> load"
+    print "         Continuously show the execution time of the mixer and the five DSP threads"
+    print "         as min/avg/max percentage of the per-sample budget and the overrun count."
+    print ""
 
     midi_list()
     exit(0)
@@ -351,6 +355,23 @@ elif name[len(name)-4:] == ".txt": # Usage 6
     file.close()
     midi_close( midi )
 	
+elif name == "load": # Usage 8 - Show mixer and DSP thread load (property 23s0)
+
+    midi = midi_open( int(sys.argv[1]) )
+    while True:
+        line = ""
+        for stage in range( 6 ):
+            midi_write( midi, property_to_midi_sysex( [0x2300+(stage<<4),0,0,0,0,0] ))
+            while True:
+                prop = midi_sysex_to_property( midi_wait( midi ))
+                if prop[0] & 0xFFFF == 0x2300+(stage<<4): break
+            budget = max( prop[5], 1 )
+            name = "MIX" if stage == 0 else "DSP%u" % stage
+            line += "%s %3u/%3u/%3u%% %-4u " % (name, 100*prop[1]/budget, 100*prop[2]/budget, \
+                                                100*prop[3]/budget, prop[4])
+        print line
+        time.sleep( 1.0 )
+
 elif len(sys.argv) == 8: # Usage 7
 
     data = [int(sys.argv[2],16),int(sys.argv[3],16),int(sys.argv[4],16),int(sys.argv[5],16), \
@@ -0,0 +1,227 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "xio.h"
+
+// Host (Linux/Windows/MacOS) implementation of the XIO framework for offline rendering of an effect.
+// The effect is linked with this file (instead of xio.a) and built with DSP_HOST defined so that
+// all DSP kernels use the bit-exact portable C instruction primitives (see DSP.H). Usage:
+//
+//   ./effect input.wav output.wav [pot1 pot2 pot3 pot4]
+//
+// Samples are read from 'input.wav' (16/24/32-bit PCM or 32-bit float, mono or stereo) and passed
+// to the mixer as ADC samples (Q31), the DAC samples produced by the mixer are written to
+// 'output.wav' as stereo 32-bit PCM at the effect's sample rate. Pot values (0.0 to 1.0, default
+// 0.5) are returned to the control task via I2C reads.
+//
+// Scheduling follows the device: 'xio_control' is called at 1 kHz, 'xio_mixer' and 'xio_thread1'
+// through 'xio_thread5' once per sample. Each thread processes the samples and property produced by
+// the previous stage during the previous sample period so the DSP output returned to the mixer is
+// delayed by five samples relative to the DSP input. DSP properties generated by the control task
+// are passed to the mixer and to thread 1 once (with the next sample) and then travel down the
+// pipeline with the samples.
+
+extern const int audio_sample_rate;
+extern void xio_initialize( void );
+
+static double _pot_values[4] = { 0.5, 0.5, 0.5, 0.5 };
+static int    _pot_select = 0;
+static byte   _flash_data[256][256];
+
+static int _wav_read_header( FILE* file, int* rate, int* chans, int* bits, int* format, int* count )
+{
+    byte hdr[12], chunk[8], fmt[40]; unsigned size;
+    if( fread( hdr, 1, 12, file ) != 12 ) return 0;
+    if( memcmp( hdr, "RIFF", 4 ) || memcmp( hdr+8, "WAVE", 4 ) ) return 0;
+    *format = 0;
+    while( fread( chunk, 1, 8, file ) == 8 )
+    {
+        size = chunk[4] + (chunk[5]<<8) + (chunk[6]<<16) + ((unsigned)chunk[7]<<24);
+        if( !memcmp( chunk, "fmt ", 4 ) )
+        {
+            if( size < 16 || size > sizeof(fmt) ) return 0;
+            if( fread( fmt, 1, size, file ) != size ) return 0;
+            *format = fmt[0] + (fmt[1]<<8);
+            *chans  = fmt[2] + (fmt[3]<<8);
+            *rate   = fmt[4] + (fmt[5]<<8) + (fmt[6]<<16) + (fmt[7]<<24);
+            *bits   = fmt[14] + (fmt[15]<<8);
+            if( *format == 0xFFFE && size >= 26 ) *format = fmt[24] + (fmt[25]<<8);
+        }
+        else if( !memcmp( chunk, "data", 4 ) )
+        {
+            if( *format == 0 || *chans < 1 || *bits < 16 ) return 0;
+            *count = size / (*chans * *bits / 8);
+            return (*format == 1 && (*bits == 16 || *bits == 24 || *bits == 32))
+                || (*format == 3 && *bits == 32);
+        }
+        else fseek( file, size + (size & 1), SEEK_CUR );
+    }
+    return 0;
+}
+
+static int _wav_read_sample( FILE* file, int bits, int format ) // Returns Q31
+{
+    byte data[4] = {0,0,0,0}; int value; float fvalue;
+    if( fread( data, 1, bits/8, file ) != (size_t)bits/8 ) return 0;
+    if( bits == 16 ) return (int)(((unsigned)data[0]<<16) + ((unsigned)data[1]<<24));
+    if( bits == 24 ) return (int)(((unsigned)data[0]<<8) + ((unsigned)data[1]<<16) + ((unsigned)data[2]<<24));
+    value = (int)(data[0] + (data[1]<<8) + (data[2]<<16) + ((unsigned)data[3]<<24));
+    if( format == 1 ) return value;
+    memcpy( &fvalue, &value, 4 );
+    if( fvalue >= +1.0f ) return 0x7FFFFFFF;
+    if( fvalue <= -1.0f ) return (int)0x80000000;
+    return (int)(fvalue * 2147483648.0);
+}
+
+static void _wav_write_word( FILE* file, unsigned value, int size )
+{
+    for( int ii = 0; ii < size; ++ii ) fputc( (value >> (8*ii)) & 0xFF, file );
+}
+
+static void _wav_write_header( FILE* file, int rate, int count )
+{
+    fwrite( "RIFF", 1, 4, file ); _wav_write_word( file, 36 + 8*count, 4 );
+    fwrite( "WAVEfmt ", 1, 8, file ); _wav_write_word( file, 16, 4 );
+    _wav_write_word( file, 1, 2 ); _wav_write_word( file, 2, 2 );
+    _wav_write_word( file, rate, 4 ); _wav_write_word( file, 8*rate, 4 );
+    _wav_write_word( file, 8, 2 ); _wav_write_word( file, 32, 2 );
+    fwrite( "data", 1, 4, file ); _wav_write_word( file, 8*count, 4 );
+}
+
+int main( int argc, char* argv[] )
+{
+    int rate = 0, chans = 0, bits = 0, format = 0, count = 0;
+
+    if( argc < 3 || argc > 7 ) {
+        fprintf( stderr, "Usage: %s input.wav output.wav [pot1 pot2 pot3 pot4]\n", argv[0] );
+        return 1;
+    }
+    for( int ii = 3; ii < argc; ++ii ) _pot_values[ii-3] = atof( argv[ii] );
+
+    FILE* input = fopen( argv[1], "rb" );
+    if( input == NULL || !_wav_read_header( input, &rate, &chans, &bits, &format, &count ) ) {
+        fprintf( stderr, "Error: cannot read '%s' (16/24/32-bit PCM or float WAV)\n", argv[1] );
+        return 1;
+    }
+    if( rate != audio_sample_rate ) {
+        fprintf( stderr, "Warning: '%s' is %i Hz, effect runs at %i Hz (not resampled)\n",
+                 argv[1], rate, audio_sample_rate );
+    }
+    FILE* output = fopen( argv[2], "wb" );
+    if( output == NULL ) {
+        fprintf( stderr, "Error: cannot create '%s'\n", argv[2] );
+        return 1;
+    }
+    _wav_write_header( output, audio_sample_rate, count );
+
+    int usb_output[32], usb_input[32], adc_output[32], dac_input[32], dsp_input[32];
+    int samples[6][32], property[6][6], rcv_prop[6], snd_prop[6], dsp_prop[6];
+    int period = audio_sample_rate / 1000;
+
+    memset( usb_output, 0, sizeof(usb_output) ); memset( adc_output, 0, sizeof(adc_output) );
+    memset( samples,    0, sizeof(samples)    ); memset( property,   0, sizeof(property)   );
+    memset( rcv_prop,   0, sizeof(rcv_prop)   ); memset( dsp_prop,   0, sizeof(dsp_prop)   );
+    memset( _flash_data, 0xFF, sizeof(_flash_data) );
+
+    xio_initialize();
+
+    for( int nn = 0; nn < count; ++nn )
+    {
+        if( nn % period == 0 ) // Control task (1 kHz)
+        {
+            memset( snd_prop, 0, sizeof(snd_prop) );
+            xio_control( rcv_prop, snd_prop, dsp_prop );
+            if( dsp_prop[0] != 0 ) { memcpy( property[0], dsp_prop, sizeof(dsp_prop) ); dsp_prop[0] = 0; }
+        }
+        for( int ch = 0; ch < chans; ++ch ) {
+            int value = _wav_read_sample( input, bits, format );
+            if( ch < 2 ) adc_output[ch] = value;
+        }
+        if( chans == 1 ) adc_output[1] = adc_output[0];
+
+        memset( usb_input, 0, sizeof(usb_input) ); memset( dac_input, 0, sizeof(dac_input) );
+        memset( dsp_input, 0, sizeof(dsp_input) );
+        xio_mixer( usb_output, usb_input, adc_output, dac_input, samples[5], dsp_input, property[0] );
+
+        // Advance the pipeline, last stage first so each thread consumes its predecessor's result
+        // from the previous sample period.
+        memcpy( samples[5], samples[4], sizeof(samples[5]) ); memcpy( property[5], property[4], 24 );
+        xio_thread5( samples[5], property[5] );
+        memcpy( samples[4], samples[3], sizeof(samples[4]) ); memcpy( property[4], property[3], 24 );
+        xio_thread4( samples[4], property[4] );
+        memcpy( samples[3], samples[2], sizeof(samples[3]) ); memcpy( property[3], property[2], 24 );
+        xio_thread3( samples[3], property[3] );
+        memcpy( samples[2], samples[1], sizeof(samples[2]) ); memcpy( property[2], property[1], 24 );
+        xio_thread2( samples[2], property[2] );
+        memcpy( samples[1], dsp_input,  sizeof(samples[1]) ); memcpy( property[1], property[0], 24 );
+        xio_thread1( samples[1], property[1] );
+        memset( property[0], 0, 24 );
+
+        _wav_write_word( output, dac_input[0], 4 );
+        _wav_write_word( output, dac_input[1], 4 );
+    }
+
+    fclose( input ); fclose( output );
+
+    // Report the load statistics gathered by the C99 framework (property 23s0) if available.
+    for( int ss = 0; ss <= 5; ++ss )
+    {
+        memset( snd_prop, 0, sizeof(snd_prop) ); rcv_prop[0] = 0x2300 + (ss << 4);
+        xio_control( rcv_prop, snd_prop, dsp_prop );
+        if( snd_prop[0] != rcv_prop[0] ) break;
+        if( ss == 0 ) fprintf( stderr, "Stage    Min    Avg    Max  Overruns (host time, 10 ns ticks)\n" );
+        fprintf( stderr, "%s%i %6i %6i %6i  %i\n", ss ? "DSP" : "MIX", ss,
+                 snd_prop[1], snd_prop[2], snd_prop[3], snd_prop[4] );
+    }
+    return 0;
+}
+
+void flash_read ( int page, byte data[256] )       { memcpy( data, _flash_data[page&255], 256 ); }
+void flash_write( int page, const byte data[256] ) { memcpy( _flash_data[page&255], data, 256 ); }
+
+unsigned timer_count( void ) // 100 MHz reference clock
+{
+    struct timespec ts; clock_gettime( CLOCK_MONOTONIC, &ts );
+    return (unsigned)ts.tv_sec * 100000000u + (unsigned)(ts.tv_nsec / 10);
+}
+
+void timer_delay( int microseconds ) {}
+
+// The pots are read through an I2C ADC (see '_read_adc' in C99.C). Writing 0x60+N to the ADC selects
+// channel N (1,3,5,7 for pots 3,1,2,4), the next read returns that pot's 8-bit value.
+
+void i2c_start( int speed ) {}
+byte i2c_write( byte value ) { if( value >= 0x61 && value <= 0x67 ) _pot_select = (value-0x61)/2; return 0; }
+byte i2c_read ( void )
+{
+    static const int map[4] = { 2, 0, 1, 3 };
+    double value = _pot_values[map[_pot_select]] * 256;
+    return (byte)(value < 0 ? 0 : value > 255 ? 255 : value);
+}
+void i2c_ack  ( byte ack ) {}
+void i2c_stop ( void ) {}
+
+void spi_config  ( int speed ) {}
+void spi_select  ( byte csel ) {}
+byte spi_transfer( byte value ) { return 0; }
+
+void port_put( int mask, int value ) {}
+void port_set( int mask ) {}
+void port_clr( int mask ) {}
+byte port_get( int mask ) { return 0; }
+
+void midi_send_start( void ) {}
+void midi_send_stop( void ) {}
+void midi_send_beat( void ) {}
+void midi_configure( double bpm ) {}
+
+void serial_write( byte data ) {}
+byte serial_count( void ) { return 0; }
+byte serial_read ( void ) { return 0; }
+
+void log_chr( char val ) { fputc( val, stderr ); }
+void log_str( const char* text ) { fputs( text, stderr ); }
+void log_bin( const byte* data, int len ) { for( int ii = 0; ii < len; ++ii ) fprintf( stderr, "%02x", data[ii] ); }
+void log_hex( byte val ) { fprintf( stderr, "%02x", val ); }